@@ -138,6 +138,7 @@
  * @defgroup api-heap                 Heap
  * @defgroup api-history-tracker      History Tracker
  * @defgroup api-jam-detection        Jam Detection
+ * @defgroup api-latency-trace        Latency Trace
  * @defgroup api-logging              Logging - Thread Stack
  * @defgroup api-mesh-diag            Mesh Diagnostics
  * @defgroup api-ncp                  Network Co-Processor
@@ -1077,6 +1077,7 @@ void radioProcessFrame(otInstance *aInstance)
 
     sReceiveFrame.mInfo.mRxInfo.mAckedWithFramePending = false;
     sReceiveFrame.mInfo.mRxInfo.mAckedWithSecEnhAck    = false;
+    sReceiveFrame.mInfo.mRxInfo.mIsSecurityProcessed   = false;
 
     otEXPECT(sPromiscuous == false);
 
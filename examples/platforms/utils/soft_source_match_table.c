@@ -32,6 +32,11 @@
  *   such hardware acceleration. It supports only the single-instance build of
  *   OpenThread.
  *
+ *   The short and extended address entries are kept in open-addressed hash tables
+ *   (linear probing) with at least twice as many slots as entries, so a lookup done
+ *   while preparing an ACK only checks a few slots, independent of the number of
+ *   entries.
+ *
  */
 
 #include "utils/soft_source_match_table.h"
@@ -44,80 +49,152 @@
 #include "utils/code_utils.h"
 
 #if RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM || RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM
+
+#if (RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM > 1024) || (RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM > 1024)
+#error "Soft source match table supports at most 1024 entries."
+#endif
+
+// Number of slots in a hash table holding up to `aNum` entries: the smallest power of two larger than `2 * aNum`.
+#define SRC_MATCH_TABLE_SIZE(aNum) \
+    (((aNum) < 4)      ? 8         \
+     : ((aNum) < 8)    ? 16        \
+     : ((aNum) < 16)   ? 32        \
+     : ((aNum) < 32)   ? 64        \
+     : ((aNum) < 64)   ? 128       \
+     : ((aNum) < 128)  ? 256       \
+     : ((aNum) < 256)  ? 512       \
+     : ((aNum) < 512)  ? 1024      \
+     : ((aNum) < 1024) ? 2048      \
+                       : 4096)
+
 static uint16_t sPanId = 0;
 
 void utilsSoftSrcMatchSetPanId(uint16_t aPanId) { sPanId = aPanId; }
+
+static uint32_t hashSrcMatchKey(uint32_t aKey)
+{
+    aKey *= 2654435761u;
+
+    return aKey ^ (aKey >> 16);
+}
 #endif // RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM || RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM
 
 #if RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM
+#define SRC_MATCH_SHORT_TABLE_SIZE SRC_MATCH_TABLE_SIZE(RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM)
+#define SRC_MATCH_SHORT_SLOT_MASK (SRC_MATCH_SHORT_TABLE_SIZE - 1)
+
 typedef struct srcMatchShortEntry
 {
-    uint16_t checksum;
+    uint16_t panId;
+    uint16_t shortAddress;
     bool     allocated;
 } sSrcMatchShortEntry;
 
-static sSrcMatchShortEntry srcMatchShortEntry[RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM];
+static sSrcMatchShortEntry srcMatchShortEntry[SRC_MATCH_SHORT_TABLE_SIZE];
+static uint16_t            sSrcMatchShortNum = 0;
+
+static uint16_t getSrcMatchShortHomeSlot(uint16_t aPanId, uint16_t aShortAddress)
+{
+    return (uint16_t)(hashSrcMatchKey(((uint32_t)aPanId << 16) | aShortAddress) & SRC_MATCH_SHORT_SLOT_MASK);
+}
 
 int16_t utilsSoftSrcMatchShortFindEntry(uint16_t aShortAddress)
 {
-    int16_t  entry    = -1;
-    uint16_t checksum = aShortAddress + sPanId;
+    int16_t  entry = -1;
+    uint16_t slot  = getSrcMatchShortHomeSlot(sPanId, aShortAddress);
 
-    for (int16_t i = 0; i < RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM; i++)
+    // The table always has free slots, so the probe ends at one of them.
+    while (srcMatchShortEntry[slot].allocated)
     {
-        if (checksum == srcMatchShortEntry[i].checksum && srcMatchShortEntry[i].allocated)
+        if (srcMatchShortEntry[slot].shortAddress == aShortAddress && srcMatchShortEntry[slot].panId == sPanId)
         {
-            entry = i;
+            entry = (int16_t)slot;
             break;
         }
+
+        slot = (slot + 1) & SRC_MATCH_SHORT_SLOT_MASK;
     }
 
     return entry;
 }
 
-static int16_t findSrcMatchShortAvailEntry(void)
+static void addToSrcMatchShortTable(uint16_t aShortAddress)
 {
-    int16_t entry = -1;
+    uint16_t slot = getSrcMatchShortHomeSlot(sPanId, aShortAddress);
 
-    for (int16_t i = 0; i < RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM; i++)
+    while (srcMatchShortEntry[slot].allocated)
     {
-        if (!srcMatchShortEntry[i].allocated)
-        {
-            entry = i;
-            break;
-        }
+        slot = (slot + 1) & SRC_MATCH_SHORT_SLOT_MASK;
     }
 
-    return entry;
+    srcMatchShortEntry[slot].panId        = sPanId;
+    srcMatchShortEntry[slot].shortAddress = aShortAddress;
+    srcMatchShortEntry[slot].allocated    = true;
+    sSrcMatchShortNum++;
 }
 
-static inline void addToSrcMatchShortIndirect(uint16_t entry, uint16_t aShortAddress)
+static void removeFromSrcMatchShortTable(uint16_t aSlot)
 {
-    uint16_t checksum = aShortAddress + sPanId;
+    // Moves back the following entries of the probe sequence which
+    // can fill the freed slot, so no deleted markers are needed.
+
+    uint16_t hole = aSlot;
+    uint16_t slot = aSlot;
+
+    while (true)
+    {
+        uint16_t home;
 
-    srcMatchShortEntry[entry].checksum  = checksum;
-    srcMatchShortEntry[entry].allocated = true;
+        slot = (slot + 1) & SRC_MATCH_SHORT_SLOT_MASK;
+        otEXPECT(srcMatchShortEntry[slot].allocated);
+
+        home = getSrcMatchShortHomeSlot(srcMatchShortEntry[slot].panId, srcMatchShortEntry[slot].shortAddress);
+
+        if (((slot - home) & SRC_MATCH_SHORT_SLOT_MASK) >= ((slot - hole) & SRC_MATCH_SHORT_SLOT_MASK))
+        {
+            srcMatchShortEntry[hole] = srcMatchShortEntry[slot];
+            hole                     = slot;
+        }
+    }
+
+exit:
+    srcMatchShortEntry[hole].allocated = false;
+    sSrcMatchShortNum--;
 }
 
-static inline void removeFromSrcMatchShortIndirect(uint16_t entry)
+otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, uint16_t aShortAddress)
 {
-    srcMatchShortEntry[entry].allocated = false;
-    srcMatchShortEntry[entry].checksum  = 0;
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError error = OT_ERROR_NONE;
+
+    otLogDebgPlat("Add ShortAddr entry: 0x%04x", aShortAddress);
+
+    otEXPECT_ACTION(sSrcMatchShortNum < RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM, error = OT_ERROR_NO_BUFS);
+
+    addToSrcMatchShortTable(aShortAddress);
+
+exit:
+    return error;
 }
 
-otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, uint16_t aShortAddress)
+otError otPlatRadioAddSrcMatchShortEntries(otInstance           *aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint16_t              aNumAddresses)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
     otError error = OT_ERROR_NONE;
-    int16_t entry = -1;
 
-    entry = findSrcMatchShortAvailEntry();
-    otLogDebgPlat("Add ShortAddr entry: %d", entry);
+    otLogDebgPlat("Add %u ShortAddr entries", aNumAddresses);
 
-    otEXPECT_ACTION(entry >= 0 && entry < RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM, error = OT_ERROR_NO_BUFS);
+    otEXPECT_ACTION(aNumAddresses <= RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM - sSrcMatchShortNum,
+                    error = OT_ERROR_NO_BUFS);
 
-    addToSrcMatchShortIndirect((uint16_t)entry, aShortAddress);
+    for (uint16_t i = 0; i < aNumAddresses; i++)
+    {
+        addToSrcMatchShortTable(aShortAddresses[i]);
+    }
 
 exit:
     return error;
@@ -133,9 +210,9 @@ otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, uint16_t aShor
     entry = utilsSoftSrcMatchShortFindEntry(aShortAddress);
     otLogDebgPlat("Clear ShortAddr entry: %d", entry);
 
-    otEXPECT_ACTION(entry >= 0 && entry < RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM, error = OT_ERROR_NO_ADDRESS);
+    otEXPECT_ACTION(entry >= 0, error = OT_ERROR_NO_ADDRESS);
 
-    removeFromSrcMatchShortIndirect((uint16_t)entry);
+    removeFromSrcMatchShortTable((uint16_t)entry);
 
 exit:
     return error;
@@ -148,88 +225,135 @@ void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance)
     otLogDebgPlat("Clear ShortAddr entries");
 
     memset(srcMatchShortEntry, 0, sizeof(srcMatchShortEntry));
+    sSrcMatchShortNum = 0;
 }
 #endif // RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM
 
 #if RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM
+#define SRC_MATCH_EXT_TABLE_SIZE SRC_MATCH_TABLE_SIZE(RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM)
+#define SRC_MATCH_EXT_SLOT_MASK (SRC_MATCH_EXT_TABLE_SIZE - 1)
+
 typedef struct srcMatchExtEntry
 {
-    uint16_t checksum;
-    bool     allocated;
+    otExtAddress extAddress;
+    uint16_t     panId;
+    bool         allocated;
 } sSrcMatchExtEntry;
 
-static sSrcMatchExtEntry srcMatchExtEntry[RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM];
+static sSrcMatchExtEntry srcMatchExtEntry[SRC_MATCH_EXT_TABLE_SIZE];
+static uint16_t          sSrcMatchExtNum = 0;
 
-int16_t utilsSoftSrcMatchExtFindEntry(const otExtAddress *aExtAddress)
+static uint16_t getSrcMatchExtHomeSlot(uint16_t aPanId, const otExtAddress *aExtAddress)
+{
+    uint32_t low  = (uint32_t)aExtAddress->m8[0] | ((uint32_t)aExtAddress->m8[1] << 8) |
+                   ((uint32_t)aExtAddress->m8[2] << 16) | ((uint32_t)aExtAddress->m8[3] << 24);
+    uint32_t high = (uint32_t)aExtAddress->m8[4] | ((uint32_t)aExtAddress->m8[5] << 8) |
+                    ((uint32_t)aExtAddress->m8[6] << 16) | ((uint32_t)aExtAddress->m8[7] << 24);
+
+    return (uint16_t)(hashSrcMatchKey(hashSrcMatchKey(low ^ aPanId) ^ high) & SRC_MATCH_EXT_SLOT_MASK);
+}
+
+static bool srcMatchExtEntryMatches(const sSrcMatchExtEntry *aEntry, uint16_t aPanId, const otExtAddress *aExtAddress)
 {
-    int16_t  entry    = -1;
-    uint16_t checksum = sPanId;
+    return (aEntry->panId == aPanId) && (memcmp(aEntry->extAddress.m8, aExtAddress->m8, sizeof(otExtAddress)) == 0);
+}
 
-    checksum += (uint16_t)aExtAddress->m8[0] | (uint16_t)(aExtAddress->m8[1] << 8);
-    checksum += (uint16_t)aExtAddress->m8[2] | (uint16_t)(aExtAddress->m8[3] << 8);
-    checksum += (uint16_t)aExtAddress->m8[4] | (uint16_t)(aExtAddress->m8[5] << 8);
-    checksum += (uint16_t)aExtAddress->m8[6] | (uint16_t)(aExtAddress->m8[7] << 8);
+int16_t utilsSoftSrcMatchExtFindEntry(const otExtAddress *aExtAddress)
+{
+    int16_t  entry = -1;
+    uint16_t slot  = getSrcMatchExtHomeSlot(sPanId, aExtAddress);
 
-    for (int16_t i = 0; i < RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM; i++)
+    // The table always has free slots, so the probe ends at one of them.
+    while (srcMatchExtEntry[slot].allocated)
     {
-        if (checksum == srcMatchExtEntry[i].checksum && srcMatchExtEntry[i].allocated)
+        if (srcMatchExtEntryMatches(&srcMatchExtEntry[slot], sPanId, aExtAddress))
         {
-            entry = i;
+            entry = (int16_t)slot;
             break;
         }
+
+        slot = (slot + 1) & SRC_MATCH_EXT_SLOT_MASK;
     }
 
     return entry;
 }
 
-static int16_t findSrcMatchExtAvailEntry(void)
+static void addToSrcMatchExtTable(const otExtAddress *aExtAddress)
 {
-    int16_t entry = -1;
+    uint16_t slot = getSrcMatchExtHomeSlot(sPanId, aExtAddress);
 
-    for (int16_t i = 0; i < RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM; i++)
+    while (srcMatchExtEntry[slot].allocated)
     {
-        if (!srcMatchExtEntry[i].allocated)
-        {
-            entry = i;
-            break;
-        }
+        slot = (slot + 1) & SRC_MATCH_EXT_SLOT_MASK;
     }
 
-    return entry;
+    srcMatchExtEntry[slot].extAddress = *aExtAddress;
+    srcMatchExtEntry[slot].panId      = sPanId;
+    srcMatchExtEntry[slot].allocated  = true;
+    sSrcMatchExtNum++;
 }
 
-static inline void addToSrcMatchExtIndirect(uint16_t entry, const otExtAddress *aExtAddress)
+static void removeFromSrcMatchExtTable(uint16_t aSlot)
 {
-    uint16_t checksum = sPanId;
+    // Moves back the following entries of the probe sequence which
+    // can fill the freed slot, so no deleted markers are needed.
+
+    uint16_t hole = aSlot;
+    uint16_t slot = aSlot;
+
+    while (true)
+    {
+        uint16_t home;
 
-    checksum += (uint16_t)aExtAddress->m8[0] | (uint16_t)(aExtAddress->m8[1] << 8);
-    checksum += (uint16_t)aExtAddress->m8[2] | (uint16_t)(aExtAddress->m8[3] << 8);
-    checksum += (uint16_t)aExtAddress->m8[4] | (uint16_t)(aExtAddress->m8[5] << 8);
-    checksum += (uint16_t)aExtAddress->m8[6] | (uint16_t)(aExtAddress->m8[7] << 8);
+        slot = (slot + 1) & SRC_MATCH_EXT_SLOT_MASK;
+        otEXPECT(srcMatchExtEntry[slot].allocated);
 
-    srcMatchExtEntry[entry].checksum  = checksum;
-    srcMatchExtEntry[entry].allocated = true;
+        home = getSrcMatchExtHomeSlot(srcMatchExtEntry[slot].panId, &srcMatchExtEntry[slot].extAddress);
+
+        if (((slot - home) & SRC_MATCH_EXT_SLOT_MASK) >= ((slot - hole) & SRC_MATCH_EXT_SLOT_MASK))
+        {
+            srcMatchExtEntry[hole] = srcMatchExtEntry[slot];
+            hole                   = slot;
+        }
+    }
+
+exit:
+    srcMatchExtEntry[hole].allocated = false;
+    sSrcMatchExtNum--;
 }
 
-static inline void removeFromSrcMatchExtIndirect(uint16_t entry)
+otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
 {
-    srcMatchExtEntry[entry].allocated = false;
-    srcMatchExtEntry[entry].checksum  = 0;
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError error = OT_ERROR_NONE;
+
+    otLogDebgPlat("Add ExtAddr entry");
+
+    otEXPECT_ACTION(sSrcMatchExtNum < RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM, error = OT_ERROR_NO_BUFS);
+
+    addToSrcMatchExtTable(aExtAddress);
+
+exit:
+    return error;
 }
 
-otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+otError otPlatRadioAddSrcMatchExtEntries(otInstance         *aInstance,
+                                         const otExtAddress *aExtAddresses,
+                                         uint16_t            aNumAddresses)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
     otError error = OT_ERROR_NONE;
-    int16_t entry = -1;
 
-    entry = findSrcMatchExtAvailEntry();
-    otLogDebgPlat("Add ExtAddr entry: %d", entry);
+    otLogDebgPlat("Add %u ExtAddr entries", aNumAddresses);
 
-    otEXPECT_ACTION(entry >= 0 && entry < RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM, error = OT_ERROR_NO_BUFS);
+    otEXPECT_ACTION(aNumAddresses <= RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM - sSrcMatchExtNum, error = OT_ERROR_NO_BUFS);
 
-    addToSrcMatchExtIndirect((uint16_t)entry, aExtAddress);
+    for (uint16_t i = 0; i < aNumAddresses; i++)
+    {
+        addToSrcMatchExtTable(&aExtAddresses[i]);
+    }
 
 exit:
     return error;
@@ -245,9 +369,9 @@ otError otPlatRadioClearSrcMatchExtEntry(otInstance *aInstance, const otExtAddre
     entry = utilsSoftSrcMatchExtFindEntry(aExtAddress);
     otLogDebgPlat("Clear ExtAddr entry: %d", entry);
 
-    otEXPECT_ACTION(entry >= 0 && entry < RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM, error = OT_ERROR_NO_ADDRESS);
+    otEXPECT_ACTION(entry >= 0, error = OT_ERROR_NO_ADDRESS);
 
-    removeFromSrcMatchExtIndirect((uint16_t)entry);
+    removeFromSrcMatchExtTable((uint16_t)entry);
 
 exit:
     return error;
@@ -260,5 +384,6 @@ void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
     otLogDebgPlat("Clear ExtAddr entries");
 
     memset(srcMatchExtEntry, 0, sizeof(srcMatchExtEntry));
+    sSrcMatchExtNum = 0;
 }
 #endif // RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM
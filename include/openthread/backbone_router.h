@@ -75,6 +75,56 @@ typedef struct otBackboneRouterConfig
  */
 otError otBackboneRouterGetPrimary(otInstance *aInstance, otBackboneRouterConfig *aConfig);
 
+/**
+ * Represents the counters of the registrations (DUA or MLR) sent by the device to the Primary Backbone Router, for
+ * itself or on behalf of its children.
+ *
+ * The latency of a registration request is the time from queuing the oldest registration it carries until receiving
+ * its response.
+ *
+ */
+typedef struct otBackboneRouterRegistrationCounters
+{
+    uint32_t mRequests;     ///< Number of registration requests sent.
+    uint32_t mAddresses;    ///< Number of addresses carried in the registration requests.
+    uint32_t mSuccesses;    ///< Number of registration requests which succeeded.
+    uint32_t mFailures;     ///< Number of registration requests which failed or got no response.
+    uint32_t mTotalLatency; ///< Sum of the latencies (in msec) of the successful registration requests.
+    uint32_t mMaxLatency;   ///< Largest latency (in msec) of a successful registration request.
+} otBackboneRouterRegistrationCounters;
+
+/**
+ * Gets the counters of the Multicast Listener Registrations.
+ *
+ * Requires `OPENTHREAD_CONFIG_MLR_ENABLE` (or an FTD with `OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE`).
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the Multicast Listener Registration counters.
+ *
+ */
+const otBackboneRouterRegistrationCounters *otBackboneRouterGetMlrCounters(otInstance *aInstance);
+
+/**
+ * Gets the counters of the Domain Unicast Address registrations.
+ *
+ * Requires `OPENTHREAD_CONFIG_DUA_ENABLE` (or an FTD with `OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE`).
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the Domain Unicast Address registration counters.
+ *
+ */
+const otBackboneRouterRegistrationCounters *otBackboneRouterGetDuaCounters(otInstance *aInstance);
+
+/**
+ * Resets the counters of the Multicast Listener Registrations and of the Domain Unicast Address registrations.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otBackboneRouterResetRegistrationCounters(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -87,6 +87,56 @@ typedef void (*otHandleCoapSecureClientConnect)(bool aConnected, void *aContext)
  */
 otError otCoapSecureStart(otInstance *aInstance, uint16_t aPort);
 
+/**
+ * Represents information about the CoAP Secure multi-session server.
+ *
+ */
+typedef struct otCoapSecureServerInfo
+{
+    uint16_t mMaxSessions;         ///< Maximum number of concurrent sessions.
+    uint16_t mNumSessions;         ///< Number of current sessions (handshaking, connected or closing).
+    uint32_t mSessionSize;         ///< Size in bytes of the state of a session, excluding mbedTLS heap allocations.
+    uint32_t mHelloVerifyRequests; ///< Number of HelloVerifyRequests (cookies) sent to new peers.
+    uint32_t mSessionsStarted;     ///< Number of sessions started by peers presenting a valid cookie.
+    uint32_t mSessionsConnected;   ///< Number of sessions which completed their handshake.
+    uint32_t mSessionsRejected;    ///< Number of new peers rejected since all sessions were in use.
+} otCoapSecureServerInfo;
+
+/**
+ * Starts the CoAP Secure service as a multi-session server.
+ *
+ * Requires `OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE`.
+ *
+ * Unlike `otCoapSecureStart()`, several peers can connect at the same time. Each peer gets its own DTLS session, up
+ * to `OPENTHREAD_CONFIG_DTLS_SERVER_MAX_SESSIONS` sessions. A new peer must first echo the cookie of a
+ * HelloVerifyRequest, so no state is kept for a peer before it proves it can receive at its address.
+ *
+ * The sessions use the PSK or certificates set with `otCoapSecureSetPsk()` or `otCoapSecureSetCertificate()`.
+ * Responses sent with `otCoapSecureSendResponse()` go to the session of the peer in their message info. The callback
+ * set with `otCoapSecureSetClientConnectedCallback()` is invoked for each session.
+ *
+ * The CoAP Secure service is stopped with `otCoapSecureStop()`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aPort      The local UDP port to bind to.
+ *
+ * @retval OT_ERROR_NONE     Successfully started the CoAP Secure server.
+ * @retval OT_ERROR_ALREADY  The CoAP Secure server is already started.
+ *
+ */
+otError otCoapSecureStartServer(otInstance *aInstance, uint16_t aPort);
+
+/**
+ * Gets information about the CoAP Secure multi-session server.
+ *
+ * Requires `OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE`.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aInfo      A pointer to return the server information.
+ *
+ */
+void otCoapSecureGetServerInfo(otInstance *aInstance, otCoapSecureServerInfo *aInfo);
+
 /**
  * Stops the CoAP Secure server.
  *
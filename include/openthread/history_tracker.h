@@ -72,6 +72,8 @@ typedef struct otHistoryTrackerIterator
 {
     uint32_t mData32;
     uint16_t mData16;
+    uint16_t mCursorOffset;
+    uint32_t mCursorAge;
 } otHistoryTrackerIterator;
 
 /**
@@ -160,6 +162,32 @@ typedef struct otHistoryTrackerMessageInfo
     bool       mRadioTrelUdp6 : 1;   ///< Indicates whether msg was sent/received over a TREL radio link.
 } otHistoryTrackerMessageInfo;
 
+/**
+ * Represents a filter to query the RX/TX message history.
+ *
+ */
+typedef struct otHistoryTrackerMessageFilter
+{
+    uint32_t mMaxAge;            ///< Only entries with an age up to this value (in msec) are matched.
+    uint16_t mNeighborRloc16;    ///< RLOC16 of the neighbor to match. Applicable if `mMatchNeighbor` is set.
+    bool     mMatchNeighbor : 1; ///< Indicates whether to only match entries of neighbor `mNeighborRloc16`.
+} otHistoryTrackerMessageFilter;
+
+/**
+ * Pointer is called when the oldest entry of the RX or TX message history is about to be dropped to make room for a
+ * new entry.
+ *
+ * @param[in] aEntry     The message info entry being dropped.
+ * @param[in] aIsTx      TRUE if the entry is from the TX message history, FALSE if from the RX message history.
+ * @param[in] aEntryAge  The entry's age (duration in msec from when entry was recorded till now).
+ * @param[in] aContext   A pointer to application-specific context.
+ *
+ */
+typedef void (*otHistoryTrackerMessageSpillCallback)(const otHistoryTrackerMessageInfo *aEntry,
+                                                     bool                               aIsTx,
+                                                     uint32_t                           aEntryAge,
+                                                     void                              *aContext);
+
 /**
  * Defines the events in a neighbor info (i.e. whether neighbor is added, removed, or changed).
  *
@@ -323,6 +351,9 @@ const otHistoryTrackerMulticastAddressInfo *otHistoryTrackerIterateMulticastAddr
 /**
  * Iterates over the entries in the RX message history list.
  *
+ * The returned entry is valid until the next call, since entries may be kept in a compact form (see
+ * `OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE`).
+ *
  * @param[in]     aInstance  A pointer to the OpenThread instance.
  * @param[in,out] aIterator  A pointer to an iterator. MUST be initialized or the behavior is undefined.
  * @param[out]    aEntryAge  A pointer to a variable to output the entry's age. MUST NOT be NULL.
@@ -340,6 +371,9 @@ const otHistoryTrackerMessageInfo *otHistoryTrackerIterateRxHistory(otInstance
 /**
  * Iterates over the entries in the TX message history list.
  *
+ * The returned entry is valid until the next call, since entries may be kept in a compact form (see
+ * `OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE`).
+ *
  * @param[in]     aInstance  A pointer to the OpenThread instance.
  * @param[in,out] aIterator  A pointer to an iterator. MUST be initialized or the behavior is undefined.
  * @param[out]    aEntryAge  A pointer to a variable to output the entry's age. MUST NOT be NULL.
@@ -354,6 +388,73 @@ const otHistoryTrackerMessageInfo *otHistoryTrackerIterateTxHistory(otInstance
                                                                     otHistoryTrackerIterator *aIterator,
                                                                     uint32_t                 *aEntryAge);
 
+/**
+ * Iterates over the entries in the RX message history list which match a given filter.
+ *
+ * Entries are given from the newest to the oldest, the same as `otHistoryTrackerIterateRxHistory()`. The iteration
+ * ends at the first entry older than `mMaxAge` of @p aFilter, so the older part of the list is not visited.
+ *
+ * The same @p aFilter MUST be used for all calls with an iterator.
+ *
+ * The returned entry is valid until the next call, since entries may be kept in a compact form (see
+ * `OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE`).
+ *
+ * @param[in]     aInstance  A pointer to the OpenThread instance.
+ * @param[in,out] aIterator  A pointer to an iterator. MUST be initialized or the behavior is undefined.
+ * @param[in]     aFilter    A pointer to the filter to match entries with (MUST NOT be NULL).
+ * @param[out]    aEntryAge  A pointer to a variable to output the entry's age. MUST NOT be NULL.
+ *                           Age is provided as the duration (in milliseconds) from when entry was recorded to
+ *                           @p aIterator initialization time.
+ *
+ * @returns The `otHistoryTrackerMessageInfo` entry or `NULL` if no more matching entries in the list.
+ *
+ */
+const otHistoryTrackerMessageInfo *otHistoryTrackerQueryRxHistory(otInstance                          *aInstance,
+                                                                  otHistoryTrackerIterator            *aIterator,
+                                                                  const otHistoryTrackerMessageFilter *aFilter,
+                                                                  uint32_t                            *aEntryAge);
+
+/**
+ * Iterates over the entries in the TX message history list which match a given filter.
+ *
+ * Entries are given from the newest to the oldest, the same as `otHistoryTrackerIterateTxHistory()`. The iteration
+ * ends at the first entry older than `mMaxAge` of @p aFilter, so the older part of the list is not visited.
+ *
+ * The same @p aFilter MUST be used for all calls with an iterator.
+ *
+ * The returned entry is valid until the next call, since entries may be kept in a compact form (see
+ * `OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE`).
+ *
+ * @param[in]     aInstance  A pointer to the OpenThread instance.
+ * @param[in,out] aIterator  A pointer to an iterator. MUST be initialized or the behavior is undefined.
+ * @param[in]     aFilter    A pointer to the filter to match entries with (MUST NOT be NULL).
+ * @param[out]    aEntryAge  A pointer to a variable to output the entry's age. MUST NOT be NULL.
+ *                           Age is provided as the duration (in milliseconds) from when entry was recorded to
+ *                           @p aIterator initialization time.
+ *
+ * @returns The `otHistoryTrackerMessageInfo` entry or `NULL` if no more matching entries in the list.
+ *
+ */
+const otHistoryTrackerMessageInfo *otHistoryTrackerQueryTxHistory(otInstance                          *aInstance,
+                                                                  otHistoryTrackerIterator            *aIterator,
+                                                                  const otHistoryTrackerMessageFilter *aFilter,
+                                                                  uint32_t                            *aEntryAge);
+
+/**
+ * Sets the callback to spill the RX/TX message history.
+ *
+ * The callback is invoked with the oldest entry of the RX or TX message history when it is about to be dropped to
+ * make room for a new entry. It can be used to persist older history, e.g., to a file.
+ *
+ * @param[in] aInstance  A pointer to the OpenThread instance.
+ * @param[in] aCallback  The callback. Can be NULL to stop spilling entries.
+ * @param[in] aContext   A pointer to application-specific context used with @p aCallback.
+ *
+ */
+void otHistoryTrackerSetMessageSpillCallback(otInstance                          *aInstance,
+                                             otHistoryTrackerMessageSpillCallback aCallback,
+                                             void                                *aContext);
+
 /**
  * Iterates over the entries in the neighbor history list.
  *
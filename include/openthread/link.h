@@ -371,6 +371,18 @@ typedef struct otMacCounters
      *
      */
     uint32_t mRxErrOther;
+
+    /**
+     * The total number of frames whose MAC header was copied from a cached header template.
+     *
+     */
+    uint32_t mTxHeaderTemplateHit;
+
+    /**
+     * The total number of frames whose MAC header was built field by field (no matching header template).
+     *
+     */
+    uint32_t mTxHeaderTemplateMiss;
 } otMacCounters;
 
 /**
@@ -160,6 +160,41 @@ void otNat64GetCounters(otInstance *aInstance, otNat64ProtocolCounters *aCounter
  */
 void otNat64GetErrorCounters(otInstance *aInstance, otNat64ErrorCounters *aCounters);
 
+/**
+ * Represents the mapping table counters of the NAT64 translator.
+ *
+ * Port mappings are only used when `OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE` is enabled, otherwise the
+ * port mapping counters stay zero.
+ *
+ */
+typedef struct otNat64MappingCounters
+{
+    uint64_t mAddressMappingsCreated;  ///< Number of address mappings created.
+    uint64_t mAddressMappingsReleased; ///< Number of address mappings released (expired or flushed).
+    uint64_t mPortMappingsCreated;     ///< Number of port mappings created.
+    uint64_t mPortMappingsReleased;    ///< Number of port mappings released (expired or flushed).
+    uint64_t mPortExhaustions;         ///< Number of flows dropped since no port mapping could be allocated.
+    uint16_t mNumAddressMappings;      ///< Number of active address mappings.
+    uint16_t mMaxNumAddressMappings;   ///< Maximum number of active address mappings seen.
+    uint16_t mAddressMappingCapacity;  ///< Size of the address mapping table.
+    uint16_t mNumPortMappings;         ///< Number of active port mappings.
+    uint16_t mMaxNumPortMappings;      ///< Maximum number of active port mappings seen.
+    uint16_t mPortMappingCapacity;     ///< Size of the port mapping table (zero if port translation is disabled).
+} otNat64MappingCounters;
+
+/**
+ * Gets the NAT64 translator mapping table counters.
+ *
+ * The churn counters are initialized to zero when the OpenThread instance is initialized.
+ *
+ * Available when `OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ * @param[out] aCounters A pointer to an `otNat64MappingCounters` where the counters will be placed.
+ *
+ */
+void otNat64GetMappingCounters(otInstance *aInstance, otNat64MappingCounters *aCounters);
+
 /**
  * Represents an address mapping record for NAT64.
  *
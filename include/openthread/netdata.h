@@ -182,6 +182,42 @@ uint8_t otNetDataGetMaxLength(otInstance *aInstance);
  */
 void otNetDataResetMaxLength(otInstance *aInstance);
 
+/**
+ * Represents the Network Data delta propagation counters.
+ *
+ */
+typedef struct otNetDataDeltaCounters
+{
+    uint32_t mDeltasSent;     ///< Number of Data Responses sent with a Network Data delta.
+    uint32_t mFullFallbacks;  ///< Number of delta requests answered with the full Network Data.
+    uint32_t mDeltaBytesSent; ///< Number of bytes of Network Data deltas sent.
+    uint32_t mBytesSaved;     ///< Number of bytes saved by sending deltas instead of the full Network Data.
+    uint32_t mDeltasApplied;  ///< Number of received Network Data deltas applied.
+    uint32_t mDeltaFailures;  ///< Number of received Network Data deltas that could not be applied.
+} otNetDataDeltaCounters;
+
+/**
+ * Gets the Network Data delta propagation counters.
+ *
+ * @param[in] aInstance    A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the Network Data delta propagation counters.
+ *
+ * @note This API is only available when `OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE` is used.
+ *
+ */
+const otNetDataDeltaCounters *otNetDataGetDeltaCounters(otInstance *aInstance);
+
+/**
+ * Resets the Network Data delta propagation counters.
+ *
+ * @param[in] aInstance    A pointer to an OpenThread instance.
+ *
+ * @note This API is only available when `OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE` is used.
+ *
+ */
+void otNetDataResetDeltaCounters(otInstance *aInstance);
+
 /**
  * Get the next On Mesh Prefix in the partition's Network Data.
  *
@@ -315,6 +315,22 @@ typedef struct otNetworkDiagTlv
     } mData;
 } otNetworkDiagTlv;
 
+/**
+ * Represents the position of a Network Diagnostic Get answer within the answers to a query.
+ *
+ * A device answers a DIAG_GET.qry with one or more answer messages. Large lists (e.g., the child table or the IPv6
+ * address list) are continued in the next answer, which the device prepares only once the previous one has been
+ * acknowledged.
+ *
+ */
+typedef struct otNetworkDiagAnswerInfo
+{
+    uint16_t mQueryId;    ///< The Query ID of the query (valid only when `mHasQueryId` is set).
+    uint16_t mIndex;      ///< The index of the answer (zero for the first answer of a device).
+    bool     mHasQueryId; ///< Indicates whether the answer contains a Query ID.
+    bool     mIsLast;     ///< Indicates whether this is the last answer of the device for the query.
+} otNetworkDiagAnswerInfo;
+
 /**
  * Gets the next Network Diagnostic TLV in the message.
  *
@@ -336,6 +352,23 @@ otError otThreadGetNextDiagnosticTlv(const otMessage       *aMessage,
                                      otNetworkDiagIterator *aIterator,
                                      otNetworkDiagTlv      *aNetworkDiagTlv);
 
+/**
+ * Gets the answer information of a received Network Diagnostic Get answer.
+ *
+ * Requires `OPENTHREAD_CONFIG_TMF_NETDIAG_CLIENT_ENABLE`.
+ *
+ * Can be used from `otReceiveDiagnosticGetCallback` to process the TLVs of each answer as it arrives and to determine
+ * when a device has sent all its answers for a query.
+ *
+ * @param[in]   aMessage     A pointer to a message.
+ * @param[out]  aAnswerInfo  A pointer to output the answer information.
+ *
+ * @retval OT_ERROR_NONE       Successfully read the answer information.
+ * @retval OT_ERROR_NOT_FOUND  @p aMessage does not contain an Answer TLV (e.g., it is a DIAG_GET.rsp).
+ *
+ */
+otError otThreadGetDiagnosticAnswerInfo(const otMessage *aMessage, otNetworkDiagAnswerInfo *aAnswerInfo);
+
 /**
  * Pointer is called when Network Diagnostic Get response is received.
  *
@@ -376,6 +409,34 @@ otError otThreadSendDiagnosticGet(otInstance                    *aInstance,
                                   otReceiveDiagnosticGetCallback aCallback,
                                   void                          *aCallbackContext);
 
+/**
+ * Send a Network Diagnostic Get query.
+ *
+ * Requires `OPENTHREAD_CONFIG_TMF_NETDIAG_CLIENT_ENABLE`.
+ *
+ * Unlike `otThreadSendDiagnosticGet()`, a DIAG_GET.qry is sent even when @p aDestination is a unicast address. The
+ * device(s) then reply with one or more answers, each reported to @p aCallback as it is received. Use
+ * `otThreadGetDiagnosticAnswerInfo()` to track the answers of each device.
+ *
+ * @param[in]  aInstance         A pointer to an OpenThread instance.
+ * @param[in]  aDestination      A pointer to destination address.
+ * @param[in]  aTlvTypes         An array of Network Diagnostic TLV types.
+ * @param[in]  aCount            Number of types in aTlvTypes.
+ * @param[in]  aCallback         A pointer to a function that is called when a Network Diagnostic Get answer
+ *                               is received or NULL to disable the callback.
+ * @param[in]  aCallbackContext  A pointer to application-specific context.
+ *
+ * @retval OT_ERROR_NONE    Successfully queued the DIAG_GET.qry.
+ * @retval OT_ERROR_NO_BUFS Insufficient message buffers available to send DIAG_GET.qry.
+ *
+ */
+otError otThreadSendDiagnosticQuery(otInstance                    *aInstance,
+                                    const otIp6Address            *aDestination,
+                                    const uint8_t                  aTlvTypes[],
+                                    uint8_t                        aCount,
+                                    otReceiveDiagnosticGetCallback aCallback,
+                                    void                          *aCallbackContext);
+
 /**
  * Send a Network Diagnostic Reset request.
  *
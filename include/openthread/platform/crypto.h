@@ -39,6 +39,7 @@
 #include <stdlib.h>
 
 #include <openthread/error.h>
+#include <openthread/instance.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -653,6 +654,44 @@ otError otPlatCryptoEcdsaVerify(const otPlatCryptoEcdsaPublicKey *aPublicKey,
                                 const otPlatCryptoSha256Hash     *aHash,
                                 const otPlatCryptoEcdsaSignature *aSignature);
 
+/**
+ * Starts verifying the ECDSA signature of a hashed message without blocking the OpenThread thread.
+ *
+ * Allows the platform to perform the verification elsewhere, e.g., on a worker thread or a crypto accelerator. When
+ * this function returns `OT_ERROR_NONE`, the platform MUST report the outcome by calling
+ * `otPlatCryptoEcdsaVerifyDone()` with the same @p aContext, from the OpenThread thread. The platform should copy the
+ * inputs as they are only guaranteed to be valid during this call.
+ *
+ * On any other return value, OpenThread verifies the signature itself using `otPlatCryptoEcdsaVerify()`.
+ *
+ * @param[in]  aInstance    The OpenThread instance structure.
+ * @param[in]  aPublicKey   A pointer to the ECDSA public key.
+ * @param[in]  aHash        A pointer to the SHA-256 hash of the signed message.
+ * @param[in]  aSignature   A pointer to the ECDSA signature to verify.
+ * @param[in]  aContext     An arbitrary context to pass back in `otPlatCryptoEcdsaVerifyDone()`.
+ *
+ * @retval OT_ERROR_NONE             The verification started, its outcome will be reported.
+ * @retval OT_ERROR_BUSY             The platform cannot accept another verification at the moment.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  Asynchronous verification is not supported by the platform.
+ *
+ */
+otError otPlatCryptoEcdsaVerifyStart(otInstance                       *aInstance,
+                                     const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                     const otPlatCryptoSha256Hash     *aHash,
+                                     const otPlatCryptoEcdsaSignature *aSignature,
+                                     void                             *aContext);
+
+/**
+ * Reports the outcome of a verification started by `otPlatCryptoEcdsaVerifyStart()`.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ * @param[in]  aContext   The context given to `otPlatCryptoEcdsaVerifyStart()`.
+ * @param[in]  aError     The outcome of the verification, with the same meaning as the values returned by
+ *                        `otPlatCryptoEcdsaVerify()` (`OT_ERROR_NONE` if the signature is valid).
+ *
+ */
+extern void otPlatCryptoEcdsaVerifyDone(otInstance *aInstance, void *aContext, otError aError);
+
 /**
  * Calculate the ECDSA signature for a hashed message using the Key reference passed.
  *
@@ -347,6 +347,17 @@ typedef struct otRadioFrame
             // Flags
             bool mAckedWithFramePending : 1; ///< This indicates if this frame was acknowledged with frame pending set.
             bool mAckedWithSecEnhAck : 1; ///< This indicates if this frame was acknowledged with secured enhance ACK.
+
+            /**
+             * Indicates whether the platform has already decrypted the frame and verified its MIC.
+             *
+             * Only honored when OpenThread is built with `OPENTHREAD_CONFIG_MAC_PLATFORM_RX_DECRYPTION_ENABLE` and
+             * only for frames using Key ID Mode 1. The platform must use the keys given by `otPlatRadioSetMacKey()`
+             * and must leave the frame untouched (and this flag cleared) if the MIC check fails. OpenThread still
+             * performs the key sequence and frame counter (replay) checks on such frames.
+             *
+             */
+            bool mIsSecurityProcessed : 1;
         } mRxInfo;
     } mInfo;
 } otRadioFrame;
@@ -956,6 +967,46 @@ otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, otShortAddress a
  */
 otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress);
 
+/**
+ * Add a list of short addresses to the source address match table.
+ *
+ * Either all the addresses are added or, on failure, none of them.
+ *
+ * Is optional. A default weak implementation is provided which adds the addresses one by one using
+ * `otPlatRadioAddSrcMatchShortEntry()`.
+ *
+ * @param[in]  aInstance        The OpenThread instance structure.
+ * @param[in]  aShortAddresses  An array of short addresses to be added.
+ * @param[in]  aNumAddresses    The number of addresses in @p aShortAddresses.
+ *
+ * @retval OT_ERROR_NONE      Successfully added all the short addresses to the source match table.
+ * @retval OT_ERROR_NO_BUFS   Not enough available entries in the source match table.
+ *
+ */
+otError otPlatRadioAddSrcMatchShortEntries(otInstance           *aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint16_t              aNumAddresses);
+
+/**
+ * Add a list of extended addresses to the source address match table.
+ *
+ * Either all the addresses are added or, on failure, none of them.
+ *
+ * Is optional. A default weak implementation is provided which adds the addresses one by one using
+ * `otPlatRadioAddSrcMatchExtEntry()`.
+ *
+ * @param[in]  aInstance      The OpenThread instance structure.
+ * @param[in]  aExtAddresses  An array of extended addresses to be added, each stored in little-endian byte order.
+ * @param[in]  aNumAddresses  The number of addresses in @p aExtAddresses.
+ *
+ * @retval OT_ERROR_NONE      Successfully added all the extended addresses to the source match table.
+ * @retval OT_ERROR_NO_BUFS   Not enough available entries in the source match table.
+ *
+ */
+otError otPlatRadioAddSrcMatchExtEntries(otInstance         *aInstance,
+                                         const otExtAddress *aExtAddresses,
+                                         uint16_t            aNumAddresses);
+
 /**
  * Remove a short address from the source address match table.
  *
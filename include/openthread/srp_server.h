@@ -145,6 +145,22 @@ typedef struct otSrpServerResponseCounters
     uint32_t mOther;         ///< The number of other responses.
 } otSrpServerResponseCounters;
 
+/**
+ * Includes the statistics of the SRP server asynchronous signature verification.
+ *
+ */
+typedef struct otSrpServerSignatureVerifierCounters
+{
+    uint32_t mVerified;      ///< The number of SRP update signatures found valid.
+    uint32_t mFailed;        ///< The number of SRP update signatures which failed verification.
+    uint32_t mOffloaded;     ///< The number of signatures handed over to `otPlatCryptoEcdsaVerifyStart()`.
+    uint32_t mQueueFull;     ///< The number of SRP updates rejected because too many were waiting for verification.
+    uint32_t mTotalLatency;  ///< The sum of the times (in milliseconds) SRP updates waited for their verification.
+    uint32_t mMaxLatency;    ///< The longest time (in milliseconds) an SRP update waited for its verification.
+    uint16_t mQueueDepth;    ///< The number of SRP updates currently waiting for their verification.
+    uint16_t mMaxQueueDepth; ///< The largest number of SRP updates waiting for their verification at once.
+} otSrpServerSignatureVerifierCounters;
+
 /**
  * Returns the domain authorized to the SRP server.
  *
@@ -424,6 +440,32 @@ const otSrpServerHost *otSrpServerGetNextHost(otInstance *aInstance, const otSrp
  */
 const otSrpServerResponseCounters *otSrpServerGetResponseCounters(otInstance *aInstance);
 
+/**
+ * Returns the signature verification counters of the SRP server.
+ *
+ * Is available when `OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE` is enabled.
+ *
+ * The average verification latency is `mTotalLatency / (mVerified + mFailed)`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns  A pointer to the signature verification counters of the SRP server.
+ *
+ */
+const otSrpServerSignatureVerifierCounters *otSrpServerGetSignatureVerifierCounters(otInstance *aInstance);
+
+/**
+ * Resets the signature verification counters of the SRP server.
+ *
+ * Is available when `OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE` is enabled.
+ *
+ * The current queue depth (`mQueueDepth`) is kept.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otSrpServerResetSignatureVerifierCounters(otInstance *aInstance);
+
 /**
  * Tells if the SRP service host has been deleted.
  *
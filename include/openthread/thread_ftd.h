@@ -69,6 +69,8 @@ typedef struct
     uint16_t     mFrameErrorRate;       ///< Frame error rate (0xffff->100%). Requires error tracking feature.
     uint16_t     mMessageErrorRate;     ///< (IPv6) msg error rate (0xffff->100%). Requires error tracking feature.
     uint16_t     mQueuedMessageCnt;     ///< Number of queued messages for the child.
+    uint16_t     mMaxQueuedMessageCnt;  ///< Maximum number of queued messages for the child (high-water mark).
+    uint32_t     mQueuedMessageAge;     ///< Time (in msec) since the oldest queued message for the child was queued.
     uint16_t     mSupervisionInterval;  ///< Supervision interval (in seconds).
     uint8_t      mVersion;              ///< MLE version
     bool         mRxOnWhenIdle : 1;     ///< rx-on-when-idle
@@ -124,6 +126,20 @@ typedef struct otCacheEntryIterator
     const void *mData[2]; ///< Opaque data used by the core implementation. Should not be changed by user.
 } otCacheEntryIterator;
 
+/**
+ * Represents the CSL transmit scheduler counters.
+ *
+ */
+typedef struct otCslTxCounters
+{
+    uint32_t mTxRequests;            ///< Number of CSL transmissions requested from the MAC.
+    uint32_t mMissedWindows;         ///< Number of CSL windows passed while a frame was pending for the child.
+    uint32_t mLateFramePreparations; ///< Number of frames prepared too late for the scheduled CSL window.
+    uint32_t mScheduleUpdates;       ///< Number of insertions, updates and removals of scheduled children.
+    uint32_t mScheduleSteps;         ///< Total number of entry moves performed by the schedule updates.
+    uint16_t mMaxScheduledChildren;  ///< Maximum number of children scheduled at the same time.
+} otCslTxCounters;
+
 /**
  * Gets the maximum number of children currently allowed.
  *
@@ -920,6 +936,30 @@ void otThreadGetNextHopAndPathCost(otInstance *aInstance,
                                    uint16_t   *aNextHopRloc16,
                                    uint8_t    *aPathCost);
 
+/**
+ * Gets the CSL transmit scheduler counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE`.
+ *
+ * The average scheduling cost can be derived as `mScheduleSteps / mScheduleUpdates`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the CSL transmit scheduler counters.
+ *
+ */
+const otCslTxCounters *otThreadGetCslTxCounters(otInstance *aInstance);
+
+/**
+ * Resets the CSL transmit scheduler counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetCslTxCounters(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -0,0 +1,168 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file defines the OpenThread Latency Trace API.
+ */
+
+#ifndef OPENTHREAD_TRACE_H_
+#define OPENTHREAD_TRACE_H_
+
+#include <openthread/error.h>
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-latency-trace
+ *
+ * @brief
+ *   This module includes functions for the hop-by-hop latency tracing of messages.
+ *
+ *   Sampled messages are timestamped at each stage of the forwarding path. When a traced message reaches a stage, the
+ *   time elapsed since the previous stage it reached is added to the latency statistics of the stage. The first stage
+ *   a message reaches (e.g., `OT_TRACE_STAGE_ENQUEUE` for a locally originated message, or `OT_TRACE_STAGE_RX` for the
+ *   first fragment of a received message) starts the trace and does not record a latency.
+ *
+ *   The functions in this module are available when `OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE` is enabled.
+ *
+ * @{
+ *
+ */
+
+/**
+ * Defines the stages of the forwarding path at which traced messages are timestamped.
+ *
+ */
+typedef enum otTraceStage
+{
+    OT_TRACE_STAGE_ENQUEUE        = 0, ///< Added to the send queue (since `Ip6::SendDatagram()` or reception).
+    OT_TRACE_STAGE_ROUTE_RESOLVED = 1, ///< Selected from the send queue with its next hop resolved.
+    OT_TRACE_STAGE_FRAME_PREPARED = 2, ///< A frame (or fragment) of the message prepared for the MAC.
+    OT_TRACE_STAGE_RADIO_START    = 3, ///< The frame handed to the radio (after CSMA-CA backoff).
+    OT_TRACE_STAGE_TX_DONE        = 4, ///< The frame transmission (including retries) is done.
+    OT_TRACE_STAGE_RX             = 5, ///< A frame of the message received (since the previous fragment).
+    OT_TRACE_STAGE_REASSEMBLED    = 6, ///< The message reassembled (since its last fragment).
+    OT_TRACE_STAGE_DELIVERED      = 7, ///< The message delivered to the upper layer or the host.
+} otTraceStage;
+
+#define OT_TRACE_NUM_STAGES 8 ///< Number of trace stages.
+
+#define OT_TRACE_HISTOGRAM_NUM_BINS 16 ///< Number of bins in a latency histogram.
+
+/**
+ * Represents the latency statistics of a trace stage.
+ *
+ * Bin `0` of `mHistogram` counts latencies below 128 microseconds. Bin `n` (for `n > 0`) counts latencies in the
+ * range `[64 << n, 128 << n)` microseconds, and the last bin also counts all the larger latencies.
+ *
+ */
+typedef struct otTraceStageStats
+{
+    uint32_t mCount;                                  ///< Number of latencies recorded.
+    uint32_t mMaxLatency;                             ///< Maximum latency (in microseconds).
+    uint64_t mTotalLatency;                           ///< Sum of all latencies (in microseconds).
+    uint32_t mHistogram[OT_TRACE_HISTOGRAM_NUM_BINS]; ///< Latency histogram.
+} otTraceStageStats;
+
+/**
+ * Sets the sampling interval of the latency trace.
+ *
+ * One message out of every @p aInterval messages (locally originated or received) is traced.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ * @param[in] aInterval  The sampling interval. 1 traces all messages, 0 disables tracing.
+ *
+ */
+void otTraceSetSampleInterval(otInstance *aInstance, uint16_t aInterval);
+
+/**
+ * Gets the sampling interval of the latency trace.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns The sampling interval (0 indicates tracing is disabled).
+ *
+ */
+uint16_t otTraceGetSampleInterval(otInstance *aInstance);
+
+/**
+ * Gets the number of messages traced so far.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns The number of traced messages.
+ *
+ */
+uint32_t otTraceGetNumTracedMessages(otInstance *aInstance);
+
+/**
+ * Gets the latency statistics of a trace stage.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aStage     The trace stage.
+ * @param[out] aStats     A pointer to return the statistics.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved the statistics.
+ * @retval OT_ERROR_INVALID_ARGS  @p aStage is not a valid stage.
+ *
+ */
+otError otTraceGetStageStats(otInstance *aInstance, otTraceStage aStage, otTraceStageStats *aStats);
+
+/**
+ * Resets the latency statistics of all stages and the number of traced messages.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otTraceResetStats(otInstance *aInstance);
+
+/**
+ * Converts a trace stage to a human-readable string.
+ *
+ * @param[in] aStage  The trace stage.
+ *
+ * @returns The string representation of @p aStage.
+ *
+ */
+const char *otTraceStageToString(otTraceStage aStage);
+
+/**
+ * @}
+ *
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_TRACE_H_
@@ -86,6 +86,9 @@
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE || OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
 #include <openthread/nat64.h>
 #endif
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+#include <openthread/trace.h>
+#endif
 #if OPENTHREAD_CONFIG_RADIO_STATS_ENABLE && (OPENTHREAD_FTD || OPENTHREAD_MTD)
 #include <openthread/radio_stats.h>
 #endif
@@ -1609,6 +1612,10 @@ template <> otError Interpreter::Process<Cmd("child")>(Arg aArgs[])
      * Age: 0
      * Link Quality In: 3
      * RSSI: -20
+     * Supervision Interval: 129
+     * Queued Messages: 1
+     * Max Queued Messages: 3
+     * Queued Message Age: 1250
      * Done
      * @endcode
      * @cparam child @ca{child-id}
@@ -1630,6 +1637,9 @@ template <> otError Interpreter::Process<Cmd("child")>(Arg aArgs[])
     OutputLine("Link Quality In: %u", childInfo.mLinkQualityIn);
     OutputLine("RSSI: %d", childInfo.mAverageRssi);
     OutputLine("Supervision Interval: %d", childInfo.mSupervisionInterval);
+    OutputLine("Queued Messages: %u", childInfo.mQueuedMessageCnt);
+    OutputLine("Max Queued Messages: %u", childInfo.mMaxQueuedMessageCnt);
+    OutputLine("Queued Message Age: %lu", ToUlong(childInfo.mQueuedMessageAge));
 
 exit:
     return error;
@@ -1987,6 +1997,9 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
     {
 #if OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
         OutputLine("br");
+#endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+        OutputLine("csl");
 #endif
         OutputLine("ip");
         OutputLine("mac");
@@ -2036,6 +2049,70 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
             error = OT_ERROR_INVALID_ARGS;
         }
     }
+#endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+    /**
+     * @cli counters csl
+     * @code
+     * counters csl
+     * TxRequests: 12
+     * MissedWindows: 1
+     * LateFramePreparations: 0
+     * ScheduleUpdates: 30
+     * ScheduleSteps: 41
+     * MaxScheduledChildren: 3
+     * Done
+     * @endcode
+     * @cparam counters @ca{csl}
+     * @par api_copy
+     * #otThreadGetCslTxCounters
+     */
+    else if (aArgs[0] == "csl")
+    {
+        if (aArgs[1].IsEmpty())
+        {
+            struct CslTxCounterName
+            {
+                const uint32_t otCslTxCounters::*mValuePtr;
+                const char                      *mName;
+            };
+
+            static const CslTxCounterName kCounterNames[] = {
+                {&otCslTxCounters::mTxRequests, "TxRequests"},
+                {&otCslTxCounters::mMissedWindows, "MissedWindows"},
+                {&otCslTxCounters::mLateFramePreparations, "LateFramePreparations"},
+                {&otCslTxCounters::mScheduleUpdates, "ScheduleUpdates"},
+                {&otCslTxCounters::mScheduleSteps, "ScheduleSteps"},
+            };
+
+            const otCslTxCounters *cslTxCounters = otThreadGetCslTxCounters(GetInstancePtr());
+
+            for (const CslTxCounterName &counter : kCounterNames)
+            {
+                OutputLine("%s: %lu", counter.mName, ToUlong(cslTxCounters->*counter.mValuePtr));
+            }
+
+            OutputLine("MaxScheduledChildren: %u", cslTxCounters->mMaxScheduledChildren);
+        }
+        /**
+         * @cli counters csl reset
+         * @code
+         * counters csl reset
+         * Done
+         * @endcode
+         * @cparam counters @ca{csl} reset
+         * @par api_copy
+         * #otThreadResetCslTxCounters
+         */
+        else if ((aArgs[1] == "reset") && aArgs[2].IsEmpty())
+        {
+            otThreadResetCslTxCounters(GetInstancePtr());
+        }
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+    }
 #endif
     /**
      * @cli counters (mac)
@@ -2055,6 +2132,11 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
      *    TxRetry: 0
      *    TxErrCca: 0
      *    TxErrBusyChannel: 0
+     *    TxErrAbort: 0
+     *    TxDirectMaxRetryExpiry: 0
+     *    TxIndirectMaxRetryExpiry: 0
+     *    TxHeaderTemplateHit: 8
+     *    TxHeaderTemplateMiss: 2
      * RxTotal: 2
      *    RxUnicast: 1
      *    RxBroadcast: 1
@@ -2105,6 +2187,8 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
                 {&otMacCounters::mTxErrAbort, "TxErrAbort"},
                 {&otMacCounters::mTxDirectMaxRetryExpiry, "TxDirectMaxRetryExpiry"},
                 {&otMacCounters::mTxIndirectMaxRetryExpiry, "TxIndirectMaxRetryExpiry"},
+                {&otMacCounters::mTxHeaderTemplateHit, "TxHeaderTemplateHit"},
+                {&otMacCounters::mTxHeaderTemplateMiss, "TxHeaderTemplateMiss"},
             };
 
             static const MacCounterName kRxCounterNames[] = {
@@ -7135,6 +7219,143 @@ template <> otError Interpreter::Process<Cmd("timeinqueue")>(Arg aArgs[])
 }
 #endif // OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+template <> otError Interpreter::Process<Cmd("trace")>(Arg aArgs[])
+{
+    otError           error = OT_ERROR_NONE;
+    otTraceStageStats stats;
+
+    /**
+     * @cli trace
+     * @code
+     * trace
+     * Traced messages: 42
+     * | Stage         | Count    | Avg (us) | Max (us) |
+     * +---------------+----------+----------+----------+
+     * | Enqueue       |       40 |      312 |     1021 |
+     * | RouteResolved |       42 |      187 |      998 |
+     * | FramePrepared |       51 |       95 |      512 |
+     * | RadioStart    |       51 |     1804 |     5120 |
+     * | TxDone        |       51 |     2210 |    18200 |
+     * | Rx            |        3 |     6980 |     7315 |
+     * | Reassembled   |       22 |      124 |      402 |
+     * | Delivered     |       20 |       48 |      113 |
+     * Done
+     * @endcode
+     * @par
+     * Prints the number of traced messages and, for each stage of the forwarding path, the number of latencies
+     * recorded with their average and maximum (the time a traced message took to reach the stage from its previous
+     * stage).
+     * @sa otTraceGetStageStats
+     */
+    if (aArgs[0].IsEmpty())
+    {
+        static const char *const kTraceTableTitles[]       = {"Stage", "Count", "Avg (us)", "Max (us)"};
+        static const uint8_t     kTraceTableColumnWidths[] = {15, 10, 10, 10};
+
+        OutputLine("Traced messages: %lu", ToUlong(otTraceGetNumTracedMessages(GetInstancePtr())));
+        OutputTableHeader(kTraceTableTitles, kTraceTableColumnWidths);
+
+        for (uint8_t stage = 0; stage < OT_TRACE_NUM_STAGES; stage++)
+        {
+            SuccessOrExit(error = otTraceGetStageStats(GetInstancePtr(), static_cast<otTraceStage>(stage), &stats));
+
+            OutputLine("| %-13s | %8lu | %8lu | %8lu |", otTraceStageToString(static_cast<otTraceStage>(stage)),
+                       ToUlong(stats.mCount),
+                       ToUlong((stats.mCount == 0) ? 0 : static_cast<uint32_t>(stats.mTotalLatency / stats.mCount)),
+                       ToUlong(stats.mMaxLatency));
+        }
+    }
+    /**
+     * @cli trace histogram
+     * @code
+     * trace histogram 3
+     * | Min (us) | Max (us) | Count    |
+     * +----------+----------+----------+
+     * |        0 |      127 |        0 |
+     * |      128 |      255 |        2 |
+     * |      256 |      511 |        9 |
+     * ...
+     * |  2097152 |      inf |        0 |
+     * Done
+     * @endcode
+     * @cparam trace histogram @ca{stage}
+     * `stage` is the stage index, 0 (Enqueue) to 7 (Delivered), in the order of the `trace` table.
+     * @par
+     * Prints the latency histogram of a stage.
+     * @sa otTraceGetStageStats
+     */
+    else if (aArgs[0] == "histogram")
+    {
+        static const char *const kHistogramTableTitles[]       = {"Min (us)", "Max (us)", "Count"};
+        static const uint8_t     kHistogramTableColumnWidths[] = {10, 10, 10};
+
+        uint8_t stage;
+
+        SuccessOrExit(error = aArgs[1].ParseAsUint8(stage));
+        SuccessOrExit(error = otTraceGetStageStats(GetInstancePtr(), static_cast<otTraceStage>(stage), &stats));
+
+        OutputTableHeader(kHistogramTableTitles, kHistogramTableColumnWidths);
+
+        for (uint8_t bin = 0; bin < OT_TRACE_HISTOGRAM_NUM_BINS; bin++)
+        {
+            OutputFormat("| %8lu | ", ToUlong((bin == 0) ? 0 : (64UL << bin)));
+
+            if (bin < OT_TRACE_HISTOGRAM_NUM_BINS - 1)
+            {
+                OutputFormat("%8lu", ToUlong((128UL << bin) - 1));
+            }
+            else
+            {
+                OutputFormat("%8s", "inf");
+            }
+
+            OutputLine(" | %8lu |", ToUlong(stats.mHistogram[bin]));
+        }
+    }
+    /**
+     * @cli trace sample
+     * @code
+     * trace sample
+     * 16
+     * Done
+     * @endcode
+     * @code
+     * trace sample 1
+     * Done
+     * @endcode
+     * @cparam trace sample [@ca{interval}]
+     * One out of every `interval` messages is traced. 0 disables tracing.
+     * @par api_copy
+     * #otTraceSetSampleInterval
+     */
+    else if (aArgs[0] == "sample")
+    {
+        error = ProcessGetSet(aArgs + 1, otTraceGetSampleInterval, otTraceSetSampleInterval);
+    }
+    /**
+     * @cli trace reset
+     * @code
+     * trace reset
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otTraceResetStats
+     */
+    else if (aArgs[0] == "reset")
+    {
+        otTraceResetStats(GetInstancePtr());
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+
 template <> otError Interpreter::Process<Cmd("dataset")>(Arg aArgs[]) { return mDataset.Process(aArgs); }
 
 template <> otError Interpreter::Process<Cmd("txpower")>(Arg aArgs[])
@@ -7517,6 +7738,13 @@ template <> otError Interpreter::Process<Cmd("networkdiagnostic")>(Arg aArgs[])
         SetCommandTimeout(kNetworkDiagnosticTimeoutMsecs);
         error = OT_ERROR_PENDING;
     }
+    else if (aArgs[0] == "query")
+    {
+        SuccessOrExit(error = otThreadSendDiagnosticQuery(GetInstancePtr(), &address, tlvTypes, count,
+                                                          &Interpreter::HandleDiagnosticGetResponse, this));
+        SetCommandTimeout(kNetworkDiagnosticTimeoutMsecs);
+        error = OT_ERROR_PENDING;
+    }
     else if (aArgs[0] == "reset")
     {
         IgnoreError(otThreadSendDiagnosticReset(GetInstancePtr(), &address, tlvTypes, count));
@@ -8170,6 +8398,9 @@ otError Interpreter::ProcessCommand(Arg aArgs[])
 #if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
         CmdEntry("timeinqueue"),
 #endif
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+        CmdEntry("trace"),
+#endif
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
         CmdEntry("trel"),
 #endif
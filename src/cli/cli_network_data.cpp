@@ -173,6 +173,59 @@ void NetworkData::OutputService(const otServiceConfig &aConfig)
     OutputLine(" %04x", aConfig.mServerConfig.mRloc16);
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+template <> otError NetworkData::Process<Cmd("delta")>(Arg aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    /**
+     * @cli netdata delta
+     * @code
+     * netdata delta
+     * Deltas Sent: 12
+     * Full Fallbacks: 3
+     * Delta Bytes Sent: 180
+     * Bytes Saved: 1650
+     * Deltas Applied: 4
+     * Delta Failures: 0
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otNetDataGetDeltaCounters
+     */
+    if (aArgs[0].IsEmpty())
+    {
+        const otNetDataDeltaCounters *counters = otNetDataGetDeltaCounters(GetInstancePtr());
+
+        OutputLine("Deltas Sent: %lu", ToUlong(counters->mDeltasSent));
+        OutputLine("Full Fallbacks: %lu", ToUlong(counters->mFullFallbacks));
+        OutputLine("Delta Bytes Sent: %lu", ToUlong(counters->mDeltaBytesSent));
+        OutputLine("Bytes Saved: %lu", ToUlong(counters->mBytesSaved));
+        OutputLine("Deltas Applied: %lu", ToUlong(counters->mDeltasApplied));
+        OutputLine("Delta Failures: %lu", ToUlong(counters->mDeltaFailures));
+    }
+    /**
+     * @cli netdata delta reset
+     * @code
+     * netdata delta reset
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otNetDataResetDeltaCounters
+     */
+    else if (aArgs[0] == "reset")
+    {
+        otNetDataResetDeltaCounters(GetInstancePtr());
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+    return error;
+}
+#endif
+
 /**
  * @cli netdata length
  * @code
@@ -876,6 +929,9 @@ otError NetworkData::Process(Arg aArgs[])
     }
 
     static constexpr Command kCommands[] = {
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+        CmdEntry("delta"),
+#endif
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
         CmdEntry("full"),
 #endif
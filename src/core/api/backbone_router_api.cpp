@@ -49,4 +49,30 @@ otError otBackboneRouterGetPrimary(otInstance *aInstance, otBackboneRouterConfig
     return AsCoreType(aInstance).Get<BackboneRouter::Leader>().GetConfig(*aConfig);
 }
 
+#if OPENTHREAD_CONFIG_MLR_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE)
+const otBackboneRouterRegistrationCounters *otBackboneRouterGetMlrCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<MlrManager>().GetCounters();
+}
+#endif
+
+#if OPENTHREAD_CONFIG_DUA_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE)
+const otBackboneRouterRegistrationCounters *otBackboneRouterGetDuaCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<DuaManager>().GetCounters();
+}
+#endif
+
+void otBackboneRouterResetRegistrationCounters(otInstance *aInstance)
+{
+#if OPENTHREAD_CONFIG_MLR_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE)
+    AsCoreType(aInstance).Get<MlrManager>().ResetCounters();
+#endif
+#if OPENTHREAD_CONFIG_DUA_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE)
+    AsCoreType(aInstance).Get<DuaManager>().ResetCounters();
+#endif
+
+    OT_UNUSED_VARIABLE(aInstance);
+}
+
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
@@ -50,6 +50,29 @@ otError otCoapSecureStart(otInstance *aInstance, uint16_t aPort)
     return AsCoreType(aInstance).GetApplicationCoapSecure().Start(aPort);
 }
 
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+otError otCoapSecureStartServer(otInstance *aInstance, uint16_t aPort)
+{
+    return AsCoreType(aInstance).GetApplicationCoapSecure().StartServer(aPort);
+}
+
+void otCoapSecureGetServerInfo(otInstance *aInstance, otCoapSecureServerInfo *aInfo)
+{
+    const MeshCoP::DtlsServer           &server   = AsCoreType(aInstance).GetApplicationCoapSecure().GetDtlsServer();
+    const MeshCoP::DtlsServer::Counters &counters = server.GetCounters();
+
+    AssertPointerIsNotNull(aInfo);
+
+    aInfo->mMaxSessions         = MeshCoP::DtlsServer::kMaxSessions;
+    aInfo->mNumSessions         = server.GetNumSessions();
+    aInfo->mSessionSize         = MeshCoP::DtlsServer::GetSessionSize();
+    aInfo->mHelloVerifyRequests = counters.mHelloVerifyRequests;
+    aInfo->mSessionsStarted     = counters.mSessionsStarted;
+    aInfo->mSessionsConnected   = counters.mSessionsConnected;
+    aInfo->mSessionsRejected    = counters.mSessionsRejected;
+}
+#endif
+
 #ifdef MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
 void otCoapSecureSetCertificate(otInstance    *aInstance,
                                 const uint8_t *aX509Cert,
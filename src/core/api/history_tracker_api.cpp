@@ -94,6 +94,35 @@ const otHistoryTrackerMessageInfo *otHistoryTrackerIterateTxHistory(otInstance
     return AsCoreType(aInstance).Get<Utils::HistoryTracker>().IterateTxHistory(AsCoreType(aIterator), *aEntryAge);
 }
 
+const otHistoryTrackerMessageInfo *otHistoryTrackerQueryRxHistory(otInstance                          *aInstance,
+                                                                  otHistoryTrackerIterator            *aIterator,
+                                                                  const otHistoryTrackerMessageFilter *aFilter,
+                                                                  uint32_t                            *aEntryAge)
+{
+    AssertPointerIsNotNull(aEntryAge);
+
+    return AsCoreType(aInstance).Get<Utils::HistoryTracker>().QueryRxHistory(AsCoreType(aIterator),
+                                                                             AsCoreType(aFilter), *aEntryAge);
+}
+
+const otHistoryTrackerMessageInfo *otHistoryTrackerQueryTxHistory(otInstance                          *aInstance,
+                                                                  otHistoryTrackerIterator            *aIterator,
+                                                                  const otHistoryTrackerMessageFilter *aFilter,
+                                                                  uint32_t                            *aEntryAge)
+{
+    AssertPointerIsNotNull(aEntryAge);
+
+    return AsCoreType(aInstance).Get<Utils::HistoryTracker>().QueryTxHistory(AsCoreType(aIterator),
+                                                                             AsCoreType(aFilter), *aEntryAge);
+}
+
+void otHistoryTrackerSetMessageSpillCallback(otInstance                          *aInstance,
+                                             otHistoryTrackerMessageSpillCallback aCallback,
+                                             void                                *aContext)
+{
+    AsCoreType(aInstance).Get<Utils::HistoryTracker>().SetMessageSpillCallback(aCallback, aContext);
+}
+
 const otHistoryTrackerNeighborInfo *otHistoryTrackerIterateNeighborHistory(otInstance               *aInstance,
                                                                            otHistoryTrackerIterator *aIterator,
                                                                            uint32_t                 *aEntryAge)
@@ -100,6 +100,11 @@ void otNat64GetErrorCounters(otInstance *aInstance, otNat64ErrorCounters *aCount
     AsCoreType(aInstance).Get<Nat64::Translator>().GetErrorCounters(AsCoreType(aCounters));
 }
 
+void otNat64GetMappingCounters(otInstance *aInstance, otNat64MappingCounters *aCounters)
+{
+    AsCoreType(aInstance).Get<Nat64::Translator>().GetMappingCounters(AsCoreType(aCounters));
+}
+
 otError otNat64GetCidr(otInstance *aInstance, otIp4Cidr *aCidr)
 {
     return AsCoreType(aInstance).Get<Nat64::Translator>().GetIp4Cidr(AsCoreType(aCidr));
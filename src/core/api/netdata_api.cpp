@@ -64,6 +64,18 @@ void otNetDataResetMaxLength(otInstance *aInstance)
     AsCoreType(aInstance).Get<NetworkData::Leader>().ResetMaxLength();
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+const otNetDataDeltaCounters *otNetDataGetDeltaCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<NetworkData::DeltaManager>().GetCounters();
+}
+
+void otNetDataResetDeltaCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<NetworkData::DeltaManager>().ResetCounters();
+}
+#endif
+
 otError otNetDataGetNextOnMeshPrefix(otInstance            *aInstance,
                                      otNetworkDataIterator *aIterator,
                                      otBorderRouterConfig  *aConfig)
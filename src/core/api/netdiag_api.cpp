@@ -52,6 +52,13 @@ otError otThreadGetNextDiagnosticTlv(const otMessage       *aMessage,
     return NetworkDiagnostic::Client::GetNextDiagTlv(AsCoapMessage(aMessage), *aIterator, *aNetworkDiagTlv);
 }
 
+otError otThreadGetDiagnosticAnswerInfo(const otMessage *aMessage, otNetworkDiagAnswerInfo *aAnswerInfo)
+{
+    AssertPointerIsNotNull(aAnswerInfo);
+
+    return NetworkDiagnostic::Client::GetAnswerInfo(AsCoapMessage(aMessage), *aAnswerInfo);
+}
+
 otError otThreadSendDiagnosticGet(otInstance                    *aInstance,
                                   const otIp6Address            *aDestination,
                                   const uint8_t                  aTlvTypes[],
@@ -63,6 +70,17 @@ otError otThreadSendDiagnosticGet(otInstance                    *aInstance,
         AsCoreType(aDestination), aTlvTypes, aCount, aCallback, aCallbackContext);
 }
 
+otError otThreadSendDiagnosticQuery(otInstance                    *aInstance,
+                                    const otIp6Address            *aDestination,
+                                    const uint8_t                  aTlvTypes[],
+                                    uint8_t                        aCount,
+                                    otReceiveDiagnosticGetCallback aCallback,
+                                    void                          *aCallbackContext)
+{
+    return AsCoreType(aInstance).Get<NetworkDiagnostic::Client>().SendDiagnosticQuery(
+        AsCoreType(aDestination), aTlvTypes, aCount, aCallback, aCallbackContext);
+}
+
 otError otThreadSendDiagnosticReset(otInstance         *aInstance,
                                     const otIp6Address *aDestination,
                                     const uint8_t       aTlvTypes[],
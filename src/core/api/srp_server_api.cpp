@@ -135,6 +135,18 @@ const otSrpServerResponseCounters *otSrpServerGetResponseCounters(otInstance *aI
     return AsCoreType(aInstance).Get<Srp::Server>().GetResponseCounters();
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+const otSrpServerSignatureVerifierCounters *otSrpServerGetSignatureVerifierCounters(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Srp::Server>().GetSignatureVerifierCounters();
+}
+
+void otSrpServerResetSignatureVerifierCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<Srp::Server>().ResetSignatureVerifierCounters();
+}
+#endif
+
 bool otSrpServerHostIsDeleted(const otSrpServerHost *aHost) { return AsCoreType(aHost).IsDeleted(); }
 
 const char *otSrpServerHostGetFullName(const otSrpServerHost *aHost) { return AsCoreType(aHost).GetFullName(); }
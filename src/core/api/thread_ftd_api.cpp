@@ -426,4 +426,13 @@ void otThreadGetNextHopAndPathCost(otInstance *aInstance,
         (aPathCost != nullptr) ? *aPathCost : pathcost);
 }
 
+#if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+const otCslTxCounters *otThreadGetCslTxCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<CslTxScheduler>().GetCounters();
+}
+
+void otThreadResetCslTxCounters(otInstance *aInstance) { AsCoreType(aInstance).Get<CslTxScheduler>().ResetCounters(); }
+#endif
+
 #endif // OPENTHREAD_FTD
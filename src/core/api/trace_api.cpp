@@ -0,0 +1,103 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the Latency Trace public APIs.
+ */
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+
+#include <openthread/trace.h>
+
+#include "common/as_core_type.hpp"
+#include "common/code_utils.hpp"
+#include "common/locator_getters.hpp"
+#include "utils/latency_tracer.hpp"
+
+using namespace ot;
+
+void otTraceSetSampleInterval(otInstance *aInstance, uint16_t aInterval)
+{
+    AsCoreType(aInstance).Get<Utils::LatencyTracer>().SetSampleInterval(aInterval);
+}
+
+uint16_t otTraceGetSampleInterval(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Utils::LatencyTracer>().GetSampleInterval();
+}
+
+uint32_t otTraceGetNumTracedMessages(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Utils::LatencyTracer>().GetNumTracedMessages();
+}
+
+otError otTraceGetStageStats(otInstance *aInstance, otTraceStage aStage, otTraceStageStats *aStats)
+{
+    Error error = kErrorNone;
+
+    AssertPointerIsNotNull(aStats);
+    VerifyOrExit(aStage < OT_TRACE_NUM_STAGES, error = kErrorInvalidArgs);
+
+    *aStats = AsCoreType(aInstance).Get<Utils::LatencyTracer>().GetStageStats(
+        static_cast<Utils::LatencyTracer::Stage>(aStage));
+
+exit:
+    return error;
+}
+
+void otTraceResetStats(otInstance *aInstance) { AsCoreType(aInstance).Get<Utils::LatencyTracer>().ResetStats(); }
+
+const char *otTraceStageToString(otTraceStage aStage)
+{
+    static const char *const kStageStrings[] = {
+        "Enqueue",       // (0) OT_TRACE_STAGE_ENQUEUE
+        "RouteResolved", // (1) OT_TRACE_STAGE_ROUTE_RESOLVED
+        "FramePrepared", // (2) OT_TRACE_STAGE_FRAME_PREPARED
+        "RadioStart",    // (3) OT_TRACE_STAGE_RADIO_START
+        "TxDone",        // (4) OT_TRACE_STAGE_TX_DONE
+        "Rx",            // (5) OT_TRACE_STAGE_RX
+        "Reassembled",   // (6) OT_TRACE_STAGE_REASSEMBLED
+        "Delivered",     // (7) OT_TRACE_STAGE_DELIVERED
+    };
+
+    static_assert(OT_TRACE_STAGE_ENQUEUE == 0, "OT_TRACE_STAGE_ENQUEUE value is incorrect");
+    static_assert(OT_TRACE_STAGE_ROUTE_RESOLVED == 1, "OT_TRACE_STAGE_ROUTE_RESOLVED value is incorrect");
+    static_assert(OT_TRACE_STAGE_FRAME_PREPARED == 2, "OT_TRACE_STAGE_FRAME_PREPARED value is incorrect");
+    static_assert(OT_TRACE_STAGE_RADIO_START == 3, "OT_TRACE_STAGE_RADIO_START value is incorrect");
+    static_assert(OT_TRACE_STAGE_TX_DONE == 4, "OT_TRACE_STAGE_TX_DONE value is incorrect");
+    static_assert(OT_TRACE_STAGE_RX == 5, "OT_TRACE_STAGE_RX value is incorrect");
+    static_assert(OT_TRACE_STAGE_REASSEMBLED == 6, "OT_TRACE_STAGE_REASSEMBLED value is incorrect");
+    static_assert(OT_TRACE_STAGE_DELIVERED == 7, "OT_TRACE_STAGE_DELIVERED value is incorrect");
+
+    return (aStage < OT_ARRAY_LENGTH(kStageStrings)) ? kStageStrings[aStage] : "Unknown";
+}
+
+#endif // OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
@@ -37,6 +37,7 @@
 
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
+#include "common/random.hpp"
 
 namespace ot {
 namespace BackboneRouter {
@@ -272,6 +273,35 @@ bool Leader::IsDomainUnicast(const Ip6::Address &aAddress) const
     return HasDomainPrefix() && aAddress.MatchesPrefix(mDomainPrefix);
 }
 
+uint16_t Leader::GetRetryDelay(uint8_t aFailureCount) const
+{
+    uint16_t delay = mConfig.mReregistrationDelay;
+
+#if OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+    if (aFailureCount > 1)
+    {
+        static constexpr uint8_t kMaxBackoffShift = 15;
+
+        uint32_t backoff = Max<uint16_t>(delay, 1);
+
+        backoff <<= Min<uint8_t>(aFailureCount - 1, kMaxBackoffShift);
+        backoff = Max<uint32_t>(Min<uint32_t>(backoff, kMaxRegistrationBackoff), delay);
+
+        // Pick the delay in the upper half so that the retries of
+        // many devices spread out as the backoff grows.
+        delay = static_cast<uint16_t>(Random::NonCrypto::GetUint32InRange(backoff / 2 + 1, backoff + 1));
+    }
+    else
+#else
+    OT_UNUSED_VARIABLE(aFailureCount);
+#endif
+    {
+        delay = (delay > 1) ? Random::NonCrypto::GetUint16InRange(1, delay) : 1;
+    }
+
+    return delay;
+}
+
 } // namespace BackboneRouter
 } // namespace ot
 
@@ -43,9 +43,11 @@
 
 #include "coap/coap.hpp"
 #include "coap/coap_message.hpp"
+#include "common/clearable.hpp"
 #include "common/locator.hpp"
 #include "common/log.hpp"
 #include "common/non_copyable.hpp"
+#include "common/num_utils.hpp"
 #include "net/ip6_address.hpp"
 
 namespace ot {
@@ -66,6 +68,53 @@ static_assert(kDefaultMlrTimeout >= kMinMlrTimeout && kDefaultMlrTimeout <= kMax
 static_assert(kMaxMlrTimeout * 1000 > kMaxMlrTimeout, "SecToMsec(kMaxMlrTimeout) will overflow");
 static_assert(kParentAggregateDelay > 1, "kParentAggregateDelay should be larger than 1 second");
 
+#if OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+constexpr uint16_t kMaxRegistrationBackoff = OPENTHREAD_CONFIG_BBR_REGISTRATION_MAX_BACKOFF; ///< Max retry delay (sec).
+
+static_assert(kMaxRegistrationBackoff > 0, "OPENTHREAD_CONFIG_BBR_REGISTRATION_MAX_BACKOFF must be non-zero");
+#endif
+
+/**
+ * Represents the counters of the DUA or MLR registrations sent to the Primary Backbone Router.
+ *
+ */
+class RegistrationCounters : public otBackboneRouterRegistrationCounters, public Clearable<RegistrationCounters>
+{
+public:
+    /**
+     * Updates the counters for a registration request sent.
+     *
+     * @param[in] aNumAddresses  The number of addresses carried in the request.
+     *
+     */
+    void HandleRequestSent(uint8_t aNumAddresses)
+    {
+        mRequests++;
+        mAddresses += aNumAddresses;
+    }
+
+    /**
+     * Updates the counters for the outcome of a registration request.
+     *
+     * @param[in] aSuccess  Whether or not the registration succeeded.
+     * @param[in] aLatency  The time (in msec) from queuing the oldest registration of the request until its response.
+     *
+     */
+    void HandleResponse(bool aSuccess, uint32_t aLatency)
+    {
+        if (aSuccess)
+        {
+            mSuccesses++;
+            mTotalLatency += aLatency;
+            mMaxLatency = Max(mMaxLatency, aLatency);
+        }
+        else
+        {
+            mFailures++;
+        }
+    }
+};
+
 /**
  * Represents Domain Prefix changes.
  *
@@ -187,6 +236,20 @@ public:
      */
     bool IsDomainUnicast(const Ip6::Address &aAddress) const;
 
+    /**
+     * Returns a random delay to retry a DUA or MLR registration after a failure.
+     *
+     * The delay is chosen in [1, Reregistration Delay) as required by Thread 1.2 Specification 5.24.2.3. With
+     * `OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE`, each further consecutive failure doubles the delay (up to
+     * `OPENTHREAD_CONFIG_BBR_REGISTRATION_MAX_BACKOFF`), which is then chosen in its upper half.
+     *
+     * @param[in] aFailureCount  The number of consecutive failures.
+     *
+     * @returns The delay in seconds.
+     *
+     */
+    uint16_t GetRetryDelay(uint8_t aFailureCount) const;
+
 private:
     void UpdateBackboneRouterPrimary(void);
     void UpdateDomainPrefixConfig(void);
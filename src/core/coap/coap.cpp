@@ -73,15 +73,18 @@ void CoapBase::ClearRequests(const Ip6::Address &aAddress) { ClearRequests(&aAdd
 
 void CoapBase::ClearRequests(const Ip6::Address *aAddress)
 {
-    for (Message &message : mPendingRequests)
+    for (MessageQueue &requests : mPendingRequests)
     {
-        Metadata metadata;
+        for (Message &message : requests)
+        {
+            Metadata metadata;
 
-        metadata.ReadFrom(message);
+            metadata.ReadFrom(message);
 
-        if ((aAddress == nullptr) || (metadata.mSourceAddress == *aAddress))
-        {
-            FinalizeCoapTransaction(message, metadata, nullptr, nullptr, kErrorAbort);
+            if ((aAddress == nullptr) || (metadata.mSourceAddress == *aAddress))
+            {
+                FinalizeCoapTransaction(message, metadata, nullptr, nullptr, kErrorAbort);
+            }
         }
     }
 }
@@ -469,50 +472,53 @@ void CoapBase::HandleRetransmissionTimer(void)
     Metadata         metadata;
     Ip6::MessageInfo messageInfo;
 
-    for (Message &message : mPendingRequests)
+    for (MessageQueue &requests : mPendingRequests)
     {
-        metadata.ReadFrom(message);
-
-        if (now >= metadata.mNextTimerShot)
+        for (Message &message : requests)
         {
-#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
-            if (message.IsRequest() && metadata.mObserve && metadata.mAcknowledged)
+            metadata.ReadFrom(message);
+
+            if (now >= metadata.mNextTimerShot)
             {
-                // This is a RFC7641 subscription.  Do not time out.
-                continue;
-            }
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+                if (message.IsRequest() && metadata.mObserve && metadata.mAcknowledged)
+                {
+                    // This is a RFC7641 subscription.  Do not time out.
+                    continue;
+                }
 #endif
 
-            if (!metadata.mConfirmable || (metadata.mRetransmissionsRemaining == 0))
-            {
-                // No expected response or acknowledgment.
-                FinalizeCoapTransaction(message, metadata, nullptr, nullptr, kErrorResponseTimeout);
-                continue;
-            }
+                if (!metadata.mConfirmable || (metadata.mRetransmissionsRemaining == 0))
+                {
+                    // No expected response or acknowledgment.
+                    FinalizeCoapTransaction(message, metadata, nullptr, nullptr, kErrorResponseTimeout);
+                    continue;
+                }
 
-            // Increment retransmission counter and timer.
-            metadata.mRetransmissionsRemaining--;
-            metadata.mRetransmissionTimeout *= 2;
-            metadata.mNextTimerShot = now + metadata.mRetransmissionTimeout;
-            metadata.UpdateIn(message);
+                // Increment retransmission counter and timer.
+                metadata.mRetransmissionsRemaining--;
+                metadata.mRetransmissionTimeout *= 2;
+                metadata.mNextTimerShot = now + metadata.mRetransmissionTimeout;
+                metadata.UpdateIn(message);
 
-            // Retransmit
-            if (!metadata.mAcknowledged)
-            {
-                messageInfo.SetPeerAddr(metadata.mDestinationAddress);
-                messageInfo.SetPeerPort(metadata.mDestinationPort);
-                messageInfo.SetSockAddr(metadata.mSourceAddress);
+                // Retransmit
+                if (!metadata.mAcknowledged)
+                {
+                    messageInfo.SetPeerAddr(metadata.mDestinationAddress);
+                    messageInfo.SetPeerPort(metadata.mDestinationPort);
+                    messageInfo.SetSockAddr(metadata.mSourceAddress);
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-                messageInfo.SetHopLimit(metadata.mHopLimit);
-                messageInfo.SetIsHostInterface(metadata.mIsHostInterface);
+                    messageInfo.SetHopLimit(metadata.mHopLimit);
+                    messageInfo.SetIsHostInterface(metadata.mIsHostInterface);
 #endif
-                messageInfo.SetMulticastLoop(metadata.mMulticastLoop);
+                    messageInfo.SetMulticastLoop(metadata.mMulticastLoop);
 
-                SendCopy(message, messageInfo);
+                    SendCopy(message, messageInfo);
+                }
             }
-        }
 
-        nextTime = Min(nextTime, metadata.mNextTimerShot);
+            nextTime = Min(nextTime, metadata.mNextTimerShot);
+        }
     }
 
     if (nextTime < now.GetDistantFuture())
@@ -540,14 +546,17 @@ Error CoapBase::AbortTransaction(ResponseHandler aHandler, void *aContext)
     Error    error = kErrorNotFound;
     Metadata metadata;
 
-    for (Message &message : mPendingRequests)
+    for (MessageQueue &requests : mPendingRequests)
     {
-        metadata.ReadFrom(message);
-
-        if (metadata.mResponseHandler == aHandler && metadata.mResponseContext == aContext)
+        for (Message &message : requests)
         {
-            FinalizeCoapTransaction(message, metadata, nullptr, nullptr, kErrorAbort);
-            error = kErrorNone;
+            metadata.ReadFrom(message);
+
+            if (metadata.mResponseHandler == aHandler && metadata.mResponseContext == aContext)
+            {
+                FinalizeCoapTransaction(message, metadata, nullptr, nullptr, kErrorAbort);
+                error = kErrorNone;
+            }
         }
     }
 
@@ -565,7 +574,7 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopy
 
     mRetransmissionTimer.FireAtIfEarlier(aMetadata.mNextTimerShot);
 
-    mPendingRequests.Enqueue(*messageCopy);
+    mPendingRequests.GetPartition(GetTokenKey(*messageCopy)).Enqueue(*messageCopy);
 
 exit:
     FreeAndNullMessageOnError(messageCopy, error);
@@ -574,9 +583,9 @@ exit:
 
 void CoapBase::DequeueMessage(Message &aMessage)
 {
-    mPendingRequests.Dequeue(aMessage);
+    mPendingRequests.GetPartition(GetTokenKey(aMessage)).Dequeue(aMessage);
 
-    if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == nullptr))
+    if (mRetransmissionTimer.IsRunning() && mPendingRequests.IsEmpty())
     {
         mRetransmissionTimer.Stop();
     }
@@ -1001,13 +1010,62 @@ exit:
     }
 }
 
+uint16_t CoapBase::GetTokenKey(const Message &aMessage)
+{
+    // Tokens are typically random or sequential, either way
+    // hashing their bytes spreads the requests evenly over the
+    // partitions.
+
+    uint16_t       key   = 0;
+    const uint8_t *token = aMessage.GetToken();
+
+    for (uint8_t i = 0; i < aMessage.GetTokenLength(); i++)
+    {
+        key = static_cast<uint16_t>(key * 31 + token[i]);
+    }
+
+    return key;
+}
+
 Message *CoapBase::FindRelatedRequest(const Message          &aResponse,
                                       const Ip6::MessageInfo &aMessageInfo,
                                       Metadata               &aMetadata)
 {
     Message *request = nullptr;
 
-    for (Message &message : mPendingRequests)
+    if (aResponse.IsEmpty())
+    {
+        // An empty message (e.g. the ACK preceding a separate
+        // response, or a reset) carries no token, so all
+        // partitions are searched for its Message ID.
+
+        for (MessageQueue &requests : mPendingRequests)
+        {
+            request = FindRelatedRequest(requests, aResponse, aMessageInfo, aMetadata);
+            VerifyOrExit(request == nullptr);
+        }
+    }
+    else
+    {
+        // A response, piggybacked or separate, echoes the token of
+        // its request, which selects the partition.
+
+        request = FindRelatedRequest(mPendingRequests.GetPartition(GetTokenKey(aResponse)), aResponse, aMessageInfo,
+                                     aMetadata);
+    }
+
+exit:
+    return request;
+}
+
+Message *CoapBase::FindRelatedRequest(MessageQueue           &aRequests,
+                                      const Message          &aResponse,
+                                      const Ip6::MessageInfo &aMessageInfo,
+                                      Metadata               &aMetadata)
+{
+    Message *request = nullptr;
+
+    for (Message &message : aRequests)
     {
         aMetadata.ReadFrom(message);
 
@@ -1476,8 +1534,47 @@ void CoapBase::Metadata::UpdateIn(Message &aMessage) const
     aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// PartitionedMessageQueue
+
+bool PartitionedMessageQueue::IsEmpty(void) const
+{
+    bool isEmpty = true;
+
+    for (const MessageQueue &queue : mPartitions)
+    {
+        if (queue.GetHead() != nullptr)
+        {
+            isEmpty = false;
+            break;
+        }
+    }
+
+    return isEmpty;
+}
+
+void PartitionedMessageQueue::DequeueAndFreeAll(void)
+{
+    for (MessageQueue &queue : mPartitions)
+    {
+        queue.DequeueAndFreeAll();
+    }
+}
+
+void PartitionedMessageQueue::GetInfo(MessageQueue::Info &aInfo) const
+{
+    for (const MessageQueue &queue : mPartitions)
+    {
+        queue.GetInfo(aInfo);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// ResponsesQueue
+
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
-    : mTimer(aInstance, ResponsesQueue::HandleTimer, this)
+    : mNumResponses(0)
+    , mTimer(aInstance, ResponsesQueue::HandleTimer, this)
 {
 }
 
@@ -1502,7 +1599,7 @@ const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, cons
 {
     const Message *response = nullptr;
 
-    for (const Message &message : mQueue)
+    for (const Message &message : mResponses.GetPartition(aRequest.GetMessageId()))
     {
         if (message.GetMessageId() == aRequest.GetMessageId())
         {
@@ -1540,7 +1637,8 @@ void ResponsesQueue::EnqueueResponse(Message                &aMessage,
 
     VerifyOrExit(metadata.AppendTo(*responseCopy) == kErrorNone, responseCopy->Free());
 
-    mQueue.Enqueue(*responseCopy);
+    mResponses.GetPartition(responseCopy->GetMessageId()).Enqueue(*responseCopy);
+    mNumResponses++;
 
     mTimer.FireAtIfEarlier(metadata.mDequeueTime);
 
@@ -1550,38 +1648,51 @@ exit:
 
 void ResponsesQueue::UpdateQueue(void)
 {
-    uint16_t  msgCount    = 0;
     Message  *earliestMsg = nullptr;
     TimeMilli earliestDequeueTime(0);
 
-    // Check the number of messages in the queue and if number is at
+    // If the number of messages in the cache is at
     // `kMaxCachedResponses` remove the one with earliest dequeue
     // time.
 
-    for (Message &message : mQueue)
+    VerifyOrExit(mNumResponses >= kMaxCachedResponses);
+
+    for (MessageQueue &responses : mResponses)
     {
-        ResponseMetadata metadata;
+        for (Message &message : responses)
+        {
+            ResponseMetadata metadata;
 
-        metadata.ReadFrom(message);
+            metadata.ReadFrom(message);
 
-        if ((earliestMsg == nullptr) || (metadata.mDequeueTime < earliestDequeueTime))
-        {
-            earliestMsg         = &message;
-            earliestDequeueTime = metadata.mDequeueTime;
+            if ((earliestMsg == nullptr) || (metadata.mDequeueTime < earliestDequeueTime))
+            {
+                earliestMsg         = &message;
+                earliestDequeueTime = metadata.mDequeueTime;
+            }
         }
-
-        msgCount++;
     }
 
-    if (msgCount >= kMaxCachedResponses)
+    if (earliestMsg != nullptr)
     {
         DequeueResponse(*earliestMsg);
     }
+
+exit:
+    return;
 }
 
-void ResponsesQueue::DequeueResponse(Message &aMessage) { mQueue.DequeueAndFree(aMessage); }
+void ResponsesQueue::DequeueResponse(Message &aMessage)
+{
+    mResponses.GetPartition(aMessage.GetMessageId()).DequeueAndFree(aMessage);
+    mNumResponses--;
+}
 
-void ResponsesQueue::DequeueAllResponses(void) { mQueue.DequeueAndFreeAll(); }
+void ResponsesQueue::DequeueAllResponses(void)
+{
+    mResponses.DequeueAndFreeAll();
+    mNumResponses = 0;
+}
 
 void ResponsesQueue::HandleTimer(Timer &aTimer)
 {
@@ -1593,19 +1704,22 @@ void ResponsesQueue::HandleTimer(void)
     TimeMilli now             = TimerMilli::GetNow();
     TimeMilli nextDequeueTime = now.GetDistantFuture();
 
-    for (Message &message : mQueue)
+    for (MessageQueue &responses : mResponses)
     {
-        ResponseMetadata metadata;
+        for (Message &message : responses)
+        {
+            ResponseMetadata metadata;
 
-        metadata.ReadFrom(message);
+            metadata.ReadFrom(message);
 
-        if (now >= metadata.mDequeueTime)
-        {
-            DequeueResponse(message);
-            continue;
-        }
+            if (now >= metadata.mDequeueTime)
+            {
+                DequeueResponse(message);
+                continue;
+            }
 
-        nextDequeueTime = Min(nextDequeueTime, metadata.mDequeueTime);
+            nextDequeueTime = Min(nextDequeueTime, metadata.mDequeueTime);
+        }
     }
 
     if (nextDequeueTime < now.GetDistantFuture())
@@ -276,6 +276,75 @@ protected:
 };
 #endif
 
+/**
+ * Represents a set of CoAP messages partitioned into a fixed number of message queues.
+ *
+ * Each message is kept in the queue selected by a key derived from the message (e.g., its Message ID), so a look-up
+ * by that key only iterates over the messages of one partition. The key of a message MUST NOT change while the
+ * message is in the set.
+ *
+ */
+class PartitionedMessageQueue
+{
+public:
+    static constexpr uint8_t kNumPartitions = OPENTHREAD_CONFIG_COAP_NUM_QUEUE_PARTITIONS; ///< Number of partitions.
+
+    /**
+     * Gets the partition for a given key.
+     *
+     * @param[in] aKey  The key.
+     *
+     * @returns The partition (message queue) for @p aKey.
+     *
+     */
+    MessageQueue &GetPartition(uint16_t aKey) { return mPartitions[aKey % kNumPartitions]; }
+
+    /**
+     * Gets the partition for a given key.
+     *
+     * @param[in] aKey  The key.
+     *
+     * @returns The partition (message queue) for @p aKey.
+     *
+     */
+    const MessageQueue &GetPartition(uint16_t aKey) const { return mPartitions[aKey % kNumPartitions]; }
+
+    /**
+     * Indicates whether all partitions are empty.
+     *
+     * @retval TRUE   There is no message in the set.
+     * @retval FALSE  There is at least one message in the set.
+     *
+     */
+    bool IsEmpty(void) const;
+
+    /**
+     * Removes all messages from all partitions and frees them.
+     *
+     */
+    void DequeueAndFreeAll(void);
+
+    /**
+     * Adds the message and buffer counts of all partitions to a given `Info`.
+     *
+     * @param[in,out] aInfo  A reference to the `Info` to update.
+     *
+     */
+    void GetInfo(MessageQueue::Info &aInfo) const;
+
+    // The following methods are intended to support range-based `for`
+    // loop iteration over the partitions and should not be used
+    // directly.
+
+    MessageQueue       *begin(void) { return &mPartitions[0]; }
+    MessageQueue       *end(void) { return &mPartitions[kNumPartitions]; }
+    const MessageQueue *begin(void) const { return &mPartitions[0]; }
+    const MessageQueue *end(void) const { return &mPartitions[kNumPartitions]; }
+
+private:
+    MessageQueue mPartitions[kNumPartitions];
+};
+
 /**
  * Caches CoAP responses to implement message deduplication.
  *
@@ -327,12 +396,12 @@ public:
     Error GetMatchedResponseCopy(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo, Message **aResponse);
 
     /**
-     * Gets a reference to the cached CoAP responses queue.
+     * Gets a reference to the cached CoAP responses.
      *
-     * @returns  A reference to the cached CoAP responses queue.
+     * @returns  A reference to the cached CoAP responses.
      *
      */
-    const MessageQueue &GetResponses(void) const { return mQueue; }
+    const PartitionedMessageQueue &GetResponses(void) const { return mResponses; }
 
 private:
     static constexpr uint16_t kMaxCachedResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
@@ -353,8 +422,9 @@ private:
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
-    MessageQueue      mQueue;
-    TimerMilliContext mTimer;
+    PartitionedMessageQueue mResponses; // Partitioned by Message ID.
+    uint16_t                mNumResponses;
+    TimerMilliContext       mTimer;
 };
 
 /**
@@ -777,20 +847,20 @@ public:
     void SetInterceptor(Interceptor aInterceptor, void *aContext) { mInterceptor.Set(aInterceptor, aContext); }
 
     /**
-     * Returns a reference to the request message list.
+     * Returns a reference to the request messages.
      *
-     * @returns A reference to the request message list.
+     * @returns A reference to the request messages.
      *
      */
-    const MessageQueue &GetRequestMessages(void) const { return mPendingRequests; }
+    const PartitionedMessageQueue &GetRequestMessages(void) const { return mPendingRequests; }
 
     /**
-     * Returns a reference to the cached response list.
+     * Returns a reference to the cached responses.
      *
-     * @returns A reference to the cached response list.
+     * @returns A reference to the cached responses.
      *
      */
-    const MessageQueue &GetCachedResponses(void) const { return mResponsesQueue.GetResponses(); }
+    const PartitionedMessageQueue &GetCachedResponses(void) const { return mResponsesQueue.GetResponses(); }
 
 protected:
     /**
@@ -896,6 +966,10 @@ private:
     Message *CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, const Metadata &aMetadata);
     void     DequeueMessage(Message &aMessage);
     Message *FindRelatedRequest(const Message &aResponse, const Ip6::MessageInfo &aMessageInfo, Metadata &aMetadata);
+    Message *FindRelatedRequest(MessageQueue           &aRequests,
+                                const Message          &aResponse,
+                                const Ip6::MessageInfo &aMessageInfo,
+                                Metadata               &aMetadata);
     void     FinalizeCoapTransaction(Message                &aRequest,
                                      const Metadata         &aMetadata,
                                      Message                *aResponse,
@@ -939,9 +1013,11 @@ private:
 
     Error Send(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
-    MessageQueue      mPendingRequests;
-    uint16_t          mMessageId;
-    TimerMilliContext mRetransmissionTimer;
+    static uint16_t GetTokenKey(const Message &aMessage);
+
+    PartitionedMessageQueue mPendingRequests; // Partitioned by token.
+    uint16_t                mMessageId;
+    TimerMilliContext       mRetransmissionTimer;
 
     LinkedList<Resource> mResources;
 
@@ -51,6 +51,9 @@ CoapSecure::CoapSecure(Instance &aInstance, bool aLayerTwoSecurity)
     : CoapBase(aInstance, &CoapSecure::Send)
     , mDtls(aInstance, aLayerTwoSecurity)
     , mTransmitTask(aInstance, CoapSecure::HandleTransmit, this)
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    , mDtlsServer(aInstance, mDtls)
+#endif
 {
 }
 
@@ -58,6 +61,10 @@ Error CoapSecure::Start(uint16_t aPort)
 {
     Error error = kErrorNone;
 
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    VerifyOrExit(!mDtlsServer.IsRunning(), error = kErrorAlready);
+#endif
+
     mConnectedCallback.Clear();
 
     SuccessOrExit(error = mDtls.Open(&CoapSecure::HandleDtlsReceive, &CoapSecure::HandleDtlsConnected, this));
@@ -80,9 +87,22 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+Error CoapSecure::StartServer(uint16_t aPort)
+{
+    mConnectedCallback.Clear();
+
+    return mDtlsServer.Start(aPort, &CoapSecure::HandleDtlsServerReceive, &CoapSecure::HandleDtlsServerConnected,
+                             this);
+}
+#endif
+
 void CoapSecure::Stop(void)
 {
     mDtls.Close();
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    mDtlsServer.Stop();
+#endif
 
     mTransmitQueue.DequeueAndFreeAll();
     ClearRequestsAndResponses();
@@ -156,12 +176,22 @@ Error CoapSecure::SendMessage(Message                &aMessage,
 
 Error CoapSecure::Send(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
+    Error error = kErrorNone;
+
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    if (mDtlsServer.IsRunning())
+    {
+        ExitNow(error = mDtlsServer.Send(aMessage, aMessageInfo));
+    }
+#else
     OT_UNUSED_VARIABLE(aMessageInfo);
+#endif
 
     mTransmitQueue.Enqueue(aMessage);
     mTransmitTask.Post();
 
-    return kErrorNone;
+exit:
+    return error;
 }
 
 void CoapSecure::HandleDtlsConnected(void *aContext, bool aConnected)
@@ -173,17 +203,36 @@ void CoapSecure::HandleDtlsConnected(bool aConnected) { mConnectedCallback.Invok
 
 void CoapSecure::HandleDtlsReceive(void *aContext, uint8_t *aBuf, uint16_t aLength)
 {
-    return static_cast<CoapSecure *>(aContext)->HandleDtlsReceive(aBuf, aLength);
+    CoapSecure *coapSecure = static_cast<CoapSecure *>(aContext);
+
+    coapSecure->HandleDtlsReceive(aBuf, aLength, coapSecure->mDtls.GetMessageInfo());
+}
+
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+void CoapSecure::HandleDtlsServerConnected(void *aContext, MeshCoP::DtlsServer::Session &aSession, bool aConnected)
+{
+    OT_UNUSED_VARIABLE(aSession);
+
+    static_cast<CoapSecure *>(aContext)->HandleDtlsConnected(aConnected);
+}
+
+void CoapSecure::HandleDtlsServerReceive(void                         *aContext,
+                                         MeshCoP::DtlsServer::Session &aSession,
+                                         uint8_t                      *aBuf,
+                                         uint16_t                      aLength)
+{
+    static_cast<CoapSecure *>(aContext)->HandleDtlsReceive(aBuf, aLength, aSession.GetMessageInfo());
 }
+#endif
 
-void CoapSecure::HandleDtlsReceive(uint8_t *aBuf, uint16_t aLength)
+void CoapSecure::HandleDtlsReceive(uint8_t *aBuf, uint16_t aLength, const Ip6::MessageInfo &aMessageInfo)
 {
     ot::Message *message = nullptr;
 
     VerifyOrExit((message = Get<MessagePool>().Allocate(Message::kTypeIp6, Message::GetHelpDataReserved())) != nullptr);
     SuccessOrExit(message->AppendBytes(aBuf, aLength));
 
-    CoapBase::Receive(*message, mDtls.GetMessageInfo());
+    CoapBase::Receive(*message, aMessageInfo);
 
 exit:
     FreeMessage(message);
@@ -36,6 +36,7 @@
 #include "coap/coap.hpp"
 #include "common/callback.hpp"
 #include "meshcop/dtls.hpp"
+#include "meshcop/dtls_server.hpp"
 #include "meshcop/meshcop.hpp"
 
 #include <openthread/coap_secure.h>
@@ -105,6 +106,33 @@ public:
         mConnectedCallback.Set(aCallback, aContext);
     }
 
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    /**
+     * Starts the secure CoAP agent as a multi-session server.
+     *
+     * Each peer gets its own DTLS session, up to `OPENTHREAD_CONFIG_DTLS_SERVER_MAX_SESSIONS` sessions. The sessions
+     * use the security configuration (PSK or certificates) set on this agent. Responses are sent in the session of the
+     * peer given by their message info. The connected callback is invoked for each session.
+     *
+     * MUST NOT be used while the agent is started with `Start()`.
+     *
+     * @param[in]  aPort      The local UDP port to bind to.
+     *
+     * @retval kErrorNone        Successfully started the CoAP agent.
+     * @retval kErrorAlready     Already started.
+     *
+     */
+    Error StartServer(uint16_t aPort);
+
+    /**
+     * Returns a reference to the multi-session DTLS server.
+     *
+     * @returns  A reference to the DTLS server.
+     *
+     */
+    const MeshCoP::DtlsServer &GetDtlsServer(void) const { return mDtlsServer; }
+#endif
+
     /**
      * Stops the secure CoAP agent.
      *
@@ -404,15 +432,26 @@ private:
     void        HandleDtlsConnected(bool aConnected);
 
     static void HandleDtlsReceive(void *aContext, uint8_t *aBuf, uint16_t aLength);
-    void        HandleDtlsReceive(uint8_t *aBuf, uint16_t aLength);
+    void        HandleDtlsReceive(uint8_t *aBuf, uint16_t aLength, const Ip6::MessageInfo &aMessageInfo);
 
     static void HandleTransmit(Tasklet &aTasklet);
     void        HandleTransmit(void);
 
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    static void HandleDtlsServerConnected(void *aContext, MeshCoP::DtlsServer::Session &aSession, bool aConnected);
+    static void HandleDtlsServerReceive(void                         *aContext,
+                                        MeshCoP::DtlsServer::Session &aSession,
+                                        uint8_t                      *aBuf,
+                                        uint16_t                      aLength);
+#endif
+
     MeshCoP::Dtls               mDtls;
     Callback<ConnectedCallback> mConnectedCallback;
     ot::MessageQueue            mTransmitQueue;
     TaskletContext              mTransmitTask;
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    MeshCoP::DtlsServer mDtlsServer;
+#endif
 };
 
 } // namespace Coap
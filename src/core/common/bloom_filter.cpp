@@ -0,0 +1,69 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the hashing used by Bloom filters.
+ */
+
+#include "bloom_filter.hpp"
+
+namespace ot {
+
+uint32_t BloomFilterHash::Calculate(const void *aObject, uint16_t aObjectSize)
+{
+    // 32-bit FNV-1a hash.
+
+    static constexpr uint32_t kOffsetBasis = 2166136261u;
+    static constexpr uint32_t kPrime       = 16777619u;
+
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(aObject);
+    uint32_t       hash  = kOffsetBasis;
+
+    for (; aObjectSize > 0; aObjectSize--, bytes++)
+    {
+        hash ^= *bytes;
+        hash *= kPrime;
+    }
+
+    return hash;
+}
+
+uint16_t BloomFilterHash::GetIndex(uint32_t aHash, uint8_t aNth, uint16_t aSize)
+{
+    // Double hashing: the n-th index is `h1 + n * h2` with `h1` and
+    // `h2` taken from the two halves of the hash. `h2` is forced odd
+    // so that it is never zero.
+
+    uint32_t h1 = (aHash & 0xffff);
+    uint32_t h2 = ((aHash >> 16) | 1);
+
+    return static_cast<uint16_t>((h1 + aNth * h2) % aSize);
+}
+
+} // namespace ot
@@ -0,0 +1,245 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for Bloom filters.
+ */
+
+#ifndef BLOOM_FILTER_HPP_
+#define BLOOM_FILTER_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/bit_vector.hpp"
+#include "common/clearable.hpp"
+#include "common/numeric_limits.hpp"
+
+namespace ot {
+
+/**
+ * @addtogroup core-bloom-filter
+ *
+ * @brief
+ *   This module includes definitions for Bloom filters.
+ *
+ * @{
+ *
+ */
+
+/**
+ * Provides the hashing shared by `BloomFilter` and `CountingBloomFilter`.
+ *
+ */
+class BloomFilterHash
+{
+public:
+    static constexpr uint8_t kNumHashes = 2; ///< Number of bit/counter indexes per object.
+
+    /**
+     * Calculates the hash of a given object.
+     *
+     * The hash covers the raw bytes of the object, so it should only be used with plain objects (e.g., addresses).
+     *
+     * @param[in] aObject      A pointer to the object.
+     * @param[in] aObjectSize  The object size in bytes.
+     *
+     * @returns The hash of the object.
+     *
+     */
+    static uint32_t Calculate(const void *aObject, uint16_t aObjectSize);
+
+    /**
+     * Gets one of the `kNumHashes` indexes derived from a hash.
+     *
+     * @param[in] aHash  The object hash (from `Calculate()`).
+     * @param[in] aNth   The index number (MUST be smaller than `kNumHashes`).
+     * @param[in] aSize  The number of bits or counters in the filter.
+     *
+     * @returns The @p aNth index in range [0, @p aSize).
+     *
+     */
+    static uint16_t GetIndex(uint32_t aHash, uint8_t aNth, uint16_t aSize);
+};
+
+/**
+ * Represents a Bloom filter.
+ *
+ * A Bloom filter is a compact set representation which can report false positives but never false negatives. Objects
+ * cannot be removed individually, the filter is instead cleared and rebuilt.
+ *
+ * @tparam ObjectType  The object type.
+ * @tparam kNumBits    The number of bits in the filter.
+ *
+ */
+template <typename ObjectType, uint16_t kNumBits>
+class BloomFilter : public Clearable<BloomFilter<ObjectType, kNumBits>>
+{
+public:
+    /**
+     * Adds an object to the filter.
+     *
+     * @param[in] aObject  The object to add.
+     *
+     */
+    void Add(const ObjectType &aObject)
+    {
+        uint32_t hash = BloomFilterHash::Calculate(&aObject, sizeof(ObjectType));
+
+        for (uint8_t n = 0; n < BloomFilterHash::kNumHashes; n++)
+        {
+            mBits.Set(BloomFilterHash::GetIndex(hash, n, kNumBits), true);
+        }
+    }
+
+    /**
+     * Indicates whether an object may be in the filter.
+     *
+     * @param[in] aObject  The object to check.
+     *
+     * @retval TRUE   The object may have been added to the filter.
+     * @retval FALSE  The object was definitely not added to the filter.
+     *
+     */
+    bool MayContain(const ObjectType &aObject) const
+    {
+        bool     contains = true;
+        uint32_t hash     = BloomFilterHash::Calculate(&aObject, sizeof(ObjectType));
+
+        for (uint8_t n = 0; n < BloomFilterHash::kNumHashes; n++)
+        {
+            if (!mBits.Get(BloomFilterHash::GetIndex(hash, n, kNumBits)))
+            {
+                contains = false;
+                break;
+            }
+        }
+
+        return contains;
+    }
+
+private:
+    BitVector<kNumBits> mBits;
+};
+
+/**
+ * Represents a counting Bloom filter.
+ *
+ * Unlike `BloomFilter`, objects can be removed. Every object removed MUST have been previously added. A counter which
+ * reaches its maximum value sticks to it, so the filter never reports false negatives.
+ *
+ * @tparam ObjectType    The object type.
+ * @tparam kNumCounters  The number of counters in the filter.
+ *
+ */
+template <typename ObjectType, uint16_t kNumCounters>
+class CountingBloomFilter : public Clearable<CountingBloomFilter<ObjectType, kNumCounters>>
+{
+public:
+    /**
+     * Adds an object to the filter.
+     *
+     * @param[in] aObject  The object to add.
+     *
+     */
+    void Add(const ObjectType &aObject)
+    {
+        uint32_t hash = BloomFilterHash::Calculate(&aObject, sizeof(ObjectType));
+
+        for (uint8_t n = 0; n < BloomFilterHash::kNumHashes; n++)
+        {
+            uint8_t &counter = mCounters[BloomFilterHash::GetIndex(hash, n, kNumCounters)];
+
+            if (counter != NumericLimits<uint8_t>::kMax)
+            {
+                counter++;
+            }
+        }
+    }
+
+    /**
+     * Removes an object from the filter.
+     *
+     * @param[in] aObject  The object to remove.
+     *
+     */
+    void Remove(const ObjectType &aObject)
+    {
+        uint32_t hash = BloomFilterHash::Calculate(&aObject, sizeof(ObjectType));
+
+        for (uint8_t n = 0; n < BloomFilterHash::kNumHashes; n++)
+        {
+            uint8_t &counter = mCounters[BloomFilterHash::GetIndex(hash, n, kNumCounters)];
+
+            if ((counter != 0) && (counter != NumericLimits<uint8_t>::kMax))
+            {
+                counter--;
+            }
+        }
+    }
+
+    /**
+     * Indicates whether an object may be in the filter.
+     *
+     * @param[in] aObject  The object to check.
+     *
+     * @retval TRUE   The object may be in the filter.
+     * @retval FALSE  The object is definitely not in the filter.
+     *
+     */
+    bool MayContain(const ObjectType &aObject) const
+    {
+        bool     contains = true;
+        uint32_t hash     = BloomFilterHash::Calculate(&aObject, sizeof(ObjectType));
+
+        for (uint8_t n = 0; n < BloomFilterHash::kNumHashes; n++)
+        {
+            if (mCounters[BloomFilterHash::GetIndex(hash, n, kNumCounters)] == 0)
+            {
+                contains = false;
+                break;
+            }
+        }
+
+        return contains;
+    }
+
+private:
+    uint8_t mCounters[kNumCounters];
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // BLOOM_FILTER_HPP_
@@ -0,0 +1,235 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for an intrusive hash table.
+ */
+
+#ifndef HASH_TABLE_HPP_
+#define HASH_TABLE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+namespace ot {
+
+/**
+ * @addtogroup core-hash-table
+ *
+ * @brief
+ *   This module includes definitions for OpenThread intrusive hash table.
+ *
+ * @{
+ *
+ */
+
+/**
+ * Calculates a 32-bit FNV-1a hash over a sequence of bytes.
+ *
+ */
+class HashCalculator
+{
+public:
+    /**
+     * Initializes the hash calculator.
+     *
+     */
+    HashCalculator(void)
+        : mHash(kOffsetBasis)
+    {
+    }
+
+    /**
+     * Feeds a byte value into the hash computation.
+     *
+     * @param[in] aByte  The byte value.
+     *
+     */
+    void Update(uint8_t aByte)
+    {
+        mHash ^= aByte;
+        mHash *= kPrime;
+    }
+
+    /**
+     * Feeds a sequence of bytes into the hash computation.
+     *
+     * @param[in] aBytes   A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     *
+     */
+    void Update(const void *aBytes, uint16_t aLength)
+    {
+        for (const uint8_t *byte = static_cast<const uint8_t *>(aBytes); aLength > 0; aLength--, byte++)
+        {
+            Update(*byte);
+        }
+    }
+
+    /**
+     * Feeds a `uint16_t` value into the hash computation.
+     *
+     * @param[in] aValue  The value.
+     *
+     */
+    void Update(uint16_t aValue)
+    {
+        Update(static_cast<uint8_t>(aValue >> 8));
+        Update(static_cast<uint8_t>(aValue & 0xff));
+    }
+
+    /**
+     * Gets the current hash value.
+     *
+     * @returns The current hash value.
+     *
+     */
+    uint32_t GetHash(void) const { return mHash; }
+
+private:
+    static constexpr uint32_t kOffsetBasis = 2166136261u;
+    static constexpr uint32_t kPrime       = 16777619u;
+
+    uint32_t mHash;
+};
+
+/**
+ * Represents an intrusive hash table with separate chaining.
+ *
+ * The table does not own its entries and does not compute hashes. The caller provides the hash of an entry's key when
+ * adding, removing or looking up an entry, and MUST use the same hash for the lifetime of the entry in the table.
+ *
+ * The chain link is the member of `Type` given by `kNextMember`, so an entry can be part of several hash tables (e.g.,
+ * keyed by different fields) and of a `LinkedList` at the same time, as long as each uses its own next pointer.
+ *
+ * To check that an entry matches a key, the `Matches()` method is invoked on each entry in the key's bucket. The
+ * `Matches()` method should be provided by `Type` class accordingly:
+ *
+ *     bool Type::Matches(const KeyType &aKey) const
+ *
+ * @tparam Type         The entry type.
+ * @tparam kNextMember  A pointer to the `Type` member used to chain entries in a bucket.
+ * @tparam kNumBuckets  The number of buckets.
+ *
+ */
+template <typename Type, Type *Type::*kNextMember, uint16_t kNumBuckets> class HashTable
+{
+    static_assert(kNumBuckets > 0, "kNumBuckets MUST NOT be zero");
+
+public:
+    /**
+     * Initializes the hash table as empty.
+     *
+     */
+    HashTable(void) { Clear(); }
+
+    /**
+     * Removes all entries from the hash table.
+     *
+     * The entries themselves are not changed.
+     *
+     */
+    void Clear(void)
+    {
+        for (Type *&head : mBuckets)
+        {
+            head = nullptr;
+        }
+    }
+
+    /**
+     * Adds an entry to the hash table.
+     *
+     * The entry MUST NOT already be in the hash table.
+     *
+     * @param[in] aEntry  The entry to add.
+     * @param[in] aHash   The hash of the entry's key.
+     *
+     */
+    void Add(Type &aEntry, uint32_t aHash)
+    {
+        Type *&head = mBuckets[aHash % kNumBuckets];
+
+        aEntry.*kNextMember = head;
+        head                = &aEntry;
+    }
+
+    /**
+     * Removes an entry from the hash table.
+     *
+     * @param[in] aEntry  The entry to remove.
+     * @param[in] aHash   The hash of the entry's key (same as the one used when adding the entry).
+     *
+     */
+    void Remove(Type &aEntry, uint32_t aHash)
+    {
+        for (Type **link = &mBuckets[aHash % kNumBuckets]; *link != nullptr; link = &((*link)->*kNextMember))
+        {
+            if (*link == &aEntry)
+            {
+                *link = aEntry.*kNextMember;
+                break;
+            }
+        }
+    }
+
+    /**
+     * Finds an entry matching a given key.
+     *
+     * @param[in] aKey   The key to match against entries.
+     * @param[in] aHash  The hash of @p aKey.
+     *
+     * @returns A pointer to the matching entry, or `nullptr` if no matching entry could be found.
+     *
+     */
+    template <typename KeyType> Type *FindMatching(const KeyType &aKey, uint32_t aHash) const
+    {
+        Type *entry = mBuckets[aHash % kNumBuckets];
+
+        while ((entry != nullptr) && !entry->Matches(aKey))
+        {
+            entry = entry->*kNextMember;
+        }
+
+        return entry;
+    }
+
+private:
+    Type *mBuckets[kNumBuckets];
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // HASH_TABLE_HPP_
@@ -127,6 +127,9 @@ Instance::Instance(void)
 #endif
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE || OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
     , mNetworkDataLocal(*this)
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+    , mNetworkDataDeltaManager(*this)
 #endif
     , mNetworkDataLeader(*this)
 #if OPENTHREAD_FTD || OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE || OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
@@ -216,6 +219,9 @@ Instance::Instance(void)
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
     , mHistoryTracker(*this)
 #endif
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    , mLatencyTracer(*this)
+#endif
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
     , mDatasetUpdater(*this)
 #endif
@@ -112,6 +112,7 @@
 #include "thread/mle.hpp"
 #include "thread/mle_router.hpp"
 #include "thread/mlr_manager.hpp"
+#include "thread/network_data_delta.hpp"
 #include "thread/network_data_local.hpp"
 #include "thread/network_data_notifier.hpp"
 #include "thread/network_data_publisher.hpp"
@@ -127,6 +128,7 @@
 #include "utils/heap.hpp"
 #include "utils/history_tracker.hpp"
 #include "utils/jam_detector.hpp"
+#include "utils/latency_tracer.hpp"
 #include "utils/mesh_diag.hpp"
 #include "utils/ping_sender.hpp"
 #include "utils/slaac_address.hpp"
@@ -494,6 +496,10 @@ private:
     NetworkData::Local mNetworkDataLocal;
 #endif
 
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+    NetworkData::DeltaManager mNetworkDataDeltaManager;
+#endif
+
     NetworkData::Leader mNetworkDataLeader;
 
 #if OPENTHREAD_FTD || OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE || OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
@@ -610,6 +616,10 @@ private:
     Utils::HistoryTracker mHistoryTracker;
 #endif
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    Utils::LatencyTracer mLatencyTracer;
+#endif
+
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
     MeshCoP::DatasetUpdater mDatasetUpdater;
 #endif
@@ -774,6 +784,10 @@ template <> inline NetworkData::Local &Instance::Get(void) { return mNetworkData
 
 template <> inline NetworkData::Leader &Instance::Get(void) { return mNetworkDataLeader; }
 
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+template <> inline NetworkData::DeltaManager &Instance::Get(void) { return mNetworkDataDeltaManager; }
+#endif
+
 #if OPENTHREAD_FTD || OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE || OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
 template <> inline NetworkData::Notifier &Instance::Get(void) { return mNetworkDataNotifier; }
 #endif
@@ -901,6 +915,10 @@ template <> inline Utils::MeshDiag &Instance::Get(void) { return mMeshDiag; }
 template <> inline Utils::HistoryTracker &Instance::Get(void) { return mHistoryTracker; }
 #endif
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+template <> inline Utils::LatencyTracer &Instance::Get(void) { return mLatencyTracer; }
+#endif
+
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
 template <> inline MeshCoP::DatasetUpdater &Instance::Get(void) { return mDatasetUpdater; }
 #endif
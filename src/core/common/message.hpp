@@ -217,6 +217,10 @@ protected:
         bool    mDoNotEvict : 1;       // Whether this message may be evicted.
         bool    mMulticastLoop : 1;    // Whether this multicast message may be looped back.
         bool    mResolvingAddress : 1; // Whether the message is pending an address query resolution.
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+        bool     mIsTraced : 1; // Whether the message is traced by the Latency Tracer.
+        uint32_t mTraceTime;    // The time (in usec) the traced message reached its latest stage.
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
         uint8_t mRadioType : 2;      // The radio link type the message was received on, or should be sent on.
         bool    mIsRadioTypeSet : 1; // Whether the radio type is set.
@@ -1062,6 +1066,41 @@ public:
      */
     void SetTimestampToNow(void) { SetTimestamp(TimerMilli::GetNow()); }
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    /**
+     * Indicates whether or not the message is traced by the Latency Tracer.
+     *
+     * @retval TRUE   The message is traced.
+     * @retval FALSE  The message is not traced.
+     *
+     */
+    bool IsTraced(void) const { return GetMetadata().mIsTraced; }
+
+    /**
+     * Sets whether or not the message is traced by the Latency Tracer.
+     *
+     * @param[in] aTraced  TRUE if the message is traced, FALSE otherwise.
+     *
+     */
+    void SetTraced(bool aTraced) { GetMetadata().mIsTraced = aTraced; }
+
+    /**
+     * Returns the time (in microseconds) at which the traced message reached its latest trace stage.
+     *
+     * @returns The trace time.
+     *
+     */
+    uint32_t GetTraceTime(void) const { return GetMetadata().mTraceTime; }
+
+    /**
+     * Sets the time (in microseconds) at which the traced message reached its latest trace stage.
+     *
+     * @param[in] aTime  The trace time.
+     *
+     */
+    void SetTraceTime(uint32_t aTime) { GetMetadata().mTraceTime = aTime; }
+#endif
+
     /**
      * Returns whether or not message forwarding is scheduled for direct transmission.
      *
@@ -322,4 +322,142 @@ exit:
     return error;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// TlvIndex
+
+void TlvIndex::Build(const Message &aMessage)
+{
+    uint16_t        offset = aMessage.GetOffset();
+    Tlv::ParsedInfo info;
+
+    mMessage     = &aMessage;
+    mNumEntries  = 0;
+    mIsTruncated = false;
+
+    // Stop at the first TLV which is not well-formed, same as
+    // `ParsedInfo::FindIn()` which never looks beyond it.
+
+    while (info.ParseFrom(aMessage, offset) == kErrorNone)
+    {
+        if (mNumEntries == kMaxEntries)
+        {
+            mIsTruncated = true;
+            break;
+        }
+
+        mEntries[mNumEntries++] = info;
+        offset += info.mSize;
+    }
+}
+
+Error TlvIndex::FindInfo(uint8_t aType, Tlv::ParsedInfo &aInfo) const
+{
+    Error error = kErrorNotFound;
+
+    OT_ASSERT(mMessage != nullptr);
+
+    for (uint8_t index = 0; index < mNumEntries; index++)
+    {
+        if (mEntries[index].mType == aType)
+        {
+            aInfo = mEntries[index];
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+    // The first TLV of `aType` (if any) is after the recorded ones,
+    // so searching the whole message gives the same result.
+
+    if (mIsTruncated)
+    {
+        error = aInfo.FindIn(*mMessage, aType);
+    }
+
+exit:
+    return error;
+}
+
+Error TlvIndex::FindTlvValueOffset(uint8_t aType, uint16_t &aValueOffset, uint16_t &aLength) const
+{
+    Error           error;
+    Tlv::ParsedInfo info;
+
+    SuccessOrExit(error = FindInfo(aType, info));
+
+    aValueOffset = info.mValueOffset;
+    aLength      = info.mLength;
+
+exit:
+    return error;
+}
+
+Error TlvIndex::FindTlvValueStartEndOffsets(uint8_t aType, uint16_t &aValueStartOffset, uint16_t &aValueEndOffset) const
+{
+    Error           error;
+    Tlv::ParsedInfo info;
+
+    SuccessOrExit(error = FindInfo(aType, info));
+
+    aValueStartOffset = info.mValueOffset;
+    aValueEndOffset   = info.mValueOffset + info.mLength;
+
+exit:
+    return error;
+}
+
+Error TlvIndex::FindTlv(uint8_t aType, uint16_t aMaxSize, Tlv &aTlv) const
+{
+    Error           error;
+    Tlv::ParsedInfo info;
+
+    SuccessOrExit(error = FindInfo(aType, info));
+
+    mMessage->ReadBytes(info.mOffset, &aTlv, Min(aMaxSize, info.mSize));
+
+exit:
+    return error;
+}
+
+Error TlvIndex::FindTlv(uint8_t aType, void *aValue, uint8_t aLength) const
+{
+    Error           error;
+    Tlv::ParsedInfo info;
+
+    SuccessOrExit(error = FindInfo(aType, info));
+    VerifyOrExit(info.mLength >= aLength, error = kErrorParse);
+    mMessage->ReadBytes(info.mValueOffset, aValue, aLength);
+
+exit:
+    return error;
+}
+
+Error TlvIndex::FindStringTlv(uint8_t aType, uint8_t aMaxStringLength, char *aValue) const
+{
+    Error           error;
+    Tlv::ParsedInfo info;
+
+    SuccessOrExit(error = FindInfo(aType, info));
+    error = Tlv::ReadStringTlv(*mMessage, info.mOffset, aMaxStringLength, aValue);
+
+exit:
+    return error;
+}
+
+template <typename UintType> Error TlvIndex::FindUintTlv(uint8_t aType, UintType &aValue) const
+{
+    Error           error;
+    Tlv::ParsedInfo info;
+
+    SuccessOrExit(error = FindInfo(aType, info));
+    error = Tlv::ReadUintTlv<UintType>(*mMessage, info.mOffset, aValue);
+
+exit:
+    return error;
+}
+
+// Explicit instantiations of `FindUintTlv<>()`
+template Error TlvIndex::FindUintTlv<uint8_t>(uint8_t aType, uint8_t &aValue) const;
+template Error TlvIndex::FindUintTlv<uint16_t>(uint8_t aType, uint16_t &aValue) const;
+template Error TlvIndex::FindUintTlv<uint32_t>(uint8_t aType, uint32_t &aValue) const;
+
 } // namespace ot
@@ -542,6 +542,8 @@ protected:
     static const uint8_t kExtendedLength = 255; // Extended Length value.
 
 private:
+    friend class TlvIndex;
+
     struct ParsedInfo
     {
         Error ParseFrom(const Message &aMessage, uint16_t aOffset);
@@ -715,6 +717,188 @@ public:
     typedef char StringType[kMaxStringLength + 1]; ///< String buffer for TLV value.
 };
 
+/**
+ * Represents an index of the top-level TLVs in a message.
+ *
+ * `Tlv::Find()` methods search the message from its offset on every call. When a handler looks up many TLVs from
+ * the same message, a `TlvIndex` can be built once (parsing each TLV header a single time) and then used for all the
+ * look-ups. The `Find()` methods mirror the ones in `Tlv` and behave the same way.
+ *
+ * The index records up to `kMaxEntries` TLVs. If the message contains more, a look-up for a type not found among the
+ * recorded entries falls back to searching the message.
+ *
+ * The index is only valid while the message content and offset are not changed.
+ *
+ */
+class TlvIndex
+{
+public:
+    static constexpr uint8_t kMaxEntries = 24; ///< Maximum number of TLVs recorded in the index.
+
+    /**
+     * Initializes an empty `TlvIndex`.
+     *
+     */
+    TlvIndex(void)
+        : mMessage(nullptr)
+        , mNumEntries(0)
+        , mIsTruncated(false)
+    {
+    }
+
+    /**
+     * Builds the index from the TLVs in a given message.
+     *
+     * The TLVs are parsed starting from `aMessage.GetOffset()` up to the end of the message or up to the first TLV
+     * which is not well-formed (same as `Tlv::Find()` methods).
+     *
+     * @param[in] aMessage  The message to index.
+     *
+     */
+    void Build(const Message &aMessage);
+
+    /**
+     * Gets the number of TLVs recorded in the index.
+     *
+     * @returns The number of recorded TLVs.
+     *
+     */
+    uint8_t GetNumEntries(void) const { return mNumEntries; }
+
+    /**
+     * Indicates whether the message contains more TLVs than the index could record.
+     *
+     * @retval TRUE   The message contains more TLVs than `kMaxEntries`.
+     * @retval FALSE  All the TLVs in the message are recorded.
+     *
+     */
+    bool IsTruncated(void) const { return mIsTruncated; }
+
+    /**
+     * Finds the offset and length of TLV value for a given TLV type.
+     *
+     * @param[in]   aType         The Type value to search for.
+     * @param[out]  aValueOffset  The offset where the value starts.
+     * @param[out]  aLength       The length of the value.
+     *
+     * @retval kErrorNone       Successfully found the TLV.
+     * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+     *
+     */
+    Error FindTlvValueOffset(uint8_t aType, uint16_t &aValueOffset, uint16_t &aLength) const;
+
+    /**
+     * Finds the start and end offset of TLV value for a given TLV type.
+     *
+     * @param[in]   aType              The Type value to search for.
+     * @param[out]  aValueStartOffset  The offset where the value starts.
+     * @param[out]  aValueEndOffset    The offset immediately after the last byte of value.
+     *
+     * @retval kErrorNone       Successfully found the TLV.
+     * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+     *
+     */
+    Error FindTlvValueStartEndOffsets(uint8_t aType, uint16_t &aValueStartOffset, uint16_t &aValueEndOffset) const;
+
+    /**
+     * Searches for and reads a requested TLV.
+     *
+     * @tparam      TlvType     The TlvType to search for (must be a sub-class of `Tlv`).
+     *
+     * @param[out]  aTlv        A reference to the TLV that will be copied to.
+     *
+     * @retval kErrorNone       Successfully copied the TLV.
+     * @retval kErrorNotFound   Could not find the TLV.
+     *
+     */
+    template <typename TlvType> Error FindTlv(TlvType &aTlv) const
+    {
+        return FindTlv(TlvType::kType, sizeof(TlvType), aTlv);
+    }
+
+    /**
+     * Searches for a TLV, ensures its length is same or larger than an expected minimum value, and then reads its value
+     * into a given buffer.
+     *
+     * @tparam       TlvType     The TLV type to find.
+     *
+     * @param[out]   aValue      A buffer to output the value (must contain at least @p aLength bytes).
+     * @param[in]    aLength     The expected (minimum) length of the TLV value.
+     *
+     * @retval kErrorNone       The TLV was found and read successfully. @p aValue is updated.
+     * @retval kErrorNotFound   Could not find the TLV.
+     * @retval kErrorParse      TLV was found but it was not well-formed and could not be parsed.
+     *
+     */
+    template <typename TlvType> Error Find(void *aValue, uint8_t aLength) const
+    {
+        return FindTlv(TlvType::kType, aValue, aLength);
+    }
+
+    /**
+     * Searches for a simple TLV with a single non-integral value and reads its value.
+     *
+     * @tparam       SimpleTlvType   The simple TLV type to find (must be a sub-class of `SimpleTlvInfo`)
+     *
+     * @param[out]   aValue          A reference to the value object to output the read value.
+     *
+     * @retval kErrorNone         The TLV was found and read successfully. @p aValue is updated.
+     * @retval kErrorNotFound     Could not find the TLV.
+     * @retval kErrorParse        TLV was found but it was not well-formed and could not be parsed.
+     *
+     */
+    template <typename SimpleTlvType> Error Find(typename SimpleTlvType::ValueType &aValue) const
+    {
+        return FindTlv(SimpleTlvType::kType, &aValue, sizeof(aValue));
+    }
+
+    /**
+     * Searches for a simple TLV with a single integral value and reads its value.
+     *
+     * @tparam       UintTlvType     The simple TLV type to find (must be a sub-class of `UintTlvInfo`)
+     *
+     * @param[out]   aValue          A reference to an unsigned int value to output the TLV's value.
+     *
+     * @retval kErrorNone         The TLV was found and read successfully. @p aValue is updated.
+     * @retval kErrorNotFound     Could not find the TLV.
+     * @retval kErrorParse        TLV was found but it was not well-formed and could not be parsed.
+     *
+     */
+    template <typename UintTlvType> Error Find(typename UintTlvType::UintValueType &aValue) const
+    {
+        return FindUintTlv(UintTlvType::kType, aValue);
+    }
+
+    /**
+     * Searches for a simple TLV with a UTF-8 string value and reads its value into a given string buffer.
+     *
+     * @tparam       StringTlvType  The simple TLV type to find (must be a sub-class of `StringTlvInfo`)
+     *
+     * @param[out]   aValue          A reference to a string buffer to output the TLV's value.
+     *
+     * @retval kErrorNone         The TLV was found and read successfully. @p aValue is updated.
+     * @retval kErrorNotFound     Could not find the TLV.
+     * @retval kErrorParse        TLV was found but it was not well-formed and could not be parsed.
+     *
+     */
+    template <typename StringTlvType> Error Find(typename StringTlvType::StringType &aValue) const
+    {
+        return FindStringTlv(StringTlvType::kType, StringTlvType::kMaxStringLength, aValue);
+    }
+
+private:
+    Error FindInfo(uint8_t aType, Tlv::ParsedInfo &aInfo) const;
+    Error FindTlv(uint8_t aType, uint16_t aMaxSize, Tlv &aTlv) const;
+    Error FindTlv(uint8_t aType, void *aValue, uint8_t aLength) const;
+    Error FindStringTlv(uint8_t aType, uint8_t aMaxStringLength, char *aValue) const;
+    template <typename UintType> Error FindUintTlv(uint8_t aType, UintType &aValue) const;
+
+    const Message  *mMessage;
+    uint8_t         mNumEntries;
+    bool            mIsTruncated;
+    Tlv::ParsedInfo mEntries[kMaxEntries];
+};
+
 } // namespace ot
 
 #endif // TLVS_HPP_
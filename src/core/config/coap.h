@@ -47,6 +47,19 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_NUM_QUEUE_PARTITIONS
+ *
+ * Number of partitions of the CoAP pending requests and cached responses.
+ *
+ * Pending requests are partitioned by token and cached responses by Message ID, so matching a received message only
+ * searches one partition.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_NUM_QUEUE_PARTITIONS
+#define OPENTHREAD_CONFIG_COAP_NUM_QUEUE_PARTITIONS 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
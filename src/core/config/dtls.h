@@ -62,4 +62,27 @@
      OPENTHREAD_CONFIG_COMMISSIONER_ENABLE || OPENTHREAD_CONFIG_JOINER_ENABLE)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+ *
+ * Define to 1 to enable the multi-session DTLS server, which allows the application CoAP Secure agent to serve
+ * several peers at the same time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+#define OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SERVER_MAX_SESSIONS
+ *
+ * The maximum number of concurrent sessions of the multi-session DTLS server.
+ *
+ * Each session allocates its own mbedTLS context from the heap, so the heap should be sized accordingly.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SERVER_MAX_SESSIONS
+#define OPENTHREAD_CONFIG_DTLS_SERVER_MAX_SESSIONS 4
+#endif
+
 #endif // CONFIG_DTLS_H_
@@ -105,6 +105,61 @@
 #define OPENTHREAD_CONFIG_HISTORY_TRACKER_TX_LIST_SIZE 32
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+ *
+ * Define as 1 to keep the RX and TX history in a compact form.
+ *
+ * Entries are then appended to a byte buffer (instead of a fixed array of entries) with delta-encoded timestamps,
+ * IPv6 addresses and neighbor RLOC16s replaced by indexes into a small dictionary, and flags packed into bits. An
+ * entry typically takes 10 to 20 bytes instead of about 50 bytes. The number of entries then depends on the buffer
+ * sizes `OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_RX_BUFFER_SIZE` and
+ * `OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_TX_BUFFER_SIZE`. Setting the RX or TX list size to zero still disables
+ * the corresponding history.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_RX_BUFFER_SIZE
+ *
+ * Specifies the size (in bytes) of the buffer holding the compact RX history.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_RX_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_RX_BUFFER_SIZE 1024
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_TX_BUFFER_SIZE
+ *
+ * Specifies the size (in bytes) of the buffer holding the compact TX history.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_TX_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_TX_BUFFER_SIZE 1024
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_DICTIONARY_SIZE
+ *
+ * Specifies the number of IPv6 addresses (and of neighbor RLOC16s) in the dictionary of a compact RX or TX history.
+ *
+ * Addresses and RLOC16s which do not fit in the dictionary are stored in full within the entry.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_DICTIONARY_SIZE
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_DICTIONARY_SIZE 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_EXCLUDE_THREAD_CONTROL_MESSAGES
  *
@@ -129,6 +129,19 @@
 #define OPENTHREAD_CONFIG_IP6_SLAAC_NUM_ADDRESSES 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_SIZE
+ *
+ * The number of destinations for which the result of the default source address selection is remembered.
+ *
+ * The cache is flushed whenever a unicast address is added to, removed from or updated on the Thread network
+ * interface. Set to zero to run the selection rules for every datagram.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_SIZE
+#define OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
  *
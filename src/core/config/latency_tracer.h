@@ -0,0 +1,63 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes compile-time configurations for the Latency Tracer module.
+ *
+ */
+
+#ifndef CONFIG_LATENCY_TRACER_H_
+#define CONFIG_LATENCY_TRACER_H_
+
+/**
+ * @def OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+ *
+ * Define as 1 to enable Latency Tracer module which timestamps sampled messages at each stage of the forwarding path
+ * (from `Ip6::SendDatagram()` down to the radio, and from frame reception up to delivery) and keeps per-stage latency
+ * histograms.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+#define OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LATENCY_TRACER_DEFAULT_SAMPLE_INTERVAL
+ *
+ * Specifies the default sampling interval of Latency Tracer, i.e., one message out of every given number of messages
+ * is traced. Zero disables tracing.
+ *
+ * The sampling interval can be changed at run-time using `otTraceSetSampleInterval()`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LATENCY_TRACER_DEFAULT_SAMPLE_INTERVAL
+#define OPENTHREAD_CONFIG_LATENCY_TRACER_DEFAULT_SAMPLE_INTERVAL 16
+#endif
+
+#endif // CONFIG_LATENCY_TRACER_H_
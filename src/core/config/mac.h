@@ -555,4 +555,30 @@
 #define OPENTHREAD_CONFIG_MAC_DATA_POLL_TIMEOUT 100
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_PLATFORM_RX_DECRYPTION_ENABLE
+ *
+ * Define as 1 to skip the AES-CCM processing of received frames which the platform reports as already decrypted and
+ * authenticated (`mRxInfo.mIsSecurityProcessed`).
+ *
+ * Only enable this on platforms which always initialize `mIsSecurityProcessed` on received frames.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_PLATFORM_RX_DECRYPTION_ENABLE
+#define OPENTHREAD_CONFIG_MAC_PLATFORM_RX_DECRYPTION_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE
+ *
+ * Specifies the number of MAC header templates kept for preparing transmitted frames.
+ *
+ * A frame prepared with the same type, version, addresses, PAN IDs and security settings as a cached template gets
+ * its MAC header copied from the template instead of being built field by field. Set to zero to disable the cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE
+#define OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE 4
+#endif
+
 #endif // CONFIG_MAC_H_
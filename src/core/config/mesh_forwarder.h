@@ -72,6 +72,20 @@
 #define OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES 8
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES
+ *
+ * The number of entries shared by the per-child indirect transmission queues.
+ *
+ * An entry is used for each (message, sleepy child) pair, e.g., a multicast message queued for indirect transmission
+ * to ten sleepy children uses ten entries. When no entry is available, the messages for the affected child are found
+ * by scanning the send queue until all its queued messages are sent or removed.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES
+#define OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES (2 * OPENTHREAD_CONFIG_MLE_MAX_CHILDREN)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_ENABLE
  *
@@ -279,6 +279,9 @@
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 // Internal heap doesn't support size larger than 64K bytes.
 #define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (63 * 1024)
+#elif OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+// Each session of the DTLS server uses its own mbedTLS context.
+#define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (63 * 1024)
 #elif OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 #define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (3136 * sizeof(void *))
 #else
@@ -510,6 +513,43 @@
 #define OPENTHREAD_CONFIG_MLR_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+ *
+ * Define as 1 to batch the Multicast Listener Registrations of the device and of its children into full MLR.req
+ * messages, and to back off exponentially when DUA or MLR registrations with the Primary Backbone Router fail.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+#define OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCH_WINDOW
+ *
+ * The time (in seconds) the first queued Multicast Listener Registration waits for more registrations before an
+ * MLR.req is sent. An MLR.req is sent right away once enough registrations are queued to fill it.
+ *
+ * Applicable only if `OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCH_WINDOW
+#define OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCH_WINDOW 3
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_BBR_REGISTRATION_MAX_BACKOFF
+ *
+ * The maximum delay (in seconds) before retrying a DUA or MLR registration after consecutive failures. The delay
+ * starts at the Reregistration Delay of the Primary Backbone Router and doubles with each failure.
+ *
+ * Applicable only if `OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_BBR_REGISTRATION_MAX_BACKOFF
+#define OPENTHREAD_CONFIG_BBR_REGISTRATION_MAX_BACKOFF 300
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NEIGHBOR_DISCOVERY_AGENT_ENABLE
  *
@@ -65,6 +65,80 @@
 #define OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS 7200
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+ *
+ * Define to 1 to enable port translation (NAPT64) in the NAT64 translator.
+ *
+ * When enabled, Thread hosts share the IPv4 addresses of the configured CIDR. Each TCP/UDP flow and ICMP echo session
+ * is given its own port (or ICMP identifier) on the shared IPv4 address, so a single IPv4 address can serve many
+ * Thread hosts.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+#define OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_MAX_PORT_MAPPINGS
+ *
+ * Specifies maximum number of active port mappings (flows) for NAT64 port translation.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_MAX_PORT_MAPPINGS
+#define OPENTHREAD_CONFIG_NAT64_MAX_PORT_MAPPINGS 1024
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_PORT_MAPPING_HASH_BUCKETS
+ *
+ * Specifies the number of hash buckets used to look up NAT64 port mappings (in each direction).
+ *
+ * Applicable when `OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_PORT_MAPPING_HASH_BUCKETS
+#define OPENTHREAD_CONFIG_NAT64_PORT_MAPPING_HASH_BUCKETS 256
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_UDP_IDLE_TIMEOUT_SECONDS
+ *
+ * Specifies timeout in seconds before removing an inactive UDP port mapping.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE` is enabled. The default follows RFC 4787.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_UDP_IDLE_TIMEOUT_SECONDS
+#define OPENTHREAD_CONFIG_NAT64_UDP_IDLE_TIMEOUT_SECONDS 300
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_TCP_IDLE_TIMEOUT_SECONDS
+ *
+ * Specifies timeout in seconds before removing an inactive TCP port mapping.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE` is enabled. The default follows RFC 5382.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_TCP_IDLE_TIMEOUT_SECONDS
+#define OPENTHREAD_CONFIG_NAT64_TCP_IDLE_TIMEOUT_SECONDS 7440
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_ICMP_IDLE_TIMEOUT_SECONDS
+ *
+ * Specifies timeout in seconds before removing an inactive ICMP echo identifier mapping.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE` is enabled. The default follows RFC 5508.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_ICMP_IDLE_TIMEOUT_SECONDS
+#define OPENTHREAD_CONFIG_NAT64_ICMP_IDLE_TIMEOUT_SECONDS 60
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
  *
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes compile-time configurations for Network Data delta propagation.
+ *
+ */
+
+#ifndef CONFIG_NETDATA_DELTA_H_
+#define CONFIG_NETDATA_DELTA_H_
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+ *
+ * Define to 1 to enable Network Data delta propagation.
+ *
+ * When enabled, a device asks in its MLE Data Request for the Network Data changes relative to the version it already
+ * has. A router or leader that still holds that version in its history answers with a TLV-level delta instead of the
+ * full Network Data, and falls back to the full Network Data otherwise. This is a non-standard extension: devices
+ * that do not support it ignore the request and send the full Network Data.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_DELTA_HISTORY_SIZE
+ *
+ * Specifies the number of past Network Data versions kept by a router or leader to serve deltas from.
+ *
+ * Each entry uses about 260 bytes of RAM. Applicable only on FTD builds.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_DELTA_HISTORY_SIZE
+#define OPENTHREAD_CONFIG_NETDATA_DELTA_HISTORY_SIZE 4
+#endif
+
+#endif // CONFIG_NETDATA_DELTA_H_
@@ -82,4 +82,31 @@
 #define OPENTHREAD_CONFIG_NET_DIAG_VENDOR_INFO_SET_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NET_DIAG_MAX_ANSWER_STREAMS
+ *
+ * The maximum number of Network Diagnostic queries (DIAG_GET.qry) that an FTD answers at the same time.
+ *
+ * The answers to a query are prepared one message at a time, so each query in progress holds at most one answer
+ * message. A query received while all streams are in use is dropped.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NET_DIAG_MAX_ANSWER_STREAMS
+#define OPENTHREAD_CONFIG_NET_DIAG_MAX_ANSWER_STREAMS 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NET_DIAG_QUERY_ANSWER_JITTER
+ *
+ * The maximum random delay (in milliseconds) before an FTD sends its first answer to a multicast Network Diagnostic
+ * query (DIAG_GET.qry).
+ *
+ * Spreads the answers of all devices receiving the query so that they do not reach the requester all at once. Set to
+ * zero to answer immediately.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NET_DIAG_QUERY_ANSWER_JITTER
+#define OPENTHREAD_CONFIG_NET_DIAG_QUERY_ANSWER_JITTER 0
+#endif
+
 #endif // CONFIG_NETWORK_DIAGNOSTIC_H_
@@ -109,4 +109,33 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT ((4 * 250u) + 250u)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+ *
+ * Define to 1 to verify the signatures of received SRP updates asynchronously.
+ *
+ * When enabled, a received SRP update is parsed and its signed hash is computed right away, but the ECDSA signature
+ * check is queued. The platform may take the check over through `otPlatCryptoEcdsaVerifyStart()`. Otherwise the
+ * server verifies one queued signature per tasklet run, so that a burst of SRP updates (e.g., after a reboot of the
+ * Border Router) does not stall other OpenThread processing.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_SIGNATURE_VERIFICATIONS
+ *
+ * Specifies the maximum number of received SRP updates waiting for their signature to be verified.
+ *
+ * Further SRP updates are answered with a server failure response, and the SRP clients retry them later.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_SIGNATURE_VERIFICATIONS
+#define OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_SIGNATURE_VERIFICATIONS 32
+#endif
+
 #endif // CONFIG_SRP_SERVER_H_
@@ -711,6 +711,42 @@ OT_TOOL_WEAK otError otPlatCryptoEcdsaVerify(const otPlatCryptoEcdsaPublicKey *a
 
 #endif // #if OPENTHREAD_CONFIG_CRYPTO_LIB == OPENTHREAD_CONFIG_CRYPTO_LIB_MBEDTLS
 
+#if !OPENTHREAD_RADIO && OPENTHREAD_CONFIG_ECDSA_ENABLE
+
+OT_TOOL_WEAK otError otPlatCryptoEcdsaVerifyStart(otInstance                       *aInstance,
+                                                  const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                                  const otPlatCryptoSha256Hash     *aHash,
+                                                  const otPlatCryptoEcdsaSignature *aSignature,
+                                                  void                             *aContext)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aPublicKey);
+    OT_UNUSED_VARIABLE(aHash);
+    OT_UNUSED_VARIABLE(aSignature);
+    OT_UNUSED_VARIABLE(aContext);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+extern "C" void otPlatCryptoEcdsaVerifyDone(otInstance *aInstance, void *aContext, otError aError)
+{
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    Instance &instance = AsCoreType(aInstance);
+
+    VerifyOrExit(instance.IsInitialized());
+    instance.Get<Srp::Server>().HandleSignatureVerifyDone(aContext, aError);
+
+exit:
+    return;
+#else
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aError);
+#endif
+}
+
+#endif // #if !OPENTHREAD_RADIO && OPENTHREAD_CONFIG_ECDSA_ENABLE
+
 //---------------------------------------------------------------------------------------------------------------------
 // APIs to be used in "hybrid" mode by every OPENTHREAD_CONFIG_CRYPTO_LIB variant until full PSA support is ready
 
@@ -104,6 +104,9 @@ Mac::Mac(Instance &aInstance)
     , mTimer(aInstance)
     , mKeyIdMode2FrameCounter(0)
     , mCcaSampleCount(0)
+#if OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE > 0
+    , mNextHeaderTemplate(0)
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     , mTxError(kErrorNone)
 #endif
@@ -118,6 +121,13 @@ Mac::Mac(Instance &aInstance)
     mCcaSuccessRateTracker.Clear();
     ResetCounters();
 
+#if OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE > 0
+    for (HeaderTemplate &headerTemplate : mHeaderTemplates)
+    {
+        headerTemplate.mHeaderLength = 0;
+    }
+#endif
+
     SetEnabled(true);
 
     Get<KeyManager>().UpdateKeyMaterial();
@@ -841,6 +851,91 @@ bool Mac::IsJoinable(void) const
     return (numUnsecurePorts != 0);
 }
 
+void Mac::InitTxFrameMacHeader(TxFrame             &aFrame,
+                               Frame::Type          aType,
+                               Frame::Version       aVersion,
+                               const Addresses     &aAddrs,
+                               const PanIds        &aPanIds,
+                               Frame::SecurityLevel aSecurityLevel,
+                               Frame::KeyIdMode     aKeyIdMode)
+{
+#if OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE > 0
+    HeaderTemplate *headerTemplate;
+    uint8_t         headerLength;
+
+    // The header built by `InitMacHeader()` only depends on the
+    // parameters (and the radio type), so a matching template can
+    // be copied as is. Frame counter and key index bytes are left
+    // to be written on transmission, as with a freshly built header.
+
+    for (const HeaderTemplate &entry : mHeaderTemplates)
+    {
+        if (entry.Matches(aFrame, aType, aVersion, aAddrs, aPanIds, aSecurityLevel, aKeyIdMode))
+        {
+            memcpy(aFrame.GetPsdu(), entry.mHeader, entry.mHeaderLength);
+            aFrame.SetLength(entry.mFrameLength);
+            mCounters.mTxHeaderTemplateHit++;
+            ExitNow();
+        }
+    }
+
+    mCounters.mTxHeaderTemplateMiss++;
+#endif
+
+    aFrame.InitMacHeader(aType, aVersion, aAddrs, aPanIds, aSecurityLevel, aKeyIdMode);
+
+#if OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE > 0
+    headerLength = aFrame.GetHeaderLength();
+    VerifyOrExit(headerLength <= HeaderTemplate::kMaxHeaderLength);
+
+    headerTemplate = &mHeaderTemplates[mNextHeaderTemplate];
+    mNextHeaderTemplate++;
+
+    if (mNextHeaderTemplate == GetArrayLength(mHeaderTemplates))
+    {
+        mNextHeaderTemplate = 0;
+    }
+
+    headerTemplate->mAddrs         = aAddrs;
+    headerTemplate->mPanIds        = aPanIds;
+    headerTemplate->mType          = aType;
+    headerTemplate->mVersion       = aVersion;
+    headerTemplate->mSecurityLevel = aSecurityLevel;
+    headerTemplate->mKeyIdMode     = aKeyIdMode;
+#if OPENTHREAD_CONFIG_MULTI_RADIO
+    headerTemplate->mRadioType = aFrame.GetRadioType();
+#endif
+    headerTemplate->mHeaderLength = headerLength;
+    headerTemplate->mFrameLength  = aFrame.GetLength();
+    memcpy(headerTemplate->mHeader, aFrame.GetPsdu(), headerLength);
+
+exit:
+    return;
+#endif
+}
+
+#if OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE > 0
+bool Mac::HeaderTemplate::Matches(const TxFrame       &aFrame,
+                                  Frame::Type          aType,
+                                  Frame::Version       aVersion,
+                                  const Addresses     &aAddrs,
+                                  const PanIds        &aPanIds,
+                                  Frame::SecurityLevel aSecurityLevel,
+                                  Frame::KeyIdMode     aKeyIdMode) const
+{
+    OT_UNUSED_VARIABLE(aFrame);
+
+    return (mHeaderLength != 0) && (mAddrs.mDestination == aAddrs.mDestination) &&
+           (mAddrs.mSource == aAddrs.mSource) && (mPanIds.mDestination == aPanIds.mDestination) &&
+           (mPanIds.mSource == aPanIds.mSource) && (mType == aType) && (mVersion == aVersion) &&
+           (mSecurityLevel == aSecurityLevel) &&
+#if OPENTHREAD_CONFIG_MULTI_RADIO
+           (mRadioType == aFrame.GetRadioType()) &&
+#endif
+           (mKeyIdMode == aKeyIdMode);
+}
+#endif
+
 void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
 {
     KeyManager       &keyManager = Get<KeyManager>();
@@ -1595,7 +1690,12 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         ExitNow();
     }
 
-    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+#if OPENTHREAD_CONFIG_MAC_PLATFORM_RX_DECRYPTION_ENABLE
+    if ((keyIdMode != Frame::kKeyIdMode1) || !aFrame.IsSecurityProcessed())
+#endif
+    {
+        SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    }
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -2336,7 +2436,7 @@ void Mac::ProcessCsl(const RxFrame &aFrame, const Address &aSrcAddr)
             ToUlong(static_cast<uint32_t>(aFrame.GetTimestamp())), aFrame.GetSequence(), csl->GetPeriod(),
             csl->GetPhase(), child->GetCslPhase());
 
-    Get<CslTxScheduler>().Update();
+    Get<CslTxScheduler>().Update(*child);
 
 exit:
     return;
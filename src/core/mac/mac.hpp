@@ -504,6 +504,30 @@ public:
      */
     otMacCounters &GetCounters(void) { return mCounters; }
 
+    /**
+     * Initializes the MAC header of a frame to be transmitted.
+     *
+     * Produces the same header as `TxFrame::InitMacHeader()`. When a cached header template matches all of the given
+     * parameters, the header bytes are copied from it (the sequence number and frame counter are set later on
+     * transmission). Otherwise the header is built and saved as a template, replacing the oldest one.
+     *
+     * @param[in,out] aFrame          The frame to initialize.
+     * @param[in]     aType           Frame type.
+     * @param[in]     aVersion        Frame version.
+     * @param[in]     aAddrs          Frame source and destination addresses.
+     * @param[in]     aPanIds         Source and destination PAN IDs.
+     * @param[in]     aSecurityLevel  Frame security level.
+     * @param[in]     aKeyIdMode      Frame security key ID mode.
+     *
+     */
+    void InitTxFrameMacHeader(TxFrame             &aFrame,
+                              Frame::Type          aType,
+                              Frame::Version       aVersion,
+                              const Addresses     &aAddrs,
+                              const PanIds        &aPanIds,
+                              Frame::SecurityLevel aSecurityLevel,
+                              Frame::KeyIdMode     aKeyIdMode);
+
 #if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
     /**
      * Returns the MAC retry histogram for direct transmission.
@@ -761,6 +785,36 @@ private:
     };
 #endif // OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
 
+#if OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE > 0
+    struct HeaderTemplate
+    {
+        // FCF, sequence number, two PAN IDs, two extended addresses
+        // and the largest auxiliary security header.
+        static constexpr uint8_t kMaxHeaderLength = 37;
+
+        bool Matches(const TxFrame       &aFrame,
+                     Frame::Type          aType,
+                     Frame::Version       aVersion,
+                     const Addresses     &aAddrs,
+                     const PanIds        &aPanIds,
+                     Frame::SecurityLevel aSecurityLevel,
+                     Frame::KeyIdMode     aKeyIdMode) const;
+
+        Addresses            mAddrs;
+        PanIds               mPanIds;
+        Frame::Type          mType;
+        Frame::Version       mVersion;
+        Frame::SecurityLevel mSecurityLevel;
+        Frame::KeyIdMode     mKeyIdMode;
+#if OPENTHREAD_CONFIG_MULTI_RADIO
+        RadioType mRadioType;
+#endif
+        uint8_t  mHeaderLength; // Zero for an unused template.
+        uint16_t mFrameLength;
+        uint8_t  mHeader[kMaxHeaderLength];
+    };
+#endif
+
     Error ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor);
     void  ProcessTransmitSecurity(TxFrame &aFrame);
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
@@ -866,6 +920,10 @@ private:
 #if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
     RetryHistogram mRetryHistogram;
 #endif
+#if OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE > 0
+    HeaderTemplate mHeaderTemplates[OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE];
+    uint8_t        mNextHeaderTemplate;
+#endif
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     RadioTypes mTxPendingRadioLinks;
@@ -1211,6 +1211,15 @@ public:
      */
     const uint64_t &GetTimestamp(void) const { return mInfo.mRxInfo.mTimestamp; }
 
+    /**
+     * Indicates whether or not the platform has already decrypted the frame and verified its MIC.
+     *
+     * @retval TRUE   The frame was decrypted and authenticated by the platform.
+     * @retval FALSE  The frame still needs AES CCM processing.
+     *
+     */
+    bool IsSecurityProcessed(void) const { return mInfo.mRxInfo.mIsSecurityProcessed; }
+
     /**
      * Performs AES CCM on the frame which is received.
      *
@@ -393,6 +393,17 @@ public:
      */
     bool IsShortAddrInvalid(void) const { return ((mType == kTypeShort) && (GetShort() == kShortAddrInvalid)); }
 
+    /**
+     * Overloads operator `==` to evaluate whether or not two `Address` instances are equal.
+     *
+     * @param[in]  aOther  The other `Address` instance to compare with.
+     *
+     * @retval TRUE   If the two addresses have the same type and value.
+     * @retval FALSE  If the two addresses are not equal.
+     *
+     */
+    bool operator==(const Address &aOther) const;
+
     /**
      * Converts an address to a null-terminated string
      *
@@ -547,6 +547,10 @@ void SubMac::BeginTransmit(void)
 
     SetState(kStateTransmit);
 
+#if (OPENTHREAD_MTD || OPENTHREAD_FTD) && OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    Get<Utils::LatencyTracer>().HandleRadioTxStart();
+#endif
+
     if (mPcapCallback.IsSet())
     {
         mPcapCallback.Invoke(&mTransmitFrame, true);
@@ -78,6 +78,9 @@ Dtls::Dtls(Instance &aInstance, bool aLayerTwoSecurity)
     , mState(kStateClosed)
     , mPskLength(0)
     , mVerifyPeerCertificate(true)
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    , mSharedCookieCtx(nullptr)
+#endif
     , mTimer(aInstance, Dtls::HandleTimer, this)
     , mTimerIntermediate(0)
     , mTimerSet(false)
@@ -315,10 +318,21 @@ Error Dtls::Setup(bool aClient)
 #if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
     if (!aClient)
     {
-        rval = mbedtls_ssl_cookie_setup(&mCookieCtx, Crypto::MbedTls::CryptoSecurePrng, nullptr);
-        VerifyOrExit(rval == 0);
+        mbedtls_ssl_cookie_ctx *cookieCtx = &mCookieCtx;
+
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+        if (mSharedCookieCtx != nullptr)
+        {
+            cookieCtx = mSharedCookieCtx;
+        }
+        else
+#endif
+        {
+            rval = mbedtls_ssl_cookie_setup(&mCookieCtx, Crypto::MbedTls::CryptoSecurePrng, nullptr);
+            VerifyOrExit(rval == 0);
+        }
 
-        mbedtls_ssl_conf_dtls_cookies(&mConf, mbedtls_ssl_cookie_write, mbedtls_ssl_cookie_check, &mCookieCtx);
+        mbedtls_ssl_conf_dtls_cookies(&mConf, mbedtls_ssl_cookie_write, mbedtls_ssl_cookie_check, cookieCtx);
     }
 #endif
 
@@ -552,6 +566,35 @@ exit:
 
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+void Dtls::SetSecurityConfig(const Dtls &aDtls)
+{
+    memcpy(mCipherSuites, aDtls.mCipherSuites, sizeof(mCipherSuites));
+    memcpy(mPsk, aDtls.mPsk, sizeof(mPsk));
+    mPskLength             = aDtls.mPskLength;
+    mVerifyPeerCertificate = aDtls.mVerifyPeerCertificate;
+    mLayerTwoSecurity      = aDtls.mLayerTwoSecurity;
+    mMessageDefaultSubType = aDtls.mMessageDefaultSubType;
+
+#if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
+#ifdef MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
+    mCaChainSrc       = aDtls.mCaChainSrc;
+    mCaChainLength    = aDtls.mCaChainLength;
+    mOwnCertSrc       = aDtls.mOwnCertSrc;
+    mOwnCertLength    = aDtls.mOwnCertLength;
+    mPrivateKeySrc    = aDtls.mPrivateKeySrc;
+    mPrivateKeyLength = aDtls.mPrivateKeyLength;
+#endif
+#ifdef MBEDTLS_KEY_EXCHANGE_PSK_ENABLED
+    mPreSharedKey         = aDtls.mPreSharedKey;
+    mPreSharedKeyIdentity = aDtls.mPreSharedKeyIdentity;
+    mPreSharedKeyLength   = aDtls.mPreSharedKeyLength;
+    mPreSharedKeyIdLength = aDtls.mPreSharedKeyIdLength;
+#endif
+#endif
+}
+#endif // OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+
 #ifdef MBEDTLS_SSL_SRV_C
 Error Dtls::SetClientId(const uint8_t *aClientId, uint8_t aLength)
 {
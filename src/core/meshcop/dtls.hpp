@@ -342,6 +342,39 @@ public:
      */
     const Ip6::MessageInfo &GetMessageInfo(void) const { return mMessageInfo; }
 
+    /**
+     * Indicates whether or not the DTLS messages are sent with layer two security.
+     *
+     * @retval TRUE   The DTLS messages are sent with layer two security.
+     * @retval FALSE  The DTLS messages are sent without layer two security.
+     *
+     */
+    bool IsLayerTwoSecurityEnabled(void) const { return mLayerTwoSecurity; }
+
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    /**
+     * Copies the security configuration (cipher suite, PSK, certificates, authentication mode and layer two security)
+     * of another DTLS object.
+     *
+     * The certificates and PSK identity are referenced, not copied, and MUST outlive this DTLS object.
+     *
+     * @param[in]  aDtls  The DTLS object to copy the security configuration from.
+     *
+     */
+    void SetSecurityConfig(const Dtls &aDtls);
+
+    /**
+     * Sets the cookie context used to verify the ClientHello cookies when acting as a server.
+     *
+     * Allows a multi-session server to verify the cookies it issued before the session was created. By default, each
+     * session uses its own cookie context.
+     *
+     * @param[in]  aCookieCtx  A pointer to the shared cookie context.
+     *
+     */
+    void SetCookieContext(mbedtls_ssl_cookie_ctx *aCookieCtx) { mSharedCookieCtx = aCookieCtx; }
+#endif
+
     void HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
 private:
@@ -487,6 +520,9 @@ private:
 #ifdef MBEDTLS_SSL_COOKIE_C
     mbedtls_ssl_cookie_ctx mCookieCtx;
 #endif
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    mbedtls_ssl_cookie_ctx *mSharedCookieCtx;
+#endif
 
     TimerMilliContext mTimer;
 
@@ -0,0 +1,489 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the multi-session DTLS server.
+ */
+
+#include "dtls_server.hpp"
+
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+
+#include "common/as_core_type.hpp"
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+#include "common/instance.hpp"
+#include "common/log.hpp"
+#include "crypto/mbedtls.hpp"
+
+namespace ot {
+namespace MeshCoP {
+
+RegisterLogModule("DtlsServer");
+
+DtlsServer::DtlsServer(Instance &aInstance, const Dtls &aConfig)
+    : InstanceLocator(aInstance)
+    , mConfig(aConfig)
+    , mIsRunning(false)
+    , mNumSessions(0)
+    , mSocket(aInstance)
+    , mTasklet(aInstance, DtlsServer::HandleTasklet, this)
+{
+    memset(&mCookieCtx, 0, sizeof(mCookieCtx));
+    memset(&mCounters, 0, sizeof(mCounters));
+}
+
+Error DtlsServer::Start(uint16_t         aPort,
+                        ReceiveHandler   aReceiveHandler,
+                        ConnectedHandler aConnectedHandler,
+                        void            *aContext)
+{
+    Error error;
+
+    VerifyOrExit(!mIsRunning, error = kErrorAlready);
+
+    SuccessOrExit(error = mSocket.Open(&DtlsServer::HandleUdpReceive, this));
+
+    error = mSocket.Bind(aPort, Ip6::kNetifUnspecified);
+
+    if (error == kErrorNone)
+    {
+        error = StartCookies();
+    }
+
+    if (error != kErrorNone)
+    {
+        IgnoreError(mSocket.Close());
+        ExitNow();
+    }
+
+    mReceiveCallback.Set(aReceiveHandler, aContext);
+    mConnectedCallback.Set(aConnectedHandler, aContext);
+    mIsRunning = true;
+
+exit:
+    return error;
+}
+
+Error DtlsServer::Start(Dtls::TransportCallback aTransportCallback,
+                        ReceiveHandler          aReceiveHandler,
+                        ConnectedHandler        aConnectedHandler,
+                        void                   *aContext)
+{
+    Error error;
+
+    VerifyOrExit(!mIsRunning, error = kErrorAlready);
+
+    SuccessOrExit(error = StartCookies());
+
+    mTransportCallback.Set(aTransportCallback, aContext);
+    mReceiveCallback.Set(aReceiveHandler, aContext);
+    mConnectedCallback.Set(aConnectedHandler, aContext);
+    mIsRunning = true;
+
+exit:
+    return error;
+}
+
+Error DtlsServer::StartCookies(void)
+{
+    int rval;
+
+    mbedtls_ssl_cookie_init(&mCookieCtx);
+
+    rval = mbedtls_ssl_cookie_setup(&mCookieCtx, Crypto::MbedTls::CryptoSecurePrng, nullptr);
+
+    if (rval != 0)
+    {
+        mbedtls_ssl_cookie_free(&mCookieCtx);
+    }
+
+    return Crypto::MbedTls::MapError(rval);
+}
+
+void DtlsServer::Stop(void)
+{
+    VerifyOrExit(mIsRunning);
+
+    while (!mSessions.IsEmpty())
+    {
+        RemoveSession(*mSessions.GetHead());
+    }
+
+    mbedtls_ssl_cookie_free(&mCookieCtx);
+    IgnoreError(mSocket.Close());
+
+    mTransportCallback.Clear();
+    mReceiveCallback.Clear();
+    mConnectedCallback.Clear();
+    mIsRunning = false;
+
+exit:
+    return;
+}
+
+void DtlsServer::DisconnectAll(void)
+{
+    for (Session &session : mSessions)
+    {
+        session.Disconnect();
+    }
+}
+
+DtlsServer::Session *DtlsServer::FindSession(const Ip6::MessageInfo &aMessageInfo)
+{
+    return mSessions.FindMatching(aMessageInfo);
+}
+
+Error DtlsServer::Send(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error    error   = kErrorNone;
+    Session *session = FindSession(aMessageInfo);
+
+    VerifyOrExit((session != nullptr) && session->IsConnected(), error = kErrorNotFound);
+
+    session->mTransmitQueue.Enqueue(aMessage);
+    mTasklet.Post();
+
+exit:
+    return error;
+}
+
+void DtlsServer::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    static_cast<DtlsServer *>(aContext)->HandleUdpReceive(AsCoreType(aMessage), AsCoreType(aMessageInfo));
+}
+
+void DtlsServer::HandleUdpReceive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Session *session;
+
+    VerifyOrExit(mIsRunning);
+
+    session = FindSession(aMessageInfo);
+
+    if (session == nullptr)
+    {
+        HandleNewPeer(aMessage, aMessageInfo);
+        ExitNow();
+    }
+
+    session->HandleUdpReceive(aMessage, aMessageInfo);
+
+exit:
+    return;
+}
+
+void DtlsServer::HandleNewPeer(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    ClientHello clientHello;
+    Session    *session;
+
+    // Only a ClientHello can start a session. It is answered with a
+    // HelloVerifyRequest (keeping no state) unless it echoes a valid
+    // cookie for the peer's address.
+
+    SuccessOrExit(ParseClientHello(aMessage, clientHello));
+
+    if ((clientHello.mCookieLength == 0) ||
+        (mbedtls_ssl_cookie_check(&mCookieCtx, clientHello.mCookie, clientHello.mCookieLength,
+                                  aMessageInfo.GetPeerAddr().GetBytes(), sizeof(Ip6::Address)) != 0))
+    {
+        IgnoreError(SendHelloVerifyRequest(clientHello, aMessageInfo));
+        ExitNow();
+    }
+
+    if (mNumSessions >= kMaxSessions)
+    {
+        mCounters.mSessionsRejected++;
+        LogNote("Rejected peer %s, all sessions in use", aMessageInfo.GetPeerAddr().ToString().AsCString());
+        ExitNow();
+    }
+
+    session = Session::Allocate(GetInstance(), *this, aMessageInfo);
+
+    if (session == nullptr)
+    {
+        mCounters.mSessionsRejected++;
+        ExitNow();
+    }
+
+    if (session->Start() != kErrorNone)
+    {
+        session->Free();
+        ExitNow();
+    }
+
+    mSessions.Push(*session);
+    mNumSessions++;
+    mCounters.mSessionsStarted++;
+
+    session->HandleUdpReceive(aMessage, aMessageInfo);
+
+    if (!session->IsConnectionActive())
+    {
+        // The session could not be set up.
+        RemoveSession(*session);
+    }
+
+exit:
+    return;
+}
+
+Error DtlsServer::ParseClientHello(const ot::Message &aMessage, ClientHello &aClientHello) const
+{
+    Error    error;
+    uint16_t offset = aMessage.GetOffset();
+    uint8_t  length;
+    uint32_t handshakeLength;
+
+    SuccessOrExit(error = aMessage.Read(offset, aClientHello.mRecordHeader));
+    offset += kRecordHeaderSize;
+
+    // Content type, then the epoch (bytes 3 and 4) which is zero
+    // before the first ChangeCipherSpec.
+    VerifyOrExit(aClientHello.mRecordHeader[0] == kContentTypeHandshake, error = kErrorParse);
+    VerifyOrExit(Encoding::BigEndian::ReadUint16(&aClientHello.mRecordHeader[3]) == 0, error = kErrorParse);
+
+    SuccessOrExit(error = aMessage.Read(offset, aClientHello.mHandshakeHeader));
+    offset += kHandshakeHeaderSize;
+
+    // Message type, length, message sequence, fragment offset and
+    // fragment length. Only an unfragmented ClientHello is accepted.
+    handshakeLength = Encoding::BigEndian::ReadUint24(&aClientHello.mHandshakeHeader[1]);
+
+    VerifyOrExit(aClientHello.mHandshakeHeader[0] == kHandshakeClientHello, error = kErrorParse);
+    VerifyOrExit(Encoding::BigEndian::ReadUint24(&aClientHello.mHandshakeHeader[6]) == 0, error = kErrorParse);
+    VerifyOrExit(Encoding::BigEndian::ReadUint24(&aClientHello.mHandshakeHeader[9]) == handshakeLength,
+                 error = kErrorParse);
+
+    // Skip `client_version`, `random` and `session_id`.
+    offset += sizeof(uint16_t) + kRandomSize;
+    SuccessOrExit(error = aMessage.Read(offset, length));
+    offset += sizeof(uint8_t) + length;
+
+    SuccessOrExit(error = aMessage.Read(offset, length));
+    offset += sizeof(uint8_t);
+
+    // A cookie longer than the ones we issue can not be valid, it is
+    // treated as missing.
+    aClientHello.mCookieLength = (length <= kMaxCookieLength) ? length : 0;
+
+    error = aMessage.Read(offset, aClientHello.mCookie, aClientHello.mCookieLength);
+
+exit:
+    return error;
+}
+
+Error DtlsServer::SendHelloVerifyRequest(const ClientHello &aClientHello, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error        error   = kErrorNone;
+    ot::Message *message = nullptr;
+    uint8_t      cookie[kMaxCookieLength];
+    uint8_t     *cookieEnd = cookie;
+    uint8_t      recordHeader[kRecordHeaderSize];
+    uint8_t      handshakeHeader[kHandshakeHeaderSize];
+    uint16_t     bodyLength;
+
+    VerifyOrExit(mbedtls_ssl_cookie_write(&mCookieCtx, &cookieEnd, GetArrayEnd(cookie),
+                                          aMessageInfo.GetPeerAddr().GetBytes(), sizeof(Ip6::Address)) == 0,
+                 error = kErrorFailed);
+
+    // `server_version`, cookie length and cookie.
+    bodyLength = sizeof(uint16_t) + sizeof(uint8_t) + static_cast<uint16_t>(cookieEnd - cookie);
+
+    // The record echoes the version and the sequence number of the
+    // ClientHello record (RFC 6347 - 4.2.1), and the handshake echoes its
+    // message sequence.
+    memcpy(recordHeader, aClientHello.mRecordHeader, sizeof(recordHeader));
+    Encoding::BigEndian::WriteUint16(kHandshakeHeaderSize + bodyLength, &recordHeader[11]);
+
+    handshakeHeader[0] = kHandshakeHelloVerifyRequest;
+    Encoding::BigEndian::WriteUint24(bodyLength, &handshakeHeader[1]);
+    memcpy(&handshakeHeader[4], &aClientHello.mHandshakeHeader[4], sizeof(uint16_t));
+    Encoding::BigEndian::WriteUint24(0, &handshakeHeader[6]);
+    Encoding::BigEndian::WriteUint24(bodyLength, &handshakeHeader[9]);
+
+    VerifyOrExit((message = mSocket.NewMessage()) != nullptr, error = kErrorNoBufs);
+    message->SetLinkSecurityEnabled(mConfig.IsLayerTwoSecurityEnabled());
+
+    SuccessOrExit(error = message->Append(recordHeader));
+    SuccessOrExit(error = message->Append(handshakeHeader));
+    SuccessOrExit(error = message->Append<uint16_t>(Encoding::BigEndian::HostSwap16(kHelloVerifyRequestVersion)));
+    SuccessOrExit(error = message->Append<uint8_t>(static_cast<uint8_t>(cookieEnd - cookie)));
+    SuccessOrExit(error = message->AppendBytes(cookie, static_cast<uint16_t>(cookieEnd - cookie)));
+
+    SuccessOrExit(error = SendMessage(*message, aMessageInfo));
+
+    mCounters.mHelloVerifyRequests++;
+
+exit:
+    FreeMessageOnError(message, error);
+    return error;
+}
+
+Error DtlsServer::SendMessage(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error error;
+
+    if (mTransportCallback.IsSet())
+    {
+        error = mTransportCallback.Invoke(aMessage, aMessageInfo);
+    }
+    else
+    {
+        error = mSocket.SendTo(aMessage, aMessageInfo);
+    }
+
+    return error;
+}
+
+void DtlsServer::RemoveSession(Session &aSession)
+{
+    aSession.Close();
+    aSession.mTransmitQueue.DequeueAndFreeAll();
+
+    // Freeing the returned `OwnedPtr` frees the session.
+    mSessions.RemoveMatching(aSession);
+    mNumSessions--;
+}
+
+void DtlsServer::HandleSessionReceive(Session &aSession, uint8_t *aBuf, uint16_t aLength)
+{
+    mReceiveCallback.InvokeIfSet(aSession, aBuf, aLength);
+}
+
+void DtlsServer::HandleSessionConnected(Session &aSession, bool aConnected)
+{
+    if (aConnected)
+    {
+        mCounters.mSessionsConnected++;
+    }
+    else
+    {
+        // The session reports being disconnected once its close guard
+        // time expires, from its own timer handler. It is freed from
+        // the tasklet.
+        aSession.mIsReleased = true;
+        mTasklet.Post();
+    }
+
+    mConnectedCallback.InvokeIfSet(aSession, aConnected);
+}
+
+void DtlsServer::HandleTasklet(Tasklet &aTasklet)
+{
+    static_cast<DtlsServer *>(static_cast<TaskletContext &>(aTasklet).GetContext())->HandleTasklet();
+}
+
+void DtlsServer::HandleTasklet(void)
+{
+    Session *session;
+
+    for (Session &entry : mSessions)
+    {
+        ot::Message *message;
+
+        while (!entry.mIsReleased && ((message = entry.mTransmitQueue.GetHead()) != nullptr))
+        {
+            Error error;
+
+            entry.mTransmitQueue.Dequeue(*message);
+
+            error = entry.Dtls::Send(*message, message->GetLength());
+
+            if (error != kErrorNone)
+            {
+                LogNote("Transmit: %s", ErrorToString(error));
+                message->Free();
+            }
+        }
+    }
+
+    while ((session = mSessions.FindMatching(/* aIsReleased */ true)) != nullptr)
+    {
+        RemoveSession(*session);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// DtlsServer::Session
+
+DtlsServer::Session::Session(Instance &aInstance, DtlsServer &aServer, const Ip6::MessageInfo &aMessageInfo)
+    : Dtls(aInstance, /* aLayerTwoSecurity */ false)
+    , mNext(nullptr)
+    , mServer(aServer)
+    , mPeerSockAddr(aMessageInfo.GetPeerAddr(), aMessageInfo.GetPeerPort())
+    , mIsReleased(false)
+{
+    SetSecurityConfig(aServer.mConfig);
+}
+
+Error DtlsServer::Session::Start(void)
+{
+    Error error;
+
+    SuccessOrExit(error = Open(&Session::HandleReceive, &Session::HandleConnected, this));
+    SuccessOrExit(error = Bind(&Session::HandleTransmit, this));
+
+    SetCookieContext(&mServer.mCookieCtx);
+
+exit:
+    return error;
+}
+
+bool DtlsServer::Session::Matches(const Ip6::MessageInfo &aMessageInfo) const
+{
+    return !mIsReleased && (mPeerSockAddr.GetAddress() == aMessageInfo.GetPeerAddr()) &&
+           (mPeerSockAddr.GetPort() == aMessageInfo.GetPeerPort());
+}
+
+void DtlsServer::Session::HandleReceive(void *aContext, uint8_t *aBuf, uint16_t aLength)
+{
+    Session *session = static_cast<Session *>(aContext);
+
+    session->mServer.HandleSessionReceive(*session, aBuf, aLength);
+}
+
+void DtlsServer::Session::HandleConnected(void *aContext, bool aConnected)
+{
+    Session *session = static_cast<Session *>(aContext);
+
+    session->mServer.HandleSessionConnected(*session, aConnected);
+}
+
+Error DtlsServer::Session::HandleTransmit(void *aContext, ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    return static_cast<Session *>(aContext)->mServer.SendMessage(aMessage, aMessageInfo);
+}
+
+} // namespace MeshCoP
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
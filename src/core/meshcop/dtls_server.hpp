@@ -0,0 +1,340 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the multi-session DTLS server.
+ */
+
+#ifndef DTLS_SERVER_HPP_
+#define DTLS_SERVER_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+
+#if !OPENTHREAD_CONFIG_DTLS_ENABLE
+#error "OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE requires OPENTHREAD_CONFIG_DTLS_ENABLE"
+#endif
+
+#include <mbedtls/ssl_cookie.h>
+
+#if !defined(MBEDTLS_SSL_SRV_C) || !defined(MBEDTLS_SSL_COOKIE_C)
+#error "OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE requires MBEDTLS_SSL_SRV_C and MBEDTLS_SSL_COOKIE_C"
+#endif
+
+#include "common/callback.hpp"
+#include "common/heap_allocatable.hpp"
+#include "common/linked_list.hpp"
+#include "common/locator.hpp"
+#include "common/message.hpp"
+#include "common/non_copyable.hpp"
+#include "common/owning_list.hpp"
+#include "common/tasklet.hpp"
+#include "meshcop/dtls.hpp"
+#include "net/socket.hpp"
+#include "net/udp6.hpp"
+
+namespace ot {
+namespace MeshCoP {
+
+/**
+ * Implements a DTLS server serving several peers at the same time.
+ *
+ * Each peer (identified by its socket address) gets its own DTLS session, with its own handshake state and timers.
+ * The number of sessions is bounded by `OPENTHREAD_CONFIG_DTLS_SERVER_MAX_SESSIONS`. A session and its mbedTLS
+ * context are allocated from the heap when a peer starts a handshake, and freed once the session is closed.
+ *
+ * New peers go through a stateless cookie exchange first: a ClientHello from an unknown peer is answered with a
+ * HelloVerifyRequest without allocating anything, and a session is only allocated once the peer echoes a valid
+ * cookie. This bounds the state a spoofed peer can make the server keep.
+ *
+ */
+class DtlsServer : public InstanceLocator, private NonCopyable
+{
+public:
+    static constexpr uint16_t kMaxSessions = OPENTHREAD_CONFIG_DTLS_SERVER_MAX_SESSIONS; ///< Max number of sessions.
+
+    /**
+     * Represents a DTLS session with a peer.
+     *
+     */
+    class Session : public Dtls, public LinkedListEntry<Session>, public Heap::Allocatable<Session>
+    {
+        friend class DtlsServer;
+        friend class LinkedList<Session>;
+        friend class LinkedListEntry<Session>;
+        friend class Heap::Allocatable<Session>;
+
+    public:
+        /**
+         * Returns the socket address of the peer.
+         *
+         * @returns The socket address of the peer.
+         *
+         */
+        const Ip6::SockAddr &GetPeerSockAddr(void) const { return mPeerSockAddr; }
+
+    private:
+        Session(Instance &aInstance, DtlsServer &aServer, const Ip6::MessageInfo &aMessageInfo);
+
+        Error Start(void);
+        bool  Matches(const Ip6::MessageInfo &aMessageInfo) const;
+        bool  Matches(const Session &aSession) const { return this == &aSession; }
+        bool  Matches(bool aIsReleased) const { return mIsReleased == aIsReleased; }
+
+        static void  HandleReceive(void *aContext, uint8_t *aBuf, uint16_t aLength);
+        static void  HandleConnected(void *aContext, bool aConnected);
+        static Error HandleTransmit(void *aContext, ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+
+        Session         *mNext;
+        DtlsServer      &mServer;
+        Ip6::SockAddr    mPeerSockAddr;
+        ot::MessageQueue mTransmitQueue;
+        bool             mIsReleased;
+    };
+
+    /**
+     * Represents the DTLS server counters.
+     *
+     */
+    struct Counters
+    {
+        uint32_t mHelloVerifyRequests; ///< Number of HelloVerifyRequests sent to new peers.
+        uint32_t mSessionsStarted;     ///< Number of sessions started by peers presenting a valid cookie.
+        uint32_t mSessionsConnected;   ///< Number of sessions which completed their handshake.
+        uint32_t mSessionsRejected;    ///< Number of new peers rejected since all sessions were in use.
+    };
+
+    /**
+     * Pointer is called when a session is established or torn down.
+     *
+     * @param[in]  aContext    A pointer to application-specific context.
+     * @param[in]  aSession    The session.
+     * @param[in]  aConnected  TRUE if the session was established, FALSE otherwise.
+     *
+     */
+    typedef void (*ConnectedHandler)(void *aContext, Session &aSession, bool aConnected);
+
+    /**
+     * Pointer is called when data is received from a session.
+     *
+     * @param[in]  aContext  A pointer to application-specific context.
+     * @param[in]  aSession  The session.
+     * @param[in]  aBuf      A pointer to the received data buffer.
+     * @param[in]  aLength   Number of bytes in the received data buffer.
+     *
+     */
+    typedef void (*ReceiveHandler)(void *aContext, Session &aSession, uint8_t *aBuf, uint16_t aLength);
+
+    /**
+     * Initializes the DTLS server.
+     *
+     * The sessions take their security configuration (cipher suite, PSK, certificates and authentication mode) from
+     * @p aConfig when they are created.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     * @param[in]  aConfig    The DTLS object providing the security configuration of the sessions.
+     *
+     */
+    DtlsServer(Instance &aInstance, const Dtls &aConfig);
+
+    /**
+     * Starts the DTLS server on a UDP port.
+     *
+     * @param[in]  aPort              The UDP port to bind to.
+     * @param[in]  aReceiveHandler    A pointer to a function that is called to receive DTLS payload.
+     * @param[in]  aConnectedHandler  A pointer to a function that is called when a session is connected or
+     *                                disconnected.
+     * @param[in]  aContext           A pointer to arbitrary context information.
+     *
+     * @retval kErrorNone     Successfully started the DTLS server.
+     * @retval kErrorAlready  The DTLS server is already running.
+     * @retval kErrorNoBufs   Failed to allocate the cookie context.
+     *
+     */
+    Error Start(uint16_t aPort, ReceiveHandler aReceiveHandler, ConnectedHandler aConnectedHandler, void *aContext);
+
+    /**
+     * Starts the DTLS server, using a transport callback instead of a UDP socket.
+     *
+     * Datagrams received by the transport MUST be provided through `HandleUdpReceive()`.
+     *
+     * @param[in]  aTransportCallback  A pointer to a function for sending messages.
+     * @param[in]  aReceiveHandler     A pointer to a function that is called to receive DTLS payload.
+     * @param[in]  aConnectedHandler   A pointer to a function that is called when a session is connected or
+     *                                 disconnected.
+     * @param[in]  aContext            A pointer to arbitrary context information.
+     *
+     * @retval kErrorNone     Successfully started the DTLS server.
+     * @retval kErrorAlready  The DTLS server is already running.
+     * @retval kErrorNoBufs   Failed to allocate the cookie context.
+     *
+     */
+    Error Start(Dtls::TransportCallback aTransportCallback,
+                ReceiveHandler          aReceiveHandler,
+                ConnectedHandler        aConnectedHandler,
+                void                   *aContext);
+
+    /**
+     * Stops the DTLS server and frees all sessions.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * Indicates whether or not the DTLS server is running.
+     *
+     * @retval TRUE   The DTLS server is running.
+     * @retval FALSE  The DTLS server is not running.
+     *
+     */
+    bool IsRunning(void) const { return mIsRunning; }
+
+    /**
+     * Gets the UDP port of the DTLS server.
+     *
+     * @returns  UDP port number.
+     *
+     */
+    uint16_t GetUdpPort(void) const { return mSocket.GetSockName().GetPort(); }
+
+    /**
+     * Queues a message to be sent in the session with a given peer.
+     *
+     * The message is sent from a tasklet, so it is safe to call this method from the receive handler.
+     *
+     * @param[in]  aMessage      The message to send. Ownership is transferred on success.
+     * @param[in]  aMessageInfo  The message info whose peer socket address identifies the session.
+     *
+     * @retval kErrorNone      Successfully queued the message.
+     * @retval kErrorNotFound  There is no connected session with the peer.
+     *
+     */
+    Error Send(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+
+    /**
+     * Disconnects all sessions.
+     *
+     */
+    void DisconnectAll(void);
+
+    /**
+     * Provides a received datagram to the DTLS server.
+     *
+     * @param[in]  aMessage      The received message.
+     * @param[in]  aMessageInfo  The message info of @p aMessage.
+     *
+     */
+    void HandleUdpReceive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+
+    /**
+     * Finds the session with a given peer.
+     *
+     * @param[in]  aMessageInfo  The message info whose peer socket address identifies the session.
+     *
+     * @returns A pointer to the session, or `nullptr` if there is no session with the peer.
+     *
+     */
+    Session *FindSession(const Ip6::MessageInfo &aMessageInfo);
+
+    /**
+     * Returns the number of sessions (handshaking, connected or closing).
+     *
+     * @returns The number of sessions.
+     *
+     */
+    uint16_t GetNumSessions(void) const { return mNumSessions; }
+
+    /**
+     * Returns the size of the state kept for a session, excluding the mbedTLS context allocations.
+     *
+     * @returns The size of a session object in bytes.
+     *
+     */
+    static uint32_t GetSessionSize(void) { return sizeof(Session); }
+
+    /**
+     * Returns the DTLS server counters.
+     *
+     * @returns The DTLS server counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+private:
+    // DTLS record and handshake constants (RFC 6347).
+    static constexpr uint8_t  kContentTypeHandshake        = 22;
+    static constexpr uint8_t  kHandshakeClientHello        = 1;
+    static constexpr uint8_t  kHandshakeHelloVerifyRequest = 3;
+    static constexpr uint16_t kRecordHeaderSize            = 13;
+    static constexpr uint16_t kHandshakeHeaderSize         = 12;
+    static constexpr uint16_t kRandomSize                  = 32;
+    static constexpr uint16_t kHelloVerifyRequestVersion   = 0xfeff; // DTLS 1.0, as recommended by RFC 6347.
+    static constexpr uint8_t  kMaxCookieLength             = 32;     // Size of `mbedtls_ssl_cookie_write()` cookies.
+
+    struct ClientHello
+    {
+        uint8_t mRecordHeader[kRecordHeaderSize];
+        uint8_t mHandshakeHeader[kHandshakeHeaderSize];
+        uint8_t mCookie[kMaxCookieLength];
+        uint8_t mCookieLength;
+    };
+
+    Error StartCookies(void);
+    void  HandleNewPeer(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    Error ParseClientHello(const ot::Message &aMessage, ClientHello &aClientHello) const;
+    Error SendHelloVerifyRequest(const ClientHello &aClientHello, const Ip6::MessageInfo &aMessageInfo);
+    Error SendMessage(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    void  RemoveSession(Session &aSession);
+    void  HandleSessionReceive(Session &aSession, uint8_t *aBuf, uint16_t aLength);
+    void  HandleSessionConnected(Session &aSession, bool aConnected);
+    void  HandleTasklet(void);
+
+    static void HandleTasklet(Tasklet &aTasklet);
+    static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
+
+    const Dtls                       &mConfig;
+    bool                              mIsRunning;
+    uint16_t                          mNumSessions;
+    OwningList<Session>               mSessions;
+    mbedtls_ssl_cookie_ctx            mCookieCtx;
+    Ip6::Udp::Socket                  mSocket;
+    Callback<Dtls::TransportCallback> mTransportCallback;
+    Callback<ReceiveHandler>          mReceiveCallback;
+    Callback<ConnectedHandler>        mConnectedCallback;
+    TaskletContext                    mTasklet;
+    Counters                          mCounters;
+};
+
+} // namespace MeshCoP
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+
+#endif // DTLS_SERVER_HPP_
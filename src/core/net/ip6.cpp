@@ -79,6 +79,7 @@ Ip6::Ip6(Instance &aInstance)
 #if OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
     ResetBorderRoutingCounters();
 #endif
+    InvalidateSourceAddressCache();
 }
 
 Message *Ip6::NewMessage(void) { return NewMessage(0); }
@@ -491,6 +492,10 @@ Error Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aI
 
     aMessage.SetMulticastLoop(aMessageInfo.GetMulticastLoop());
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    Get<Utils::LatencyTracer>().Start(aMessage);
+#endif
+
     if (aMessage.GetLength() > kMaxDatagramLength)
     {
         error = FragmentDatagram(aMessage, aIpProto);
@@ -1214,6 +1219,13 @@ start:
         goto start;
     }
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    if (forwardHost || receive)
+    {
+        Get<Utils::LatencyTracer>().Mark(aMessage, Utils::LatencyTracer::kStageDelivered);
+    }
+#endif
+
     if ((forwardHost || receive) && !aIsReassembled)
     {
         error = PassToHost(aMessage, aOrigin, messageInfo, nextHeader,
@@ -1305,7 +1317,7 @@ exit:
     return error;
 }
 
-Error Ip6::SelectSourceAddress(MessageInfo &aMessageInfo) const
+Error Ip6::SelectSourceAddress(MessageInfo &aMessageInfo)
 {
     Error          error = kErrorNone;
     const Address *source;
@@ -1318,7 +1330,54 @@ exit:
     return error;
 }
 
-const Address *Ip6::SelectSourceAddress(const Address &aDestination) const
+void Ip6::InvalidateSourceAddressCache(void)
+{
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_SIZE > 0
+    mNumCachedSources = 0;
+    mNextCachedSource = 0;
+#endif
+}
+
+const Address *Ip6::SelectSourceAddress(const Address &aDestination)
+{
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_SIZE > 0
+    const Address *source = nullptr;
+
+    for (uint8_t i = 0; i < mNumCachedSources; i++)
+    {
+        if (mSourceCache[i].mDestination == aDestination)
+        {
+            ExitNow(source = mSourceCache[i].mSource);
+        }
+    }
+
+    source = DetermineSourceAddress(aDestination);
+
+    // Only successful selections are remembered so that a node
+    // without any usable address keeps re-evaluating the rules.
+    // Entries are replaced in round-robin order once the cache
+    // is full.
+
+    VerifyOrExit(source != nullptr);
+
+    mSourceCache[mNextCachedSource].mDestination = aDestination;
+    mSourceCache[mNextCachedSource].mSource      = source;
+
+    if (mNumCachedSources < kSourceCacheSize)
+    {
+        mNumCachedSources++;
+    }
+
+    mNextCachedSource = (mNextCachedSource + 1) % kSourceCacheSize;
+
+exit:
+    return source;
+#else
+    return DetermineSourceAddress(aDestination);
+#endif
+}
+
+const Address *Ip6::DetermineSourceAddress(const Address &aDestination) const
 {
     uint8_t                      destScope    = aDestination.GetScope();
     bool                         destIsRloc   = Get<Mle::Mle>().IsRoutingLocator(aDestination);
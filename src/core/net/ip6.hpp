@@ -311,17 +311,29 @@ public:
      * @retval  kErrorNotFound  No source address was found and @p aMessageInfo is unchanged.
      *
      */
-    Error SelectSourceAddress(MessageInfo &aMessageInfo) const;
+    Error SelectSourceAddress(MessageInfo &aMessageInfo);
 
     /**
      * Performs default source address selection.
      *
      * @param[in]  aDestination  The destination address.
      *
+     * The result is remembered per destination address (up to `OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_SIZE`
+     * entries) until `InvalidateSourceAddressCache()` is called.
+     *
      * @returns A pointer to the selected IPv6 source address or `nullptr` if no source address was found.
      *
      */
-    const Address *SelectSourceAddress(const Address &aDestination) const;
+    const Address *SelectSourceAddress(const Address &aDestination);
+
+    /**
+     * Flushes the remembered results of the default source address selection.
+     *
+     * Must be called whenever a unicast address is added to or removed from the Thread network interface, or when
+     * any of the properties used by the selection rules (e.g., preferred flag or prefix length) of an address changes.
+     *
+     */
+    void InvalidateSourceAddressCache(void);
 
     /**
      * Returns a reference to the send queue.
@@ -381,6 +393,16 @@ private:
 
     static constexpr uint16_t kMinimalMtu = 1280;
 
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_SIZE > 0
+    static constexpr uint8_t kSourceCacheSize = OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_SIZE;
+
+    struct SourceCacheEntry
+    {
+        Address        mDestination;
+        const Address *mSource;
+    };
+#endif
+
     void HandleSendQueue(void);
 
     static uint8_t PriorityToDscp(Message::Priority aPriority);
@@ -418,6 +440,9 @@ private:
                         Message::Ownership aMessageOwnership);
     bool  IsOnLink(const Address &aAddress) const;
     Error RouteLookup(const Address &aSource, const Address &aDestination) const;
+
+    const Address *DetermineSourceAddress(const Address &aDestination) const;
+
 #if OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
     void UpdateBorderRoutingCounters(const Header &aHeader, uint16_t aMessageLength, bool aIsInbound);
 #endif
@@ -450,6 +475,12 @@ private:
 #if OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
     otBorderRoutingCounters mBorderRoutingCounters;
 #endif
+
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_SIZE > 0
+    uint8_t          mNumCachedSources;
+    uint8_t          mNextCachedSource;
+    SourceCacheEntry mSourceCache[kSourceCacheSize];
+#endif
 };
 
 /**
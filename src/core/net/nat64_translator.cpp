@@ -39,8 +39,10 @@
 #include <openthread/platform/toolchain.h>
 
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/num_utils.hpp"
 #include "net/checksum.hpp"
 #include "net/ip4_types.hpp"
 #include "net/ip6.hpp"
@@ -48,6 +50,8 @@
 namespace ot {
 namespace Nat64 {
 
+using ot::Encoding::BigEndian::HostSwap16;
+
 RegisterLogModule("Nat64");
 
 const char *StateToString(State aState)
@@ -76,7 +80,12 @@ Translator::Translator(Instance &aInstance)
 
     mNat64Prefix.Clear();
     mIp4Cidr.Clear();
-    mMappingExpirerTimer.Start(kAddressMappingIdleTimeoutMsec);
+    mMappingCounters.Clear();
+    mMappingCounters.mAddressMappingCapacity = kAddressMappingPoolSize;
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    mMappingCounters.mPortMappingCapacity = kPortMappingPoolSize;
+#endif
+    mMappingExpirerTimer.Start(kMappingExpirerIntervalMsec);
 }
 
 Message *Translator::NewIp4Message(const Message::Settings &aSettings)
@@ -174,6 +183,14 @@ Translator::Result Translator::TranslateFromIp6(Message &aMessage)
         ExitNow(res = kDrop);
     }
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    if (TranslatePortFromIp6(aMessage, *mapping, ip6Header.GetNextHeader()) != kErrorNone)
+    {
+        dropReason = ErrorCounters::Reason::kNoMapping;
+        ExitNow(res = kDrop);
+    }
+#endif
+
     // res here must be kForward based on the switch above.
     // TODO: Implement the logic for replying ICMP messages.
     ip4Header.SetTotalLength(sizeof(Ip4::Header) + aMessage.GetLength() - aMessage.GetOffset());
@@ -205,6 +222,10 @@ Translator::Result Translator::TranslateToIp6(Message &aMessage)
     Ip6::Header           ip6Header;
     Ip4::Header           ip4Header;
     AddressMapping       *mapping = nullptr;
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    PortMapping *portMapping = nullptr;
+    uint16_t     portOffset;
+#endif
 
     // Ip6::Header::ParseFrom may return an error value when the incoming message is an IPv4 datagram.
     // If the message is already an IPv6 datagram, forward it directly.
@@ -230,7 +251,12 @@ Translator::Result Translator::TranslateToIp6(Message &aMessage)
         ExitNow(res = kDrop);
     }
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    portMapping = FindPortMapping(aMessage, ip4Header);
+    mapping     = (portMapping != nullptr) ? portMapping->mAddressMapping : nullptr;
+#else
     mapping = FindMapping(ip4Header.GetDestination());
+#endif
     if (mapping == nullptr)
     {
         LogWarn("no mapping found for the IPv4 address");
@@ -240,6 +266,13 @@ Translator::Result Translator::TranslateToIp6(Message &aMessage)
 
     aMessage.RemoveHeader(sizeof(Ip4::Header));
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    // `FindPortMapping()` succeeding means the protocol is supported and
+    // the payload contains the port.
+    IgnoreError(GetPortOffset(portMapping->mProtocol, /* aIsSource */ false, portOffset));
+    aMessage.Write(portOffset, HostSwap16(portMapping->mIp6Port));
+#endif
+
     ip6Header.Clear();
     ip6Header.InitVersionTrafficClassFlow();
     ip6Header.GetSource().SynthesizeFromIp4Address(mNat64Prefix, ip4Header.GetSource());
@@ -321,10 +354,26 @@ void Translator::AddressMapping::CopyTo(otNat64AddressMapping &aMapping, TimeMil
     }
 }
 
+template <typename AddressType> uint32_t Translator::HashAddress(const AddressType &aAddress)
+{
+    HashCalculator hash;
+
+    hash.Update(&aAddress, sizeof(aAddress));
+
+    return hash.GetHash();
+}
+
 void Translator::ReleaseMapping(AddressMapping &aMapping)
 {
+    mAddressMappingsByIp6.Remove(aMapping, HashAddress(aMapping.mIp6));
+#if !OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    // With port translation, IPv4 addresses are shared and stay in the pool.
+    mAddressMappingsByIp4.Remove(aMapping, HashAddress(aMapping.mIp4));
     IgnoreError(mIp4AddressPool.PushBack(aMapping.mIp4));
+#endif
     mAddressMappingPool.Free(aMapping);
+    mMappingCounters.mAddressMappingsReleased++;
+    mMappingCounters.mNumAddressMappings--;
     LogInfo("mapping removed: %s", aMapping.ToString().AsCString());
 }
 
@@ -345,15 +394,46 @@ uint16_t Translator::ReleaseExpiredMappings(void)
 {
     LinkedList<AddressMapping> idleMappings;
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    // Address mappings are only released once all their port mappings
+    // are gone.
+    IgnoreReturnValue(ReleaseExpiredPortMappings());
+#endif
+
     mActiveAddressMappings.RemoveAllMatching(TimerMilli::GetNow(), idleMappings);
 
     return ReleaseMappings(idleMappings);
 }
 
+void Translator::ReleaseAllMappings(void)
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    IgnoreReturnValue(ReleasePortMappings(mActivePortMappings));
+#endif
+    IgnoreReturnValue(ReleaseMappings(mActiveAddressMappings));
+}
+
 Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6Addr)
 {
     AddressMapping *mapping = nullptr;
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    VerifyOrExit(!mIp4AddressPool.IsEmpty());
+
+    mapping = mAddressMappingPool.Allocate();
+
+    if (mapping == nullptr)
+    {
+        // ReleaseExpiredMappings returns the number of mappings removed.
+        VerifyOrExit(ReleaseExpiredMappings() > 0);
+        mapping = mAddressMappingPool.Allocate();
+        VerifyOrExit(mapping != nullptr);
+    }
+
+    // The same Thread host is always given the same IPv4 address from the pool.
+    mapping->mIp4             = mIp4AddressPool[HashAddress(aIp6Addr) % mIp4AddressPool.GetLength()];
+    mapping->mNumPortMappings = 0;
+#else
     // The address pool will be no larger than the mapping pool, so checking the address pool is enough.
     if (mIp4AddressPool.IsEmpty())
     {
@@ -366,12 +446,23 @@ Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6
     // empty.
     VerifyOrExit(mapping != nullptr);
 
+    // PopBack must return a valid address since it is not empty.
+    mapping->mIp4 = *mIp4AddressPool.PopBack();
+    mAddressMappingsByIp4.Add(*mapping, HashAddress(mapping->mIp4));
+#endif
+
     mActiveAddressMappings.Push(*mapping);
+    mAddressMappingsByIp6.Add(*mapping, HashAddress(aIp6Addr));
     mapping->mId  = ++mNextMappingId;
     mapping->mIp6 = aIp6Addr;
-    // PopBack must return a valid address since it is not empty.
-    mapping->mIp4 = *mIp4AddressPool.PopBack();
+    mapping->mCounters.Clear();
     mapping->Touch(TimerMilli::GetNow());
+
+    mMappingCounters.mAddressMappingsCreated++;
+    mMappingCounters.mNumAddressMappings++;
+    mMappingCounters.mMaxNumAddressMappings =
+        Max(mMappingCounters.mMaxNumAddressMappings, mMappingCounters.mNumAddressMappings);
+
     LogInfo("mapping created: %s", mapping->ToString().AsCString());
 
 exit:
@@ -380,20 +471,279 @@ exit:
 
 Translator::AddressMapping *Translator::FindOrAllocateMapping(const Ip6::Address &aIp6Addr)
 {
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp6Addr);
+    AddressMapping *mapping = mAddressMappingsByIp6.FindMatching(aIp6Addr, HashAddress(aIp6Addr));
+
+    if (mapping == nullptr)
+    {
+        mapping = AllocateMapping(aIp6Addr);
+    }
+    else
+    {
+        mapping->Touch(TimerMilli::GetNow());
+    }
+
+    return mapping;
+}
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
+template <typename AddressType> uint32_t Translator::FlowKey<AddressType>::GetHash(void) const
+{
+    HashCalculator hash;
+
+    hash.Update(&mAddress, sizeof(mAddress));
+    hash.Update(mProtocol);
+    hash.Update(mPort);
+
+    return hash.GetHash();
+}
+
+void Translator::PortMapping::Touch(TimeMilli aNow)
+{
+    uint32_t timeout;
+
+    switch (mProtocol)
+    {
+    case Ip6::kProtoTcp:
+        timeout = kTcpIdleTimeoutMsec;
+        break;
+    case Ip6::kProtoUdp:
+        timeout = kUdpIdleTimeoutMsec;
+        break;
+    default:
+        timeout = kIcmpIdleTimeoutMsec;
+        break;
+    }
+
+    mExpiry = aNow + timeout;
+}
+
+bool Translator::PortMapping::Matches(const Ip6FlowKey &aKey) const
+{
+    return (mIp6Port == aKey.mPort) && (mProtocol == aKey.mProtocol) && (mAddressMapping->mIp6 == aKey.mAddress);
+}
+
+bool Translator::PortMapping::Matches(const Ip4FlowKey &aKey) const
+{
+    return (mIp4Port == aKey.mPort) && (mProtocol == aKey.mProtocol) && (mAddressMapping->mIp4 == aKey.mAddress);
+}
+
+Error Translator::GetPortOffset(uint8_t aProtocol, bool aIsSource, uint16_t &aOffset)
+{
+    // Offsets from the start of the TCP/UDP/ICMP header. ICMP echo
+    // messages carry the identifier at the same offset in both ICMP
+    // versions, and it is used as port in both directions.
+
+    static constexpr uint16_t kSourcePortOffset      = 0;
+    static constexpr uint16_t kDestinationPortOffset = 2;
+    static constexpr uint16_t kIcmpIdentifierOffset  = 4;
+
+    Error error = kErrorNone;
+
+    switch (aProtocol)
+    {
+    case Ip6::kProtoTcp:
+    case Ip6::kProtoUdp:
+        aOffset = aIsSource ? kSourcePortOffset : kDestinationPortOffset;
+        break;
+    case Ip6::kProtoIcmp6:
+        aOffset = kIcmpIdentifierOffset;
+        break;
+    default:
+        error = kErrorInvalidArgs;
+        break;
+    }
+
+    return error;
+}
+
+Error Translator::TranslatePortFromIp6(Message &aMessage, AddressMapping &aMapping, uint8_t aProtocol)
+{
+    // The caller consumed the IPv6 header, so the TCP/UDP/ICMP header is at offset 0.
+
+    Error        error;
+    uint16_t     offset;
+    uint16_t     port;
+    PortMapping *portMapping;
+
+    SuccessOrExit(error = GetPortOffset(aProtocol, /* aIsSource */ true, offset));
+    SuccessOrExit(error = aMessage.Read(offset, port));
+    port = HostSwap16(port);
+
+    {
+        Ip6FlowKey key(aMapping.mIp6, aProtocol, port);
+
+        portMapping = mPortMappingsByIp6.FindMatching(key, key.GetHash());
+    }
+
+    if (portMapping == nullptr)
+    {
+        portMapping = AllocatePortMapping(aMapping, aProtocol, port);
+        VerifyOrExit(portMapping != nullptr, error = kErrorNoBufs);
+    }
+
+    portMapping->Touch(TimerMilli::GetNow());
+    aMessage.Write(offset, HostSwap16(portMapping->mIp4Port));
+
+exit:
+    return error;
+}
+
+Translator::PortMapping *Translator::FindPortMapping(const Message &aMessage, const Ip4::Header &aIp4Header)
+{
+    PortMapping *portMapping = nullptr;
+    uint8_t      protocol    = aIp4Header.GetProtocol();
+    uint16_t     offset;
+    uint16_t     port;
+    TimeMilli    now;
+
+    if (protocol == Ip4::kProtoIcmp)
+    {
+        protocol = Ip6::kProtoIcmp6;
+    }
+
+    SuccessOrExit(GetPortOffset(protocol, /* aIsSource */ false, offset));
+    SuccessOrExit(aMessage.Read(sizeof(Ip4::Header) + offset, port));
+    port = HostSwap16(port);
+
+    {
+        Ip4FlowKey key(aIp4Header.GetDestination(), protocol, port);
+
+        portMapping = mPortMappingsByIp4.FindMatching(key, key.GetHash());
+    }
 
-    // Exit if we found a valid mapping.
-    VerifyOrExit(mapping == nullptr);
+    VerifyOrExit(portMapping != nullptr);
 
-    mapping = AllocateMapping(aIp6Addr);
+    now = TimerMilli::GetNow();
+    portMapping->Touch(now);
+    portMapping->mAddressMapping->Touch(now);
 
 exit:
-    return mapping;
+    return portMapping;
+}
+
+Translator::PortMapping *Translator::AllocatePortMapping(AddressMapping &aMapping, uint8_t aProtocol, uint16_t aPort)
+{
+    PortMapping *portMapping = mPortMappingPool.Allocate();
+    uint16_t     ip4Port;
+
+    if (portMapping == nullptr)
+    {
+        VerifyOrExit(ReleaseExpiredPortMappings() > 0);
+        portMapping = mPortMappingPool.Allocate();
+        VerifyOrExit(portMapping != nullptr);
+    }
+
+    if (AllocatePort(aMapping.mIp4, aProtocol, aPort, ip4Port) != kErrorNone)
+    {
+        mPortMappingPool.Free(*portMapping);
+        ExitNow(portMapping = nullptr);
+    }
+
+    portMapping->mAddressMapping = &aMapping;
+    portMapping->mProtocol       = aProtocol;
+    portMapping->mIp6Port        = aPort;
+    portMapping->mIp4Port        = ip4Port;
+
+    mActivePortMappings.Push(*portMapping);
+    mPortMappingsByIp6.Add(*portMapping, portMapping->GetIp6Key().GetHash());
+    mPortMappingsByIp4.Add(*portMapping, portMapping->GetIp4Key().GetHash());
+    aMapping.mNumPortMappings++;
+
+    mMappingCounters.mPortMappingsCreated++;
+    mMappingCounters.mNumPortMappings++;
+    mMappingCounters.mMaxNumPortMappings = Max(mMappingCounters.mMaxNumPortMappings, mMappingCounters.mNumPortMappings);
+
+    LogDebg("port mapping created: %s proto %u port %u -> %u", aMapping.ToString().AsCString(), aProtocol, aPort,
+            ip4Port);
+
+exit:
+    if (portMapping == nullptr)
+    {
+        mMappingCounters.mPortExhaustions++;
+        LogWarn("no port mapping available for %s proto %u port %u", aMapping.mIp6.ToString().AsCString(), aProtocol,
+                aPort);
+    }
+
+    return portMapping;
 }
 
+Error Translator::AllocatePort(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPort, uint16_t &aIp4Port)
+{
+    // The port chosen by the Thread host is preserved when it is free
+    // (RFC 4787 REQ-3), otherwise a limited number of ports following
+    // a random one are probed.
+
+    Error    error = kErrorNotFound;
+    uint16_t port  = aPort;
+
+    if (port < kMinTranslatedPort)
+    {
+        port = Random::NonCrypto::GetUint16InRange(kMinTranslatedPort, kMaxTranslatedPort);
+    }
+
+    for (uint16_t numProbes = 0; numProbes < kMaxPortProbes; numProbes++)
+    {
+        Ip4FlowKey key(aIp4Addr, aProtocol, port);
+
+        if (mPortMappingsByIp4.FindMatching(key, key.GetHash()) == nullptr)
+        {
+            aIp4Port = port;
+            ExitNow(error = kErrorNone);
+        }
+
+        if (numProbes == 0)
+        {
+            port = Random::NonCrypto::GetUint16InRange(kMinTranslatedPort, kMaxTranslatedPort);
+        }
+        else
+        {
+            port = (port == kMaxTranslatedPort) ? kMinTranslatedPort : port + 1;
+        }
+    }
+
+exit:
+    return error;
+}
+
+void Translator::ReleasePortMapping(PortMapping &aPortMapping)
+{
+    mPortMappingsByIp6.Remove(aPortMapping, aPortMapping.GetIp6Key().GetHash());
+    mPortMappingsByIp4.Remove(aPortMapping, aPortMapping.GetIp4Key().GetHash());
+    aPortMapping.mAddressMapping->mNumPortMappings--;
+    mPortMappingPool.Free(aPortMapping);
+
+    mMappingCounters.mPortMappingsReleased++;
+    mMappingCounters.mNumPortMappings--;
+}
+
+uint16_t Translator::ReleasePortMappings(LinkedList<PortMapping> &aPortMappings)
+{
+    uint16_t numRemoved = 0;
+
+    for (PortMapping *portMapping = aPortMappings.Pop(); portMapping != nullptr; portMapping = aPortMappings.Pop())
+    {
+        numRemoved++;
+        ReleasePortMapping(*portMapping);
+    }
+
+    return numRemoved;
+}
+
+uint16_t Translator::ReleaseExpiredPortMappings(void)
+{
+    LinkedList<PortMapping> idlePortMappings;
+
+    mActivePortMappings.RemoveAllMatching(TimerMilli::GetNow(), idlePortMappings);
+
+    return ReleasePortMappings(idlePortMappings);
+}
+
+#else // OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
 Translator::AddressMapping *Translator::FindMapping(const Ip4::Address &aIp4Addr)
 {
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp4Addr);
+    AddressMapping *mapping = mAddressMappingsByIp4.FindMatching(aIp4Addr, HashAddress(aIp4Addr));
 
     if (mapping != nullptr)
     {
@@ -402,6 +752,8 @@ Translator::AddressMapping *Translator::FindMapping(const Ip4::Address &aIp4Addr
     return mapping;
 }
 
+#endif // OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
 Error Translator::TranslateIcmp4(Message &aMessage)
 {
     Error             err = kErrorNone;
@@ -492,8 +844,7 @@ Error Translator::SetIp4Cidr(const Ip4::Cidr &aCidr)
     }
     numberOfHosts = OT_MIN(numberOfHosts, kAddressMappingPoolSize);
 
-    mAddressMappingPool.FreeAll();
-    mActiveAddressMappings.Clear();
+    ReleaseAllMappings();
     mIp4AddressPool.Clear();
 
     for (uint32_t i = 0; i < numberOfHosts; i++)
@@ -543,8 +894,16 @@ exit:
 
 void Translator::HandleMappingExpirerTimer(void)
 {
-    LogInfo("Released %d expired mappings", ReleaseExpiredMappings());
-    mMappingExpirerTimer.Start(kAddressMappingIdleTimeoutMsec);
+    uint16_t numReleased = ReleaseExpiredMappings();
+
+    // The timer fires often with port translation, only log when
+    // something was released.
+    if (numReleased > 0)
+    {
+        LogInfo("Released %u expired mappings", numReleased);
+    }
+
+    mMappingExpirerTimer.Start(kMappingExpirerIntervalMsec);
 }
 
 void Translator::InitAddressMappingIterator(AddressMappingIterator &aIterator)
@@ -675,7 +1034,7 @@ void Translator::SetEnabled(bool aEnabled)
 
     if (!aEnabled)
     {
-        ReleaseMappings(mActiveAddressMappings);
+        ReleaseAllMappings();
     }
 
     UpdateState();
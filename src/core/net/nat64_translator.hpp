@@ -38,6 +38,7 @@
 #include "openthread-core-config.h"
 
 #include "common/array.hpp"
+#include "common/hash_table.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/pool.hpp"
@@ -79,6 +80,16 @@ public:
         OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
     static constexpr uint32_t kAddressMappingPoolSize = OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS;
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    static constexpr uint16_t kPortMappingPoolSize = OPENTHREAD_CONFIG_NAT64_MAX_PORT_MAPPINGS;
+    static constexpr uint32_t kUdpIdleTimeoutMsec =
+        OPENTHREAD_CONFIG_NAT64_UDP_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
+    static constexpr uint32_t kTcpIdleTimeoutMsec =
+        OPENTHREAD_CONFIG_NAT64_TCP_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
+    static constexpr uint32_t kIcmpIdleTimeoutMsec =
+        OPENTHREAD_CONFIG_NAT64_ICMP_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
+#endif
+
     typedef otNat64AddressMappingIterator AddressMappingIterator; ///< Address mapping Iterator.
 
     /**
@@ -152,6 +163,14 @@ public:
         void Count6To4(Reason aReason) { mCount6To4[aReason]++; }
     };
 
+    /**
+     * Represents the counters of the address and port mapping tables.
+     *
+     */
+    class MappingCounters : public otNat64MappingCounters, public Clearable<MappingCounters>
+    {
+    };
+
     /**
      * Initializes the NAT64 translator.
      *
@@ -315,6 +334,14 @@ public:
      */
     void GetErrorCounters(ErrorCounters &aCounters) const { aCounters = mErrorCounters; }
 
+    /**
+     * Gets the NAT64 translator mapping table counters.
+     *
+     * @param[out] aCounters  A `MappingCounters` where the mapping table counters will be placed.
+     *
+     */
+    void GetMappingCounters(MappingCounters &aCounters) const { aCounters = mMappingCounters; }
+
     /**
      * Gets the configured CIDR in the NAT64 translator.
      *
@@ -338,6 +365,18 @@ public:
     Error GetIp6Prefix(Ip6::Prefix &aPrefix);
 
 private:
+    static constexpr uint16_t kNumAddressMappingBuckets = 64;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    static constexpr uint16_t kNumPortMappingBuckets      = OPENTHREAD_CONFIG_NAT64_PORT_MAPPING_HASH_BUCKETS;
+    static constexpr uint16_t kMinTranslatedPort          = 1024;
+    static constexpr uint16_t kMaxTranslatedPort          = 65535;
+    static constexpr uint16_t kMaxPortProbes              = 64;
+    static constexpr uint32_t kMappingExpirerIntervalMsec = 10 * Time::kOneSecondInMsec;
+#else
+    static constexpr uint32_t kMappingExpirerIntervalMsec = kAddressMappingIdleTimeoutMsec;
+#endif
+
     class AddressMapping : public LinkedListEntry<AddressMapping>
     {
     public:
@@ -349,6 +388,8 @@ private:
         void       Touch(TimeMilli aNow) { mExpiry = aNow + kAddressMappingIdleTimeoutMsec; }
         InfoString ToString(void) const;
         void       CopyTo(otNat64AddressMapping &aMapping, TimeMilli aNow) const;
+        bool       Matches(const Ip4::Address &aIp4) const { return mIp4 == aIp4; }
+        bool       Matches(const Ip6::Address &aIp6) const { return mIp6 == aIp6; }
 
         uint64_t mId; // The unique id for a mapping session.
 
@@ -358,23 +399,101 @@ private:
 
         ProtocolCounters mCounters;
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        uint16_t mNumPortMappings; // The mapping is kept while it has port mappings.
+#endif
+
+        AddressMapping *mNextInIp6Table;
+#if !OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        AddressMapping *mNextInIp4Table;
+#endif
+
     private:
-        bool Matches(const Ip4::Address &aIp4) const { return mIp4 == aIp4; }
-        bool Matches(const Ip6::Address &aIp6) const { return mIp6 == aIp6; }
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        bool Matches(const TimeMilli aNow) const { return (mExpiry < aNow) && (mNumPortMappings == 0); }
+#else
         bool Matches(const TimeMilli aNow) const { return mExpiry < aNow; }
+#endif
 
         AddressMapping *mNext;
     };
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    // Identifies a flow on one side of the translator. The protocol is
+    // always the IPv6 one (ICMP echo flows use `Ip6::kProtoIcmp6`) and
+    // the port is the TCP/UDP port or the ICMP echo identifier.
+    template <typename AddressType> struct FlowKey
+    {
+        FlowKey(const AddressType &aAddress, uint8_t aProtocol, uint16_t aPort)
+            : mAddress(aAddress)
+            , mProtocol(aProtocol)
+            , mPort(aPort)
+        {
+        }
+
+        uint32_t GetHash(void) const;
+
+        const AddressType &mAddress;
+        uint8_t            mProtocol;
+        uint16_t           mPort;
+    };
+
+    typedef FlowKey<Ip6::Address> Ip6FlowKey;
+    typedef FlowKey<Ip4::Address> Ip4FlowKey;
+
+    class PortMapping : public LinkedListEntry<PortMapping>
+    {
+    public:
+        friend class LinkedListEntry<PortMapping>;
+        friend class LinkedList<PortMapping>;
+
+        void       Touch(TimeMilli aNow);
+        Ip6FlowKey GetIp6Key(void) const { return Ip6FlowKey(mAddressMapping->mIp6, mProtocol, mIp6Port); }
+        Ip4FlowKey GetIp4Key(void) const { return Ip4FlowKey(mAddressMapping->mIp4, mProtocol, mIp4Port); }
+        bool       Matches(const Ip6FlowKey &aKey) const;
+        bool       Matches(const Ip4FlowKey &aKey) const;
+
+        AddressMapping *mAddressMapping;
+        TimeMilli       mExpiry;
+        uint16_t        mIp6Port; // The port (or ICMP identifier) used by the Thread host.
+        uint16_t        mIp4Port; // The translated port (or ICMP identifier) on the IPv4 side.
+        uint8_t         mProtocol;
+
+        PortMapping *mNextInIp6Table;
+        PortMapping *mNextInIp4Table;
+
+    private:
+        bool Matches(const TimeMilli aNow) const { return mExpiry < aNow; }
+
+        PortMapping *mNext;
+    };
+#endif // OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
+    template <typename AddressType> static uint32_t HashAddress(const AddressType &aAddress);
+
     Error TranslateIcmp4(Message &aMessage);
     Error TranslateIcmp6(Message &aMessage);
 
     uint16_t        ReleaseMappings(LinkedList<AddressMapping> &aMappings);
     void            ReleaseMapping(AddressMapping &aMapping);
     uint16_t        ReleaseExpiredMappings(void);
+    void            ReleaseAllMappings(void);
     AddressMapping *AllocateMapping(const Ip6::Address &aIp6Addr);
     AddressMapping *FindOrAllocateMapping(const Ip6::Address &aIp6Addr);
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    static Error GetPortOffset(uint8_t aProtocol, bool aIsSource, uint16_t &aOffset);
+
+    Error        TranslatePortFromIp6(Message &aMessage, AddressMapping &aMapping, uint8_t aProtocol);
+    PortMapping *FindPortMapping(const Message &aMessage, const Ip4::Header &aIp4Header);
+    PortMapping *AllocatePortMapping(AddressMapping &aMapping, uint8_t aProtocol, uint16_t aPort);
+    Error        AllocatePort(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPort, uint16_t &aIp4Port);
+    void         ReleasePortMapping(PortMapping &aPortMapping);
+    uint16_t     ReleasePortMappings(LinkedList<PortMapping> &aPortMappings);
+    uint16_t     ReleaseExpiredPortMappings(void);
+#else
     AddressMapping *FindMapping(const Ip4::Address &aIp4Addr);
+#endif
 
     void HandleMappingExpirerTimer(void);
 
@@ -391,6 +510,18 @@ private:
     Pool<AddressMapping, kAddressMappingPoolSize> mAddressMappingPool;
     LinkedList<AddressMapping>                    mActiveAddressMappings;
 
+    HashTable<AddressMapping, &AddressMapping::mNextInIp6Table, kNumAddressMappingBuckets> mAddressMappingsByIp6;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    Pool<PortMapping, kPortMappingPoolSize> mPortMappingPool;
+    LinkedList<PortMapping>                 mActivePortMappings;
+
+    HashTable<PortMapping, &PortMapping::mNextInIp6Table, kNumPortMappingBuckets> mPortMappingsByIp6;
+    HashTable<PortMapping, &PortMapping::mNextInIp4Table, kNumPortMappingBuckets> mPortMappingsByIp4;
+#else
+    HashTable<AddressMapping, &AddressMapping::mNextInIp4Table, kNumAddressMappingBuckets> mAddressMappingsByIp4;
+#endif
+
     Ip6::Prefix mNat64Prefix;
     Ip4::Cidr   mIp4Cidr;
 
@@ -398,6 +529,7 @@ private:
 
     ProtocolCounters mCounters;
     ErrorCounters    mErrorCounters;
+    MappingCounters  mMappingCounters;
 };
 #endif // OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
 
@@ -407,6 +539,7 @@ DefineMapEnum(otNat64State, Nat64::State);
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
 DefineCoreType(otNat64ProtocolCounters, Nat64::Translator::ProtocolCounters);
 DefineCoreType(otNat64ErrorCounters, Nat64::Translator::ErrorCounters);
+DefineCoreType(otNat64MappingCounters, Nat64::Translator::MappingCounters);
 #endif
 
 } // namespace ot
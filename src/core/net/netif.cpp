@@ -87,11 +87,16 @@ Netif::Netif(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMulticastPromiscuous(false)
 {
+    mMulticastFilter.Clear();
 }
 
 bool Netif::IsMulticastSubscribed(const Address &aAddress) const
 {
-    return mMulticastAddresses.ContainsMatching(aAddress);
+    // Most received multicast datagrams are for groups the interface
+    // is not subscribed to, so check the filter before walking the
+    // list to verify a possible match.
+
+    return mMulticastFilter.MayContain(aAddress) && mMulticastAddresses.ContainsMatching(aAddress);
 }
 
 void Netif::SubscribeAllNodesMulticast(void)
@@ -239,6 +244,18 @@ exit:
 
 void Netif::SignalMulticastAddressChange(AddressEvent aEvent, const MulticastAddress &aAddress, AddressOrigin aOrigin)
 {
+    // Every change to `mMulticastAddresses` is signaled here, so this
+    // is where `mMulticastFilter` is kept in sync with the list.
+
+    if (aEvent == kAddressAdded)
+    {
+        mMulticastFilter.Add(aAddress.GetAddress());
+    }
+    else
+    {
+        mMulticastFilter.Remove(aAddress.GetAddress());
+    }
+
     Get<Notifier>().Signal(aEvent == kAddressAdded ? kEventIp6MulticastSubscribed : kEventIp6MulticastUnsubscribed);
 
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
@@ -365,6 +382,11 @@ void Netif::UnsubscribeAllExternalMulticastAddresses(void)
 
 void Netif::AddUnicastAddress(UnicastAddress &aAddress)
 {
+    // Callers may update an address entry in place and re-add it,
+    // so the source address cache is flushed even if `aAddress` is
+    // already in the list.
+    Get<Ip6>().InvalidateSourceAddressCache();
+
     SuccessOrExit(mUnicastAddresses.Add(aAddress));
     SignalUnicastAddressChange(kAddressAdded, aAddress);
 
@@ -374,6 +396,8 @@ exit:
 
 void Netif::RemoveUnicastAddress(const UnicastAddress &aAddress)
 {
+    Get<Ip6>().InvalidateSourceAddressCache();
+
     SuccessOrExit(mUnicastAddresses.Remove(aAddress));
     SignalUnicastAddressChange(kAddressRemoved, aAddress);
 
@@ -385,6 +409,8 @@ void Netif::SignalUnicastAddressChange(AddressEvent aEvent, const UnicastAddress
 {
     Event event;
 
+    Get<Ip6>().InvalidateSourceAddressCache();
+
     if (aAddress.mRloc)
     {
         event = (aEvent == kAddressAdded) ? kEventThreadRlocAdded : kEventThreadRlocRemoved;
@@ -430,6 +456,7 @@ Error Netif::AddExternalUnicastAddress(const UnicastAddress &aAddress)
         entry->mAddressOrigin = aAddress.mAddressOrigin;
         entry->mPreferred     = aAddress.mPreferred;
         entry->mValid         = aAddress.mValid;
+        Get<Ip6>().InvalidateSourceAddressCache();
         ExitNow();
     }
 
@@ -37,6 +37,7 @@
 #include "openthread-core-config.h"
 
 #include "common/as_core_type.hpp"
+#include "common/bloom_filter.hpp"
 #include "common/callback.hpp"
 #include "common/clearable.hpp"
 #include "common/code_utils.hpp"
@@ -652,6 +653,10 @@ private:
 
     static constexpr uint8_t kMulticastPrefixLength = 128; // Multicast prefix length used in `AdressInfo`.
 
+    // Number of counters in `mMulticastFilter`. Sized for about eight
+    // counters per subscribed address (fixed, Thread and external).
+    static constexpr uint16_t kMulticastFilterSize = 64 + 8 * OPENTHREAD_CONFIG_IP6_MAX_EXT_MCAST_ADDRS;
+
     void SignalUnicastAddressChange(AddressEvent aEvent, const UnicastAddress &aAddress);
     void SignalMulticastAddressChange(AddressEvent aEvent, const MulticastAddress &aAddress, AddressOrigin aOrigin);
     void SignalMulticastAddressesChange(AddressEvent            aEvent,
@@ -662,6 +667,8 @@ private:
     LinkedList<MulticastAddress> mMulticastAddresses;
     bool                         mMulticastPromiscuous;
 
+    CountingBloomFilter<Address, kMulticastFilterSize> mMulticastFilter;
+
     Callback<otIp6AddressCallback> mAddressCallback;
 
     Pool<UnicastAddress, OPENTHREAD_CONFIG_IP6_MAX_EXT_UCAST_ADDRS>           mExtUnicastAddressPool;
@@ -89,6 +89,9 @@ Server::Server(Instance &aInstance)
     , mSocket(aInstance)
     , mLeaseTimer(aInstance)
     , mOutstandingUpdatesTimer(aInstance)
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    , mSignatureVerifyTasklet(aInstance)
+#endif
     , mServiceUpdateId(Random::NonCrypto::GetUint32())
     , mPort(kUdpPortMin)
     , mState(kStateDisabled)
@@ -100,6 +103,10 @@ Server::Server(Instance &aInstance)
 #endif
 {
     IgnoreError(SetDomain(kDefaultDomain));
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    memset(&mSignatureVerifierCounters, 0, sizeof(mSignatureVerifierCounters));
+#endif
 }
 
 Error Server::SetAddressMode(AddressMode aMode)
@@ -685,6 +692,10 @@ void Server::Stop(void)
         mOutstandingUpdates.Pop()->Free();
     }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    ClearPendingVerifications();
+#endif
+
     mLeaseTimer.Stop();
     mOutstandingUpdatesTimer.Stop();
 
@@ -751,6 +762,14 @@ void Server::ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata)
         ExitNow(error = kErrorNone);
     }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    if (mPendingVerifications.ContainsMatching(aMetadata))
+    {
+        LogInfo("Drop duplicated SRP update request: MessageId=%u (verifying)", aMetadata.mDnsHeader.GetMessageId());
+        ExitNow(error = kErrorNone);
+    }
+#endif
+
     // Per 2.3.2 of SRP draft 6, no prerequisites should be included in a SRP update.
     VerifyOrExit(aMetadata.mDnsHeader.GetPrerequisiteRecordCount() == 0, error = kErrorFailed);
 
@@ -761,7 +780,12 @@ void Server::ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata)
     // Parse lease time and validate signature.
     SuccessOrExit(error = ProcessAdditionalSection(host, aMessage, aMetadata));
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    // The queued verification takes over `host`.
+    SuccessOrExit(error = QueueSignatureVerification(*host, aMetadata));
+#else
     HandleUpdate(*host, aMetadata);
+#endif
 
 exit:
     if (error != kErrorNone)
@@ -1227,8 +1251,12 @@ Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, Mes
     VerifyOrExit(sigRecord.GetTypeCovered() == 0, error = kErrorFailed);
     VerifyOrExit(signatureLength == Crypto::Ecdsa::P256::Signature::kSize, error = kErrorParse);
 
-    SuccessOrExit(error = VerifySignature(aHost->mKey, aMessage, aMetadata.mDnsHeader, sigOffset, sigRdataOffset,
-                                          sigRecord.GetLength(), signerName));
+    SuccessOrExit(error = ReadSignature(aMessage, aMetadata, sigOffset, sigRdataOffset, sigRecord.GetLength(),
+                                        signerName));
+
+#if !OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    SuccessOrExit(error = VerifySignature(aHost->mKey, aMetadata));
+#endif
 
     aMetadata.mOffset = offset;
 
@@ -1241,21 +1269,19 @@ exit:
     return error;
 }
 
-Error Server::VerifySignature(const Host::Key  &aKey,
-                              const Message    &aMessage,
-                              Dns::UpdateHeader aDnsHeader,
-                              uint16_t          aSigOffset,
-                              uint16_t          aSigRdataOffset,
-                              uint16_t          aSigRdataLength,
-                              const char       *aSignerName) const
+Error Server::ReadSignature(const Message   &aMessage,
+                            MessageMetadata &aMetadata,
+                            uint16_t         aSigOffset,
+                            uint16_t         aSigRdataOffset,
+                            uint16_t         aSigRdataLength,
+                            const char      *aSignerName) const
 {
-    Error                          error;
-    uint16_t                       offset = aMessage.GetOffset();
-    uint16_t                       signatureOffset;
-    Crypto::Sha256                 sha256;
-    Crypto::Sha256::Hash           hash;
-    Crypto::Ecdsa::P256::Signature signature;
-    Message                       *signerNameMessage = nullptr;
+    Error             error;
+    uint16_t          offset = aMessage.GetOffset();
+    uint16_t          signatureOffset;
+    Crypto::Sha256    sha256;
+    Dns::UpdateHeader dnsHeader         = aMetadata.mDnsHeader;
+    Message          *signerNameMessage = nullptr;
 
     VerifyOrExit(aSigRdataLength >= Crypto::Ecdsa::P256::Signature::kSize, error = kErrorInvalidArgs);
 
@@ -1272,27 +1298,37 @@ Error Server::VerifySignature(const Host::Key  &aKey,
     sha256.Update(*signerNameMessage, signerNameMessage->GetOffset(), signerNameMessage->GetLength());
 
     // We need the DNS header before appending the SIG RR.
-    aDnsHeader.SetAdditionalRecordCount(aDnsHeader.GetAdditionalRecordCount() - 1);
-    sha256.Update(aDnsHeader);
-    sha256.Update(aMessage, offset + sizeof(aDnsHeader), aSigOffset - offset - sizeof(aDnsHeader));
+    dnsHeader.SetAdditionalRecordCount(dnsHeader.GetAdditionalRecordCount() - 1);
+    sha256.Update(dnsHeader);
+    sha256.Update(aMessage, offset + sizeof(dnsHeader), aSigOffset - offset - sizeof(dnsHeader));
 
-    sha256.Finish(hash);
+    sha256.Finish(aMetadata.mSignedHash);
 
     signatureOffset = aSigRdataOffset + aSigRdataLength - Crypto::Ecdsa::P256::Signature::kSize;
-    SuccessOrExit(error = aMessage.Read(signatureOffset, signature));
-
-    error = aKey.Verify(hash, signature);
+    error           = aMessage.Read(signatureOffset, aMetadata.mSignature);
 
 exit:
     if (error != kErrorNone)
     {
-        LogWarn("Failed to verify message signature: %s", ErrorToString(error));
+        LogWarn("Failed to read message signature: %s", ErrorToString(error));
     }
 
     FreeMessage(signerNameMessage);
     return error;
 }
 
+Error Server::VerifySignature(const Host::Key &aKey, const MessageMetadata &aMetadata) const
+{
+    Error error = aKey.Verify(aMetadata.mSignedHash, aMetadata.mSignature);
+
+    if (error != kErrorNone)
+    {
+        LogWarn("Failed to verify message signature: %s", ErrorToString(error));
+    }
+
+    return error;
+}
+
 void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
 {
     Error error = kErrorNone;
@@ -1708,6 +1744,193 @@ void Server::UpdateResponseCounters(Dns::UpdateHeader::Response aResponseCode)
     }
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
+void Server::ResetSignatureVerifierCounters(void)
+{
+    uint16_t queueDepth = mSignatureVerifierCounters.mQueueDepth;
+
+    memset(&mSignatureVerifierCounters, 0, sizeof(mSignatureVerifierCounters));
+    mSignatureVerifierCounters.mQueueDepth    = queueDepth;
+    mSignatureVerifierCounters.mMaxQueueDepth = queueDepth;
+}
+
+Error Server::QueueSignatureVerification(Host &aHost, const MessageMetadata &aMetadata)
+{
+    Error                error = kErrorNone;
+    PendingVerification *pending;
+
+    if (mSignatureVerifierCounters.mQueueDepth >= kMaxPendingVerifications)
+    {
+        mSignatureVerifierCounters.mQueueFull++;
+        LogWarn("Too many SRP updates waiting for signature verification");
+        ExitNow(error = kErrorNoBufs);
+    }
+
+    pending = PendingVerification::Allocate(aHost, aMetadata);
+    VerifyOrExit(pending != nullptr, error = kErrorNoBufs);
+
+    // New entries are pushed at the head, the oldest one is the tail.
+    mPendingVerifications.Push(*pending);
+
+    mSignatureVerifierCounters.mQueueDepth++;
+    mSignatureVerifierCounters.mMaxQueueDepth =
+        Max(mSignatureVerifierCounters.mMaxQueueDepth, mSignatureVerifierCounters.mQueueDepth);
+
+    mSignatureVerifyTasklet.Post();
+
+exit:
+    return error;
+}
+
+Server::PendingVerification *Server::FindNextVerificationToStart(void)
+{
+    PendingVerification *next = nullptr;
+
+    for (PendingVerification &pending : mPendingVerifications)
+    {
+        if (!pending.IsStarted())
+        {
+            next = &pending;
+        }
+    }
+
+    return next;
+}
+
+void Server::HandleSignatureVerifyTasklet(void)
+{
+    PendingVerification *pending;
+
+    // Hand over the queued verifications to the platform, oldest first.
+    // The entry is marked as started beforehand since the platform may
+    // report the outcome (and so free the entry) from within the call.
+
+    while ((pending = FindNextVerificationToStart()) != nullptr)
+    {
+        pending->SetStarted(true);
+
+        if (otPlatCryptoEcdsaVerifyStart(&GetInstance(), &pending->GetKey(), &pending->GetMessageMetadata().mSignedHash,
+                                         &pending->GetMessageMetadata().mSignature, pending) != kErrorNone)
+        {
+            pending->SetStarted(false);
+            break;
+        }
+
+        mSignatureVerifierCounters.mOffloaded++;
+    }
+
+    // Otherwise verify a single signature here, so that other tasklets
+    // get to run before the next one (`FinishSignatureVerification()`
+    // posts the tasklet again).
+
+    VerifyOrExit(pending != nullptr);
+
+    pending->SetStarted(true);
+    FinishSignatureVerification(*pending, VerifySignature(pending->GetKey(), pending->GetMessageMetadata()));
+
+exit:
+    return;
+}
+
+void Server::HandleSignatureVerifyDone(void *aContext, Error aError)
+{
+    PendingVerification *pending = static_cast<PendingVerification *>(aContext);
+
+    VerifyOrExit(mPendingVerifications.Contains(*pending) && pending->IsStarted());
+
+    if (aError != kErrorNone)
+    {
+        LogWarn("Failed to verify message signature: %s", ErrorToString(aError));
+    }
+
+    FinishSignatureVerification(*pending, aError);
+
+exit:
+    return;
+}
+
+void Server::FinishSignatureVerification(PendingVerification &aPending, Error aError)
+{
+    Host    *host    = aPending.GetHost();
+    uint32_t latency = TimerMilli::GetNow() - aPending.GetQueueTime();
+
+    IgnoreError(mPendingVerifications.Remove(aPending));
+
+    mSignatureVerifierCounters.mQueueDepth--;
+    mSignatureVerifierCounters.mTotalLatency += latency;
+    mSignatureVerifierCounters.mMaxLatency = Max(mSignatureVerifierCounters.mMaxLatency, latency);
+
+    if (aError == kErrorNone)
+    {
+        mSignatureVerifierCounters.mVerified++;
+    }
+    else
+    {
+        mSignatureVerifierCounters.mFailed++;
+    }
+
+    // `host` is `nullptr` when the server was stopped meanwhile.
+    VerifyOrExit(host != nullptr);
+
+    // Other SRP updates may have been committed while this one was
+    // waiting, so name conflicts are checked again.
+    if ((aError == kErrorNone) && HasNameConflictsWith(*host))
+    {
+        aError = kErrorDuplicated;
+    }
+
+    if (aError == kErrorNone)
+    {
+        HandleUpdate(*host, aPending.GetMessageMetadata());
+    }
+    else
+    {
+        host->Free();
+
+        if (aPending.GetMessageMetadata().IsDirectRxFromClient())
+        {
+            SendResponse(aPending.GetMessageMetadata().mDnsHeader, ErrorToDnsResponseCode(aError),
+                         *aPending.GetMessageMetadata().mMessageInfo);
+        }
+    }
+
+exit:
+    aPending.Free();
+
+    if (FindNextVerificationToStart() != nullptr)
+    {
+        mSignatureVerifyTasklet.Post();
+    }
+}
+
+void Server::ClearPendingVerifications(void)
+{
+    PendingVerification *next;
+
+    // Verifications started on the platform are only abandoned, their
+    // entries are freed once the platform reports the outcome.
+
+    for (PendingVerification *pending = mPendingVerifications.GetHead(); pending != nullptr; pending = next)
+    {
+        next = pending->GetNext();
+
+        if (pending->IsStarted())
+        {
+            pending->Abandon();
+        }
+        else
+        {
+            IgnoreError(mPendingVerifications.Remove(*pending));
+            mSignatureVerifierCounters.mQueueDepth--;
+            pending->Abandon();
+            pending->Free();
+        }
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
 //---------------------------------------------------------------------------------------------------------------------
 // Server::Service
 
@@ -2105,6 +2328,46 @@ Server::UpdateMetadata::UpdateMetadata(Instance &aInstance, Host &aHost, const M
     }
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// Server::PendingVerification
+
+Server::PendingVerification::PendingVerification(Host &aHost, const MessageMetadata &aMessageMetadata)
+    : mNext(nullptr)
+    , mHost(&aHost)
+    , mKey(aHost.GetKey())
+    , mMessageMetadata(aMessageMetadata)
+    , mQueueTime(TimerMilli::GetNow())
+    , mIsStarted(false)
+{
+    if (aMessageMetadata.mMessageInfo != nullptr)
+    {
+        mMessageInfo                  = *aMessageMetadata.mMessageInfo;
+        mMessageMetadata.mMessageInfo = &mMessageInfo;
+    }
+}
+
+void Server::PendingVerification::Abandon(void)
+{
+    if (mHost != nullptr)
+    {
+        mHost->Free();
+        mHost = nullptr;
+    }
+}
+
+bool Server::PendingVerification::Matches(const MessageMetadata &aMessageMetadata) const
+{
+    return (mHost != nullptr) && aMessageMetadata.IsDirectRxFromClient() &&
+           mMessageMetadata.IsDirectRxFromClient() &&
+           (aMessageMetadata.mDnsHeader.GetMessageId() == mMessageMetadata.mDnsHeader.GetMessageId()) &&
+           (aMessageMetadata.mMessageInfo->GetPeerAddr() == mMessageInfo.GetPeerAddr()) &&
+           (aMessageMetadata.mMessageInfo->GetPeerPort() == mMessageInfo.GetPeerPort());
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
 } // namespace Srp
 } // namespace ot
 
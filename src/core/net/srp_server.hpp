@@ -69,8 +69,10 @@
 #include "common/num_utils.hpp"
 #include "common/numeric_limits.hpp"
 #include "common/retain_ptr.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
+#include "crypto/sha256.hpp"
 #include "net/dns_types.hpp"
 #include "net/ip6.hpp"
 #include "net/ip6_address.hpp"
@@ -853,6 +855,34 @@ public:
      */
     const otSrpServerResponseCounters *GetResponseCounters(void) const { return &mResponseCounters; }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    /**
+     * Returns the signature verification counters of the SRP server.
+     *
+     * @returns  A pointer to the signature verification counters of the SRP server.
+     *
+     */
+    const otSrpServerSignatureVerifierCounters *GetSignatureVerifierCounters(void) const
+    {
+        return &mSignatureVerifierCounters;
+    }
+
+    /**
+     * Resets the signature verification counters of the SRP server, except for the current queue depth.
+     *
+     */
+    void ResetSignatureVerifierCounters(void);
+
+    /**
+     * Handles the outcome of a signature verification started with `otPlatCryptoEcdsaVerifyStart()`.
+     *
+     * @param[in]  aContext  The context given to `otPlatCryptoEcdsaVerifyStart()`.
+     * @param[in]  aError    The outcome of the verification.
+     *
+     */
+    void HandleSignatureVerifyDone(void *aContext, Error aError);
+#endif
+
     /**
      * Receives the service update result from service handler set by
      * SetServiceHandler.
@@ -879,6 +909,11 @@ private:
 
     static constexpr uint16_t kAnycastAddressModePort = 53;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    static constexpr uint16_t kMaxPendingVerifications =
+        OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_SIGNATURE_VERIFICATIONS;
+#endif
+
     // Metadata for a received SRP Update message.
     struct MessageMetadata
     {
@@ -886,13 +921,15 @@ private:
         // client or from an SRPL partner.
         bool IsDirectRxFromClient(void) const { return (mMessageInfo != nullptr); }
 
-        Dns::UpdateHeader       mDnsHeader;
-        Dns::Zone               mDnsZone;
-        uint16_t                mOffset;
-        TimeMilli               mRxTime;
-        TtlConfig               mTtlConfig;
-        LeaseConfig             mLeaseConfig;
-        const Ip6::MessageInfo *mMessageInfo; // Set to `nullptr` when from SRPL.
+        Dns::UpdateHeader              mDnsHeader;
+        Dns::Zone                      mDnsZone;
+        uint16_t                       mOffset;
+        TimeMilli                      mRxTime;
+        TtlConfig                      mTtlConfig;
+        LeaseConfig                    mLeaseConfig;
+        const Ip6::MessageInfo        *mMessageInfo; // Set to `nullptr` when from SRPL.
+        Crypto::Sha256::Hash           mSignedHash;
+        Crypto::Ecdsa::P256::Signature mSignature;
     };
 
     // This class includes metadata for processing a SRP update (register, deregister)
@@ -929,6 +966,38 @@ private:
         bool              mIsDirectRxFromClient;
     };
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    // A received SRP update waiting for its signature to be verified.
+    // It owns the parsed `Host` until the verification completes.
+    class PendingVerification : public LinkedListEntry<PendingVerification>,
+                                public Heap::Allocatable<PendingVerification>
+    {
+        friend class LinkedListEntry<PendingVerification>;
+        friend class Heap::Allocatable<PendingVerification>;
+
+    public:
+        Host                  *GetHost(void) { return mHost; }
+        void                   Abandon(void);
+        const Host::Key       &GetKey(void) const { return mKey; }
+        const MessageMetadata &GetMessageMetadata(void) const { return mMessageMetadata; }
+        TimeMilli              GetQueueTime(void) const { return mQueueTime; }
+        bool                   IsStarted(void) const { return mIsStarted; }
+        void                   SetStarted(bool aStarted) { mIsStarted = aStarted; }
+        bool                   Matches(const MessageMetadata &aMessageMetadata) const;
+
+    private:
+        PendingVerification(Host &aHost, const MessageMetadata &aMessageMetadata);
+
+        PendingVerification *mNext;
+        Host                *mHost; // Set to `nullptr` when abandoned.
+        Host::Key            mKey;
+        MessageMetadata      mMessageMetadata;
+        Ip6::MessageInfo     mMessageInfo; // Valid when `mMessageMetadata.IsDirectRxFromClient()`.
+        TimeMilli            mQueueTime;
+        bool                 mIsStarted;
+    };
+#endif
+
     void              Enable(void);
     void              Disable(void);
     void              Start(void);
@@ -964,13 +1033,13 @@ private:
     void  ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata);
     Error ProcessUpdateSection(Host &aHost, const Message &aMessage, MessageMetadata &aMetadata) const;
     Error ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata) const;
-    Error VerifySignature(const Host::Key  &aKey,
-                          const Message    &aMessage,
-                          Dns::UpdateHeader aDnsHeader,
-                          uint16_t          aSigOffset,
-                          uint16_t          aSigRdataOffset,
-                          uint16_t          aSigRdataLength,
-                          const char       *aSignerName) const;
+    Error ReadSignature(const Message   &aMessage,
+                        MessageMetadata &aMetadata,
+                        uint16_t         aSigOffset,
+                        uint16_t         aSigRdataOffset,
+                        uint16_t         aSigRdataLength,
+                        const char      *aSignerName) const;
+    Error VerifySignature(const Host::Key &aKey, const MessageMetadata &aMetadata) const;
     Error ProcessZoneSection(const Message &aMessage, MessageMetadata &aMetadata) const;
     Error ProcessHostDescriptionInstruction(Host                  &aHost,
                                             const Message         &aMessage,
@@ -1005,6 +1074,16 @@ private:
 
     void UpdateResponseCounters(Dns::Header::Response aResponseCode);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    Error                QueueSignatureVerification(Host &aHost, const MessageMetadata &aMetadata);
+    PendingVerification *FindNextVerificationToStart(void);
+    void                 HandleSignatureVerifyTasklet(void);
+    void                 FinishSignatureVerification(PendingVerification &aPending, Error aError);
+    void                 ClearPendingVerifications(void);
+
+    using SignatureVerifyTasklet = TaskletIn<Server, &Server::HandleSignatureVerifyTasklet>;
+#endif
+
     using LeaseTimer  = TimerMilliIn<Server, &Server::HandleLeaseTimer>;
     using UpdateTimer = TimerMilliIn<Server, &Server::HandleOutstandingUpdatesTimer>;
 
@@ -1023,6 +1102,12 @@ private:
     UpdateTimer                mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    LinkedList<PendingVerification>      mPendingVerifications;
+    SignatureVerifyTasklet               mSignatureVerifyTasklet;
+    otSrpServerSignatureVerifierCounters mSignatureVerifierCounters;
+#endif
+
     ServiceUpdateId mServiceUpdateId;
     uint16_t        mPort;
     State           mState;
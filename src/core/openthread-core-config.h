@@ -92,6 +92,7 @@
 #include "config/history_tracker.h"
 #include "config/ip6.h"
 #include "config/joiner.h"
+#include "config/latency_tracer.h"
 #include "config/link_quality.h"
 #include "config/link_raw.h"
 #include "config/logging.h"
@@ -101,6 +102,7 @@
 #include "config/misc.h"
 #include "config/mle.h"
 #include "config/nat64.h"
+#include "config/netdata_delta.h"
 #include "config/netdata_publisher.h"
 #include "config/network_diagnostic.h"
 #include "config/parent_search.h"
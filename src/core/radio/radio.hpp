@@ -639,6 +639,34 @@ public:
      */
     Error AddSrcMatchExtEntry(const Mac::ExtAddress &aExtAddress);
 
+    /**
+     * Adds a list of short addresses to the source address match table.
+     *
+     * Either all the addresses are added or, on failure, none of them.
+     *
+     * @param[in]  aShortAddresses  An array of short addresses to be added.
+     * @param[in]  aNumAddresses    The number of addresses in @p aShortAddresses.
+     *
+     * @retval kErrorNone     Successfully added all the short addresses to the source match table.
+     * @retval kErrorNoBufs   Not enough available entries in the source match table.
+     *
+     */
+    Error AddSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumAddresses);
+
+    /**
+     * Adds a list of extended addresses to the source address match table.
+     *
+     * Either all the addresses are added or, on failure, none of them.
+     *
+     * @param[in]  aExtAddresses  An array of extended addresses to be added, each stored in little-endian byte order.
+     * @param[in]  aNumAddresses  The number of addresses in @p aExtAddresses.
+     *
+     * @retval kErrorNone     Successfully added all the extended addresses to the source match table.
+     * @retval kErrorNoBufs   Not enough available entries in the source match table.
+     *
+     */
+    Error AddSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumAddresses);
+
     /**
      * Removes a short address from the source address match table.
      *
@@ -895,6 +923,16 @@ inline Error Radio::AddSrcMatchExtEntry(const Mac::ExtAddress &aExtAddress)
     return otPlatRadioAddSrcMatchExtEntry(GetInstancePtr(), &aExtAddress);
 }
 
+inline Error Radio::AddSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumAddresses)
+{
+    return otPlatRadioAddSrcMatchShortEntries(GetInstancePtr(), aShortAddresses, aNumAddresses);
+}
+
+inline Error Radio::AddSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumAddresses)
+{
+    return otPlatRadioAddSrcMatchExtEntries(GetInstancePtr(), aExtAddresses, aNumAddresses);
+}
+
 inline Error Radio::ClearSrcMatchShortEntry(Mac::ShortAddress aShortAddress)
 {
     return otPlatRadioClearSrcMatchShortEntry(GetInstancePtr(), aShortAddress);
@@ -990,6 +1028,10 @@ inline Error Radio::AddSrcMatchShortEntry(Mac::ShortAddress) { return kErrorNone
 
 inline Error Radio::AddSrcMatchExtEntry(const Mac::ExtAddress &) { return kErrorNone; }
 
+inline Error Radio::AddSrcMatchShortEntries(const Mac::ShortAddress *, uint16_t) { return kErrorNone; }
+
+inline Error Radio::AddSrcMatchExtEntries(const Mac::ExtAddress *, uint16_t) { return kErrorNone; }
+
 inline Error Radio::ClearSrcMatchShortEntry(Mac::ShortAddress) { return kErrorNone; }
 
 inline Error Radio::ClearSrcMatchExtEntry(const Mac::ExtAddress &) { return kErrorNone; }
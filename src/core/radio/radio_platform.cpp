@@ -305,6 +305,56 @@ OT_TOOL_WEAK otError otPlatRadioGetRegion(otInstance *aInstance, uint16_t *aRegi
     return kErrorNotImplemented;
 }
 
+OT_TOOL_WEAK otError otPlatRadioAddSrcMatchShortEntries(otInstance           *aInstance,
+                                                        const otShortAddress *aShortAddresses,
+                                                        uint16_t              aNumAddresses)
+{
+    otError  error = kErrorNone;
+    uint16_t numAdded;
+
+    for (numAdded = 0; numAdded < aNumAddresses; numAdded++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchShortEntry(aInstance, aShortAddresses[numAdded]));
+    }
+
+exit:
+    if (error != kErrorNone)
+    {
+        while (numAdded > 0)
+        {
+            numAdded--;
+            IgnoreError(otPlatRadioClearSrcMatchShortEntry(aInstance, aShortAddresses[numAdded]));
+        }
+    }
+
+    return error;
+}
+
+OT_TOOL_WEAK otError otPlatRadioAddSrcMatchExtEntries(otInstance         *aInstance,
+                                                      const otExtAddress *aExtAddresses,
+                                                      uint16_t            aNumAddresses)
+{
+    otError  error = kErrorNone;
+    uint16_t numAdded;
+
+    for (numAdded = 0; numAdded < aNumAddresses; numAdded++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchExtEntry(aInstance, &aExtAddresses[numAdded]));
+    }
+
+exit:
+    if (error != kErrorNone)
+    {
+        while (numAdded > 0)
+        {
+            numAdded--;
+            IgnoreError(otPlatRadioClearSrcMatchExtEntry(aInstance, &aExtAddresses[numAdded]));
+        }
+    }
+
+    return error;
+}
+
 OT_TOOL_WEAK otError otPlatRadioReceiveAt(otInstance *aInstance, uint8_t aChannel, uint32_t aStart, uint32_t aDuration)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -237,6 +237,7 @@ void Link::BeginTransmit(void)
         mRxFrame.mInfo.mRxInfo.mRssi                  = Radio::kInvalidRssi;
         mRxFrame.mInfo.mRxInfo.mLqi                   = OT_RADIO_LQI_NONE;
         mRxFrame.mInfo.mRxInfo.mAckedWithFramePending = false;
+        mRxFrame.mInfo.mRxInfo.mIsSecurityProcessed   = false;
 
         ackFrame = &mRxFrame;
     }
@@ -374,6 +375,7 @@ void Link::ProcessReceivedPacket(Packet &aPacket)
     mRxFrame.mInfo.mRxInfo.mRssi                  = kRxRssi;
     mRxFrame.mInfo.mRxInfo.mLqi                   = OT_RADIO_LQI_NONE;
     mRxFrame.mInfo.mRxInfo.mAckedWithFramePending = true;
+    mRxFrame.mInfo.mRxInfo.mIsSecurityProcessed   = false;
 
     Get<Mac::Mac>().HandleReceivedFrame(&mRxFrame, kErrorNone);
 
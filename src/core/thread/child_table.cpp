@@ -76,6 +76,7 @@ exit:
 ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
+    , mMulticastFilterStale(true)
 {
     for (Child &child : mChildren)
     {
@@ -90,6 +91,8 @@ void ChildTable::Clear(void)
     {
         child.Clear();
     }
+
+    MarkMulticastFilterStale();
 }
 
 Child *ChildTable::GetChildAtIndex(uint16_t aChildIndex)
@@ -118,6 +121,19 @@ const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
     const Child *child = mChildren;
 
+    if (CanUseIndex(aMatcher.mStateFilter))
+    {
+        if (aMatcher.mExtAddress != nullptr)
+        {
+            ExitNow(child = mChildrenByExtAddress.FindMatching(aMatcher, HashExtAddress(*aMatcher.mExtAddress)));
+        }
+
+        if (aMatcher.mShortAddress != Mac::kShortAddrInvalid)
+        {
+            ExitNow(child = mChildrenByRloc16.FindMatching(aMatcher, HashRloc16(aMatcher.mShortAddress)));
+        }
+    }
+
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (child->Matches(aMatcher))
@@ -132,6 +148,76 @@ exit:
     return child;
 }
 
+bool ChildTable::CanUseIndex(Child::StateFilter aFilter)
+{
+    // The index only contains children that are not in `kStateInvalid`, so it can be used for filters which
+    // never accept a child in `kStateInvalid`.
+
+    bool canUse = false;
+
+    switch (aFilter)
+    {
+    case Child::kInStateValid:
+    case Child::kInStateValidOrRestoring:
+    case Child::kInStateChildIdRequest:
+    case Child::kInStateValidOrAttaching:
+    case Child::kInStateAnyExceptInvalid:
+        canUse = true;
+        break;
+
+    case Child::kInStateInvalid:
+    case Child::kInStateAnyExceptValidOrRestoring:
+    case Child::kInStateAny:
+        break;
+    }
+
+    return canUse;
+}
+
+uint32_t ChildTable::HashExtAddress(const Mac::ExtAddress &aExtAddress)
+{
+    HashCalculator hash;
+
+    hash.Update(aExtAddress.m8, sizeof(aExtAddress.m8));
+
+    return hash.GetHash();
+}
+
+uint32_t ChildTable::HashRloc16(uint16_t aRloc16)
+{
+    HashCalculator hash;
+
+    hash.Update(aRloc16);
+
+    return hash.GetHash();
+}
+
+void ChildTable::AddToIndex(Neighbor &aNeighbor)
+{
+    Child &child = static_cast<Child &>(aNeighbor);
+
+    VerifyOrExit(Contains(aNeighbor) && !aNeighbor.IsStateInvalid());
+
+    mChildrenByExtAddress.Add(child, HashExtAddress(child.GetExtAddress()));
+    mChildrenByRloc16.Add(child, HashRloc16(child.GetRloc16()));
+
+exit:
+    return;
+}
+
+void ChildTable::RemoveFromIndex(Neighbor &aNeighbor)
+{
+    Child &child = static_cast<Child &>(aNeighbor);
+
+    VerifyOrExit(Contains(aNeighbor) && !aNeighbor.IsStateInvalid());
+
+    mChildrenByExtAddress.Remove(child, HashExtAddress(child.GetExtAddress()));
+    mChildrenByRloc16.Remove(child, HashRloc16(child.GetRloc16()));
+
+exit:
+    return;
+}
+
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
 {
     return FindChild(Child::AddressMatcher(aRloc16, aFilter));
@@ -314,11 +400,21 @@ exit:
     return;
 }
 
-bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) const
+bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address)
 {
     bool         hasChild = false;
     const Child *child    = &mChildren[0];
 
+    if (aIp6Address.IsMulticast())
+    {
+        if (mMulticastFilterStale)
+        {
+            RebuildMulticastFilter();
+        }
+
+        VerifyOrExit(mMulticastFilter.MayContain(aIp6Address));
+    }
+
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (child->IsStateValidOrRestoring() && !child->IsRxOnWhenIdle() && child->HasIp6Address(aIp6Address))
@@ -328,9 +424,30 @@ bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) cons
         }
     }
 
+exit:
     return hasChild;
 }
 
+void ChildTable::RebuildMulticastFilter(void)
+{
+    // The filter covers the multicast addresses of all child entries
+    // regardless of their state or mode. This keeps it valid when a
+    // child changes state or mode (at the cost of false positives
+    // which are caught by the exact check on a filter hit).
+
+    mMulticastFilter.Clear();
+
+    for (const Child &child : mChildren)
+    {
+        for (const Ip6::Address &address : child.IterateIp6Addresses(Ip6::Address::kTypeMulticast))
+        {
+            mMulticastFilter.Add(address);
+        }
+    }
+
+    mMulticastFilterStale = false;
+}
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
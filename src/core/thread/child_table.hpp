@@ -38,7 +38,9 @@
 
 #if OPENTHREAD_FTD
 
+#include "common/bloom_filter.hpp"
 #include "common/const_cast.hpp"
+#include "common/hash_table.hpp"
 #include "common/iterator_utils.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -53,6 +55,8 @@ namespace ot {
 class ChildTable : public InstanceLocator, private NonCopyable
 {
     friend class NeighborTable;
+    friend class Neighbor;
+    friend class Child;
     class IteratorBuilder;
 
 public:
@@ -298,11 +302,23 @@ public:
      *
      * @param[in]  aIp6Address  An IPv6 address.
      *
+     * Multicast addresses are first checked against a Bloom filter of the addresses registered by all children (which
+     * is rebuilt here if it is stale), and the child table is only searched on a filter hit.
+     *
      * @retval TRUE   If the child table contains any sleepy child with @p aIp6Address.
      * @retval FALSE  If the child table does not contain any sleepy child with @p aIp6Address.
      *
      */
-    bool HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) const;
+    bool HasSleepyChildWithAddress(const Ip6::Address &aIp6Address);
+
+    /**
+     * Marks the multicast address filter used by `HasSleepyChildWithAddress()` as stale.
+     *
+     * MUST be called when a multicast address is registered by a child. It should also be called when addresses are
+     * removed so that the filter does not accumulate false positives.
+     *
+     */
+    void MarkMulticastFilterStale(void) { mMulticastFilterStale = true; }
 
     /**
      * Indicates whether the child table contains a given `Neighbor` instance.
@@ -323,6 +339,12 @@ public:
 private:
     static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
 
+    // Number of bits in `mMulticastFilter`, about eight bits per child.
+    static constexpr uint16_t kMulticastFilterBits = (kMaxChildren < 32) ? 256 : (8 * kMaxChildren);
+
+    // Number of buckets in the extended address and RLOC16 hash tables, about one per child.
+    static constexpr uint16_t kNumHashBuckets = kMaxChildren;
+
     class IteratorBuilder : public InstanceLocator
     {
     public:
@@ -343,9 +365,22 @@ private:
 
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
     void         RefreshStoredChildren(void);
-
-    uint16_t mMaxChildrenAllowed;
-    Child    mChildren[kMaxChildren];
+    void         RebuildMulticastFilter(void);
+
+    // Children in any state other than `kStateInvalid` are indexed by their extended address and RLOC16. `Neighbor`
+    // calls `RemoveFromIndex()` before changing the state or an address of an entry and `AddToIndex()` afterwards.
+    void            AddToIndex(Neighbor &aNeighbor);
+    void            RemoveFromIndex(Neighbor &aNeighbor);
+    static bool     CanUseIndex(Child::StateFilter aFilter);
+    static uint32_t HashExtAddress(const Mac::ExtAddress &aExtAddress);
+    static uint32_t HashRloc16(uint16_t aRloc16);
+
+    uint16_t                                                     mMaxChildrenAllowed;
+    Child                                                        mChildren[kMaxChildren];
+    HashTable<Child, &Child::mNextByExtAddress, kNumHashBuckets> mChildrenByExtAddress;
+    HashTable<Child, &Child::mNextByRloc16, kNumHashBuckets>     mChildrenByRloc16;
+    bool                                                         mMulticastFilterStale;
+    BloomFilter<Ip6::Address, kMulticastFilterBits>              mMulticastFilter;
 };
 
 } // namespace ot
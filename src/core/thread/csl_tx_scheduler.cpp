@@ -32,6 +32,7 @@
 
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/num_utils.hpp"
 #include "common/time.hpp"
 #include "mac/mac.hpp"
 
@@ -67,8 +68,11 @@ CslTxScheduler::CslTxScheduler(Instance &aInstance)
     , mCslTxMessage(nullptr)
     , mFrameContext()
     , mCallbacks(aInstance)
+    , mScheduleLength(0)
 {
     InitFrameRequestAhead();
+    ClearSchedule();
+    mCounters.Clear();
 }
 
 void CslTxScheduler::InitFrameRequestAhead(void)
@@ -80,8 +84,10 @@ void CslTxScheduler::InitFrameRequestAhead(void)
     mCslFrameRequestAheadUs = OPENTHREAD_CONFIG_MAC_CSL_REQUEST_AHEAD_US + busTxTimeUs;
 }
 
-void CslTxScheduler::Update(void)
+void CslTxScheduler::Update(Child &aChild)
 {
+    UpdateScheduleEntry(aChild);
+
     if (mCslTxMessage == nullptr)
     {
         RescheduleCslTx();
@@ -112,6 +118,8 @@ void CslTxScheduler::Clear(void)
     mFrameContext.mMessageNextOffset = 0;
     mCslTxChild                      = nullptr;
     mCslTxMessage                    = nullptr;
+
+    ClearSchedule();
 }
 
 /**
@@ -122,51 +130,204 @@ void CslTxScheduler::Clear(void)
  */
 void CslTxScheduler::RescheduleCslTx(void)
 {
-    uint32_t minDelayTime = Time::kMaxDuration;
-    Child   *bestChild    = nullptr;
+    uint64_t radioNow  = otPlatRadioGetNow(&GetInstance());
+    Child   *bestChild = nullptr;
 
-    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+    while (mScheduleLength > 0)
     {
-        uint32_t delay;
-        uint32_t cslTxDelay;
+        uint16_t childIndex = mSchedule[0].mChildIndex;
+        Child   &child      = *Get<ChildTable>().GetChildAtIndex(childIndex);
 
-        if (!child.IsCslSynchronized() || child.GetIndirectMessageCount() == 0)
+        // Entries are validated lazily: a child may have been removed
+        // or lost CSL synchronization without its entry being updated.
+
+        if (!ShouldSchedule(child))
         {
+            RemoveScheduleEntry(childIndex);
             continue;
         }
 
-        delay = GetNextCslTransmissionDelay(child, cslTxDelay, mCslFrameRequestAheadUs);
-
-        if (delay < minDelayTime)
+        if (mSchedule[0].mTxWindow < radioNow + mCslFrameRequestAheadUs)
         {
-            minDelayTime = delay;
-            bestChild    = &child;
+            // The window went by (or is too close to prepare a frame
+            // for) while the child had a pending frame, so move the
+            // child to its next usable window.
+
+            mCounters.mMissedWindows++;
+            UpdateScheduleEntry(childIndex, GetNextCslTxWindow(child, radioNow, mCslFrameRequestAheadUs));
+            continue;
         }
+
+        bestChild = &child;
+        break;
     }
 
     if (bestChild != nullptr)
     {
-        Get<Mac::Mac>().RequestCslFrameTransmission(minDelayTime / 1000UL);
+        uint32_t delay = static_cast<uint32_t>(mSchedule[0].mTxWindow - radioNow - mCslFrameRequestAheadUs);
+
+        Get<Mac::Mac>().RequestCslFrameTransmission(delay / 1000UL);
+        mCounters.mTxRequests++;
     }
 
     mCslTxChild = bestChild;
 }
 
-uint32_t CslTxScheduler::GetNextCslTransmissionDelay(const Child &aChild,
-                                                     uint32_t    &aDelayFromLastRx,
-                                                     uint32_t     aAheadUs) const
+bool CslTxScheduler::ShouldSchedule(const Child &aChild) const
+{
+    return aChild.MatchesFilter(Child::kInStateAnyExceptInvalid) && aChild.IsCslSynchronized() &&
+           (aChild.GetIndirectMessageCount() > 0);
+}
+
+void CslTxScheduler::UpdateScheduleEntry(Child &aChild)
+{
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    if (ShouldSchedule(aChild))
+    {
+        UpdateScheduleEntry(childIndex,
+                            GetNextCslTxWindow(aChild, otPlatRadioGetNow(&GetInstance()), mCslFrameRequestAheadUs));
+    }
+    else
+    {
+        RemoveScheduleEntry(childIndex);
+    }
+}
+
+void CslTxScheduler::UpdateScheduleEntry(uint16_t aChildIndex, uint64_t aTxWindow)
+{
+    uint16_t      position = mSchedulePositions[aChildIndex];
+    ScheduleEntry entry;
+
+    entry.mTxWindow   = aTxWindow;
+    entry.mChildIndex = aChildIndex;
+
+    if (position == kNotScheduled)
+    {
+        position = mScheduleLength++;
+        mCounters.mMaxScheduledChildren = Max(mCounters.mMaxScheduledChildren, mScheduleLength);
+    }
+
+    SetScheduleEntry(position, entry);
+    SiftDown(SiftUp(position));
+
+    mCounters.mScheduleUpdates++;
+}
+
+void CslTxScheduler::RemoveScheduleEntry(uint16_t aChildIndex)
+{
+    uint16_t position = mSchedulePositions[aChildIndex];
+
+    VerifyOrExit(position != kNotScheduled);
+
+    mSchedulePositions[aChildIndex] = kNotScheduled;
+    mScheduleLength--;
+
+    if (position != mScheduleLength)
+    {
+        SetScheduleEntry(position, mSchedule[mScheduleLength]);
+        SiftDown(SiftUp(position));
+    }
+
+    mCounters.mScheduleUpdates++;
+
+exit:
+    return;
+}
+
+void CslTxScheduler::ClearSchedule(void)
+{
+    mScheduleLength = 0;
+
+    for (uint16_t &position : mSchedulePositions)
+    {
+        position = kNotScheduled;
+    }
+}
+
+uint16_t CslTxScheduler::SiftUp(uint16_t aPosition)
+{
+    ScheduleEntry entry = mSchedule[aPosition];
+
+    while (aPosition > 0)
+    {
+        uint16_t parent = (aPosition - 1) / 2;
+
+        if (mSchedule[parent].mTxWindow <= entry.mTxWindow)
+        {
+            break;
+        }
+
+        SetScheduleEntry(aPosition, mSchedule[parent]);
+        aPosition = parent;
+    }
+
+    SetScheduleEntry(aPosition, entry);
+
+    return aPosition;
+}
+
+uint16_t CslTxScheduler::SiftDown(uint16_t aPosition)
+{
+    ScheduleEntry entry = mSchedule[aPosition];
+
+    while (true)
+    {
+        uint16_t child = 2 * aPosition + 1;
+
+        if (child >= mScheduleLength)
+        {
+            break;
+        }
+
+        if ((child + 1 < mScheduleLength) && (mSchedule[child + 1].mTxWindow < mSchedule[child].mTxWindow))
+        {
+            child++;
+        }
+
+        if (entry.mTxWindow <= mSchedule[child].mTxWindow)
+        {
+            break;
+        }
+
+        SetScheduleEntry(aPosition, mSchedule[child]);
+        aPosition = child;
+    }
+
+    SetScheduleEntry(aPosition, entry);
+
+    return aPosition;
+}
+
+void CslTxScheduler::SetScheduleEntry(uint16_t aPosition, const ScheduleEntry &aEntry)
+{
+    mSchedule[aPosition]                   = aEntry;
+    mSchedulePositions[aEntry.mChildIndex] = aPosition;
+    mCounters.mScheduleSteps++;
+}
+
+uint64_t CslTxScheduler::GetNextCslTxWindow(const Child &aChild, uint64_t aRadioNow, uint32_t aAheadUs) const
 {
-    uint64_t radioNow   = otPlatRadioGetNow(&GetInstance());
     uint32_t periodInUs = aChild.GetCslPeriod() * kUsPerTenSymbols;
     uint64_t firstTxWindow =
         aChild.GetLastRxTimestamp() - kRadioHeaderShrDuration + aChild.GetCslPhase() * kUsPerTenSymbols;
-    uint64_t nextTxWindow = radioNow - (radioNow % periodInUs) + (firstTxWindow % periodInUs);
+    uint64_t nextTxWindow = aRadioNow - (aRadioNow % periodInUs) + (firstTxWindow % periodInUs);
 
-    while (nextTxWindow < radioNow + aAheadUs)
+    while (nextTxWindow < aRadioNow + aAheadUs)
     {
         nextTxWindow += periodInUs;
     }
 
+    return nextTxWindow;
+}
+
+uint32_t CslTxScheduler::GetNextCslTransmissionDelay(const Child &aChild,
+                                                     uint32_t    &aDelayFromLastRx,
+                                                     uint32_t     aAheadUs) const
+{
+    uint64_t radioNow     = otPlatRadioGetNow(&GetInstance());
+    uint64_t nextTxWindow = GetNextCslTxWindow(aChild, radioNow, aAheadUs);
+
     aDelayFromLastRx = static_cast<uint32_t>(nextTxWindow - aChild.GetLastRxTimestamp());
 
     return static_cast<uint32_t>(nextTxWindow - radioNow - aAheadUs);
@@ -238,7 +399,11 @@ Mac::TxFrame *CslTxScheduler::HandleFrameRequest(Mac::TxFrames &aTxFrames)
     // and by the time `HandleFrameRequest()` is invoked, we miss the
     // current CSL window and move to the next window.
 
-    VerifyOrExit(delay <= mCslFrameRequestAheadUs + kFramePreparationGuardInterval, frame = nullptr);
+    if (delay > mCslFrameRequestAheadUs + kFramePreparationGuardInterval)
+    {
+        mCounters.mLateFramePreparations++;
+        ExitNow(frame = nullptr);
+    }
 
     frame->SetTxDelay(txDelay);
     frame->SetTxDelayBaseTime(
@@ -267,6 +432,10 @@ void CslTxScheduler::HandleSentFrame(const Mac::TxFrame &aFrame, Error aError)
 
     HandleSentFrame(aFrame, aError, *child);
 
+    // Move the child past the window that was just used so that it
+    // is not accounted as a missed window when rescheduling.
+    UpdateScheduleEntry(*child);
+
 exit:
     RescheduleCslTx();
 }
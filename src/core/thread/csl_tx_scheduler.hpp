@@ -33,9 +33,13 @@
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
 
+#include <openthread/thread_ftd.h>
+
+#include "common/clearable.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/time.hpp"
 #include "mac/mac.hpp"
 #include "mac/mac_frame.hpp"
@@ -113,6 +117,14 @@ public:
         static_assert(kMaxCslTriggeredTxAttempts < (1 << 7), "mCslTxAttempts cannot fit max!");
     };
 
+    /**
+     * Represents the CSL tx scheduler counters.
+     *
+     */
+    class Counters : public otCslTxCounters, public Clearable<Counters>
+    {
+    };
+
     /**
      * Defines the callbacks used by the `CslTxScheduler`.
      *
@@ -171,14 +183,19 @@ public:
     explicit CslTxScheduler(Instance &aInstance);
 
     /**
-     * Updates the next CSL transmission (finds the nearest child).
+     * Updates the CSL tx schedule of a given child and then the next CSL transmission (finds the nearest child).
+     *
+     * Must be called whenever the CSL parameters, the CSL synchronization state, or the indirect messages of
+     * @p aChild change. The child's next CSL window is re-evaluated and its entry in the schedule is updated.
      *
      * It would then request the `Mac` to do the CSL tx. If the last CSL tx has been fired at `Mac` but hasn't been
      * done yet, and it's aborted, this method would set `mCslTxChild` to `nullptr` to notify the `HandleTransmitDone`
      * that the operation has been aborted.
      *
+     * @param[in] aChild  The child whose CSL tx state changed.
+     *
      */
-    void Update(void);
+    void Update(Child &aChild);
 
     /**
      * Clears all the states inside `CslTxScheduler` and the related states in each child.
@@ -186,13 +203,51 @@ public:
      */
     void Clear(void);
 
+    /**
+     * Gets the CSL tx scheduler counters.
+     *
+     * @returns A reference to the CSL tx scheduler counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the CSL tx scheduler counters.
+     *
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
 private:
     // Guard time in usec to add when checking delay while preparing the CSL frame for tx.
     static constexpr uint32_t kFramePreparationGuardInterval = 1500;
 
-    void InitFrameRequestAhead(void);
-    void RescheduleCslTx(void);
+    static constexpr uint16_t kMaxChildren  = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+    static constexpr uint16_t kNotScheduled = NumericLimits<uint16_t>::kMax;
+
+    // The schedule is a binary min-heap of the children which are
+    // CSL synchronized and have pending indirect messages, keyed by
+    // the radio time (in usec) of their next usable CSL window.
+    // `mSchedulePositions` maps a child index to its position in the
+    // heap so that entries can be updated in O(log n).
+
+    struct ScheduleEntry
+    {
+        uint64_t mTxWindow;
+        uint16_t mChildIndex;
+    };
 
+    void     InitFrameRequestAhead(void);
+    void     RescheduleCslTx(void);
+    bool     ShouldSchedule(const Child &aChild) const;
+    void     UpdateScheduleEntry(Child &aChild);
+    void     UpdateScheduleEntry(uint16_t aChildIndex, uint64_t aTxWindow);
+    void     RemoveScheduleEntry(uint16_t aChildIndex);
+    void     ClearSchedule(void);
+    uint16_t SiftUp(uint16_t aPosition);
+    uint16_t SiftDown(uint16_t aPosition);
+    void     SetScheduleEntry(uint16_t aPosition, const ScheduleEntry &aEntry);
+
+    uint64_t GetNextCslTxWindow(const Child &aChild, uint64_t aRadioNow, uint32_t aAheadUs) const;
     uint32_t GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx, uint32_t aAheadUs) const;
 
     // Callbacks from `Mac`
@@ -206,6 +261,10 @@ private:
     Message                *mCslTxMessage;
     Callbacks::FrameContext mFrameContext;
     Callbacks               mCallbacks;
+    uint16_t                mScheduleLength;
+    ScheduleEntry           mSchedule[kMaxChildren];
+    uint16_t                mSchedulePositions[kMaxChildren];
+    Counters                mCounters;
 };
 
 /**
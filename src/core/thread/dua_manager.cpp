@@ -55,7 +55,9 @@ RegisterLogModule("DuaManager");
 DuaManager::DuaManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mRegistrationTask(aInstance)
+    , mFailureCount(0)
     , mIsDuaPending(false)
+    , mHasQueueTime(false)
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     , mDuaState(kNotExist)
     , mDadCounter(0)
@@ -66,6 +68,7 @@ DuaManager::DuaManager(Instance &aInstance)
 #endif
 {
     mDelay.mValue = 0;
+    mCounters.Clear();
 
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     mDomainUnicastAddress.InitAsThreadOriginGlobalScope();
@@ -248,6 +251,8 @@ void DuaManager::RemoveDomainUnicastAddress(void)
 
 void DuaManager::UpdateRegistrationDelay(uint8_t aDelay)
 {
+    HandleRegistrationQueued();
+
     if (mDelay.mFields.mRegistrationDelay == 0 || mDelay.mFields.mRegistrationDelay > aDelay)
     {
         mDelay.mFields.mRegistrationDelay = aDelay;
@@ -271,12 +276,12 @@ void DuaManager::NotifyDuplicateDomainUnicastAddress(void)
 
 void DuaManager::UpdateReregistrationDelay(void)
 {
-    uint16_t               delay = 0;
-    BackboneRouter::Config config;
+    uint16_t delay = 0;
 
-    VerifyOrExit(Get<BackboneRouter::Leader>().GetConfig(config) == kErrorNone);
+    VerifyOrExit(Get<BackboneRouter::Leader>().HasPrimary());
 
-    delay = config.mReregistrationDelay > 1 ? Random::NonCrypto::GetUint16InRange(1, config.mReregistrationDelay) : 1;
+    HandleRegistrationQueued();
+    delay = Get<BackboneRouter::Leader>().GetRetryDelay(mFailureCount);
 
     if (mDelay.mFields.mReregistrationDelay == 0 || mDelay.mFields.mReregistrationDelay > delay)
     {
@@ -291,6 +296,8 @@ exit:
 
 void DuaManager::UpdateCheckDelay(uint8_t aDelay)
 {
+    HandleRegistrationQueued();
+
     if (mDelay.mFields.mCheckDelay == 0 || mDelay.mFields.mCheckDelay > aDelay)
     {
         mDelay.mFields.mCheckDelay = aDelay;
@@ -300,6 +307,23 @@ void DuaManager::UpdateCheckDelay(uint8_t aDelay)
     }
 }
 
+void DuaManager::HandleRegistrationQueued(void)
+{
+    if (!mHasQueueTime)
+    {
+        mQueueTime    = TimerMilli::GetNow();
+        mHasQueueTime = true;
+    }
+}
+
+void DuaManager::IncrementFailureCount(void)
+{
+    if (mFailureCount < NumericLimits<uint8_t>::kMax)
+    {
+        mFailureCount++;
+    }
+}
+
 void DuaManager::HandleNotifierEvents(Events aEvents)
 {
     Mle::MleRouter &mle = Get<Mle::MleRouter>();
@@ -357,6 +381,10 @@ void DuaManager::HandleBackboneRouterPrimaryUpdate(BackboneRouter::Leader::State
 
     if (aState == BackboneRouter::Leader::kStateAdded || aState == BackboneRouter::Leader::kStateToTriggerRereg)
     {
+        // Failures with the previous Primary Backbone Router do not
+        // delay the registrations with the new one.
+        mFailureCount = 0;
+
 #if OPENTHREAD_CONFIG_DUA_ENABLE
         if (Get<Mle::Mle>().IsFullThreadDevice() || Get<Mle::Mle>().GetParent().IsThreadVersion1p1())
 #endif
@@ -378,6 +406,7 @@ void DuaManager::HandleTimeTick(void)
         (TimerMilli::GetNow() > (mLastRegistrationTime + TimeMilli::SecToMsec(kDuaDadPeriod))))
     {
         mDomainUnicastAddress.mPreferred = true;
+        Get<Ip6::Ip6>().InvalidateSourceAddressCache();
     }
 
     if ((mDelay.mFields.mRegistrationDelay > 0) && (--mDelay.mFields.mRegistrationDelay == 0))
@@ -531,6 +560,8 @@ void DuaManager::PerformNextRegistration(void)
     mIsDuaPending   = true;
     mRegisteringDua = dua;
     mDelay.mValue   = 0;
+    mSentQueueTime  = mQueueTime;
+    mCounters.HandleRequestSent(1);
 
     // Generally Thread 1.2 Router would send DUA.req on behalf for DUA registered by its MTD child.
     // When Thread 1.2 MTD attaches to Thread 1.1 parent, 1.2 MTD should send DUA.req to PBBR itself.
@@ -547,6 +578,10 @@ exit:
     {
         UpdateCheckDelay(kNoBufDelay);
     }
+    else if (error == kErrorNotFound)
+    {
+        mHasQueueTime = false;
+    }
 
     LogInfo("PerformNextRegistration: %s", ErrorToString(error));
     FreeMessageOnError(message, error);
@@ -564,7 +599,8 @@ void DuaManager::HandleDuaResponse(void                *aContext,
 void DuaManager::HandleDuaResponse(Coap::Message *aMessage, const Ip6::MessageInfo *aMessageInfo, Error aResult)
 {
     OT_UNUSED_VARIABLE(aMessageInfo);
-    Error error;
+    Error   error;
+    uint8_t status = ThreadStatusTlv::kDuaGeneralFailure;
 
     mIsDuaPending = false;
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
@@ -573,7 +609,13 @@ void DuaManager::HandleDuaResponse(Coap::Message *aMessage, const Ip6::MessageIn
 
     if (aResult == kErrorResponseTimeout)
     {
+        IncrementFailureCount();
+#if OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+        UpdateCheckDelay(static_cast<uint8_t>(KResponseTimeoutDelay
+                                              << Min<uint8_t>(mFailureCount - 1, kMaxTimeoutBackoffShift)));
+#else
         UpdateCheckDelay(KResponseTimeoutDelay);
+#endif
         ExitNow(error = aResult);
     }
 
@@ -583,9 +625,16 @@ void DuaManager::HandleDuaResponse(Coap::Message *aMessage, const Ip6::MessageIn
     VerifyOrExit(aMessage->GetCode() == Coap::kCodeChanged || aMessage->GetCode() >= Coap::kCodeBadRequest,
                  error = kErrorParse);
 
-    error = ProcessDuaResponse(*aMessage);
+    error = ProcessDuaResponse(*aMessage, status);
 
 exit:
+    // Aborted registrations were dropped by the device itself.
+    if (aResult != kErrorAbort)
+    {
+        mCounters.HandleResponse(error == kErrorNone && status == ThreadStatusTlv::kDuaSuccess,
+                                 TimerMilli::GetNow() - mSentQueueTime);
+    }
+
     if (error != kErrorResponseTimeout)
     {
         mRegistrationTask.Post();
@@ -599,7 +648,8 @@ void DuaManager::HandleTmf<kUriDuaRegistrationNotify>(Coap::Message &aMessage, c
 {
     OT_UNUSED_VARIABLE(aMessageInfo);
 
-    Error error;
+    Error   error;
+    uint8_t status;
 
     VerifyOrExit(aMessage.IsPostRequest(), error = kErrorParse);
 
@@ -608,22 +658,23 @@ void DuaManager::HandleTmf<kUriDuaRegistrationNotify>(Coap::Message &aMessage, c
         LogInfo("Sent %s ack", UriToString<kUriDuaRegistrationNotify>());
     }
 
-    error = ProcessDuaResponse(aMessage);
+    error = ProcessDuaResponse(aMessage, status);
 
 exit:
     OT_UNUSED_VARIABLE(error);
     LogInfo("Received %s: %s", UriToString<kUriDuaRegistrationNotify>(), ErrorToString(error));
 }
 
-Error DuaManager::ProcessDuaResponse(Coap::Message &aMessage)
+Error DuaManager::ProcessDuaResponse(Coap::Message &aMessage, uint8_t &aStatus)
 {
-    Error        error = kErrorNone;
+    Error        error  = kErrorNone;
+    uint8_t     &status = aStatus;
     Ip6::Address target;
-    uint8_t      status;
+
+    status = ThreadStatusTlv::kDuaGeneralFailure;
 
     if (aMessage.GetCode() >= Coap::kCodeBadRequest)
     {
-        status = ThreadStatusTlv::kDuaGeneralFailure;
         target = mRegisteringDua;
     }
     else
@@ -642,6 +693,7 @@ Error DuaManager::ProcessDuaResponse(Coap::Message &aMessage)
         case ThreadStatusTlv::kDuaSuccess:
             mLastRegistrationTime = TimerMilli::GetNow();
             mDuaState             = kRegistered;
+            mFailureCount         = 0;
             break;
         case ThreadStatusTlv::kDuaReRegister:
             if (Get<ThreadNetif>().HasUnicastAddress(GetDomainUnicastAddress()))
@@ -660,6 +712,7 @@ Error DuaManager::ProcessDuaResponse(Coap::Message &aMessage)
         case ThreadStatusTlv::kDuaNoResources:
         case ThreadStatusTlv::kDuaNotPrimary:
         case ThreadStatusTlv::kDuaGeneralFailure:
+            IncrementFailureCount();
             UpdateReregistrationDelay();
             break;
         }
@@ -692,6 +745,8 @@ Error DuaManager::ProcessDuaResponse(Coap::Message &aMessage)
             {
                 mChildDuaRegisteredMask.Set(childIndex, true);
             }
+
+            mFailureCount = 0;
             break;
         case ThreadStatusTlv::kDuaReRegister:
             // Parent stops registering for the Child's DUA until next Child Update Request
@@ -707,6 +762,7 @@ Error DuaManager::ProcessDuaResponse(Coap::Message &aMessage)
         case ThreadStatusTlv::kDuaNoResources:
         case ThreadStatusTlv::kDuaNotPrimary:
         case ThreadStatusTlv::kDuaGeneralFailure:
+            IncrementFailureCount();
             UpdateReregistrationDelay();
             break;
         }
@@ -51,6 +51,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/tasklet.hpp"
 #include "common/time.hpp"
 #include "common/time_ticker.hpp"
@@ -193,6 +194,20 @@ public:
     void HandleChildDuaAddressEvent(const Child &aChild, ChildDuaAddressEvent aEvent);
 #endif
 
+    /**
+     * Returns the DUA registration counters.
+     *
+     * @returns The DUA registration counters.
+     *
+     */
+    const BackboneRouter::RegistrationCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the DUA registration counters.
+     *
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
 private:
     static constexpr uint32_t kDuaDadPeriod               = 100; // DAD wait time to become "Preferred" (in sec).
     static constexpr uint8_t  kNoBufDelay                 = 5;   // In sec.
@@ -200,6 +215,13 @@ private:
     static constexpr uint8_t  kNewRouterRegistrationDelay = 3;   // Delay (in sec) to establish link for a new router.
     static constexpr uint8_t  kNewDuaRegistrationDelay    = 1;   // Delay (in sec) for newly added DUA.
 
+#if OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+    static constexpr uint8_t kMaxTimeoutBackoffShift = 3; // Max doubling of `KResponseTimeoutDelay`.
+
+    static_assert((KResponseTimeoutDelay << kMaxTimeoutBackoffShift) <= NumericLimits<uint8_t>::kMax,
+                  "the response timeout backoff does not fit in `mCheckDelay`");
+#endif
+
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     Error GenerateDomainUnicastAddressIid(void);
     Error Store(void);
@@ -227,17 +249,24 @@ private:
 
     template <Uri kUri> void HandleTmf(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
-    Error ProcessDuaResponse(Coap::Message &aMessage);
+    Error ProcessDuaResponse(Coap::Message &aMessage, uint8_t &aStatus);
 
     void PerformNextRegistration(void);
     void UpdateReregistrationDelay(void);
     void UpdateCheckDelay(uint8_t aDelay);
+    void HandleRegistrationQueued(void);
+    void IncrementFailureCount(void);
 
     using RegistrationTask = TaskletIn<DuaManager, &DuaManager::PerformNextRegistration>;
 
-    RegistrationTask mRegistrationTask;
-    Ip6::Address     mRegisteringDua;
-    bool             mIsDuaPending : 1;
+    RegistrationTask                     mRegistrationTask;
+    Ip6::Address                         mRegisteringDua;
+    BackboneRouter::RegistrationCounters mCounters;
+    TimeMilli                            mQueueTime;     // When the oldest registration still to send was queued.
+    TimeMilli                            mSentQueueTime; // `mQueueTime` of the DUA.req in flight.
+    uint8_t                              mFailureCount;  // Number of consecutive failed DUA.req.
+    bool                                 mIsDuaPending : 1;
+    bool                                 mHasQueueTime : 1;
 
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     enum DuaState : uint8_t
@@ -0,0 +1,201 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements per-child indirect transmission queues.
+ */
+
+#include "indirect_queue_table.hpp"
+
+#if OPENTHREAD_FTD
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/locator_getters.hpp"
+#include "thread/child_table.hpp"
+
+namespace ot {
+
+IndirectQueueTable::IndirectQueueTable(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mNumFreeEntries(kNumEntries)
+{
+    mOverflowMask.Clear();
+}
+
+void IndirectQueueTable::Clear(void)
+{
+    for (Queue &queue : mQueues)
+    {
+        queue.Clear();
+    }
+
+    mEntryPool.FreeAll();
+    mNumFreeEntries = kNumEntries;
+    mOverflowMask.Clear();
+}
+
+IndirectQueueTable::Queue &IndirectQueueTable::GetQueue(const Child &aChild)
+{
+    return mQueues[Get<ChildTable>().GetChildIndex(aChild)];
+}
+
+const IndirectQueueTable::Queue &IndirectQueueTable::GetQueue(const Child &aChild) const
+{
+    return mQueues[Get<ChildTable>().GetChildIndex(aChild)];
+}
+
+Error IndirectQueueTable::Add(Message &aMessage, const Child &aChild)
+{
+    Error    error      = kErrorNone;
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    Queue   &queue      = mQueues[childIndex];
+    Entry   *prev       = nullptr;
+    Entry   *entry;
+
+    VerifyOrExit(!mOverflowMask.Get(childIndex), error = kErrorAlready);
+
+    entry = mEntryPool.Allocate();
+
+    if (entry == nullptr)
+    {
+        // Release the entries of the child so they can be used by
+        // others. The child's messages are found by scanning the send
+        // queue until its queue is cleared.
+
+        FreeEntries(queue);
+        mOverflowMask.Set(childIndex, true);
+        ExitNow(error = kErrorNoBufs);
+    }
+
+    mNumFreeEntries--;
+    entry->mMessage = &aMessage;
+
+    // Keep the same order as the send queue: after all messages with
+    // the same or higher priority.
+
+    for (Entry &cur : queue)
+    {
+        if (cur.mMessage->GetPriority() < aMessage.GetPriority())
+        {
+            break;
+        }
+
+        prev = &cur;
+    }
+
+    if (prev == nullptr)
+    {
+        queue.Push(*entry);
+    }
+    else
+    {
+        queue.PushAfter(*entry, *prev);
+    }
+
+exit:
+    return error;
+}
+
+void IndirectQueueTable::Remove(const Message &aMessage, const Child &aChild)
+{
+    Entry *entry = GetQueue(aChild).RemoveMatching(aMessage);
+
+    VerifyOrExit(entry != nullptr);
+    mEntryPool.Free(*entry);
+    mNumFreeEntries++;
+
+exit:
+    return;
+}
+
+void IndirectQueueTable::RemoveAll(const Child &aChild)
+{
+    FreeEntries(GetQueue(aChild));
+    mOverflowMask.Set(Get<ChildTable>().GetChildIndex(aChild), false);
+}
+
+void IndirectQueueTable::FreeEntries(Queue &aQueue)
+{
+    Entry *entry;
+
+    while ((entry = aQueue.Pop()) != nullptr)
+    {
+        mEntryPool.Free(*entry);
+        mNumFreeEntries++;
+    }
+}
+
+bool IndirectQueueTable::IsOverflowed(const Child &aChild) const
+{
+    return mOverflowMask.Get(Get<ChildTable>().GetChildIndex(aChild));
+}
+
+Message *IndirectQueueTable::GetHead(const Child &aChild)
+{
+    Entry *entry = GetQueue(aChild).GetHead();
+
+    return (entry != nullptr) ? entry->mMessage : nullptr;
+}
+
+Message *IndirectQueueTable::FindMessage(const Child &aChild, Message::Type aType)
+{
+    Message *message = nullptr;
+
+    for (Entry &entry : GetQueue(aChild))
+    {
+        if (entry.mMessage->GetType() == aType)
+        {
+            message = entry.mMessage;
+            break;
+        }
+    }
+
+    return message;
+}
+
+const Message *IndirectQueueTable::FindOldestMessage(const Child &aChild) const
+{
+    const Message *oldest = nullptr;
+
+    for (const Entry &entry : GetQueue(aChild))
+    {
+        if ((oldest == nullptr) || (entry.mMessage->GetTimestamp() < oldest->GetTimestamp()))
+        {
+            oldest = entry.mMessage;
+        }
+    }
+
+    return oldest;
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_FTD
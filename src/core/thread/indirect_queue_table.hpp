@@ -0,0 +1,208 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for per-child indirect transmission queues.
+ */
+
+#ifndef INDIRECT_QUEUE_TABLE_HPP_
+#define INDIRECT_QUEUE_TABLE_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_FTD
+
+#include "common/error.hpp"
+#include "common/linked_list.hpp"
+#include "common/locator.hpp"
+#include "common/message.hpp"
+#include "common/non_copyable.hpp"
+#include "common/pool.hpp"
+#include "thread/child_mask.hpp"
+
+namespace ot {
+
+class Child;
+
+/**
+ * @addtogroup core-mesh-forwarding
+ *
+ * @{
+ */
+
+/**
+ * Implements per-child indirect transmission queues.
+ *
+ * The `Message::GetChildMask()` bits remain the authoritative record of which sleepy children a message in the send
+ * queue is destined to. `IndirectQueueTable` maintains, for every child, a list of the same messages ordered as in
+ * the send queue (higher priority first, then in the order they were added), so that the next indirect message for a
+ * child can be found without scanning the whole send queue.
+ *
+ * Since a message can be destined to many children (e.g., multicast), list entries are allocated from a fixed-size
+ * pool rather than being embedded in the message metadata. If the pool runs out of entries while adding a message
+ * for a child, the child's queue is marked as overflowed. An overflowed queue is empty and the caller is expected to
+ * fall back to scanning the send queue for that child, until all its queued messages are removed and the queue is
+ * cleared using `RemoveAll()`.
+ *
+ */
+class IndirectQueueTable : public InstanceLocator, private NonCopyable
+{
+public:
+    /**
+     * Initializes the object.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit IndirectQueueTable(Instance &aInstance);
+
+    /**
+     * Clears the queues of all children.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * Adds a message to the queue of a child.
+     *
+     * The message MUST already be in the send queue and MUST NOT be already in the queue of the child.
+     *
+     * @param[in] aMessage  The message to add.
+     * @param[in] aChild    The child.
+     *
+     * @retval kErrorNone     Successfully added the message.
+     * @retval kErrorNoBufs   Could not allocate a queue entry. The child's queue is now marked as overflowed.
+     * @retval kErrorAlready  The child's queue is already overflowed.
+     *
+     */
+    Error Add(Message &aMessage, const Child &aChild);
+
+    /**
+     * Removes a message from the queue of a child.
+     *
+     * If the message is not in the queue of the child (or the queue is overflowed), no action is performed.
+     *
+     * @param[in] aMessage  The message to remove.
+     * @param[in] aChild    The child.
+     *
+     */
+    void Remove(const Message &aMessage, const Child &aChild);
+
+    /**
+     * Removes all messages from the queue of a child and clears its overflowed state.
+     *
+     * @param[in] aChild    The child.
+     *
+     */
+    void RemoveAll(const Child &aChild);
+
+    /**
+     * Indicates whether or not the queue of a child is overflowed.
+     *
+     * @param[in] aChild    The child.
+     *
+     * @retval TRUE   The queue is overflowed and does not track the messages of the child.
+     * @retval FALSE  The queue tracks all the messages of the child.
+     *
+     */
+    bool IsOverflowed(const Child &aChild) const;
+
+    /**
+     * Returns the first message in the queue of a child.
+     *
+     * @param[in] aChild    The child.
+     *
+     * @returns A pointer to the first message in the queue, or `nullptr` if the queue is empty.
+     *
+     */
+    Message *GetHead(const Child &aChild);
+
+    /**
+     * Finds the first message of a given type in the queue of a child.
+     *
+     * @param[in] aChild    The child.
+     * @param[in] aType     The message type.
+     *
+     * @returns A pointer to the first matching message, or `nullptr` if none is found.
+     *
+     */
+    Message *FindMessage(const Child &aChild, Message::Type aType);
+
+    /**
+     * Finds the oldest message (earliest timestamp) in the queue of a child.
+     *
+     * @param[in] aChild    The child.
+     *
+     * @returns A pointer to the oldest message, or `nullptr` if the queue is empty.
+     *
+     */
+    const Message *FindOldestMessage(const Child &aChild) const;
+
+    /**
+     * Returns the number of free queue entries.
+     *
+     * @returns The number of free queue entries.
+     *
+     */
+    uint16_t GetNumFreeEntries(void) const { return mNumFreeEntries; }
+
+private:
+    static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+    static constexpr uint16_t kNumEntries  = OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES;
+
+    struct Entry : public LinkedListEntry<Entry>
+    {
+        bool Matches(const Message &aMessage) const { return mMessage == &aMessage; }
+
+        Message *mMessage;
+        Entry   *mNext;
+    };
+
+    typedef LinkedList<Entry> Queue;
+
+    Queue       &GetQueue(const Child &aChild);
+    const Queue &GetQueue(const Child &aChild) const;
+    void         FreeEntries(Queue &aQueue);
+
+    Pool<Entry, kNumEntries> mEntryPool;
+    uint16_t                 mNumFreeEntries;
+    Queue                    mQueues[kMaxChildren];
+    ChildMask                mOverflowMask;
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // OPENTHREAD_FTD
+
+#endif // INDIRECT_QUEUE_TABLE_HPP_
@@ -62,6 +62,7 @@ const Mac::Address &IndirectSender::ChildInfo::GetMacAddress(Mac::Address &aMacA
 IndirectSender::IndirectSender(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEnabled(false)
+    , mQueueTable(aInstance)
     , mSourceMatchController(aInstance)
     , mDataPollHandler(aInstance)
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
@@ -86,6 +87,7 @@ void IndirectSender::Stop(void)
 #endif
 
 exit:
+    mQueueTable.Clear();
     mEnabled = false;
 }
 
@@ -100,6 +102,8 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
 
     aMessage.SetChildMask(childIndex);
     mSourceMatchController.IncrementMessageCount(aChild);
+    aChild.UpdateMaxIndirectMessageCount();
+    IgnoreError(mQueueTable.Add(aMessage, aChild));
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
     {
@@ -127,6 +131,7 @@ Error IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &aCh
 
     aMessage.ClearChildMask(childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
+    RemoveMessageFromQueue(aMessage, aChild);
 
     RequestMessageUpdate(aChild);
 
@@ -147,10 +152,11 @@ void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 
     aChild.SetIndirectMessage(nullptr);
     mSourceMatchController.ResetMessageCount(aChild);
+    mQueueTable.RemoveAll(aChild);
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
 exit:
@@ -192,10 +198,11 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
         aChild.SetIndirectMessage(nullptr);
         mSourceMatchController.ResetMessageCount(aChild);
+        mQueueTable.RemoveAll(aChild);
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
     }
 
@@ -209,8 +216,20 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
 Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly)
 {
-    Message *msg        = nullptr;
-    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    Message *msg = nullptr;
+    uint16_t childIndex;
+
+    if (!mQueueTable.IsOverflowed(aChild))
+    {
+        msg = aSupervisionTypeOnly ? mQueueTable.FindMessage(aChild, Message::kTypeSupervision)
+                                   : mQueueTable.GetHead(aChild);
+        ExitNow();
+    }
+
+    // The child's queue ran out of entries, so we fall back to
+    // searching the send queue for the child's messages.
+
+    childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
     for (Message &message : Get<MeshForwarder>().mSendQueue)
     {
@@ -222,9 +241,55 @@ Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTyp
         }
     }
 
+exit:
     return msg;
 }
 
+void IndirectSender::RemoveMessageFromQueue(Message &aMessage, Child &aChild)
+{
+    mQueueTable.Remove(aMessage, aChild);
+
+    // Once all messages of the child are removed, `RemoveAll()` also
+    // clears any overflowed state of its queue.
+
+    if (aChild.GetIndirectMessageCount() == 0)
+    {
+        mQueueTable.RemoveAll(aChild);
+    }
+}
+
+uint32_t IndirectSender::GetIndirectMessageAge(const Child &aChild) const
+{
+    uint32_t       age    = 0;
+    const Message *oldest = nullptr;
+
+    VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
+
+    if (!mQueueTable.IsOverflowed(aChild))
+    {
+        oldest = mQueueTable.FindOldestMessage(aChild);
+    }
+    else
+    {
+        uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+        for (const Message &message : Get<MeshForwarder>().mSendQueue)
+        {
+            if (message.GetChildMask(childIndex) &&
+                ((oldest == nullptr) || (message.GetTimestamp() < oldest->GetTimestamp())))
+            {
+                oldest = &message;
+            }
+        }
+    }
+
+    VerifyOrExit(oldest != nullptr);
+    age = TimerMilli::GetNow() - oldest->GetTimestamp();
+
+exit:
+    return age;
+}
+
 void IndirectSender::RequestMessageUpdate(Child &aChild)
 {
     Message *curMessage = aChild.GetIndirectMessage();
@@ -251,7 +316,7 @@ void IndirectSender::RequestMessageUpdate(Child &aChild)
         aChild.SetWaitingForMessageUpdate(true);
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
 
         ExitNow();
@@ -284,7 +349,7 @@ void IndirectSender::RequestMessageUpdate(Child &aChild)
     aChild.SetWaitingForMessageUpdate(true);
     mDataPollHandler.RequestFrameChange(DataPollHandler::kReplaceFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
 exit:
@@ -310,7 +375,7 @@ void IndirectSender::UpdateIndirectMessage(Child &aChild)
     aChild.SetIndirectTxSuccess(true);
 
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
     if (message != nullptr)
@@ -469,7 +534,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         aChild.SetIndirectFragmentOffset(nextOffset);
         mDataPollHandler.HandleNewFrame(aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
         ExitNow();
     }
@@ -534,6 +599,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         {
             message->ClearChildMask(childIndex);
             mSourceMatchController.DecrementMessageCount(aChild);
+            RemoveMessageFromQueue(*message, aChild);
         }
 
         Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
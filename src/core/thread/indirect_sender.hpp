@@ -44,6 +44,7 @@
 #include "mac/data_poll_handler.hpp"
 #include "mac/mac_frame.hpp"
 #include "thread/csl_tx_scheduler.hpp"
+#include "thread/indirect_queue_table.hpp"
 #include "thread/indirect_sender_frame_context.hpp"
 #include "thread/mle_types.hpp"
 #include "thread/src_match_controller.hpp"
@@ -96,6 +97,14 @@ public:
          */
         uint16_t GetIndirectMessageCount(void) const { return mQueuedMessageCount; }
 
+        /**
+         * Returns the maximum number of queued messages for the child (high-water mark).
+         *
+         * @returns Maximum number of queued messages for the child.
+         *
+         */
+        uint16_t GetMaxIndirectMessageCount(void) const { return mMaxQueuedMessageCount; }
+
     private:
         Message *GetIndirectMessage(void) { return mIndirectMessage; }
         void     SetIndirectMessage(Message *aMessage) { mIndirectMessage = aMessage; }
@@ -115,6 +124,13 @@ public:
         void IncrementIndirectMessageCount(void) { mQueuedMessageCount++; }
         void DecrementIndirectMessageCount(void) { mQueuedMessageCount--; }
         void ResetIndirectMessageCount(void) { mQueuedMessageCount = 0; }
+        void UpdateMaxIndirectMessageCount(void)
+        {
+            if (mQueuedMessageCount > mMaxQueuedMessageCount)
+            {
+                mMaxQueuedMessageCount = mQueuedMessageCount;
+            }
+        }
 
         bool IsWaitingForMessageUpdate(void) const { return mWaitingForMessageUpdate; }
         void SetWaitingForMessageUpdate(bool aNeedsUpdate) { mWaitingForMessageUpdate = aNeedsUpdate; }
@@ -128,6 +144,7 @@ public:
         uint16_t mQueuedMessageCount : 14;     // Number of queued indirect messages for the child.
         bool     mUseShortAddress : 1;         // Indicates whether to use short or extended address.
         bool     mSourceMatchPending : 1;      // Indicates whether or not pending to add to src match table.
+        uint16_t mMaxQueuedMessageCount;       // Maximum number of queued indirect messages for the child.
 
         static_assert(OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS < (1UL << 14),
                       "mQueuedMessageCount cannot fit max required!");
@@ -202,6 +219,16 @@ public:
      */
     void HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMode);
 
+    /**
+     * Returns the time since the oldest queued indirect message for a child was added to the send queue.
+     *
+     * @param[in]  aChild  The child.
+     *
+     * @returns The age of the oldest queued message (in milliseconds), or zero if there is no queued message.
+     *
+     */
+    uint32_t GetIndirectMessageAge(const Child &aChild) const;
+
 private:
     // Callbacks from DataPollHandler
     Error PrepareFrameForChild(Mac::TxFrame &aFrame, FrameContext &aContext, Child &aChild);
@@ -210,12 +237,14 @@ private:
 
     void     UpdateIndirectMessage(Child &aChild);
     Message *FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly = false);
+    void     RemoveMessageFromQueue(Message &aMessage, Child &aChild);
     void     RequestMessageUpdate(Child &aChild);
     uint16_t PrepareDataFrame(Mac::TxFrame &aFrame, Child &aChild, Message &aMessage);
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
     void     ClearMessagesForRemovedChildren(void);
 
     bool                  mEnabled;
+    IndirectQueueTable    mQueueTable;
     SourceMatchController mSourceMatchController;
     DataPollHandler       mDataPollHandler;
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
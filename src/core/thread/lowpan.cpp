@@ -51,22 +51,133 @@ namespace Lowpan {
 
 Lowpan::Lowpan(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mContextsValid(false)
+    , mNumContexts(0)
 {
 }
 
-void Lowpan::FindContextForId(uint8_t aContextId, Context &aContext) const
+void Lowpan::UpdateContexts(void)
 {
-    if (Get<NetworkData::Leader>().GetContext(aContextId, aContext) != kErrorNone)
+    // Compiles the 6LoWPAN contexts in Network Data into `mContexts`
+    // so that compressing or decompressing a frame does not need to
+    // walk the Network Data TLVs.
+
+    NetworkData::Iterator          iterator = NetworkData::kIteratorInit;
+    NetworkData::LowpanContextInfo info;
+
+    VerifyOrExit(!mContextsValid);
+
+    mNumContexts = 0;
+    memset(mContextIndex, kInvalidIndex, sizeof(mContextIndex));
+
+    while (Get<NetworkData::Leader>().GetNextLowpanContextInfo(iterator, info) == kErrorNone)
     {
-        aContext.Clear();
+        const Ip6::Prefix &prefix = AsCoreType(&info.mPrefix);
+        uint8_t            index;
+
+        if ((info.mContextId == Mle::kMeshLocalPrefixContextId) || (info.mContextId >= kMaxContexts) ||
+            (mContextIndex[info.mContextId] != kInvalidIndex))
+        {
+            continue;
+        }
+
+        mContextIndex[info.mContextId] = mNumContexts;
+
+        // Insert keeping the entries sorted by decreasing prefix
+        // length. Entries of equal length stay in Network Data order.
+
+        for (index = mNumContexts; index > 0; index--)
+        {
+            if (mContexts[index - 1].mPrefix.GetLength() >= prefix.GetLength())
+            {
+                break;
+            }
+
+            mContexts[index] = mContexts[index - 1];
+        }
+
+        mContexts[index].mPrefix       = prefix;
+        mContexts[index].mContextId    = info.mContextId;
+        mContexts[index].mCompressFlag = info.mCompressFlag;
+        mNumContexts++;
     }
+
+    for (uint8_t index = 0; index < mNumContexts; index++)
+    {
+        mContextIndex[mContexts[index].mContextId] = index;
+    }
+
+    mContextsValid = true;
+
+exit:
+    return;
+}
+
+void Lowpan::CopyContext(const ContextEntry &aEntry, Context &aContext)
+{
+    aContext.mPrefix       = aEntry.mPrefix;
+    aContext.mContextId    = aEntry.mContextId;
+    aContext.mCompressFlag = aEntry.mCompressFlag;
+    aContext.mIsValid      = true;
 }
 
-void Lowpan::FindContextToCompressAddress(const Ip6::Address &aIp6Address, Context &aContext) const
+void Lowpan::FindContextForId(uint8_t aContextId, Context &aContext)
 {
-    Error error = Get<NetworkData::Leader>().GetContext(aIp6Address, aContext);
+    aContext.Clear();
 
-    if ((error != kErrorNone) || !aContext.mCompressFlag)
+    if (aContextId == Mle::kMeshLocalPrefixContextId)
+    {
+        aContext.mPrefix.Set(Get<Mle::Mle>().GetMeshLocalPrefix());
+        aContext.mContextId    = Mle::kMeshLocalPrefixContextId;
+        aContext.mCompressFlag = true;
+        aContext.mIsValid      = true;
+        ExitNow();
+    }
+
+    UpdateContexts();
+
+    VerifyOrExit((aContextId < kMaxContexts) && (mContextIndex[aContextId] != kInvalidIndex));
+    CopyContext(mContexts[mContextIndex[aContextId]], aContext);
+
+exit:
+    return;
+}
+
+void Lowpan::FindContextToCompressAddress(const Ip6::Address &aIp6Address, Context &aContext)
+{
+    uint8_t minLength = 0;
+
+    aContext.Clear();
+
+    if (Get<Mle::Mle>().IsMeshLocalAddress(aIp6Address))
+    {
+        FindContextForId(Mle::kMeshLocalPrefixContextId, aContext);
+        minLength = aContext.mPrefix.GetLength();
+    }
+
+    UpdateContexts();
+
+    // Entries are sorted by decreasing prefix length, so the first
+    // match is the longest. A Network Data context only replaces the
+    // mesh-local one if its prefix is strictly longer.
+
+    for (uint8_t index = 0; index < mNumContexts; index++)
+    {
+        const ContextEntry &entry = mContexts[index];
+
+        if (entry.mPrefix.GetLength() <= minLength)
+        {
+            break;
+        }
+
+        if (aIp6Address.MatchesPrefix(entry.mPrefix))
+        {
+            CopyContext(entry, aContext);
+            break;
+        }
+    }
+
+    if (!aContext.mCompressFlag)
     {
         aContext.Clear();
     }
@@ -255,8 +366,22 @@ Error Lowpan::Compress(Message              &aMessage,
 
     SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), ip6Header));
 
-    FindContextToCompressAddress(ip6Header.GetSource(), srcContext);
-    FindContextToCompressAddress(ip6Header.GetDestination(), dstContext);
+    // Link-local, unspecified and multicast addresses are compressed
+    // without a context (multicast uses the mesh-local context
+    // directly), so the context look-up is skipped for them.
+
+    srcContext.Clear();
+    dstContext.Clear();
+
+    if (!ip6Header.GetSource().IsUnspecified() && !ip6Header.GetSource().IsLinkLocal())
+    {
+        FindContextToCompressAddress(ip6Header.GetSource(), srcContext);
+    }
+
+    if (!ip6Header.GetDestination().IsMulticast() && !ip6Header.GetDestination().IsLinkLocal())
+    {
+        FindContextToCompressAddress(ip6Header.GetDestination(), dstContext);
+    }
 
     // Lowpan HC Control Bits
     hcCtlOffset = aFrameBuilder.GetLength();
@@ -626,8 +751,20 @@ Error Lowpan::DecompressBaseHeader(Ip6::Header          &aIp6Header,
         dstContextId = (byte & 0xf);
     }
 
-    FindContextForId(srcContextId, srcContext);
-    FindContextForId(dstContextId, dstContext);
+    // Contexts are only looked up when the address modes use them.
+
+    srcContext.Clear();
+    dstContext.Clear();
+
+    if ((hcCtl & kHcSrcAddrContext) && ((hcCtl & kHcSrcAddrModeMask) != kHcSrcAddrMode0))
+    {
+        FindContextForId(srcContextId, srcContext);
+    }
+
+    if (hcCtl & kHcDstAddrContext)
+    {
+        FindContextForId(dstContextId, dstContext);
+    }
 
     aIp6Header.Clear();
     aIp6Header.InitVersionTrafficClassFlow();
@@ -211,7 +211,25 @@ public:
      */
     void MarkCompressedEcn(Message &aMessage, uint16_t aOffset);
 
+    /**
+     * Marks the compiled context table as out of date.
+     *
+     * MUST be called whenever the Thread Network Data changes. The table is rebuilt from the Network Data on its
+     * next use.
+     *
+     */
+    void InvalidateContexts(void) { mContextsValid = false; }
+
 private:
+    static constexpr uint8_t kMaxContexts = 16; // Context ID is a 4-bit field.
+
+    struct ContextEntry
+    {
+        Ip6::Prefix mPrefix;
+        uint8_t     mContextId;
+        bool        mCompressFlag;
+    };
+
     static constexpr uint16_t kHcDispatch     = 3 << 13;
     static constexpr uint16_t kHcDispatchMask = 7 << 13;
 
@@ -262,8 +280,9 @@ private:
     static constexpr uint8_t kUdpChecksum = 1 << 2;
     static constexpr uint8_t kUdpPortMask = 3 << 0;
 
-    void  FindContextForId(uint8_t aContextId, Context &aContext) const;
-    void  FindContextToCompressAddress(const Ip6::Address &aIp6Address, Context &aContext) const;
+    void  UpdateContexts(void);
+    void  FindContextForId(uint8_t aContextId, Context &aContext);
+    void  FindContextToCompressAddress(const Ip6::Address &aIp6Address, Context &aContext);
     Error Compress(Message              &aMessage,
                    const Mac::Addresses &aMacAddrs,
                    FrameBuilder         &aFrameBuilder,
@@ -288,6 +307,19 @@ private:
     Error DispatchToNextHeader(uint8_t aDispatch, uint8_t &aNextHeader);
 
     static Error ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::InterfaceIdentifier &aIid);
+    static void  CopyContext(const ContextEntry &aEntry, Context &aContext);
+
+    // Contexts from Network Data (excluding the mesh-local context
+    // ID 0), sorted by decreasing prefix length so the first match
+    // is the longest one. `mContextIndex` maps a context ID to its
+    // entry (or `kInvalidIndex`).
+
+    static constexpr uint8_t kInvalidIndex = 0xff;
+
+    bool         mContextsValid;
+    uint8_t      mNumContexts;
+    uint8_t      mContextIndex[kMaxContexts];
+    ContextEntry mContexts[kMaxContexts];
 };
 
 /**
@@ -611,6 +611,9 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
         case kErrorNone:
 #if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
             mTxQueueStats.UpdateFor(*curMessage);
+#endif
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+            Get<Utils::LatencyTracer>().Mark(*curMessage, Utils::LatencyTracer::kStageRouteResolved);
 #endif
             ExitNow();
 
@@ -828,6 +831,10 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
 
     frame->SetIsARetransmission(false);
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    Get<Utils::LatencyTracer>().HandleFramePrepared(*mSendMessage);
+#endif
+
 exit:
     return frame;
 }
@@ -846,7 +853,7 @@ void MeshForwarder::PrepareMacHeaders(Mac::TxFrame             &aFrame,
     iePresent = CalcIePresent(aMessage);
     version   = CalcFrameVersion(Get<NeighborTable>().FindNeighbor(aMacAddrs.mDestination), iePresent);
 
-    aFrame.InitMacHeader(aFrameType, version, aMacAddrs, aPanIds, aSecurityLevel, aKeyIdMode);
+    Get<Mac::Mac>().InitTxFrameMacHeader(aFrame, aFrameType, version, aMacAddrs, aPanIds, aSecurityLevel, aKeyIdMode);
 
 #if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
     if (iePresent)
@@ -1177,6 +1184,10 @@ void MeshForwarder::HandleSentFrame(Mac::TxFrame &aFrame, Error aError)
 
     mSendBusy = false;
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    Get<Utils::LatencyTracer>().HandleFrameSent(mSendMessage);
+#endif
+
     VerifyOrExit(mEnabled);
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
@@ -1507,6 +1518,9 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
         message->AddLqi(aLinkInfo.GetLqi());
 #endif
         message->SetTimestampToNow();
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+        Get<Utils::LatencyTracer>().Mark(*message, Utils::LatencyTracer::kStageRx);
+#endif
     }
 
 exit:
@@ -1599,6 +1613,10 @@ Error MeshForwarder::FrameToMessage(const FrameData      &aFrameData,
     SuccessOrExit(error = aMessage->AppendData(frameData));
     aMessage->MoveOffset(frameData.GetLength());
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    Get<Utils::LatencyTracer>().Start(*aMessage);
+#endif
+
 exit:
     return error;
 }
@@ -1643,6 +1661,10 @@ Error MeshForwarder::HandleDatagram(Message &aMessage, const ThreadLinkInfo &aLi
     Get<Utils::HistoryTracker>().RecordRxMessage(aMessage, aMacSource);
 #endif
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    Get<Utils::LatencyTracer>().Mark(aMessage, Utils::LatencyTracer::kStageReassembled);
+#endif
+
     LogMessage(kMessageReceive, aMessage, kErrorNone, &aMacSource);
 
     if (aMessage.GetType() == Message::kTypeIp6)
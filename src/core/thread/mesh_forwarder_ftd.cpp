@@ -56,6 +56,10 @@ Error MeshForwarder::SendMessage(Message &aMessage)
     aMessage.SetTimestampToNow();
     mSendQueue.Enqueue(aMessage);
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    Get<Utils::LatencyTracer>().HandleEnqueue(aMessage);
+#endif
+
     switch (aMessage.GetType())
     {
     case Message::kTypeIp6:
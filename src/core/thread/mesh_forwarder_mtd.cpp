@@ -35,6 +35,8 @@
 
 #if OPENTHREAD_MTD
 
+#include "common/locator_getters.hpp"
+
 namespace ot {
 
 Error MeshForwarder::SendMessage(Message &aMessage)
@@ -47,6 +49,10 @@ Error MeshForwarder::SendMessage(Message &aMessage)
     mSendQueue.Enqueue(aMessage);
     mScheduleTransmissionTask.Post();
 
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    Get<Utils::LatencyTracer>().HandleEnqueue(aMessage);
+#endif
+
 #if (OPENTHREAD_CONFIG_MAX_FRAMES_IN_DIRECT_TX_QUEUE > 0)
     ApplyDirectTxQueueLimit(aMessage);
 #endif
@@ -1131,7 +1131,10 @@ exit:
 
 void Mle::InitNeighbor(Neighbor &aNeighbor, const RxInfo &aRxInfo)
 {
-    aRxInfo.mMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(aNeighbor.GetExtAddress());
+    Mac::ExtAddress extAddress;
+
+    aRxInfo.mMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(extAddress);
+    aNeighbor.SetExtAddress(extAddress);
     aNeighbor.GetLinkInfo().Clear();
     aNeighbor.GetLinkInfo().AddRss(aRxInfo.mMessageInfo.GetThreadLinkInfo()->GetRss());
     aNeighbor.ResetLinkFailures();
@@ -1668,6 +1671,11 @@ void Mle::SendDelayedResponse(TxMessage &aMessage, const DelayedResponseMetadata
     {
         SuccessOrExit(error = aMessage.AppendActiveTimestampTlv());
         SuccessOrExit(error = aMessage.AppendPendingTimestampTlv());
+
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+        // Delayed Data Requests always request the Network Data.
+        SuccessOrExit(error = aMessage.AppendNetworkDataDeltaRequestTlv());
+#endif
     }
 
     SuccessOrExit(error = aMessage.SendTo(aMetadata.mDestination));
@@ -1900,6 +1908,13 @@ Error Mle::SendDataRequest(const Ip6::Address &aDestination, const uint8_t *aTlv
         SuccessOrExit(error = message->AppendActiveTimestampTlv());
         SuccessOrExit(error = message->AppendPendingTimestampTlv());
 
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+        if (memchr(aTlvs, Tlv::kNetworkData, aTlvsLength) != nullptr)
+        {
+            SuccessOrExit(error = message->AppendNetworkDataDeltaRequestTlv());
+        }
+#endif
+
         SuccessOrExit(error = message->SendTo(aDestination));
         Log(kMessageSend, kTypeDataRequest, aDestination);
 
@@ -2979,7 +2994,31 @@ Error Mle::HandleLeaderData(RxInfo &aRxInfo)
             leaderData.GetDataVersion(NetworkData::kFullSet), leaderData.GetDataVersion(NetworkData::kStableSubset),
             GetNetworkDataType(), aRxInfo.mMessage, networkDataOffset, networkDataLength);
         SuccessOrExit(error);
+
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+        Get<NetworkData::DeltaManager>().HandleFullNetworkData();
+#endif
+    }
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+    else if (!aRxInfo.mMessageInfo.GetSockAddr().IsMulticast() && !mRetrieveNewNetworkData)
+    {
+        // A unicast Data Response answering our Data Request may carry
+        // a delta to our Network Data instead of the Network Data.
+        // Without a delta that can be applied, request it again.
+
+        uint8_t networkData[NetworkData::NetworkData::kMaxSize];
+        uint8_t length = sizeof(networkData);
+
+        VerifyOrExit(Get<NetworkData::DeltaManager>().ProcessDeltaTlv(aRxInfo.mMessage, GetNetworkDataType(),
+                                                                      networkData, length) == kErrorNone,
+                     dataRequest = true);
+
+        error = Get<NetworkData::Leader>().SetNetworkData(leaderData.GetDataVersion(NetworkData::kFullSet),
+                                                          leaderData.GetDataVersion(NetworkData::kStableSubset),
+                                                          GetNetworkDataType(), networkData, length);
+        SuccessOrExit(error);
     }
+#endif
     else
     {
         ExitNow(dataRequest = true);
@@ -4777,6 +4816,21 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+Error Mle::TxMessage::AppendNetworkDataDeltaRequestTlv(void)
+{
+    Error error = kErrorNone;
+
+    // The Network Data of a previous partition cannot be the base of
+    // a delta.
+    VerifyOrExit(!Get<Mle>().mRetrieveNewNetworkData);
+    error = Get<NetworkData::DeltaManager>().AppendRequestTlv(*this);
+
+exit:
+    return error;
+}
+#endif
+
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
 Error Mle::TxMessage::AppendCslChannelTlv(void)
 {
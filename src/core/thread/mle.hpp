@@ -947,6 +947,9 @@ private:
         Error AppendXtalAccuracyTlv(void);
         Error AppendActiveTimestampTlv(void);
         Error AppendPendingTimestampTlv(void);
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+        Error AppendNetworkDataDeltaRequestTlv(void);
+#endif
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
         Error AppendTimeRequestTlv(void);
         Error AppendTimeParameterTlv(void);
@@ -1686,7 +1686,7 @@ void MleRouter::HandleTimeTick(void)
         {
             LogInfo("Child CSL synchronization expired");
             child.SetCslSynchronized(false);
-            Get<CslTxScheduler>().Update();
+            Get<CslTxScheduler>().Update(child);
         }
 #endif
 
@@ -2074,6 +2074,7 @@ void MleRouter::HandleChildIdRequest(RxInfo &aRxInfo)
     Child             *child;
     Router            *router;
     uint16_t           supervisionInterval;
+    TlvIndex           tlvIndex;
 
     Log(kMessageReceive, kTypeChildIdRequest, aRxInfo.mMessageInfo.GetPeerAddr());
 
@@ -2088,8 +2089,11 @@ void MleRouter::HandleChildIdRequest(RxInfo &aRxInfo)
     child = mChildTable.FindChild(extAddr, Child::kInStateAnyExceptInvalid);
     VerifyOrExit(child != nullptr, error = kErrorAlready);
 
+    // Parse the TLVs once for all the look-ups below.
+    tlvIndex.Build(aRxInfo.mMessage);
+
     // Version
-    SuccessOrExit(error = Tlv::Find<VersionTlv>(aRxInfo.mMessage, version));
+    SuccessOrExit(error = tlvIndex.Find<VersionTlv>(version));
     VerifyOrExit(version >= kThreadVersion1p1, error = kErrorParse);
 
     // Response
@@ -2106,17 +2110,17 @@ void MleRouter::HandleChildIdRequest(RxInfo &aRxInfo)
     SuccessOrExit(error = aRxInfo.mMessage.ReadFrameCounterTlvs(linkFrameCounter, mleFrameCounter));
 
     // Mode
-    SuccessOrExit(error = Tlv::Find<ModeTlv>(aRxInfo.mMessage, modeBitmask));
+    SuccessOrExit(error = tlvIndex.Find<ModeTlv>(modeBitmask));
     mode.Set(modeBitmask);
 
     // Timeout
-    SuccessOrExit(error = Tlv::Find<TimeoutTlv>(aRxInfo.mMessage, timeout));
+    SuccessOrExit(error = tlvIndex.Find<TimeoutTlv>(timeout));
 
     // Requested TLVs
     SuccessOrExit(error = aRxInfo.mMessage.ReadTlvRequestTlv(tlvList));
 
     // Supervision interval
-    switch (Tlv::Find<SupervisionIntervalTlv>(aRxInfo.mMessage, supervisionInterval))
+    switch (tlvIndex.Find<SupervisionIntervalTlv>(supervisionInterval))
     {
     case kErrorNone:
         tlvList.Add(Tlv::kSupervisionInterval);
@@ -2129,7 +2133,7 @@ void MleRouter::HandleChildIdRequest(RxInfo &aRxInfo)
     }
 
     // Active Timestamp
-    switch (Tlv::Find<ActiveTimestampTlv>(aRxInfo.mMessage, timestamp))
+    switch (tlvIndex.Find<ActiveTimestampTlv>(timestamp))
     {
     case kErrorNone:
         if (MeshCoP::Timestamp::Compare(&timestamp, Get<MeshCoP::ActiveDatasetManager>().GetTimestamp()) == 0)
@@ -2148,7 +2152,7 @@ void MleRouter::HandleChildIdRequest(RxInfo &aRxInfo)
     }
 
     // Pending Timestamp
-    switch (Tlv::Find<PendingTimestampTlv>(aRxInfo.mMessage, timestamp))
+    switch (tlvIndex.Find<PendingTimestampTlv>(timestamp))
     {
     case kErrorNone:
         if (MeshCoP::Timestamp::Compare(&timestamp, Get<MeshCoP::PendingDatasetManager>().GetTimestamp()) == 0)
@@ -3209,10 +3213,30 @@ void MleRouter::SendDataResponse(const Ip6::Address &aDestination,
         switch (tlvType)
         {
         case Tlv::kNetworkData:
+        {
+            NetworkData::Type type;
+
             neighbor = mNeighborTable.FindNeighbor(aDestination);
-            SuccessOrExit(error = message->AppendNetworkDataTlv((neighbor != nullptr) ? neighbor->GetNetworkDataType()
-                                                                                      : NetworkData::kFullSet));
+            type     = (neighbor != nullptr) ? neighbor->GetNetworkDataType() : NetworkData::kFullSet;
+
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+            // Answer a Data Request with a delta if the requester
+            // asked for one and it is smaller than the Network Data.
+            if (aRequestMessage != nullptr)
+            {
+                error = Get<NetworkData::DeltaManager>().AppendDeltaTlv(*message, type, *aRequestMessage);
+
+                if (error != kErrorNotFound)
+                {
+                    SuccessOrExit(error);
+                    break;
+                }
+            }
+#endif
+
+            SuccessOrExit(error = message->AppendNetworkDataTlv(type));
             break;
+        }
 
         case Tlv::kActiveDataset:
             SuccessOrExit(error = message->AppendActiveDatasetTlv());
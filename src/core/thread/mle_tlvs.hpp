@@ -112,6 +112,15 @@ public:
         kLinkMetricsReport     = 89, ///< Link Metrics Report TLV
         kLinkProbe             = 90, ///< Link Probe TLV
 
+        /**
+         * Applicable/Required only when Network Data delta propagation
+         * (`OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE`) is enabled. These
+         * TLVs are not part of the Thread specification.
+         *
+         */
+        kNetworkDataDeltaRequest = 240, ///< Network Data Delta Request TLV
+        kNetworkDataDelta        = 241, ///< Network Data Delta TLV
+
         /**
          * Applicable/Required only when time synchronization service
          * (`OPENTHREAD_CONFIG_TIME_SYNC_ENABLE`) is enabled.
@@ -700,6 +709,140 @@ private:
     uint8_t  mLeaderRouterId;
 } OT_TOOL_PACKED_END;
 
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+/**
+ * Implements Network Data Delta Request TLV generation and parsing.
+ *
+ * Carries the Network Data versions the sender already has, so that the responder can send a delta.
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+class NetworkDataDeltaRequestTlv : public Tlv, public TlvInfo<Tlv::kNetworkDataDeltaRequest>
+{
+public:
+    /**
+     * Initializes the TLV.
+     *
+     */
+    void Init(void)
+    {
+        SetType(kNetworkDataDeltaRequest);
+        SetLength(sizeof(*this) - sizeof(Tlv));
+    }
+
+    /**
+     * Indicates whether or not the TLV appears to be well-formed.
+     *
+     * @retval TRUE   If the TLV appears to be well-formed.
+     * @retval FALSE  If the TLV does not appear to be well-formed.
+     *
+     */
+    bool IsValid(void) const { return GetLength() >= sizeof(*this) - sizeof(Tlv); }
+
+    /**
+     * Returns the full Network Data version.
+     *
+     * @returns The full Network Data version.
+     *
+     */
+    uint8_t GetVersion(void) const { return mVersion; }
+
+    /**
+     * Sets the full Network Data version.
+     *
+     * @param[in]  aVersion  The full Network Data version.
+     *
+     */
+    void SetVersion(uint8_t aVersion) { mVersion = aVersion; }
+
+    /**
+     * Returns the stable Network Data version.
+     *
+     * @returns The stable Network Data version.
+     *
+     */
+    uint8_t GetStableVersion(void) const { return mStableVersion; }
+
+    /**
+     * Sets the stable Network Data version.
+     *
+     * @param[in]  aStableVersion  The stable Network Data version.
+     *
+     */
+    void SetStableVersion(uint8_t aStableVersion) { mStableVersion = aStableVersion; }
+
+private:
+    uint8_t mVersion;
+    uint8_t mStableVersion;
+} OT_TOOL_PACKED_END;
+
+/**
+ * Implements Network Data Delta TLV generation and parsing.
+ *
+ * The fixed fields are followed by the delta operations (see `NetworkData::DeltaManager`).
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+class NetworkDataDeltaTlv : public Tlv, public TlvInfo<Tlv::kNetworkDataDelta>
+{
+public:
+    /**
+     * Initializes the TLV.
+     *
+     */
+    void Init(void)
+    {
+        SetType(kNetworkDataDelta);
+        SetLength(sizeof(*this) - sizeof(Tlv));
+    }
+
+    /**
+     * Indicates whether or not the TLV appears to be well-formed.
+     *
+     * @retval TRUE   If the TLV appears to be well-formed.
+     * @retval FALSE  If the TLV does not appear to be well-formed.
+     *
+     */
+    bool IsValid(void) const { return GetLength() >= sizeof(*this) - sizeof(Tlv); }
+
+    /**
+     * Returns the version of the Network Data the delta applies to.
+     *
+     * @returns The base version.
+     *
+     */
+    uint8_t GetBaseVersion(void) const { return mBaseVersion; }
+
+    /**
+     * Sets the version of the Network Data the delta applies to.
+     *
+     * @param[in]  aBaseVersion  The base version.
+     *
+     */
+    void SetBaseVersion(uint8_t aBaseVersion) { mBaseVersion = aBaseVersion; }
+
+    /**
+     * Returns the CRC16 (CCITT) of the Network Data resulting from the delta.
+     *
+     * @returns The CRC16 of the resulting Network Data.
+     *
+     */
+    uint16_t GetChecksum(void) const { return HostSwap16(mChecksum); }
+
+    /**
+     * Sets the CRC16 (CCITT) of the Network Data resulting from the delta.
+     *
+     * @param[in]  aChecksum  The CRC16 of the resulting Network Data.
+     *
+     */
+    void SetChecksum(uint16_t aChecksum) { mChecksum = HostSwap16(aChecksum); }
+
+private:
+    uint8_t  mBaseVersion;
+    uint16_t mChecksum;
+} OT_TOOL_PACKED_END;
+#endif // OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+
 /**
  * Implements Scan Mask TLV generation and parsing.
  *
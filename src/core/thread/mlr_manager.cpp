@@ -40,6 +40,7 @@
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/numeric_limits.hpp"
 #include "net/ip6_address.hpp"
 #include "thread/thread_netif.hpp"
 #include "thread/uri_paths.hpp"
@@ -53,11 +54,14 @@ MlrManager::MlrManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mReregistrationDelay(0)
     , mSendDelay(0)
+    , mFailureCount(0)
     , mMlrPending(false)
+    , mHasQueueTime(false)
 #if (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE) && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
     , mRegisterMulticastListenersPending(false)
 #endif
 {
+    mCounters.Clear();
 }
 
 void MlrManager::HandleNotifierEvents(Events aEvents)
@@ -84,6 +88,13 @@ void MlrManager::HandleBackboneRouterPrimaryUpdate(BackboneRouter::Leader::State
     bool needRereg =
         aState == BackboneRouter::Leader::kStateAdded || aState == BackboneRouter::Leader::kStateToTriggerRereg;
 
+    if (needRereg)
+    {
+        // Failures with the previous Primary Backbone Router do not
+        // delay the registrations with the new one.
+        mFailureCount = 0;
+    }
+
     UpdateReregistrationDelay(needRereg);
 }
 
@@ -103,7 +114,12 @@ void MlrManager::UpdateLocalSubscriptions(void)
 #endif
 
     CheckInvariants();
+
+#if OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+    ScheduleBatchedSend();
+#else
     ScheduleSend(0);
+#endif
 }
 
 bool MlrManager::IsAddressMlrRegisteredByNetif(const Ip6::Address &aAddress) const
@@ -171,7 +187,11 @@ exit:
 
     if (aChild.HasAnyMlrToRegisterAddress())
     {
+#if OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+        ScheduleBatchedSend();
+#else
         ScheduleSend(Random::NonCrypto::GetUint16InRange(1, BackboneRouter::kParentAggregateDelay));
+#endif
     }
 }
 
@@ -181,6 +201,8 @@ void MlrManager::ScheduleSend(uint16_t aDelay)
 {
     OT_ASSERT(!mMlrPending || mSendDelay == 0);
 
+    HandleRegistrationQueued();
+
     VerifyOrExit(!mMlrPending);
 
     if (aDelay == 0)
@@ -198,6 +220,68 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+void MlrManager::ScheduleBatchedSend(void)
+{
+    // Registrations queued within the batch window opened by the
+    // first one share an MLR.req. Later registrations do not shorten
+    // the window, but a full MLR.req is sent right away unless the
+    // device is backing off after failures.
+
+    HandleRegistrationQueued();
+
+    if (mFailureCount == 0 && CountAddressesToRegister() >= Ip6AddressesTlv::kMaxAddresses)
+    {
+        ScheduleSend(0);
+    }
+    else if (mSendDelay == 0)
+    {
+        ScheduleSend(kBatchWindow);
+    }
+}
+#endif
+
+void MlrManager::HandleRegistrationQueued(void)
+{
+    // The latency of a registration starts when its first address
+    // becomes pending, not when a (re)send is merely scheduled.
+
+    if (!mHasQueueTime && CountAddressesToRegister() > 0)
+    {
+        mQueueTime    = TimerMilli::GetNow();
+        mHasQueueTime = true;
+    }
+}
+
+uint16_t MlrManager::CountAddressesToRegister(void) const
+{
+    uint16_t count = 0;
+
+#if OPENTHREAD_CONFIG_MLR_ENABLE
+    for (const Ip6::Netif::ExternalMulticastAddress &addr :
+         Get<ThreadNetif>().IterateExternalMulticastAddresses(Ip6::Address::kTypeMulticastLargerThanRealmLocal))
+    {
+        count += (addr.GetMlrState() == kMlrStateToRegister);
+    }
+#endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        if (!child.HasAnyMlrToRegisterAddress())
+        {
+            continue;
+        }
+
+        for (const Ip6::Address &address : child.IterateIp6Addresses(Ip6::Address::kTypeMulticastLargerThanRealmLocal))
+        {
+            count += (child.GetAddressMlrState(address) == kMlrStateToRegister);
+        }
+    }
+#endif
+
+    return count;
+}
+
 void MlrManager::UpdateTimeTickerRegistration(void)
 {
     if (mSendDelay == 0 && mReregistrationDelay == 0)
@@ -276,6 +360,9 @@ void MlrManager::SendMulticastListenerRegistration(void)
             addresses, addressesNum, nullptr, &MlrManager::HandleMulticastListenerRegistrationResponse, this));
 
     mMlrPending = true;
+    mCounters.HandleRequestSent(addressesNum);
+    mSentQueueTime = mQueueTime;
+    mHasQueueTime  = (CountAddressesToRegister() > 0);
 
     // Generally Thread 1.2 Router would send MLR.req on behalf for MA (scope >=4) subscribed by its MTD child.
     // When Thread 1.2 MTD attaches to Thread 1.1 parent, 1.2 MTD should send MLR.req to PBBR itself.
@@ -294,6 +381,10 @@ exit:
         {
             ScheduleSend(1);
         }
+        else if (error == kErrorNotFound)
+        {
+            mHasQueueTime = false;
+        }
     }
 
     LogMulticastAddresses();
@@ -449,31 +540,40 @@ void MlrManager::HandleMulticastListenerRegistrationResponse(Coap::Message
     Error        error;
     Ip6::Address failedAddresses[Ip6AddressesTlv::kMaxAddresses];
     uint8_t      failedAddressNum = 0;
+    bool         success;
 
     error = ParseMulticastListenerRegistrationResponse(aResult, aMessage, status, failedAddresses, failedAddressNum);
 
-    FinishMulticastListenerRegistration(error == kErrorNone && status == ThreadStatusTlv::MlrStatus::kMlrSuccess,
-                                        failedAddresses, failedAddressNum);
+    success = (error == kErrorNone && status == ThreadStatusTlv::MlrStatus::kMlrSuccess);
+    mCounters.HandleResponse(success, TimerMilli::GetNow() - mSentQueueTime);
 
-    if (error == kErrorNone && status == ThreadStatusTlv::MlrStatus::kMlrSuccess)
+    FinishMulticastListenerRegistration(success, failedAddresses, failedAddressNum);
+
+    if (success)
     {
+        mFailureCount = 0;
+
         // keep sending until all multicast addresses are registered.
         ScheduleSend(0);
     }
     else
     {
-        BackboneRouter::Config config;
-        uint16_t               reregDelay;
+        // The failed registrations are queued again, and are older
+        // than any registration queued since the MLR.req was sent.
+        mQueueTime    = mSentQueueTime;
+        mHasQueueTime = true;
+
+        if (mFailureCount < NumericLimits<uint8_t>::kMax)
+        {
+            mFailureCount++;
+        }
 
         // The Device has just attempted a Multicast Listener Registration which failed, and it retries the same
         // registration with a random time delay chosen in the interval [0, Reregistration Delay].
         // This is required by Thread 1.2 Specification 5.24.2.3
-        if (Get<BackboneRouter::Leader>().GetConfig(config) == kErrorNone)
+        if (Get<BackboneRouter::Leader>().HasPrimary())
         {
-            reregDelay = config.mReregistrationDelay > 1
-                             ? Random::NonCrypto::GetUint16InRange(1, config.mReregistrationDelay)
-                             : 1;
-            ScheduleSend(reregDelay);
+            ScheduleSend(Get<BackboneRouter::Leader>().GetRetryDelay(mFailureCount));
         }
     }
 }
@@ -142,7 +142,27 @@ public:
                                      void                                   *aContext);
 #endif
 
+    /**
+     * Returns the Multicast Listener Registration counters.
+     *
+     * @returns The Multicast Listener Registration counters.
+     *
+     */
+    const BackboneRouter::RegistrationCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the Multicast Listener Registration counters.
+     *
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
 private:
+#if OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+    static constexpr uint16_t kBatchWindow = OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCH_WINDOW; // In sec.
+
+    static_assert(kBatchWindow > 0, "OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCH_WINDOW must be non-zero");
+#endif
+
     void HandleNotifierEvents(Events aEvents);
 
     void  SendMulticastListenerRegistration(void);
@@ -206,6 +226,13 @@ private:
     void Reregister(void);
     void HandleTimeTick(void);
 
+#if OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+    void ScheduleBatchedSend(void);
+#endif
+
+    void     HandleRegistrationQueued(void);
+    uint16_t CountAddressesToRegister(void) const;
+
     void        LogMulticastAddresses(void);
     void        CheckInvariants(void) const;
     static void LogMlrResponse(Error               aResult,
@@ -221,7 +248,13 @@ private:
     uint32_t mReregistrationDelay;
     uint16_t mSendDelay;
 
+    BackboneRouter::RegistrationCounters mCounters;
+    TimeMilli                            mQueueTime;     // When the oldest registration still to send was queued.
+    TimeMilli                            mSentQueueTime; // `mQueueTime` of the MLR.req in flight.
+    uint8_t                              mFailureCount;  // Number of consecutive failed MLR.req.
+
     bool mMlrPending : 1;
+    bool mHasQueueTime : 1;
 #if (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE) && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
     bool mRegisterMulticastListenersPending : 1;
 #endif
@@ -0,0 +1,494 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements Network Data delta propagation.
+ */
+
+#include "network_data_delta.hpp"
+
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+
+#include "common/code_utils.hpp"
+#include "common/crc16.hpp"
+#include "common/instance.hpp"
+#include "common/locator_getters.hpp"
+#include "common/log.hpp"
+#include "common/num_utils.hpp"
+#include "thread/mle_tlvs.hpp"
+
+namespace ot {
+namespace NetworkData {
+
+RegisterLogModule("NetDataDelta");
+
+DeltaManager::DeltaManager(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mFullDataRequired(false)
+#if OPENTHREAD_FTD
+    , mNumSnapshots(0)
+    , mNewestSnapshot(0)
+#endif
+{
+    ResetCounters();
+}
+
+Error DeltaManager::AppendRequestTlv(Message &aMessage)
+{
+    Error                           error = kErrorNone;
+    Mle::NetworkDataDeltaRequestTlv tlv;
+
+    VerifyOrExit(!mFullDataRequired);
+
+    tlv.Init();
+    tlv.SetVersion(Get<Leader>().GetVersion(kFullSet));
+    tlv.SetStableVersion(Get<Leader>().GetVersion(kStableSubset));
+    error = aMessage.Append(tlv);
+
+exit:
+    return error;
+}
+
+Error DeltaManager::ProcessDeltaTlv(const Message &aMessage, Type aType, uint8_t *aData, uint8_t &aDataLength)
+{
+    Error                    error;
+    const Leader            &leader = Get<Leader>();
+    Mle::NetworkDataDeltaTlv tlv;
+    uint16_t                 offset;
+    uint8_t                  delta[NetworkData::kMaxSize];
+    uint8_t                  deltaLength;
+
+    SuccessOrExit(error = Tlv::FindTlv(aMessage, tlv, offset));
+
+    VerifyOrExit(tlv.IsValid(), error = kErrorParse);
+    VerifyOrExit(tlv.GetBaseVersion() == leader.GetVersion(aType), error = kErrorParse);
+
+    deltaLength = static_cast<uint8_t>(tlv.GetLength() - (sizeof(tlv) - sizeof(Tlv)));
+    VerifyOrExit(deltaLength <= sizeof(delta), error = kErrorParse);
+    SuccessOrExit(error = aMessage.Read(offset + sizeof(tlv), delta, deltaLength));
+
+    SuccessOrExit(error = ApplyDelta(leader.GetBytes(), leader.GetLength(), delta, deltaLength, aData, aDataLength));
+    VerifyOrExit(CalculateChecksum(aData, aDataLength) == tlv.GetChecksum(), error = kErrorParse);
+
+    mCounters.mDeltasApplied++;
+
+exit:
+    if ((error != kErrorNone) && (error != kErrorNotFound))
+    {
+        LogNote("Failed to apply Network Data delta, requesting full Network Data");
+        mFullDataRequired = true;
+        mCounters.mDeltaFailures++;
+        error = kErrorParse;
+    }
+
+    return error;
+}
+
+#if OPENTHREAD_FTD
+
+void DeltaManager::HandleNetDataChanged(void)
+{
+    // Only the versions of the full Network Data are recorded, a
+    // device with the stable subset never serves deltas from it.
+
+    const Leader &leader      = Get<Leader>();
+    Mle::Mle     &mle         = Get<Mle::Mle>();
+    uint32_t      partitionId = mle.GetLeaderData().GetPartitionId();
+    Snapshot     *snapshot;
+
+    VerifyOrExit(mle.IsAttached() && (mle.GetNetworkDataType() == kFullSet));
+
+    if ((mNumSnapshots > 0) && (mSnapshots[mNewestSnapshot].mPartitionId != partitionId))
+    {
+        ClearHistory();
+    }
+
+    snapshot = &mSnapshots[mNewestSnapshot];
+
+    if ((mNumSnapshots == 0) || (snapshot->mVersion != leader.GetVersion(kFullSet)) ||
+        (snapshot->mStableVersion != leader.GetVersion(kStableSubset)))
+    {
+        mNewestSnapshot = (mNumSnapshots == 0) ? 0 : static_cast<uint8_t>((mNewestSnapshot + 1) % kHistorySize);
+        mNumSnapshots   = Min<uint8_t>(mNumSnapshots + 1, kHistorySize);
+        snapshot        = &mSnapshots[mNewestSnapshot];
+    }
+
+    snapshot->mPartitionId   = partitionId;
+    snapshot->mVersion       = leader.GetVersion(kFullSet);
+    snapshot->mStableVersion = leader.GetVersion(kStableSubset);
+    snapshot->mLength        = leader.GetLength();
+    memcpy(snapshot->mTlvs, leader.GetBytes(), leader.GetLength());
+
+exit:
+    return;
+}
+
+const DeltaManager::Snapshot *DeltaManager::FindSnapshot(Type aType, uint8_t aVersion, uint8_t aStableVersion) const
+{
+    const Snapshot *match       = nullptr;
+    uint32_t        partitionId = Get<Mle::Mle>().GetLeaderData().GetPartitionId();
+
+    // Search from the newest snapshot. Any snapshot with the requested
+    // stable version has the same stable subset.
+
+    for (uint8_t i = 0; i < mNumSnapshots; i++)
+    {
+        const Snapshot &snapshot = mSnapshots[(mNewestSnapshot + kHistorySize - i) % kHistorySize];
+
+        if ((snapshot.mPartitionId != partitionId) || (snapshot.mStableVersion != aStableVersion))
+        {
+            continue;
+        }
+
+        if ((aType == kStableSubset) || (snapshot.mVersion == aVersion))
+        {
+            match = &snapshot;
+            break;
+        }
+    }
+
+    return match;
+}
+
+Error DeltaManager::AppendDeltaTlv(Message &aMessage, Type aType, const Message &aRequestMessage)
+{
+    Error                           error = kErrorNone;
+    Mle::NetworkDataDeltaRequestTlv requestTlv;
+    Mle::NetworkDataDeltaTlv        tlv;
+    const Snapshot                 *snapshot;
+    uint8_t                         base[NetworkData::kMaxSize];
+    uint8_t                         baseLength = sizeof(base);
+    uint8_t                         target[NetworkData::kMaxSize];
+    uint8_t                         targetLength = sizeof(target);
+    uint8_t                         delta[NetworkData::kMaxSize];
+    uint8_t                         deltaLength;
+    bool                            requested = false;
+
+    if ((Tlv::FindTlv(aRequestMessage, requestTlv) != kErrorNone) || !requestTlv.IsValid())
+    {
+        // The requester does not support deltas.
+        ExitNow(error = kErrorNotFound);
+    }
+
+    requested = true;
+
+    snapshot = FindSnapshot(aType, requestTlv.GetVersion(), requestTlv.GetStableVersion());
+    VerifyOrExit(snapshot != nullptr, error = kErrorNotFound);
+
+    SuccessOrExit(error = NetworkData(GetInstance(), snapshot->mTlvs, snapshot->mLength)
+                              .CopyNetworkData(aType, base, baseLength));
+    SuccessOrExit(error = Get<Leader>().CopyNetworkData(aType, target, targetLength));
+
+    // The delta is only sent if its TLV is smaller than the Network
+    // Data TLV it replaces.
+
+    VerifyOrExit(targetLength > sizeof(tlv) - sizeof(Tlv) + 1, error = kErrorNotFound);
+    deltaLength = static_cast<uint8_t>(targetLength - (sizeof(tlv) - sizeof(Tlv)) - 1);
+
+    if (EncodeDelta(base, baseLength, target, targetLength, delta, deltaLength) != kErrorNone)
+    {
+        ExitNow(error = kErrorNotFound);
+    }
+
+    tlv.Init();
+    tlv.SetLength(static_cast<uint8_t>(tlv.GetLength() + deltaLength));
+    tlv.SetBaseVersion((aType == kFullSet) ? requestTlv.GetVersion() : requestTlv.GetStableVersion());
+    tlv.SetChecksum(CalculateChecksum(target, targetLength));
+
+    SuccessOrExit(error = aMessage.Append(tlv));
+    SuccessOrExit(error = aMessage.AppendBytes(delta, deltaLength));
+
+    mCounters.mDeltasSent++;
+    mCounters.mDeltaBytesSent += tlv.GetLength();
+    mCounters.mBytesSaved += targetLength - tlv.GetLength();
+
+exit:
+    if ((error == kErrorNotFound) && requested)
+    {
+        mCounters.mFullFallbacks++;
+    }
+
+    return error;
+}
+
+#endif // OPENTHREAD_FTD
+
+uint16_t DeltaManager::GetTlvSize(const uint8_t *aCur, const uint8_t *aEnd)
+{
+    // Returns the size of the TLV at `aCur`, or zero if the TLV is
+    // truncated.
+
+    uint16_t size = 0;
+
+    VerifyOrExit(aEnd - aCur >= static_cast<ptrdiff_t>(sizeof(NetworkDataTlv)));
+    size = sizeof(NetworkDataTlv) + reinterpret_cast<const NetworkDataTlv *>(aCur)->GetLength();
+
+    if (size > aEnd - aCur)
+    {
+        size = 0;
+    }
+
+exit:
+    return size;
+}
+
+bool DeltaManager::IsWellFormed(const uint8_t *aData, uint8_t aLength)
+{
+    const uint8_t *end = aData + aLength;
+    uint16_t       size;
+
+    for (const uint8_t *cur = aData; cur < end; cur += size)
+    {
+        size = GetTlvSize(cur, end);
+
+        if (size == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint16_t DeltaManager::GetMatchLength(const uint8_t *aBase,
+                                      const uint8_t *aBaseEnd,
+                                      const uint8_t *aTarget,
+                                      const uint8_t *aTargetEnd,
+                                      uint8_t       &aNumTlvs)
+{
+    // Returns the number of bytes (and of TLVs in `aNumTlvs`) of the
+    // identical consecutive TLVs at `aBase` and `aTarget`.
+
+    uint16_t length = 0;
+
+    aNumTlvs = 0;
+
+    while (aNumTlvs < NumericLimits<uint8_t>::kMax)
+    {
+        uint16_t size = GetTlvSize(aBase, aBaseEnd);
+
+        if ((size == 0) || (size != GetTlvSize(aTarget, aTargetEnd)) || (memcmp(aBase, aTarget, size) != 0))
+        {
+            break;
+        }
+
+        aBase += size;
+        aTarget += size;
+        length += size;
+        aNumTlvs++;
+    }
+
+    return length;
+}
+
+Error DeltaManager::AppendOp(uint8_t        aOp,
+                             uint8_t        aParam,
+                             const uint8_t *aBytes,
+                             uint8_t        aLength,
+                             uint8_t       *aDelta,
+                             uint8_t        aDeltaSize,
+                             uint8_t       &aDeltaLength)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aDeltaSize - aDeltaLength >= kOpHeaderSize + aLength, error = kErrorNoBufs);
+
+    aDelta[aDeltaLength++] = aOp;
+    aDelta[aDeltaLength++] = aParam;
+    memcpy(&aDelta[aDeltaLength], aBytes, aLength);
+    aDeltaLength += aLength;
+
+exit:
+    return error;
+}
+
+Error DeltaManager::EncodeDelta(const uint8_t *aBase,
+                                uint8_t        aBaseLength,
+                                const uint8_t *aTarget,
+                                uint8_t        aTargetLength,
+                                uint8_t       *aDelta,
+                                uint8_t       &aDeltaLength)
+{
+    Error          error      = kErrorNone;
+    const uint8_t *baseEnd    = aBase + aBaseLength;
+    const uint8_t *target     = aTarget;
+    const uint8_t *targetEnd  = aTarget + aTargetLength;
+    const uint8_t *insertFrom = nullptr;
+    uint8_t        deltaSize  = aDeltaLength;
+
+    aDeltaLength = 0;
+
+    VerifyOrExit(IsWellFormed(aBase, aBaseLength) && IsWellFormed(aTarget, aTargetLength), error = kErrorParse);
+
+    while (target < targetEnd)
+    {
+        // Find the longest run of base TLVs matching the TLVs at
+        // `target`. Top-level TLVs are few, so a plain search is used.
+
+        uint16_t bestLength = 0;
+        uint8_t  bestIndex  = 0;
+        uint8_t  bestCount  = 0;
+        uint8_t  index      = 0;
+
+        for (const uint8_t *base = aBase; base < baseEnd; base += GetTlvSize(base, baseEnd), index++)
+        {
+            uint8_t  count;
+            uint16_t length = GetMatchLength(base, baseEnd, target, targetEnd, count);
+
+            if (length > bestLength)
+            {
+                bestLength = length;
+                bestIndex  = index;
+                bestCount  = count;
+            }
+        }
+
+        // Copying only pays off if the copy op is shorter than the
+        // TLVs it replaces, otherwise the TLVs are inserted.
+
+        if (bestLength > kOpHeaderSize + 1)
+        {
+            if (insertFrom != nullptr)
+            {
+                SuccessOrExit(error = AppendOp(kOpInsert, static_cast<uint8_t>(target - insertFrom), insertFrom,
+                                               static_cast<uint8_t>(target - insertFrom), aDelta, deltaSize,
+                                               aDeltaLength));
+                insertFrom = nullptr;
+            }
+
+            SuccessOrExit(error = AppendOp(kOpCopy, bestIndex, &bestCount, sizeof(bestCount), aDelta, deltaSize,
+                                           aDeltaLength));
+            target += bestLength;
+        }
+        else
+        {
+            if (insertFrom == nullptr)
+            {
+                insertFrom = target;
+            }
+
+            target += GetTlvSize(target, targetEnd);
+        }
+    }
+
+    if (insertFrom != nullptr)
+    {
+        SuccessOrExit(error = AppendOp(kOpInsert, static_cast<uint8_t>(target - insertFrom), insertFrom,
+                                       static_cast<uint8_t>(target - insertFrom), aDelta, deltaSize, aDeltaLength));
+    }
+
+exit:
+    return error;
+}
+
+Error DeltaManager::ApplyDelta(const uint8_t *aBase,
+                               uint8_t        aBaseLength,
+                               const uint8_t *aDelta,
+                               uint8_t        aDeltaLength,
+                               uint8_t       *aTarget,
+                               uint8_t       &aTargetLength)
+{
+    Error          error      = kErrorNone;
+    const uint8_t *baseEnd    = aBase + aBaseLength;
+    const uint8_t *deltaEnd   = aDelta + aDeltaLength;
+    uint8_t        targetSize = aTargetLength;
+
+    aTargetLength = 0;
+
+    VerifyOrExit(IsWellFormed(aBase, aBaseLength), error = kErrorParse);
+
+    for (const uint8_t *op = aDelta; op < deltaEnd;)
+    {
+        const uint8_t *start;
+        const uint8_t *end;
+
+        VerifyOrExit(deltaEnd - op >= kOpHeaderSize, error = kErrorParse);
+
+        switch (op[0])
+        {
+        case kOpCopy:
+            VerifyOrExit(deltaEnd - op >= kOpHeaderSize + 1, error = kErrorParse);
+
+            start = aBase;
+
+            for (uint8_t index = 0; index < op[1]; index++)
+            {
+                VerifyOrExit(start < baseEnd, error = kErrorParse);
+                start += GetTlvSize(start, baseEnd);
+            }
+
+            end = start;
+
+            for (uint8_t count = 0; count < op[2]; count++)
+            {
+                VerifyOrExit(end < baseEnd, error = kErrorParse);
+                end += GetTlvSize(end, baseEnd);
+            }
+
+            op += kOpHeaderSize + 1;
+            break;
+
+        case kOpInsert:
+            start = op + kOpHeaderSize;
+            end   = start + op[1];
+            VerifyOrExit(end <= deltaEnd, error = kErrorParse);
+            op = end;
+            break;
+
+        default:
+            ExitNow(error = kErrorParse);
+        }
+
+        VerifyOrExit(end - start <= targetSize - aTargetLength, error = kErrorParse);
+        memcpy(&aTarget[aTargetLength], start, static_cast<size_t>(end - start));
+        aTargetLength += static_cast<uint8_t>(end - start);
+    }
+
+    VerifyOrExit(IsWellFormed(aTarget, aTargetLength), error = kErrorParse);
+
+exit:
+    return error;
+}
+
+uint16_t DeltaManager::CalculateChecksum(const uint8_t *aData, uint8_t aLength)
+{
+    Crc16 crc(Crc16::kCcitt);
+
+    for (uint8_t i = 0; i < aLength; i++)
+    {
+        crc.Update(aData[i]);
+    }
+
+    return crc.Get();
+}
+
+} // namespace NetworkData
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
@@ -0,0 +1,269 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for Network Data delta propagation.
+ */
+
+#ifndef NETWORK_DATA_DELTA_HPP_
+#define NETWORK_DATA_DELTA_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+
+#include <string.h>
+
+#include <openthread/netdata.h>
+
+#include "common/locator.hpp"
+#include "common/message.hpp"
+#include "common/non_copyable.hpp"
+#include "thread/network_data.hpp"
+#include "thread/network_data_types.hpp"
+
+namespace ot {
+namespace NetworkData {
+
+/**
+ * Implements Network Data delta propagation.
+ *
+ * A device asks in its MLE Data Request for the changes relative to the Network Data version it already has
+ * (Network Data Delta Request TLV). A router or leader keeps the last few Network Data versions it had and, if the
+ * requested version is among them, answers with a Network Data Delta TLV instead of the full Network Data, provided
+ * the delta is smaller.
+ *
+ * A delta is a sequence of operations rebuilding the new Network Data from the top-level TLVs of the old one:
+ *
+ * - Copy `[kOpCopy, index, count]`: appends `count` consecutive top-level TLVs of the old Network Data, starting
+ *   at TLV `index`.
+ * - Insert `[kOpInsert, length, bytes...]`: appends `length` bytes taken from the delta.
+ *
+ * The delta carries the CRC16 of the resulting Network Data. A device that cannot apply a delta falls back to
+ * requesting the full Network Data.
+ *
+ */
+class DeltaManager : public InstanceLocator, private NonCopyable
+{
+public:
+    typedef otNetDataDeltaCounters Counters; ///< Network Data delta counters.
+
+    /**
+     * Initializes the `DeltaManager`.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     *
+     */
+    explicit DeltaManager(Instance &aInstance);
+
+    /**
+     * Appends a Network Data Delta Request TLV with the current Network Data versions to a message.
+     *
+     * Does nothing if the last received delta could not be applied, so that the full Network Data is sent instead.
+     *
+     * @param[in] aMessage  The message to append to.
+     *
+     * @retval kErrorNone    Successfully appended the TLV (or nothing to append).
+     * @retval kErrorNoBufs  Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendRequestTlv(Message &aMessage);
+
+    /**
+     * Applies the Network Data Delta TLV in a received message to the current Network Data.
+     *
+     * @param[in]     aMessage     The received message.
+     * @param[in]     aType        The Network Data type of the current Network Data.
+     * @param[out]    aData        A buffer to output the resulting Network Data.
+     * @param[in,out] aDataLength  On entry, the size of @p aData. On exit, the length of the resulting Network Data.
+     *
+     * @retval kErrorNone      Successfully applied the delta.
+     * @retval kErrorNotFound  The message has no Network Data Delta TLV.
+     * @retval kErrorParse     The delta could not be applied. The next request asks for the full Network Data.
+     *
+     */
+    Error ProcessDeltaTlv(const Message &aMessage, Type aType, uint8_t *aData, uint8_t &aDataLength);
+
+    /**
+     * Indicates that the full Network Data was received.
+     *
+     */
+    void HandleFullNetworkData(void) { mFullDataRequired = false; }
+
+#if OPENTHREAD_FTD
+    /**
+     * Records the current Network Data into the version history.
+     *
+     * Is called whenever the Network Data changes.
+     *
+     */
+    void HandleNetDataChanged(void);
+
+    /**
+     * Clears the version history.
+     *
+     */
+    void ClearHistory(void) { mNumSnapshots = 0; }
+
+    /**
+     * Appends a Network Data Delta TLV answering the Network Data Delta Request TLV of a received Data Request.
+     *
+     * @param[in] aMessage         The Data Response to append to.
+     * @param[in] aType            The Network Data type to send.
+     * @param[in] aRequestMessage  The received Data Request.
+     *
+     * @retval kErrorNone      Successfully appended the TLV.
+     * @retval kErrorNotFound  No delta can be sent. The full Network Data should be appended instead.
+     * @retval kErrorNoBufs    Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendDeltaTlv(Message &aMessage, Type aType, const Message &aRequestMessage);
+#endif
+
+    /**
+     * Returns the Network Data delta counters.
+     *
+     * @returns The Network Data delta counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the Network Data delta counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
+    /**
+     * Encodes the delta rebuilding a Network Data from another one.
+     *
+     * @param[in]     aBase          The old Network Data.
+     * @param[in]     aBaseLength    The length of @p aBase.
+     * @param[in]     aTarget        The new Network Data.
+     * @param[in]     aTargetLength  The length of @p aTarget.
+     * @param[out]    aDelta         A buffer to output the delta operations.
+     * @param[in,out] aDeltaLength   On entry, the size of @p aDelta. On exit, the length of the delta.
+     *
+     * @retval kErrorNone    Successfully encoded the delta.
+     * @retval kErrorNoBufs  The delta does not fit in @p aDelta.
+     * @retval kErrorParse   @p aBase or @p aTarget is not well-formed.
+     *
+     */
+    static Error EncodeDelta(const uint8_t *aBase,
+                             uint8_t        aBaseLength,
+                             const uint8_t *aTarget,
+                             uint8_t        aTargetLength,
+                             uint8_t       *aDelta,
+                             uint8_t       &aDeltaLength);
+
+    /**
+     * Applies a delta to a Network Data.
+     *
+     * @param[in]     aBase          The old Network Data.
+     * @param[in]     aBaseLength    The length of @p aBase.
+     * @param[in]     aDelta         The delta operations.
+     * @param[in]     aDeltaLength   The length of @p aDelta.
+     * @param[out]    aTarget        A buffer to output the new Network Data.
+     * @param[in,out] aTargetLength  On entry, the size of @p aTarget. On exit, the length of the new Network Data.
+     *
+     * @retval kErrorNone   Successfully applied the delta.
+     * @retval kErrorParse  The delta is not well-formed, refers to missing TLVs or does not produce a well-formed
+     *                      Network Data fitting in @p aTarget.
+     *
+     */
+    static Error ApplyDelta(const uint8_t *aBase,
+                            uint8_t        aBaseLength,
+                            const uint8_t *aDelta,
+                            uint8_t        aDeltaLength,
+                            uint8_t       *aTarget,
+                            uint8_t       &aTargetLength);
+
+    /**
+     * Calculates the checksum of a Network Data carried in a Network Data Delta TLV.
+     *
+     * @param[in] aData    The Network Data.
+     * @param[in] aLength  The length of @p aData.
+     *
+     * @returns The CRC16 (CCITT) of @p aData.
+     *
+     */
+    static uint16_t CalculateChecksum(const uint8_t *aData, uint8_t aLength);
+
+private:
+    static constexpr uint8_t kOpCopy       = 1;
+    static constexpr uint8_t kOpInsert     = 2;
+    static constexpr uint8_t kOpHeaderSize = 2; // Op and its first parameter.
+
+#if OPENTHREAD_FTD
+    static constexpr uint8_t kHistorySize = OPENTHREAD_CONFIG_NETDATA_DELTA_HISTORY_SIZE;
+
+    static_assert(kHistorySize > 0, "OPENTHREAD_CONFIG_NETDATA_DELTA_HISTORY_SIZE must be non-zero");
+
+    struct Snapshot
+    {
+        uint32_t mPartitionId;
+        uint8_t  mVersion;
+        uint8_t  mStableVersion;
+        uint8_t  mLength;
+        uint8_t  mTlvs[NetworkData::kMaxSize];
+    };
+
+    const Snapshot *FindSnapshot(Type aType, uint8_t aVersion, uint8_t aStableVersion) const;
+#endif
+
+    static uint16_t GetTlvSize(const uint8_t *aCur, const uint8_t *aEnd);
+    static bool     IsWellFormed(const uint8_t *aData, uint8_t aLength);
+    static uint16_t GetMatchLength(const uint8_t *aBase,
+                                   const uint8_t *aBaseEnd,
+                                   const uint8_t *aTarget,
+                                   const uint8_t *aTargetEnd,
+                                   uint8_t       &aNumTlvs);
+    static Error    AppendOp(uint8_t        aOp,
+                             uint8_t        aParam,
+                             const uint8_t *aBytes,
+                             uint8_t        aLength,
+                             uint8_t       *aDelta,
+                             uint8_t        aDeltaSize,
+                             uint8_t       &aDeltaLength);
+
+    bool     mFullDataRequired;
+    Counters mCounters;
+#if OPENTHREAD_FTD
+    uint8_t  mNumSnapshots;
+    uint8_t  mNewestSnapshot;
+    Snapshot mSnapshots[kHistorySize];
+#endif
+};
+
+} // namespace NetworkData
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+
+#endif // NETWORK_DATA_DELTA_HPP_
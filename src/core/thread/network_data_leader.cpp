@@ -60,6 +60,11 @@ void LeaderBase::Reset(void)
     mVersion       = Random::NonCrypto::GetUint8();
     mStableVersion = Random::NonCrypto::GetUint8();
     SetLength(0);
+
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE && OPENTHREAD_FTD
+    Get<DeltaManager>().ClearHistory();
+#endif
+
     SignalNetDataChanged();
 }
 
@@ -404,7 +409,32 @@ Error LeaderBase::SetNetworkData(uint8_t        aVersion,
     VerifyOrExit(aLength <= kMaxSize, error = kErrorParse);
     SuccessOrExit(error = aMessage.Read(aOffset, GetBytes(), aLength));
 
-    SetLength(static_cast<uint8_t>(aLength));
+    HandleNetworkDataSet(aVersion, aStableVersion, aType, static_cast<uint8_t>(aLength));
+
+exit:
+    return error;
+}
+
+Error LeaderBase::SetNetworkData(uint8_t        aVersion,
+                                 uint8_t        aStableVersion,
+                                 Type           aType,
+                                 const uint8_t *aData,
+                                 uint8_t        aLength)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aLength <= kMaxSize, error = kErrorParse);
+    memmove(GetBytes(), aData, aLength);
+
+    HandleNetworkDataSet(aVersion, aStableVersion, aType, aLength);
+
+exit:
+    return error;
+}
+
+void LeaderBase::HandleNetworkDataSet(uint8_t aVersion, uint8_t aStableVersion, Type aType, uint8_t aLength)
+{
+    SetLength(aLength);
     mVersion       = aVersion;
     mStableVersion = aStableVersion;
 
@@ -423,9 +453,6 @@ Error LeaderBase::SetNetworkData(uint8_t        aVersion,
     DumpDebg("SetNetworkData", GetBytes(), GetLength());
 
     SignalNetDataChanged();
-
-exit:
-    return error;
 }
 
 Error LeaderBase::SetCommissioningData(const uint8_t *aValue, uint8_t aValueLength)
@@ -545,6 +572,12 @@ Error LeaderBase::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDisce
 void LeaderBase::SignalNetDataChanged(void)
 {
     mMaxLength = Max(mMaxLength, GetLength());
+    Get<Lowpan::Lowpan>().InvalidateContexts();
+
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE && OPENTHREAD_FTD
+    Get<DeltaManager>().HandleNetDataChanged();
+#endif
+
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -181,6 +181,21 @@ public:
                          uint16_t       aOffset,
                          uint16_t       aLength);
 
+    /**
+     * Is used by non-Leader devices to set Network Data from a buffer (e.g. rebuilt from a Network Data delta).
+     *
+     * @param[in]  aVersion        The Version value.
+     * @param[in]  aStableVersion  The Stable Version value.
+     * @param[in]  aType           The Network Data type to set, the full set or stable subset.
+     * @param[in]  aData           A pointer to the Network Data.
+     * @param[in]  aLength         The length of Network Data.
+     *
+     * @retval kErrorNone   Successfully set the network data.
+     * @retval kErrorParse  @p aLength is larger than the maximum Network Data size.
+     *
+     */
+    Error SetNetworkData(uint8_t aVersion, uint8_t aStableVersion, Type aType, const uint8_t *aData, uint8_t aLength);
+
     /**
      * Returns a pointer to the Commissioning Data.
      *
@@ -309,6 +324,7 @@ private:
     const PrefixTlv *FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
 
     void RemoveCommissioningData(void);
+    void HandleNetworkDataSet(uint8_t aVersion, uint8_t aStableVersion, Type aType, uint8_t aLength);
 
     template <typename EntryType> int CompareRouteEntries(const EntryType &aFirst, const EntryType &aSecond) const;
     int                               CompareRouteEntries(int8_t   aFirstPreference,
@@ -42,6 +42,8 @@
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/num_utils.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/random.hpp"
 #include "mac/mac.hpp"
 #include "net/netif.hpp"
@@ -66,6 +68,9 @@ const char Server::kVendorSwVersion[] = OPENTHREAD_CONFIG_NET_DIAG_VENDOR_SW_VER
 
 Server::Server(Instance &aInstance)
     : InstanceLocator(aInstance)
+#if OPENTHREAD_FTD
+    , mAnswerTimer(aInstance)
+#endif
 {
     static_assert(sizeof(kVendorName) <= sizeof(VendorNameTlv::StringType), "VENDOR_NAME is too long");
     static_assert(sizeof(kVendorModel) <= sizeof(VendorModelTlv::StringType), "VENDOR_MODEL is too long");
@@ -76,6 +81,13 @@ Server::Server(Instance &aInstance)
     memcpy(mVendorModel, kVendorModel, sizeof(kVendorModel));
     memcpy(mVendorSwVersion, kVendorSwVersion, sizeof(kVendorSwVersion));
 #endif
+
+#if OPENTHREAD_FTD
+    for (AnswerStream &stream : mAnswerStreams)
+    {
+        stream.Init(aInstance);
+    }
+#endif
 }
 
 #if OPENTHREAD_CONFIG_NET_DIAG_VENDOR_INFO_SET_API_ENABLE
@@ -135,17 +147,26 @@ void Server::PrepareMessageInfoForDest(const Ip6::Address &aDestination, Tmf::Me
     aMessageInfo.SetPeerAddr(aDestination);
 }
 
-Error Server::AppendIp6AddressList(Message &aMessage)
+Error Server::AppendIp6AddressList(Message &aMessage, uint16_t &aCursor, uint16_t aMaxCount)
 {
+    // Appends an IPv6 Address List TLV with up to `aMaxCount`
+    // addresses, starting from the address at index `aCursor`, and
+    // advances `aCursor`. Returns `kErrorPending` if more addresses
+    // remain to be appended in a following TLV.
+
     Error    error = kErrorNone;
-    uint16_t count = 0;
+    uint16_t total = 0;
+    uint16_t index = 0;
+    uint16_t count;
 
     for (const Ip6::Netif::UnicastAddress &addr : Get<ThreadNetif>().GetUnicastAddresses())
     {
         OT_UNUSED_VARIABLE(addr);
-        count++;
+        total++;
     }
 
+    count = (total > aCursor) ? Min<uint16_t>(total - aCursor, aMaxCount) : 0;
+
     if (count * Ip6::Address::kSize <= Tlv::kBaseTlvMaxLength)
     {
         Tlv tlv;
@@ -165,22 +186,43 @@ Error Server::AppendIp6AddressList(Message &aMessage)
 
     for (const Ip6::Netif::UnicastAddress &addr : Get<ThreadNetif>().GetUnicastAddresses())
     {
-        SuccessOrExit(error = aMessage.Append(addr.GetAddress()));
+        if ((index >= aCursor) && (index - aCursor < count))
+        {
+            SuccessOrExit(error = aMessage.Append(addr.GetAddress()));
+        }
+
+        index++;
     }
 
+    aCursor += count;
+    error = (aCursor < total) ? kErrorPending : kErrorNone;
+
 exit:
     return error;
 }
 
 #if OPENTHREAD_FTD
-Error Server::AppendChildTable(Message &aMessage)
+Error Server::AppendChildTable(Message &aMessage, uint16_t &aCursor, uint16_t aMaxCount)
 {
+    // Appends a Child Table TLV with up to `aMaxCount` entries for
+    // the valid children whose child table index is `aCursor` or
+    // larger. If more children remain, `aCursor` is set to the index
+    // of the next one and `kErrorPending` is returned.
+
     Error    error = kErrorNone;
-    uint16_t count;
+    uint16_t count = 0;
 
     VerifyOrExit(Get<Mle::MleRouter>().IsRouterOrLeader());
 
-    count = Min(Get<ChildTable>().GetNumChildren(Child::kInStateValid), kMaxChildEntries);
+    for (const Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        if (Get<ChildTable>().GetChildIndex(child) >= aCursor)
+        {
+            count++;
+        }
+    }
+
+    count = Min(count, aMaxCount);
 
     if (count * sizeof(ChildTableEntry) <= Tlv::kBaseTlvMaxLength)
     {
@@ -201,10 +243,22 @@ Error Server::AppendChildTable(Message &aMessage)
 
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
     {
-        uint8_t         timeout = 0;
+        uint16_t        childIndex = Get<ChildTable>().GetChildIndex(child);
+        uint8_t         timeout    = 0;
         ChildTableEntry entry;
 
-        VerifyOrExit(count--);
+        if (childIndex < aCursor)
+        {
+            continue;
+        }
+
+        if (count == 0)
+        {
+            aCursor = childIndex;
+            ExitNow(error = kErrorPending);
+        }
+
+        count--;
 
         while (static_cast<uint32_t>(1 << timeout) < child.GetTimeout())
         {
@@ -310,8 +364,12 @@ Error Server::AppendDiagTlv(uint8_t aTlvType, Message &aMessage)
         break;
 
     case Tlv::kIp6AddressList:
-        error = AppendIp6AddressList(aMessage);
+    {
+        uint16_t cursor = 0;
+
+        error = AppendIp6AddressList(aMessage, cursor, NumericLimits<uint16_t>::kMax);
         break;
+    }
 
     case Tlv::kMacCounters:
         error = AppendMacCounters(aMessage);
@@ -377,8 +435,14 @@ Error Server::AppendDiagTlv(uint8_t aTlvType, Message &aMessage)
     }
 
     case Tlv::kChildTable:
-        error = AppendChildTable(aMessage);
+    {
+        uint16_t cursor = 0;
+
+        // Children beyond the first `kMaxChildEntries` are omitted.
+        error = AppendChildTable(aMessage, cursor, kMaxChildEntries);
+        error = (error == kErrorPending) ? kErrorNone : error;
         break;
+    }
 
     case Tlv::kMaxChildTimeout:
     {
@@ -416,7 +480,7 @@ void Server::HandleTmf<kUriDiagnosticGetQuery>(Coap::Message &aMessage, const Ip
 #if OPENTHREAD_MTD
     SendAnswer(aMessageInfo.GetPeerAddr(), aMessage);
 #elif OPENTHREAD_FTD
-    PrepareAndSendAnswers(aMessageInfo.GetPeerAddr(), aMessage);
+    PrepareAndSendAnswers(aMessageInfo.GetPeerAddr(), aMessage, aMessageInfo.GetSockAddr().IsMulticast());
 #endif
 
 exit:
@@ -460,195 +524,204 @@ exit:
 
 #if OPENTHREAD_FTD
 
-Error Server::AllocateAnswer(Coap::Message *&aAnswer, AnswerInfo &aInfo)
+void Server::PrepareAndSendAnswers(const Ip6::Address &aDestination, const Message &aRequest, bool aIsMulticast)
 {
-    // Allocate an `Answer` message, adds it in `mAnswerQueue`,
-    // update the `aInfo.mFirstAnswer` if it is the first allocated
-    // messages, and appends `QueryIdTlv` to the message (if needed).
-
-    Error error = kErrorNone;
-
-    aAnswer = Get<Tmf::Agent>().NewConfirmablePostMessage(kUriDiagnosticGetAnswer);
-    VerifyOrExit(aAnswer != nullptr, error = kErrorNoBufs);
-    IgnoreError(aAnswer->SetPriority(aInfo.mPriority));
-
-    mAnswerQueue.Enqueue(*aAnswer);
+    AnswerStream *stream = nullptr;
+    uint16_t      offset;
+    uint16_t      length;
 
-    if (aInfo.mFirstAnswer == nullptr)
+    for (AnswerStream &answerStream : mAnswerStreams)
     {
-        aInfo.mFirstAnswer = aAnswer;
+        if (!answerStream.mInUse)
+        {
+            stream = &answerStream;
+            break;
+        }
     }
 
-    if (aInfo.mHasQueryId)
+    if (stream == nullptr)
     {
-        SuccessOrExit(error = Tlv::Append<QueryIdTlv>(*aAnswer, aInfo.mQueryId));
+        LogNote("Dropping query from %s, already answering %u queries", aDestination.ToString().AsCString(),
+                kMaxAnswerStreams);
+        ExitNow();
     }
 
-exit:
-    return error;
-}
+    SuccessOrExit(Tlv::FindTlvValueOffset(aRequest, Tlv::kTypeList, offset, length));
 
-bool Server::IsLastAnswer(const Coap::Message &aAnswer) const
-{
-    // Indicates whether `aAnswer` is the last one associated with
-    // the same query.
-
-    bool      isLast = true;
-    AnswerTlv answerTlv;
+    stream->mDestination = aDestination;
+    stream->mPriority    = aRequest.GetPriority();
+    stream->mHasQueryId  = (Tlv::Find<QueryIdTlv>(aRequest, stream->mQueryId) == kErrorNone);
+    stream->mAnswerIndex = 0;
+    stream->mEntryCursor = 0;
+    stream->mTlvIndex    = 0;
+    stream->mNumTlvTypes = static_cast<uint8_t>(Min<uint16_t>(length, kMaxQueryTlvTypes));
+    aRequest.ReadBytes(offset, stream->mTlvTypes, stream->mNumTlvTypes);
+    stream->mInUse     = true;
+    stream->mIsDelayed = false;
 
-    // If there is no Answer TLV, we assume it is the last answer.
+    if (aIsMulticast && (kQueryAnswerJitter > 0))
+    {
+        // Spread the answers of all the devices that received the
+        // multicast query so that they do not all reach the
+        // requester at the same time.
+
+        stream->mIsDelayed = true;
+        stream->mStartTime = TimerMilli::GetNow() + Random::NonCrypto::GetUint32InRange(0, kQueryAnswerJitter + 1);
+        mAnswerTimer.FireAtIfEarlier(stream->mStartTime);
+        ExitNow();
+    }
 
-    SuccessOrExit(Tlv::FindTlv(aAnswer, answerTlv));
-    isLast = answerTlv.IsLast();
+    SendNextAnswer(*stream);
 
 exit:
-    return isLast;
+    return;
 }
 
-void Server::FreeAllRelatedAnswers(Coap::Message &aFirstAnswer)
+void Server::HandleAnswerTimer(void)
 {
-    // This method dequeues and frees all answer messages related to
-    // same query as `aFirstAnswer`. Note that related answers are
-    // enqueued in order.
-
-    Coap::Message *answer = &aFirstAnswer;
+    TimeMilli now = TimerMilli::GetNow();
 
-    while (answer != nullptr)
+    for (AnswerStream &stream : mAnswerStreams)
     {
-        Coap::Message *next = IsLastAnswer(*answer) ? nullptr : answer->GetNextCoapMessage();
+        if (!stream.mInUse || !stream.mIsDelayed)
+        {
+            continue;
+        }
 
-        mAnswerQueue.DequeueAndFree(*answer);
-        answer = next;
+        if (stream.mStartTime <= now)
+        {
+            stream.mIsDelayed = false;
+            SendNextAnswer(stream);
+        }
+        else
+        {
+            mAnswerTimer.FireAtIfEarlier(stream.mStartTime);
+        }
     }
 }
 
-void Server::PrepareAndSendAnswers(const Ip6::Address &aDestination, const Message &aRequest)
+void Server::SendNextAnswer(AnswerStream &aStream)
 {
-    Coap::Message *answer;
-    Error          error;
-    AnswerInfo     info;
-    uint16_t       offset;
-    uint16_t       length;
-    uint16_t       endOffset;
-    AnswerTlv      answerTlv;
-
-    if (Tlv::Find<QueryIdTlv>(aRequest, info.mQueryId) == kErrorNone)
+    // Prepares and sends the next answer of `aStream`. Unless it is
+    // the last one, the stream is passed as the context of the
+    // response handler so that the following answer is prepared
+    // once this one is acknowledged.
+
+    Error            error  = kErrorNone;
+    Coap::Message   *answer = nullptr;
+    Tmf::MessageInfo messageInfo(GetInstance());
+    AnswerTlv        answerTlv;
+    bool             isLast;
+
+    answer = Get<Tmf::Agent>().NewConfirmablePostMessage(kUriDiagnosticGetAnswer);
+    VerifyOrExit(answer != nullptr, error = kErrorNoBufs);
+    IgnoreError(answer->SetPriority(aStream.mPriority));
+
+    if (aStream.mHasQueryId)
     {
-        info.mHasQueryId = true;
+        SuccessOrExit(error = Tlv::Append<QueryIdTlv>(*answer, aStream.mQueryId));
     }
 
-    info.mPriority = aRequest.GetPriority();
+    error = AppendAnswerTlvs(*answer, aStream);
+    VerifyOrExit((error == kErrorNone) || (error == kErrorPending));
+    isLast = (error == kErrorNone);
+
+    answerTlv.Init(aStream.mAnswerIndex++, isLast);
+    SuccessOrExit(error = answer->Append(answerTlv));
 
-    SuccessOrExit(error = AllocateAnswer(answer, info));
+    PrepareMessageInfoForDest(aStream.mDestination, messageInfo);
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffset(aRequest, Tlv::kTypeList, offset, length));
-    endOffset = offset + length;
+    SuccessOrExit(error = Get<Tmf::Agent>().SendMessage(*answer, messageInfo, HandleAnswerResponse,
+                                                        isLast ? nullptr : &aStream));
 
-    for (; offset < endOffset; offset++)
+    if (isLast)
     {
-        uint8_t tlvType;
+        aStream.mInUse = false;
+    }
 
-        SuccessOrExit(error = aRequest.Read(offset, tlvType));
+exit:
+    FreeMessageOnError(answer, error);
+
+    if (error != kErrorNone)
+    {
+        aStream.mInUse = false;
+    }
+}
+
+Error Server::AppendAnswerTlvs(Coap::Message &aAnswer, AnswerStream &aStream)
+{
+    // Appends the requested TLVs to `aAnswer`, continuing from the
+    // cursors of `aStream`, until the answer reaches its length
+    // threshold. Lists are split into several TLVs when they do not
+    // fit. Returns `kErrorPending` if more TLVs remain.
+
+    Error error = kErrorNone;
+
+    for (; aStream.mTlvIndex < aStream.mNumTlvTypes; aStream.mTlvIndex++)
+    {
+        uint8_t tlvType = aStream.mTlvTypes[aStream.mTlvIndex];
+
+        VerifyOrExit(HasAnswerSpace(aAnswer), error = kErrorPending);
 
         switch (tlvType)
         {
         case ChildTlv::kType:
-            SuccessOrExit(error = AppendChildTableAsChildTlvs(answer, info));
+            error = AppendChildTableAsChildTlvs(aAnswer, aStream.mEntryCursor);
             break;
         case ChildIp6AddressListTlv::kType:
-            SuccessOrExit(error = AppendChildTableIp6AddressList(answer, info));
+            error = AppendChildTableIp6AddressList(aAnswer, aStream.mEntryCursor);
             break;
         case RouterNeighborTlv::kType:
-            SuccessOrExit(error = AppendRouterNeighborTlvs(answer, info));
+            error = AppendRouterNeighborTlvs(aAnswer, aStream.mEntryCursor);
+            break;
+        case Tlv::kIp6AddressList:
+            error = AppendIp6AddressList(aAnswer, aStream.mEntryCursor, GetAnswerSpace(aAnswer, Ip6::Address::kSize));
+            break;
+        case Tlv::kChildTable:
+            error = AppendChildTable(aAnswer, aStream.mEntryCursor, GetAnswerSpace(aAnswer, sizeof(ChildTableEntry)));
             break;
         default:
-            SuccessOrExit(error = AppendDiagTlv(tlvType, *answer));
+            error = AppendDiagTlv(tlvType, aAnswer);
             break;
         }
 
-        SuccessOrExit(error = CheckAnswerLength(answer, info));
+        SuccessOrExit(error);
+        aStream.mEntryCursor = 0;
     }
 
-    answerTlv.Init(info.mAnswerIndex, /* aIsLast */ true);
-    SuccessOrExit(error = answer->Append(answerTlv));
-
-    SendNextAnswer(*info.mFirstAnswer, aDestination);
-
 exit:
-    if ((error != kErrorNone) && (info.mFirstAnswer != nullptr))
-    {
-        FreeAllRelatedAnswers(*info.mFirstAnswer);
-    }
+    return error;
 }
 
-Error Server::CheckAnswerLength(Coap::Message *&aAnswer, AnswerInfo &aInfo)
+bool Server::HasAnswerSpace(const Coap::Message &aAnswer)
 {
-    // This method checks the length of the `aAnswer` message and if it
-    // is above the threshold, it enqueues the message for transmission
-    // after appending an Answer TLV with the current index to the
-    // message. In this case, it will also allocate a new answer
-    // message.
-
-    Error     error = kErrorNone;
-    AnswerTlv answerTlv;
-
-    VerifyOrExit(aAnswer->GetLength() >= kAnswerMessageLengthThreshold);
-
-    answerTlv.Init(aInfo.mAnswerIndex++, /* aIsLast */ false);
-    SuccessOrExit(error = aAnswer->Append(answerTlv));
-
-    error = AllocateAnswer(aAnswer, aInfo);
-
-exit:
-    return error;
+    return aAnswer.GetLength() < kAnswerMessageLengthThreshold;
 }
 
-void Server::SendNextAnswer(Coap::Message &aAnswer, const Ip6::Address &aDestination)
+uint16_t Server::GetAnswerSpace(const Coap::Message &aAnswer, uint16_t aEntrySize)
 {
-    // This method send the given next `aAnswer` associated with
-    // a query to the  `aDestination`.
-
-    Error            error      = kErrorNone;
-    Coap::Message   *nextAnswer = IsLastAnswer(aAnswer) ? nullptr : aAnswer.GetNextCoapMessage();
-    Tmf::MessageInfo messageInfo(GetInstance());
-
-    mAnswerQueue.Dequeue(aAnswer);
-
-    PrepareMessageInfoForDest(aDestination, messageInfo);
-
-    // When sending the message, we pass `nextAnswer` as `aContext`
-    // to be used when invoking callback `HandleAnswerResponse()`.
-
-    error = Get<Tmf::Agent>().SendMessage(aAnswer, messageInfo, HandleAnswerResponse, nextAnswer);
-
-    if (error != kErrorNone)
-    {
-        // If the `SendMessage()` fails, we `Free` the dequeued
-        // `aAnswer` and all the related next answers in the queue.
+    // Returns the number of list entries of `aEntrySize` that fit in
+    // `aAnswer` before its length threshold (at least one).
 
-        aAnswer.Free();
+    uint16_t space = HasAnswerSpace(aAnswer) ? kAnswerMessageLengthThreshold - aAnswer.GetLength() : 0;
 
-        if (nextAnswer != nullptr)
-        {
-            FreeAllRelatedAnswers(*nextAnswer);
-        }
-    }
+    return Max<uint16_t>(space / aEntrySize, 1);
 }
 
 void Server::HandleAnswerResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, Error aResult)
 {
-    Coap::Message *nextAnswer = static_cast<Coap::Message *>(aContext);
+    AnswerStream *stream = static_cast<AnswerStream *>(aContext);
 
-    VerifyOrExit(nextAnswer != nullptr);
+    VerifyOrExit(stream != nullptr);
 
-    nextAnswer->Get<Server>().HandleAnswerResponse(*nextAnswer, AsCoapMessagePtr(aMessage), AsCoreTypePtr(aMessageInfo),
-                                                   aResult);
+    stream->Get<Server>().HandleAnswerResponse(*stream, AsCoapMessagePtr(aMessage), AsCoreTypePtr(aMessageInfo),
+                                               aResult);
 
 exit:
     return;
 }
 
-void Server::HandleAnswerResponse(Coap::Message          &aNextAnswer,
+void Server::HandleAnswerResponse(AnswerStream           &aStream,
                                   Coap::Message          *aResponse,
                                   const Ip6::MessageInfo *aMessageInfo,
                                   Error                   aResult)
@@ -659,80 +732,109 @@ void Server::HandleAnswerResponse(Coap::Message          &aNextAnswer,
     VerifyOrExit(aResponse != nullptr && aMessageInfo != nullptr, error = kErrorDrop);
     VerifyOrExit(aResponse->GetCode() == Coap::kCodeChanged, error = kErrorDrop);
 
-    SendNextAnswer(aNextAnswer, aMessageInfo->GetPeerAddr());
+    SendNextAnswer(aStream);
 
 exit:
     if (error != kErrorNone)
     {
-        FreeAllRelatedAnswers(aNextAnswer);
+        aStream.mInUse = false;
     }
 }
 
-Error Server::AppendChildTableAsChildTlvs(Coap::Message *&aAnswer, AnswerInfo &aInfo)
+Error Server::AppendChildTableAsChildTlvs(Coap::Message &aAnswer, uint16_t &aCursor)
 {
     Error    error = kErrorNone;
     ChildTlv childTlv;
 
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
     {
-        childTlv.InitFrom(child);
+        uint16_t childIndex = Get<ChildTable>().GetChildIndex(child);
 
-        SuccessOrExit(error = childTlv.AppendTo(*aAnswer));
-        SuccessOrExit(error = CheckAnswerLength(aAnswer, aInfo));
+        if (childIndex < aCursor)
+        {
+            continue;
+        }
+
+        if (!HasAnswerSpace(aAnswer))
+        {
+            aCursor = childIndex;
+            ExitNow(error = kErrorPending);
+        }
+
+        childTlv.InitFrom(child);
+        SuccessOrExit(error = childTlv.AppendTo(aAnswer));
     }
 
     // Add empty TLV to indicate end of the list
 
     childTlv.InitAsEmpty();
-    SuccessOrExit(error = childTlv.AppendTo(*aAnswer));
+    SuccessOrExit(error = childTlv.AppendTo(aAnswer));
 
 exit:
     return error;
 }
 
-Error Server::AppendRouterNeighborTlvs(Coap::Message *&aAnswer, AnswerInfo &aInfo)
+Error Server::AppendRouterNeighborTlvs(Coap::Message &aAnswer, uint16_t &aCursor)
 {
     Error             error = kErrorNone;
     RouterNeighborTlv neighborTlv;
 
-    for (Router &router : Get<RouterTable>())
+    for (uint16_t routerId = aCursor; routerId <= Mle::kMaxRouterId; routerId++)
     {
-        if (!router.IsStateValid())
+        const Router *router = Get<RouterTable>().FindRouterById(static_cast<uint8_t>(routerId));
+
+        if ((router == nullptr) || !router->IsStateValid())
         {
             continue;
         }
 
-        neighborTlv.InitFrom(router);
+        if (!HasAnswerSpace(aAnswer))
+        {
+            aCursor = routerId;
+            ExitNow(error = kErrorPending);
+        }
 
-        SuccessOrExit(error = neighborTlv.AppendTo(*aAnswer));
-        SuccessOrExit(error = CheckAnswerLength(aAnswer, aInfo));
+        neighborTlv.InitFrom(*router);
+        SuccessOrExit(error = neighborTlv.AppendTo(aAnswer));
     }
 
     // Add empty TLV to indicate end of the list
 
     neighborTlv.InitAsEmpty();
-    SuccessOrExit(error = neighborTlv.AppendTo(*aAnswer));
+    SuccessOrExit(error = neighborTlv.AppendTo(aAnswer));
 
 exit:
     return error;
 }
 
-Error Server::AppendChildTableIp6AddressList(Coap::Message *&aAnswer, AnswerInfo &aInfo)
+Error Server::AppendChildTableIp6AddressList(Coap::Message &aAnswer, uint16_t &aCursor)
 {
     Error error = kErrorNone;
     Tlv   tlv;
 
     for (const Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
     {
-        SuccessOrExit(error = AppendChildIp6AddressListTlv(*aAnswer, child));
-        SuccessOrExit(error = CheckAnswerLength(aAnswer, aInfo));
+        uint16_t childIndex = Get<ChildTable>().GetChildIndex(child);
+
+        if (childIndex < aCursor)
+        {
+            continue;
+        }
+
+        if (!HasAnswerSpace(aAnswer))
+        {
+            aCursor = childIndex;
+            ExitNow(error = kErrorPending);
+        }
+
+        SuccessOrExit(error = AppendChildIp6AddressListTlv(aAnswer, child));
     }
 
     // Add empty TLV to indicate end of the list
 
     tlv.SetType(Tlv::kChildIp6AddressList);
     tlv.SetLength(0);
-    SuccessOrExit(error = aAnswer->Append(tlv));
+    SuccessOrExit(error = aAnswer.Append(tlv));
 
 exit:
     return error;
@@ -885,6 +987,22 @@ exit:
     return error;
 }
 
+Error Client::SendDiagnosticQuery(const Ip6::Address &aDestination,
+                                  const uint8_t       aTlvTypes[],
+                                  uint8_t             aCount,
+                                  GetCallback         aCallback,
+                                  void               *aContext)
+{
+    Error error;
+
+    SuccessOrExit(error =
+                      SendCommand(kUriDiagnosticGetQuery, Message::kPriorityNormal, aDestination, aTlvTypes, aCount));
+    mGetCallback.Set(aCallback, aContext);
+
+exit:
+    return error;
+}
+
 Error Client::SendCommand(Uri                   aUri,
                           Message::Priority     aPriority,
                           const Ip6::Address   &aDestination,
@@ -1253,6 +1371,26 @@ exit:
     return error;
 }
 
+Error Client::GetAnswerInfo(const Coap::Message &aMessage, AnswerInfo &aAnswerInfo)
+{
+    Error     error;
+    AnswerTlv answerTlv;
+
+    SuccessOrExit(error = Tlv::FindTlv(aMessage, answerTlv));
+
+    aAnswerInfo.mIndex      = answerTlv.GetIndex();
+    aAnswerInfo.mIsLast     = answerTlv.IsLast();
+    aAnswerInfo.mHasQueryId = (Tlv::Find<QueryIdTlv>(aMessage, aAnswerInfo.mQueryId) == kErrorNone);
+
+    if (!aAnswerInfo.mHasQueryId)
+    {
+        aAnswerInfo.mQueryId = 0;
+    }
+
+exit:
+    return error;
+}
+
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_INFO)
 
 const char *Client::UriToString(Uri aUri)
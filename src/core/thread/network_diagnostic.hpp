@@ -41,6 +41,7 @@
 #include "common/callback.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/timer.hpp"
 #include "net/udp6.hpp"
 #include "thread/network_diagnostic_tlvs.hpp"
 #include "thread/tmf.hpp"
@@ -152,21 +153,38 @@ private:
     static constexpr uint16_t kAnswerMessageLengthThreshold = 800;
 
 #if OPENTHREAD_FTD
-    struct AnswerInfo
+    static constexpr uint8_t  kMaxAnswerStreams  = OPENTHREAD_CONFIG_NET_DIAG_MAX_ANSWER_STREAMS;
+    static constexpr uint8_t  kMaxQueryTlvTypes  = 32;
+    static constexpr uint32_t kQueryAnswerJitter = OPENTHREAD_CONFIG_NET_DIAG_QUERY_ANSWER_JITTER;
+
+    // Tracks the answers to a DIAG_GET.qry. Answers are prepared
+    // one at a time: the next one is built only once the previous
+    // one is acknowledged, continuing from `mTlvIndex` (the next
+    // requested TLV type) and `mEntryCursor` (the next entry when a
+    // list TLV did not fit in the previous answer). The first answer
+    // to a multicast query may be delayed until `mStartTime`.
+
+    class AnswerStream : public InstanceLocatorInit
     {
-        AnswerInfo(void)
-            : mAnswerIndex(0)
-            , mQueryId(0)
-            , mHasQueryId(false)
-            , mFirstAnswer(nullptr)
+    public:
+        void Init(Instance &aInstance)
         {
+            InstanceLocatorInit::Init(aInstance);
+            mInUse = false;
         }
 
-        uint16_t          mAnswerIndex;
-        uint16_t          mQueryId;
-        bool              mHasQueryId;
+        Ip6::Address      mDestination;
+        TimeMilli         mStartTime;
         Message::Priority mPriority;
-        Coap::Message    *mFirstAnswer;
+        bool              mInUse;
+        bool              mIsDelayed;
+        bool              mHasQueryId;
+        uint16_t          mQueryId;
+        uint16_t          mAnswerIndex;
+        uint16_t          mEntryCursor;
+        uint8_t           mTlvIndex;
+        uint8_t           mNumTlvTypes;
+        uint8_t           mTlvTypes[kMaxQueryTlvTypes];
     };
 #endif
 
@@ -175,7 +193,7 @@ private:
     static const char kVendorSwVersion[];
 
     Error AppendDiagTlv(uint8_t aTlvType, Message &aMessage);
-    Error AppendIp6AddressList(Message &aMessage);
+    Error AppendIp6AddressList(Message &aMessage, uint16_t &aCursor, uint16_t aMaxCount);
     Error AppendMacCounters(Message &aMessage);
     Error AppendRequestedTlvs(const Message &aRequest, Message &aResponse);
     void  PrepareMessageInfoForDest(const Ip6::Address &aDestination, Tmf::MessageInfo &aMessageInfo) const;
@@ -183,23 +201,24 @@ private:
 #if OPENTHREAD_MTD
     void SendAnswer(const Ip6::Address &aDestination, const Message &aRequest);
 #elif OPENTHREAD_FTD
-    Error       AllocateAnswer(Coap::Message *&aAnswer, AnswerInfo &aInfo);
-    Error       CheckAnswerLength(Coap::Message *&aAnswer, AnswerInfo &aInfo);
-    bool        IsLastAnswer(const Coap::Message &aAnswer) const;
-    void        FreeAllRelatedAnswers(Coap::Message &aFirstAnswer);
-    void        PrepareAndSendAnswers(const Ip6::Address &aDestination, const Message &aRequest);
-    void        SendNextAnswer(Coap::Message &aAnswer, const Ip6::Address &aDestination);
-    Error       AppendChildTable(Message &aMessage);
-    Error       AppendChildTableAsChildTlvs(Coap::Message *&aAnswer, AnswerInfo &aInfo);
-    Error       AppendRouterNeighborTlvs(Coap::Message *&aAnswer, AnswerInfo &aInfo);
-    Error       AppendChildTableIp6AddressList(Coap::Message *&aAnswer, AnswerInfo &aInfo);
-    Error       AppendChildIp6AddressListTlv(Coap::Message &aAnswer, const Child &aChild);
+    void  PrepareAndSendAnswers(const Ip6::Address &aDestination, const Message &aRequest, bool aIsMulticast);
+    void  HandleAnswerTimer(void);
+    void  SendNextAnswer(AnswerStream &aStream);
+    Error AppendAnswerTlvs(Coap::Message &aAnswer, AnswerStream &aStream);
+    Error AppendChildTable(Message &aMessage, uint16_t &aCursor, uint16_t aMaxCount);
+    Error AppendChildTableAsChildTlvs(Coap::Message &aAnswer, uint16_t &aCursor);
+    Error AppendRouterNeighborTlvs(Coap::Message &aAnswer, uint16_t &aCursor);
+    Error AppendChildTableIp6AddressList(Coap::Message &aAnswer, uint16_t &aCursor);
+    Error AppendChildIp6AddressListTlv(Coap::Message &aAnswer, const Child &aChild);
+
+    static bool     HasAnswerSpace(const Coap::Message &aAnswer);
+    static uint16_t GetAnswerSpace(const Coap::Message &aAnswer, uint16_t aEntrySize);
 
     static void HandleAnswerResponse(void                *aContext,
                                      otMessage           *aMessage,
                                      const otMessageInfo *aMessageInfo,
                                      Error                aResult);
-    void        HandleAnswerResponse(Coap::Message          &aNextAnswer,
+    void        HandleAnswerResponse(AnswerStream           &aStream,
                                      Coap::Message          *aResponse,
                                      const Ip6::MessageInfo *aMessageInfo,
                                      Error                   aResult);
@@ -216,7 +235,10 @@ private:
 #endif
 
 #if OPENTHREAD_FTD
-    Coap::MessageQueue mAnswerQueue;
+    using AnswerTimer = TimerMilliIn<Server, &Server::HandleAnswerTimer>;
+
+    AnswerStream mAnswerStreams[kMaxAnswerStreams];
+    AnswerTimer  mAnswerTimer;
 #endif
 };
 
@@ -240,6 +262,7 @@ public:
     typedef otNetworkDiagTlv               TlvInfo;     ///< Parse info from a Network Diagnostic TLV.
     typedef otNetworkDiagChildEntry        ChildInfo;   ///< Parsed info for child table entry.
     typedef otReceiveDiagnosticGetCallback GetCallback; ///< Diagnostic Get callback function pointer type.
+    typedef otNetworkDiagAnswerInfo        AnswerInfo;  ///< Position of an answer within the answers to a query.
 
     static constexpr Iterator kIteratorInit = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT; ///< Initializer for Iterator.
 
@@ -268,6 +291,22 @@ public:
                             GetCallback         aCallback,
                             void               *Context);
 
+    /**
+     * Sends Diagnostic Get query (DIAG_GET.qry) to a unicast or multicast destination.
+     *
+     * @param[in]  aDestination      The destination address.
+     * @param[in]  aTlvTypes         An array of Network Diagnostic TLV types.
+     * @param[in]  aCount            Number of types in @p aTlvTypes.
+     * @param[in]  aCallback         Callback when a Network Diagnostic Get answer is received (can be NULL).
+     * @param[in]  aContext          Application-specific context used with @p aCallback.
+     *
+     */
+    Error SendDiagnosticQuery(const Ip6::Address &aDestination,
+                              const uint8_t       aTlvTypes[],
+                              uint8_t             aCount,
+                              GetCallback         aCallback,
+                              void               *aContext);
+
     /**
      * Sends Diagnostic Reset request.
      *
@@ -292,6 +331,18 @@ public:
      */
     static Error GetNextDiagTlv(const Coap::Message &aMessage, Iterator &aIterator, TlvInfo &aTlvInfo);
 
+    /**
+     * Gets the answer information (Query ID, index and "IsLast" flag) of a given answer message.
+     *
+     * @param[in]  aMessage     The answer message.
+     * @param[out] aAnswerInfo  A reference to an `AnswerInfo` to output the information.
+     *
+     * @retval kErrorNone      Successfully read the answer information.
+     * @retval kErrorNotFound  @p aMessage contains no Answer TLV.
+     *
+     */
+    static Error GetAnswerInfo(const Coap::Message &aMessage, AnswerInfo &aAnswerInfo);
+
     /**
      * This method returns the query ID used for the last Network Diagnostic Query command.
      *
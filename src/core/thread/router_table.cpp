@@ -261,7 +261,27 @@ void RouterTable::RemoveRouterLink(Router &aRouter)
 
 const Router *RouterTable::FindRouter(const Router::AddressMatcher &aMatcher) const
 {
-    return mRouters.FindMatching(aMatcher);
+    const Router *router;
+
+    // Every entry in `mRouters` uses the RLOC16 of its Router ID, so
+    // a lookup by RLOC16 goes through `mRouterIdMap` instead of
+    // checking all entries.
+
+    if ((aMatcher.mShortAddress != Mac::kShortAddrInvalid) && (aMatcher.mExtAddress == nullptr))
+    {
+        router = FindRouterByRloc16(aMatcher.mShortAddress);
+
+        if ((router != nullptr) && !router->Matches(aMatcher))
+        {
+            router = nullptr;
+        }
+    }
+    else
+    {
+        router = mRouters.FindMatching(aMatcher);
+    }
+
+    return router;
 }
 
 Router *RouterTable::FindNeighbor(uint16_t aRloc16)
@@ -210,17 +210,88 @@ exit:
 
 Error SourceMatchController::AddPendingEntries(void)
 {
-    Error error = kErrorNone;
+    Error                    error = kErrorNone;
+    Batch<Mac::ShortAddress> shortBatch;
+    Batch<Mac::ExtAddress>   extBatch;
+
+    shortBatch.Clear();
+    extBatch.Clear();
 
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
     {
-        if (child.IsIndirectSourceMatchPending())
+        if (!child.IsIndirectSourceMatchPending())
+        {
+            continue;
+        }
+
+        if (child.IsIndirectSourceMatchShort())
         {
-            SuccessOrExit(error = AddAddress(child));
-            child.SetIndirectSourceMatchPending(false);
+            if (shortBatch.IsFull())
+            {
+                SuccessOrExit(error = AddBatch(shortBatch));
+            }
+
+            shortBatch.Add(child, child.GetRloc16());
+        }
+        else
+        {
+            Mac::ExtAddress address;
+
+            if (extBatch.IsFull())
+            {
+                SuccessOrExit(error = AddBatch(extBatch));
+            }
+
+            address.Set(child.GetExtAddress().m8, Mac::ExtAddress::kReverseByteOrder);
+            extBatch.Add(child, address);
         }
     }
 
+    SuccessOrExit(error = AddBatch(shortBatch));
+    error = AddBatch(extBatch);
+
+exit:
+    return error;
+}
+
+Error SourceMatchController::AddBatch(Batch<Mac::ShortAddress> &aBatch)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aBatch.mLength > 0);
+
+    error = Get<Radio>().AddSrcMatchShortEntries(aBatch.mAddresses, aBatch.mLength);
+    LogDebg("Adding %u short addrs -- %s (%d)", aBatch.mLength, ErrorToString(error), error);
+    SuccessOrExit(error);
+
+    for (uint8_t i = 0; i < aBatch.mLength; i++)
+    {
+        aBatch.mChildren[i]->SetIndirectSourceMatchPending(false);
+    }
+
+    aBatch.Clear();
+
+exit:
+    return error;
+}
+
+Error SourceMatchController::AddBatch(Batch<Mac::ExtAddress> &aBatch)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aBatch.mLength > 0);
+
+    error = Get<Radio>().AddSrcMatchExtEntries(aBatch.mAddresses, aBatch.mLength);
+    LogDebg("Adding %u addrs -- %s (%d)", aBatch.mLength, ErrorToString(error), error);
+    SuccessOrExit(error);
+
+    for (uint8_t i = 0; i < aBatch.mLength; i++)
+    {
+        aBatch.mChildren[i]->SetIndirectSourceMatchPending(false);
+    }
+
+    aBatch.Clear();
+
 exit:
     return error;
 }
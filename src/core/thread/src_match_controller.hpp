@@ -41,6 +41,7 @@
 #include "common/error.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "mac/mac_types.hpp"
 
 namespace ot {
 
@@ -180,12 +181,36 @@ private:
     /**
      * Adds all pending entries to the source match table.
      *
+     * The addresses are passed to the radio in batches. A child stays pending if its batch cannot be added.
+     *
      * @retval kErrorNone     All pending entries were successfully added.
      * @retval kErrorNoBufs   No available space in the source match table.
      *
      */
     Error AddPendingEntries(void);
 
+    static constexpr uint8_t kBatchSize = 8; // Max number of addresses passed to the radio at once.
+
+    template <typename AddressType> struct Batch
+    {
+        void Clear(void) { mLength = 0; }
+        bool IsFull(void) const { return (mLength == kBatchSize); }
+
+        void Add(Child &aChild, const AddressType &aAddress)
+        {
+            mChildren[mLength]  = &aChild;
+            mAddresses[mLength] = aAddress;
+            mLength++;
+        }
+
+        Child      *mChildren[kBatchSize];
+        AddressType mAddresses[kBatchSize];
+        uint8_t     mLength;
+    };
+
+    Error AddBatch(Batch<Mac::ShortAddress> &aBatch);
+    Error AddBatch(Batch<Mac::ExtAddress> &aBatch);
+
     bool mEnabled;
 };
 
@@ -45,7 +45,14 @@ namespace ot {
 void Neighbor::SetState(State aState)
 {
     VerifyOrExit(mState != aState);
+
+#if OPENTHREAD_FTD
+    Get<ChildTable>().RemoveFromIndex(*this);
+    mState = static_cast<uint8_t>(aState);
+    Get<ChildTable>().AddToIndex(*this);
+#else
     mState = static_cast<uint8_t>(aState);
+#endif
 
 #if OPENTHREAD_CONFIG_UPTIME_ENABLE
     if (mState == kStateValid)
@@ -111,6 +118,28 @@ void Neighbor::Info::SetFrom(const Neighbor &aNeighbor)
 #endif
 }
 
+void Neighbor::SetExtAddress(const Mac::ExtAddress &aAddress)
+{
+#if OPENTHREAD_FTD
+    Get<ChildTable>().RemoveFromIndex(*this);
+    mMacAddr = aAddress;
+    Get<ChildTable>().AddToIndex(*this);
+#else
+    mMacAddr = aAddress;
+#endif
+}
+
+void Neighbor::SetRloc16(uint16_t aRloc16)
+{
+#if OPENTHREAD_FTD
+    Get<ChildTable>().RemoveFromIndex(*this);
+    mRloc16 = aRloc16;
+    Get<ChildTable>().AddToIndex(*this);
+#else
+    mRloc16 = aRloc16;
+#endif
+}
+
 void Neighbor::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
@@ -275,6 +304,8 @@ void Child::Info::SetFrom(const Child &aChild)
     mFrameErrorRate      = aChild.GetLinkInfo().GetFrameErrorRate();
     mMessageErrorRate    = aChild.GetLinkInfo().GetMessageErrorRate();
     mQueuedMessageCnt    = aChild.GetIndirectMessageCount();
+    mMaxQueuedMessageCnt = aChild.GetMaxIndirectMessageCount();
+    mQueuedMessageAge    = aChild.Get<IndirectSender>().GetIndirectMessageAge(aChild);
     mVersion             = ClampToUint8(aChild.GetVersion());
     mRxOnWhenIdle        = aChild.IsRxOnWhenIdle();
     mFullThreadDevice    = aChild.IsFullThreadDevice();
@@ -328,6 +359,9 @@ void Child::Clear(void)
 {
     Instance &instance = GetInstance();
 
+#if OPENTHREAD_FTD
+    Get<ChildTable>().RemoveFromIndex(*this);
+#endif
     memset(reinterpret_cast<void *>(this), 0, sizeof(Child));
     Init(instance);
 }
@@ -340,6 +374,8 @@ void Child::ClearIp6Addresses(void)
     mMlrToRegisterMask.Clear();
     mMlrRegisteredMask.Clear();
 #endif
+
+    Get<ChildTable>().MarkMulticastFilterStale();
 }
 
 void Child::SetDeviceMode(Mle::DeviceMode aMode)
@@ -386,6 +422,12 @@ Error Child::AddIp6Address(const Ip6::Address &aAddress)
         if (ip6Address.IsUnspecified())
         {
             ip6Address = aAddress;
+
+            if (aAddress.IsMulticast())
+            {
+                Get<ChildTable>().MarkMulticastFilterStale();
+            }
+
             ExitNow();
         }
 
@@ -436,6 +478,11 @@ Error Child::RemoveIp6Address(const Ip6::Address &aAddress)
 
     mIp6Address[kNumIp6Addresses - 1].Clear();
 
+    if (aAddress.IsMulticast())
+    {
+        Get<ChildTable>().MarkMulticastFilterStale();
+    }
+
 exit:
     return error;
 }
@@ -183,6 +183,9 @@ public:
         bool Matches(const Neighbor &aNeighbor) const;
 
     private:
+        friend class ChildTable;
+        friend class RouterTable;
+
         AddressMatcher(StateFilter aStateFilter, Mac::ShortAddress aShortAddress, const Mac::ExtAddress *aExtAddress)
             : mStateFilter(aStateFilter)
             , mShortAddress(aShortAddress)
@@ -372,21 +375,13 @@ public:
      */
     const Mac::ExtAddress &GetExtAddress(void) const { return mMacAddr; }
 
-    /**
-     * Returns the Extended Address.
-     *
-     * @returns A reference to the Extended Address.
-     *
-     */
-    Mac::ExtAddress &GetExtAddress(void) { return mMacAddr; }
-
     /**
      * Sets the Extended Address.
      *
      * @param[in]  aAddress  The Extended Address value to set.
      *
      */
-    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+    void SetExtAddress(const Mac::ExtAddress &aAddress);
 
     /**
      * Gets the key sequence value.
@@ -499,7 +494,7 @@ public:
      * @param[in]  aRloc16  The RLOC16 value.
      *
      */
-    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+    void SetRloc16(uint16_t aRloc16);
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
@@ -1346,6 +1341,13 @@ private:
     uint16_t mSupervisionInterval;     // Supervision interval for the child (in sec).
     uint16_t mSecondsSinceSupervision; // Number of seconds since last supervision of the child.
 
+#if OPENTHREAD_FTD
+    friend class ChildTable;
+
+    Child *mNextByExtAddress; // Next child in the same `ChildTable` extended address hash bucket.
+    Child *mNextByRloc16;     // Next child in the same `ChildTable` RLOC16 hash bucket.
+#endif
+
     static_assert(OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS < 8192, "mQueuedMessageCount cannot fit max required!");
 };
 
@@ -53,6 +53,10 @@ namespace Utils {
 
 HistoryTracker::HistoryTracker(Instance &aInstance)
     : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+    , mRxHistory(mRxHistoryBuffer, sizeof(mRxHistoryBuffer), /* aIsTx */ false)
+    , mTxHistory(mTxHistoryBuffer, sizeof(mTxHistoryBuffer), /* aIsTx */ true)
+#endif
     , mTimer(aInstance)
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_NET_DATA
     , mPreviousNetworkData(aInstance, mNetworkDataTlvBuffer, 0, sizeof(mNetworkDataTlvBuffer))
@@ -84,9 +88,10 @@ exit:
 
 void HistoryTracker::RecordMessage(const Message &aMessage, const Mac::Address &aMacAddress, MessageType aType)
 {
-    MessageInfo *entry = nullptr;
+    MessageInfo  info;
     Ip6::Headers headers;
 
+    VerifyOrExit((aType == kRxMessage) ? (kRxListSize > 0) : (kTxListSize > 0));
     VerifyOrExit(aMessage.GetType() == Message::kTypeIp6);
 
     SuccessOrExit(headers.ParseFrom(aMessage));
@@ -111,32 +116,21 @@ void HistoryTracker::RecordMessage(const Message &aMessage, const Mac::Address &
     }
 #endif
 
-    switch (aType)
-    {
-    case kRxMessage:
-        entry = mRxHistory.AddNewEntry();
-        break;
-
-    case kTxMessage:
-        entry = mTxHistory.AddNewEntry();
-        break;
-    }
-
-    VerifyOrExit(entry != nullptr);
-
-    entry->mPayloadLength        = headers.GetIp6Header().GetPayloadLength();
-    entry->mNeighborRloc16       = aMacAddress.IsShort() ? aMacAddress.GetShort() : kInvalidRloc16;
-    entry->mSource.mAddress      = headers.GetSourceAddress();
-    entry->mSource.mPort         = headers.GetSourcePort();
-    entry->mDestination.mAddress = headers.GetDestinationAddress();
-    entry->mDestination.mPort    = headers.GetDestinationPort();
-    entry->mChecksum             = headers.GetChecksum();
-    entry->mIpProto              = headers.GetIpProto();
-    entry->mIcmp6Type            = headers.IsIcmp6() ? headers.GetIcmpHeader().GetType() : 0;
-    entry->mAveRxRss             = (aType == kRxMessage) ? aMessage.GetRssAverager().GetAverage() : Radio::kInvalidRssi;
-    entry->mLinkSecurity         = aMessage.IsLinkSecurityEnabled();
-    entry->mTxSuccess            = (aType == kTxMessage) ? aMessage.GetTxSuccess() : true;
-    entry->mPriority             = aMessage.GetPriority();
+    memset(&info, 0, sizeof(info));
+
+    info.mPayloadLength        = headers.GetIp6Header().GetPayloadLength();
+    info.mNeighborRloc16       = aMacAddress.IsShort() ? aMacAddress.GetShort() : kInvalidRloc16;
+    info.mSource.mAddress      = headers.GetSourceAddress();
+    info.mSource.mPort         = headers.GetSourcePort();
+    info.mDestination.mAddress = headers.GetDestinationAddress();
+    info.mDestination.mPort    = headers.GetDestinationPort();
+    info.mChecksum             = headers.GetChecksum();
+    info.mIpProto              = headers.GetIpProto();
+    info.mIcmp6Type            = headers.IsIcmp6() ? headers.GetIcmpHeader().GetType() : 0;
+    info.mAveRxRss             = (aType == kRxMessage) ? aMessage.GetRssAverager().GetAverage() : Radio::kInvalidRssi;
+    info.mLinkSecurity         = aMessage.IsLinkSecurityEnabled();
+    info.mTxSuccess            = (aType == kTxMessage) ? aMessage.GetTxSuccess() : true;
+    info.mPriority             = aMessage.GetPriority();
 
     if (aMacAddress.IsExtended())
     {
@@ -144,7 +138,7 @@ void HistoryTracker::RecordMessage(const Message &aMessage, const Mac::Address &
 
         if (neighbor != nullptr)
         {
-            entry->mNeighborRloc16 = neighbor->GetRloc16();
+            info.mNeighborRloc16 = neighbor->GetRloc16();
         }
     }
 
@@ -155,12 +149,12 @@ void HistoryTracker::RecordMessage(const Message &aMessage, const Mac::Address &
         {
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
         case Mac::kRadioTypeIeee802154:
-            entry->mRadioIeee802154 = true;
+            info.mRadioIeee802154 = true;
             break;
 #endif
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
         case Mac::kRadioTypeTrel:
-            entry->mRadioTrelUdp6 = true;
+            info.mRadioTrelUdp6 = true;
             break;
 #endif
         }
@@ -174,11 +168,32 @@ void HistoryTracker::RecordMessage(const Message &aMessage, const Mac::Address &
 #endif // OPENTHREAD_CONFIG_MULTI_RADIO
     {
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
-        entry->mRadioIeee802154 = true;
+        info.mRadioIeee802154 = true;
 #endif
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
-        entry->mRadioTrelUdp6 = true;
+        info.mRadioTrelUdp6 = true;
+#endif
+    }
+
+    switch (aType)
+    {
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+    case kRxMessage:
+        mRxHistory.Add(info);
+        break;
+
+    case kTxMessage:
+        mTxHistory.Add(info);
+        break;
+#else
+    case kRxMessage:
+        AddMessageEntry(mRxHistory, info, /* aIsTx */ false);
+        break;
+
+    case kTxMessage:
+        AddMessageEntry(mTxHistory, info, /* aIsTx */ true);
+        break;
 #endif
     }
 
@@ -186,6 +201,87 @@ exit:
     return;
 }
 
+void HistoryTracker::SetMessageSpillCallback(otHistoryTrackerMessageSpillCallback aCallback, void *aContext)
+{
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+    mRxHistory.SetSpillCallback(aCallback, aContext);
+    mTxHistory.SetSpillCallback(aCallback, aContext);
+#else
+    mMessageSpillCallback.Set(aCallback, aContext);
+#endif
+}
+
+const HistoryTracker::MessageInfo *HistoryTracker::QueryRxHistory(Iterator            &aIterator,
+                                                                  const MessageFilter &aFilter,
+                                                                  uint32_t            &aEntryAge)
+{
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+    return mRxHistory.Read(aIterator, &aFilter, aEntryAge);
+#else
+    return QueryMessageList(mRxHistory, aIterator, aFilter, aEntryAge);
+#endif
+}
+
+const HistoryTracker::MessageInfo *HistoryTracker::QueryTxHistory(Iterator            &aIterator,
+                                                                  const MessageFilter &aFilter,
+                                                                  uint32_t            &aEntryAge)
+{
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+    return mTxHistory.Read(aIterator, &aFilter, aEntryAge);
+#else
+    return QueryMessageList(mTxHistory, aIterator, aFilter, aEntryAge);
+#endif
+}
+
+#if !OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+
+template <uint16_t kListSize>
+void HistoryTracker::AddMessageEntry(EntryList<MessageInfo, kListSize> &aList, const MessageInfo &aInfo, bool aIsTx)
+{
+    if (mMessageSpillCallback.IsSet())
+    {
+        uint32_t           age;
+        const MessageInfo *oldest = aList.GetOldestIfFull(age);
+
+        if (oldest != nullptr)
+        {
+            mMessageSpillCallback.Invoke(oldest, aIsTx, age);
+        }
+    }
+
+    aList.AddNewEntry(aInfo);
+}
+
+template <uint16_t kListSize>
+const HistoryTracker::MessageInfo *HistoryTracker::QueryMessageList(const EntryList<MessageInfo, kListSize> &aList,
+                                                                    Iterator                                &aIterator,
+                                                                    const MessageFilter                     &aFilter,
+                                                                    uint32_t                                &aEntryAge)
+{
+    // Entries are iterated from newest to oldest, so we can stop at
+    // the first entry older than the filter's max age.
+
+    const MessageInfo *entry;
+
+    while ((entry = aList.Iterate(aIterator, aEntryAge)) != nullptr)
+    {
+        if (aEntryAge > aFilter.mMaxAge)
+        {
+            entry = nullptr;
+            break;
+        }
+
+        if (!aFilter.mMatchNeighbor || (entry->mNeighborRloc16 == aFilter.mNeighborRloc16))
+        {
+            break;
+        }
+    }
+
+    return entry;
+}
+
+#endif // !OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+
 void HistoryTracker::RecordNeighborEvent(NeighborTable::Event aEvent, const NeighborTable::EntryInfo &aInfo)
 {
     NeighborInfo *entry = mNeighborHistory.AddNewEntry();
@@ -560,6 +656,22 @@ exit:
     return error;
 }
 
+Error HistoryTracker::List::GetOldestIfFull(uint16_t        aMaxSize,
+                                            const Timestamp aTimestamps[],
+                                            uint16_t       &aListIndex,
+                                            uint32_t       &aEntryAge) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit((mSize > 0) && (mSize == aMaxSize), error = kErrorNotFound);
+
+    aListIndex = MapEntryNumberToListIndex(mSize - 1, aMaxSize);
+    aEntryAge  = aTimestamps[aListIndex].GetDurationTill(TimerMilli::GetNow());
+
+exit:
+    return error;
+}
+
 uint16_t HistoryTracker::List::MapEntryNumberToListIndex(uint16_t aEntryNumber, uint16_t aMaxSize) const
 {
     // Map the `aEntryNumber` to the list index. `aEntryNumber` value
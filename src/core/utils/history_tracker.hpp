@@ -42,6 +42,7 @@
 #include <openthread/platform/radio.h>
 
 #include "common/as_core_type.hpp"
+#include "common/callback.hpp"
 #include "common/clearable.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -55,6 +56,7 @@
 #include "thread/neighbor_table.hpp"
 #include "thread/network_data.hpp"
 #include "thread/router_table.hpp"
+#include "utils/message_history_log.hpp"
 
 namespace ot {
 namespace Utils {
@@ -122,9 +124,12 @@ public:
          * the beginning of the list.
          *
          */
-        void Init(void) { ResetEntryNumber(), SetInitTime(); }
+        void Init(void) { ResetEntryNumber(), SetInitTime(), ResetCursor(); }
 
     private:
+        static constexpr uint16_t kNoCursor = 0xffff; // Not yet used with a compact message list.
+
+        void      ResetCursor(void) { mCursorOffset = kNoCursor; }
         uint16_t  GetEntryNumber(void) const { return mData16; }
         void      ResetEntryNumber(void) { mData16 = 0; }
         void      IncrementEntryNumber(void) { mData16++; }
@@ -136,6 +141,7 @@ public:
     typedef otHistoryTrackerUnicastAddressInfo   UnicastAddressInfo;   ///< Unicast IPv6 address info.
     typedef otHistoryTrackerMulticastAddressInfo MulticastAddressInfo; ///< Multicast IPv6 address info.
     typedef otHistoryTrackerMessageInfo          MessageInfo;          ///< RX/TX IPv6 message info.
+    typedef otHistoryTrackerMessageFilter        MessageFilter;        ///< RX/TX IPv6 message filter.
     typedef otHistoryTrackerNeighborInfo         NeighborInfo;         ///< Neighbor info.
     typedef otHistoryTrackerRouterInfo           RouterInfo;           ///< Router info.
     typedef otHistoryTrackerOnMeshPrefixInfo     OnMeshPrefixInfo;     ///< Network Data on mesh prefix info.
@@ -212,9 +218,13 @@ public:
      * @returns A pointer to `MessageInfo` entry or `nullptr` if no more entries in the list.
      *
      */
-    const MessageInfo *IterateRxHistory(Iterator &aIterator, uint32_t &aEntryAge) const
+    const MessageInfo *IterateRxHistory(Iterator &aIterator, uint32_t &aEntryAge)
     {
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+        return mRxHistory.Read(aIterator, nullptr, aEntryAge);
+#else
         return mRxHistory.Iterate(aIterator, aEntryAge);
+#endif
     }
 
     /**
@@ -229,11 +239,52 @@ public:
      * @returns A pointer to `MessageInfo` entry or `nullptr` if no more entries in the list.
      *
      */
-    const MessageInfo *IterateTxHistory(Iterator &aIterator, uint32_t &aEntryAge) const
+    const MessageInfo *IterateTxHistory(Iterator &aIterator, uint32_t &aEntryAge)
     {
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+        return mTxHistory.Read(aIterator, nullptr, aEntryAge);
+#else
         return mTxHistory.Iterate(aIterator, aEntryAge);
+#endif
     }
 
+    /**
+     * Iterates over the entries in the RX history list which match a given filter.
+     *
+     * The iteration ends at the first entry older than `mMaxAge` of @p aFilter.
+     *
+     * @param[in,out] aIterator  An iterator. MUST be initialized.
+     * @param[in]     aFilter    The filter. The same filter MUST be used for all calls with @p aIterator.
+     * @param[out]    aEntryAge  A reference to a variable to output the entry's age.
+     *
+     * @returns A pointer to `MessageInfo` entry or `nullptr` if no more matching entries in the list.
+     *
+     */
+    const MessageInfo *QueryRxHistory(Iterator &aIterator, const MessageFilter &aFilter, uint32_t &aEntryAge);
+
+    /**
+     * Iterates over the entries in the TX history list which match a given filter.
+     *
+     * The iteration ends at the first entry older than `mMaxAge` of @p aFilter.
+     *
+     * @param[in,out] aIterator  An iterator. MUST be initialized.
+     * @param[in]     aFilter    The filter. The same filter MUST be used for all calls with @p aIterator.
+     * @param[out]    aEntryAge  A reference to a variable to output the entry's age.
+     *
+     * @returns A pointer to `MessageInfo` entry or `nullptr` if no more matching entries in the list.
+     *
+     */
+    const MessageInfo *QueryTxHistory(Iterator &aIterator, const MessageFilter &aFilter, uint32_t &aEntryAge);
+
+    /**
+     * Sets the callback invoked with the oldest RX or TX history entry when it is dropped to make room for a new one.
+     *
+     * @param[in] aCallback  The callback (can be `nullptr`).
+     * @param[in] aContext   An arbitrary context used with @p aCallback.
+     *
+     */
+    void SetMessageSpillCallback(otHistoryTrackerMessageSpillCallback aCallback, void *aContext);
+
     const NeighborInfo *IterateNeighborHistory(Iterator &aIterator, uint32_t &aEntryAge) const
     {
         return mNeighborHistory.Iterate(aIterator, aEntryAge);
@@ -282,6 +333,16 @@ private:
     static constexpr uint16_t kMulticastAddrListSize = OPENTHREAD_CONFIG_HISTORY_TRACKER_MULTICAST_ADDRESS_LIST_SIZE;
     static constexpr uint16_t kRxListSize            = OPENTHREAD_CONFIG_HISTORY_TRACKER_RX_LIST_SIZE;
     static constexpr uint16_t kTxListSize            = OPENTHREAD_CONFIG_HISTORY_TRACKER_TX_LIST_SIZE;
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+    static constexpr uint16_t kRxBufferSize = OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_RX_BUFFER_SIZE;
+    static constexpr uint16_t kTxBufferSize = OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_TX_BUFFER_SIZE;
+
+    static_assert(kRxBufferSize >= MessageHistoryLog::kMinBufferSize, "COMPACT_RX_BUFFER_SIZE is too small");
+    static_assert(kRxBufferSize <= MessageHistoryLog::kMaxBufferSize, "COMPACT_RX_BUFFER_SIZE is too large");
+    static_assert(kTxBufferSize >= MessageHistoryLog::kMinBufferSize, "COMPACT_TX_BUFFER_SIZE is too small");
+    static_assert(kTxBufferSize <= MessageHistoryLog::kMaxBufferSize, "COMPACT_TX_BUFFER_SIZE is too large");
+    static_assert(Iterator::kNoCursor == MessageHistoryLog::kCursorNotStarted, "kNoCursor does not match");
+#endif
     static constexpr uint16_t kNeighborListSize      = OPENTHREAD_CONFIG_HISTORY_TRACKER_NEIGHBOR_LIST_SIZE;
     static constexpr uint16_t kRouterListSize        = OPENTHREAD_CONFIG_HISTORY_TRACKER_ROUTER_LIST_SIZE;
     static constexpr uint16_t kOnMeshPrefixListSize  = OPENTHREAD_CONFIG_HISTORY_TRACKER_ON_MESH_PREFIX_LIST_SIZE;
@@ -339,6 +400,10 @@ private:
         uint16_t Add(uint16_t aMaxSize, Timestamp aTimestamps[]);
         void     UpdateAgedEntries(uint16_t aMaxSize, Timestamp aTimestamps[]);
         uint16_t MapEntryNumberToListIndex(uint16_t aEntryNumber, uint16_t aMaxSize) const;
+        Error    GetOldestIfFull(uint16_t        aMaxSize,
+                                 const Timestamp aTimestamps[],
+                                 uint16_t       &aListIndex,
+                                 uint32_t       &aEntryAge) const;
         Error    Iterate(uint16_t        aMaxSize,
                          const Timestamp aTimestamps[],
                          Iterator       &aIterator,
@@ -363,6 +428,16 @@ private:
 
         void UpdateAgedEntries(void) { List::UpdateAgedEntries(kMaxSize, mTimestamps); }
 
+        // Returns the oldest entry if the list is full, i.e., the
+        // entry to be overwritten by the next `AddNewEntry()`.
+        const Entry *GetOldestIfFull(uint32_t &aEntryAge) const
+        {
+            uint16_t index;
+
+            return (List::GetOldestIfFull(kMaxSize, mTimestamps, index, aEntryAge) == kErrorNone) ? &mEntries[index]
+                                                                                                   : nullptr;
+        }
+
         const Entry *Iterate(Iterator &aIterator, uint32_t &aEntryAge) const
         {
             uint16_t index;
@@ -385,7 +460,8 @@ private:
         Entry       *AddNewEntry(void) { return nullptr; }
         void         AddNewEntry(const Entry &) {}
         const Entry *Iterate(Iterator &, uint32_t &) const { return nullptr; }
-        void         RemoveAgedEntries(void) {}
+        const Entry *GetOldestIfFull(uint32_t &) const { return nullptr; }
+        void         UpdateAgedEntries(void) {}
     };
 
     enum MessageType : uint8_t
@@ -404,6 +480,17 @@ private:
         RecordMessage(aMessage, aMacDest, kTxMessage);
     }
 
+#if !OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+    template <uint16_t kListSize>
+    void AddMessageEntry(EntryList<MessageInfo, kListSize> &aList, const MessageInfo &aInfo, bool aIsTx);
+
+    template <uint16_t kListSize>
+    static const MessageInfo *QueryMessageList(const EntryList<MessageInfo, kListSize> &aList,
+                                               Iterator                                &aIterator,
+                                               const MessageFilter                     &aFilter,
+                                               uint32_t                                &aEntryAge);
+#endif
+
     void RecordNetworkInfo(void);
     void RecordMessage(const Message &aMessage, const Mac::Address &aMacAddress, MessageType aType);
     void RecordNeighborEvent(NeighborTable::Event aEvent, const NeighborTable::EntryInfo &aInfo);
@@ -427,8 +514,14 @@ private:
     EntryList<NetworkInfo, kNetInfoListSize>                mNetInfoHistory;
     EntryList<UnicastAddressInfo, kUnicastAddrListSize>     mUnicastAddressHistory;
     EntryList<MulticastAddressInfo, kMulticastAddrListSize> mMulticastAddressHistory;
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+    MessageHistoryLog mRxHistory;
+    MessageHistoryLog mTxHistory;
+#else
     EntryList<MessageInfo, kRxListSize>                     mRxHistory;
     EntryList<MessageInfo, kTxListSize>                     mTxHistory;
+    Callback<otHistoryTrackerMessageSpillCallback>          mMessageSpillCallback;
+#endif
     EntryList<NeighborInfo, kNeighborListSize>              mNeighborHistory;
     EntryList<RouterInfo, kRouterListSize>                  mRouterHistory;
     EntryList<OnMeshPrefixInfo, kOnMeshPrefixListSize>      mOnMeshPrefixHistory;
@@ -452,6 +545,11 @@ private:
 
     uint8_t mNetworkDataTlvBuffer[NetworkData::NetworkData::kMaxSize];
 #endif
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+    uint8_t mRxHistoryBuffer[kRxBufferSize];
+    uint8_t mTxHistoryBuffer[kTxBufferSize];
+#endif
 };
 
 } // namespace Utils
@@ -459,6 +557,7 @@ private:
 DefineCoreType(otHistoryTrackerIterator, Utils::HistoryTracker::Iterator);
 DefineCoreType(otHistoryTrackerNetworkInfo, Utils::HistoryTracker::NetworkInfo);
 DefineCoreType(otHistoryTrackerMessageInfo, Utils::HistoryTracker::MessageInfo);
+DefineCoreType(otHistoryTrackerMessageFilter, Utils::HistoryTracker::MessageFilter);
 DefineCoreType(otHistoryTrackerNeighborInfo, Utils::HistoryTracker::NeighborInfo);
 DefineCoreType(otHistoryTrackerRouterInfo, Utils::HistoryTracker::RouterInfo);
 DefineCoreType(otHistoryTrackerOnMeshPrefixInfo, Utils::HistoryTracker::OnMeshPrefixInfo);
@@ -0,0 +1,199 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the Latency Tracer module.
+ */
+
+#include "latency_tracer.hpp"
+
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+
+#include "common/code_utils.hpp"
+#include "common/num_utils.hpp"
+#include "common/timer.hpp"
+
+namespace ot {
+namespace Utils {
+
+LatencyTracer::LatencyTracer(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mSampleInterval(OPENTHREAD_CONFIG_LATENCY_TRACER_DEFAULT_SAMPLE_INTERVAL)
+    , mSampleCounter(0)
+    , mTxFrameTraced(false)
+    , mTxFrameStarted(false)
+    , mTxFrameTime(0)
+{
+    ResetStats();
+}
+
+void LatencyTracer::SetSampleInterval(uint16_t aInterval)
+{
+    mSampleInterval = aInterval;
+    mSampleCounter  = 0;
+}
+
+void LatencyTracer::ResetStats(void)
+{
+    mNumTracedMessages = 0;
+
+    for (StageStats &stats : mStageStats)
+    {
+        stats.Clear();
+    }
+}
+
+uint32_t LatencyTracer::GetNow(void)
+{
+    // Latencies are kept in microseconds. Without a microsecond
+    // timer the millisecond clock is used (the product wraps like
+    // a 32-bit microsecond clock, so differences remain valid).
+
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    return TimerMicro::GetNow().GetValue();
+#else
+    return TimerMilli::GetNow().GetValue() * 1000u;
+#endif
+}
+
+void LatencyTracer::Start(Message &aMessage)
+{
+    VerifyOrExit(mSampleInterval != 0);
+    VerifyOrExit(!aMessage.IsTraced());
+
+    if (++mSampleCounter < mSampleInterval)
+    {
+        ExitNow();
+    }
+
+    mSampleCounter = 0;
+    mNumTracedMessages++;
+
+    aMessage.SetTraced(true);
+    aMessage.SetTraceTime(GetNow());
+
+exit:
+    return;
+}
+
+void LatencyTracer::HandleEnqueue(Message &aMessage)
+{
+    if (aMessage.IsTraced())
+    {
+        Mark(aMessage, kStageEnqueue);
+    }
+    else
+    {
+        Start(aMessage);
+    }
+}
+
+void LatencyTracer::Mark(Message &aMessage, Stage aStage)
+{
+    uint32_t now;
+
+    VerifyOrExit(aMessage.IsTraced());
+
+    now = GetNow();
+    Record(aStage, now - aMessage.GetTraceTime());
+    aMessage.SetTraceTime(now);
+
+exit:
+    return;
+}
+
+void LatencyTracer::HandleFramePrepared(Message &aMessage)
+{
+    mTxFrameStarted = false;
+    mTxFrameTraced  = aMessage.IsTraced();
+
+    VerifyOrExit(mTxFrameTraced);
+
+    Mark(aMessage, kStageFramePrepared);
+    mTxFrameTime = aMessage.GetTraceTime();
+
+exit:
+    return;
+}
+
+void LatencyTracer::HandleRadioTxStart(void)
+{
+    uint32_t now;
+
+    VerifyOrExit(mTxFrameTraced && !mTxFrameStarted);
+
+    now = GetNow();
+    Record(kStageRadioStart, now - mTxFrameTime);
+    mTxFrameTime    = now;
+    mTxFrameStarted = true;
+
+exit:
+    return;
+}
+
+void LatencyTracer::HandleFrameSent(Message *aMessage)
+{
+    uint32_t now;
+
+    VerifyOrExit(mTxFrameTraced && (aMessage != nullptr) && aMessage->IsTraced());
+
+    // The frame may not have reached the radio (e.g. tx aborted),
+    // then the latency is counted from the frame preparation.
+
+    now = GetNow();
+    Record(kStageTxDone, now - (mTxFrameStarted ? mTxFrameTime : aMessage->GetTraceTime()));
+    aMessage->SetTraceTime(now);
+
+exit:
+    mTxFrameTraced  = false;
+    mTxFrameStarted = false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// LatencyTracer::StageStats
+
+void LatencyTracer::StageStats::Record(uint32_t aLatency)
+{
+    uint8_t bin = 0;
+
+    for (uint32_t value = aLatency >> kMinBinShift; value != 0; value >>= 1)
+    {
+        bin++;
+    }
+
+    mHistogram[Min<uint8_t>(bin, OT_TRACE_HISTOGRAM_NUM_BINS - 1)]++;
+    mCount++;
+    mTotalLatency += aLatency;
+    mMaxLatency = Max(mMaxLatency, aLatency);
+}
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
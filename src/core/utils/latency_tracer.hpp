@@ -0,0 +1,218 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the Latency Tracer module.
+ */
+
+#ifndef LATENCY_TRACER_HPP_
+#define LATENCY_TRACER_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+
+#include <openthread/trace.h>
+
+#include "common/clearable.hpp"
+#include "common/locator.hpp"
+#include "common/message.hpp"
+#include "common/non_copyable.hpp"
+
+namespace ot {
+namespace Utils {
+
+/**
+ * Implements the hop-by-hop Latency Tracer.
+ *
+ * A sampled message is marked as traced and carries the time at which it reached its latest stage. Each following
+ * stage records the time elapsed since then into the latency statistics of the stage. Radio start and tx done are
+ * frame events, which are tracked for the single frame the MAC is transmitting on behalf of `MeshForwarder`.
+ *
+ */
+class LatencyTracer : public InstanceLocator, private NonCopyable
+{
+public:
+    /**
+     * Represents a trace stage.
+     *
+     */
+    enum Stage : uint8_t
+    {
+        kStageEnqueue       = OT_TRACE_STAGE_ENQUEUE,        ///< Added to the send queue.
+        kStageRouteResolved = OT_TRACE_STAGE_ROUTE_RESOLVED, ///< Next hop resolved.
+        kStageFramePrepared = OT_TRACE_STAGE_FRAME_PREPARED, ///< Frame prepared.
+        kStageRadioStart    = OT_TRACE_STAGE_RADIO_START,    ///< Frame handed to the radio.
+        kStageTxDone        = OT_TRACE_STAGE_TX_DONE,        ///< Frame tx done.
+        kStageRx            = OT_TRACE_STAGE_RX,             ///< Frame received.
+        kStageReassembled   = OT_TRACE_STAGE_REASSEMBLED,    ///< Message reassembled.
+        kStageDelivered     = OT_TRACE_STAGE_DELIVERED,      ///< Message delivered.
+    };
+
+    static constexpr uint8_t kNumStages = OT_TRACE_NUM_STAGES; ///< Number of stages.
+
+    /**
+     * Represents the latency statistics of a stage.
+     *
+     */
+    class StageStats : public otTraceStageStats, public Clearable<StageStats>
+    {
+    public:
+        /**
+         * Records a latency.
+         *
+         * @param[in] aLatency  The latency in microseconds.
+         *
+         */
+        void Record(uint32_t aLatency);
+    };
+
+    /**
+     * Initializes the Latency Tracer.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     *
+     */
+    explicit LatencyTracer(Instance &aInstance);
+
+    /**
+     * Sets the sampling interval.
+     *
+     * @param[in] aInterval  The sampling interval (one out of @p aInterval messages is traced, zero disables tracing).
+     *
+     */
+    void SetSampleInterval(uint16_t aInterval);
+
+    /**
+     * Gets the sampling interval.
+     *
+     * @returns The sampling interval.
+     *
+     */
+    uint16_t GetSampleInterval(void) const { return mSampleInterval; }
+
+    /**
+     * Gets the number of messages traced since the last reset.
+     *
+     * @returns The number of traced messages.
+     *
+     */
+    uint32_t GetNumTracedMessages(void) const { return mNumTracedMessages; }
+
+    /**
+     * Gets the latency statistics of a stage.
+     *
+     * @param[in] aStage  The stage.
+     *
+     * @returns The statistics of @p aStage.
+     *
+     */
+    const StageStats &GetStageStats(Stage aStage) const { return mStageStats[aStage]; }
+
+    /**
+     * Resets the latency statistics of all stages and the number of traced messages.
+     *
+     */
+    void ResetStats(void);
+
+    /**
+     * Starts the trace of a new message, if it is sampled.
+     *
+     * Called for locally originated messages (`Ip6::SendDatagram()`) and for messages created from a received frame.
+     *
+     * @param[in] aMessage  The message.
+     *
+     */
+    void Start(Message &aMessage);
+
+    /**
+     * Handles a message being added to the send queue of `MeshForwarder`.
+     *
+     * A traced message records its `kStageEnqueue` latency. Other messages (e.g., not sent using `Ip6::SendDatagram()`)
+     * may start to be traced.
+     *
+     * @param[in] aMessage  The message.
+     *
+     */
+    void HandleEnqueue(Message &aMessage);
+
+    /**
+     * Records a stage for a message, if it is traced.
+     *
+     * @param[in] aMessage  The message.
+     * @param[in] aStage    The stage.
+     *
+     */
+    void Mark(Message &aMessage, Stage aStage);
+
+    /**
+     * Handles a frame of a message being prepared for transmission by the MAC.
+     *
+     * @param[in] aMessage  The message.
+     *
+     */
+    void HandleFramePrepared(Message &aMessage);
+
+    /**
+     * Handles the frame prepared by `HandleFramePrepared()` being handed to the radio.
+     *
+     * Only the first attempt of the frame is recorded; retries are part of `kStageTxDone`.
+     *
+     */
+    void HandleRadioTxStart(void);
+
+    /**
+     * Handles the end of transmission of the frame prepared by `HandleFramePrepared()`.
+     *
+     * @param[in] aMessage  The message, or `nullptr` if it was removed while its frame was being sent.
+     *
+     */
+    void HandleFrameSent(Message *aMessage);
+
+private:
+    static constexpr uint8_t kMinBinShift = 7; // Upper bound of the first histogram bin is `1 << kMinBinShift` usec.
+
+    static uint32_t GetNow(void);
+    void            Record(Stage aStage, uint32_t aLatency) { mStageStats[aStage].Record(aLatency); }
+
+    uint16_t   mSampleInterval;
+    uint16_t   mSampleCounter;
+    uint32_t   mNumTracedMessages;
+    bool       mTxFrameTraced;
+    bool       mTxFrameStarted;
+    uint32_t   mTxFrameTime;
+    StageStats mStageStats[kNumStages];
+};
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+
+#endif // LATENCY_TRACER_HPP_
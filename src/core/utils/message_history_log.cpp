@@ -0,0 +1,549 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the compact RX/TX message history log.
+ */
+
+#include "message_history_log.hpp"
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+
+#include <string.h>
+
+#include "common/as_core_type.hpp"
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+#include "common/encoding.hpp"
+#include "common/num_utils.hpp"
+#include "net/ip6_types.hpp"
+#include "radio/radio.hpp"
+
+namespace ot {
+namespace Utils {
+
+MessageHistoryLog::MessageHistoryLog(uint8_t *aBuffer, uint16_t aSize, bool aIsTx)
+    : mBuffer(aBuffer)
+    , mBufferSize(aSize)
+    , mNextSequence(0)
+    , mIsTx(aIsTx)
+{
+    OT_ASSERT((aSize >= kMinBufferSize) && (aSize <= kMaxBufferSize));
+
+    Clear();
+}
+
+void MessageHistoryLog::Clear(void)
+{
+    mUsedSize            = 0;
+    mOldestOffset        = 0;
+    mNewestOffset        = 0;
+    mTailOffset          = 0;
+    mNumRecords          = 0;
+    mNumLiteralRlocs     = 0;
+    mIsNewestDistantPast = false;
+    mSpanTime            = 0;
+
+    // `mNextSequence` is intentionally not reset so that iterators
+    // used before `Clear()` do not match the new records.
+
+    mRlocDictionary.Clear();
+    mAddressDictionary.Clear();
+}
+
+void MessageHistoryLog::Add(const MessageInfo &aInfo)
+{
+    TimeMilli now       = TimerMilli::GetNow();
+    uint32_t  timeDelta = 0;
+    uint8_t   record[kMaxRecordSize];
+    uint16_t  length;
+
+    if (mNumRecords > 0)
+    {
+        timeDelta = mIsNewestDistantPast ? kMaxAge : Min(now - mNewestTime, kMaxAge);
+    }
+
+    // Dictionary entries are acquired before dropping older records
+    // so that values shared with the dropped records are kept.
+
+    length = Encode(aInfo, timeDelta, record);
+
+    while (mBufferSize - mUsedSize < length + 1)
+    {
+        RemoveOldest();
+    }
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        mBuffer[Advance(mTailOffset, i)] = record[i];
+    }
+
+    mBuffer[Advance(mTailOffset, length)] = static_cast<uint8_t>(length);
+
+    if (mNumRecords == 0)
+    {
+        mOldestOffset = mTailOffset;
+    }
+    else
+    {
+        mSpanTime += timeDelta;
+    }
+
+    mNewestOffset        = mTailOffset;
+    mTailOffset          = Advance(mTailOffset, length + 1);
+    mUsedSize            = mUsedSize + length + 1;
+    mNewestTime          = now;
+    mIsNewestDistantPast = false;
+    mNumRecords++;
+    mNextSequence++;
+}
+
+uint16_t MessageHistoryLog::Encode(const MessageInfo &aInfo, uint32_t aTimeDelta, uint8_t *aRecord)
+{
+    uint8_t *cursor      = aRecord;
+    uint8_t  flags       = (aInfo.mPriority & kFlagPriorityMask);
+    uint8_t  format      = 0;
+    uint8_t  rlocIndex   = mRlocDictionary.Acquire(aInfo.mNeighborRloc16);
+    uint8_t  sourceIndex = mAddressDictionary.Acquire(AsCoreType(&aInfo.mSource.mAddress));
+    uint8_t  destIndex   = mAddressDictionary.Acquire(AsCoreType(&aInfo.mDestination.mAddress));
+
+    flags |= aInfo.mLinkSecurity ? kFlagLinkSecurity : 0;
+    flags |= aInfo.mTxSuccess ? kFlagTxSuccess : 0;
+    flags |= aInfo.mRadioIeee802154 ? kFlagRadio154 : 0;
+    flags |= aInfo.mRadioTrelUdp6 ? kFlagRadioTrel : 0;
+    flags |= (aInfo.mAveRxRss != Radio::kInvalidRssi) ? kFlagHasRss : 0;
+
+    if (rlocIndex == kNotInDictionary)
+    {
+        flags |= kFlagLiteralRloc;
+        mNumLiteralRlocs++;
+    }
+
+    switch (aInfo.mIpProto)
+    {
+    case Ip6::kProtoUdp:
+        format = kFormatUdp;
+        break;
+    case Ip6::kProtoTcp:
+        format = kFormatTcp;
+        break;
+    case Ip6::kProtoIcmp6:
+        format = kFormatIcmp6;
+        break;
+    default:
+        format = kFormatOther;
+        break;
+    }
+
+    format |= (sourceIndex == kNotInDictionary) ? kFormatLiteralSrc : 0;
+    format |= (destIndex == kNotInDictionary) ? kFormatLiteralDst : 0;
+
+    *cursor++ = flags;
+    *cursor++ = format;
+    cursor    = WriteVarint(aTimeDelta, cursor);
+
+    if (rlocIndex == kNotInDictionary)
+    {
+        Encoding::BigEndian::WriteUint16(aInfo.mNeighborRloc16, cursor);
+        cursor += sizeof(uint16_t);
+    }
+    else
+    {
+        *cursor++ = rlocIndex;
+    }
+
+    cursor = WriteVarint(aInfo.mPayloadLength, cursor);
+
+    if (sourceIndex == kNotInDictionary)
+    {
+        memcpy(cursor, &aInfo.mSource.mAddress, sizeof(Ip6::Address));
+        cursor += sizeof(Ip6::Address);
+    }
+    else
+    {
+        *cursor++ = sourceIndex;
+    }
+
+    if (destIndex == kNotInDictionary)
+    {
+        memcpy(cursor, &aInfo.mDestination.mAddress, sizeof(Ip6::Address));
+        cursor += sizeof(Ip6::Address);
+    }
+    else
+    {
+        *cursor++ = destIndex;
+    }
+
+    switch (format & kFormatProtoMask)
+    {
+    case kFormatUdp:
+    case kFormatTcp:
+        Encoding::BigEndian::WriteUint16(aInfo.mSource.mPort, cursor);
+        Encoding::BigEndian::WriteUint16(aInfo.mDestination.mPort, cursor + sizeof(uint16_t));
+        Encoding::BigEndian::WriteUint16(aInfo.mChecksum, cursor + 2 * sizeof(uint16_t));
+        cursor += 3 * sizeof(uint16_t);
+        break;
+    case kFormatIcmp6:
+        *cursor++ = aInfo.mIcmp6Type;
+        Encoding::BigEndian::WriteUint16(aInfo.mChecksum, cursor);
+        cursor += sizeof(uint16_t);
+        break;
+    default:
+        *cursor++ = aInfo.mIpProto;
+        break;
+    }
+
+    if (flags & kFlagHasRss)
+    {
+        *cursor++ = static_cast<uint8_t>(aInfo.mAveRxRss);
+    }
+
+    return static_cast<uint16_t>(cursor - aRecord);
+}
+
+void MessageHistoryLog::ParseHeader(uint16_t aOffset, Record &aRecord, uint16_t &aNextOffset) const
+{
+    aNextOffset = aOffset;
+
+    aRecord.mFlags     = ReadByte(aNextOffset);
+    aRecord.mFormat    = ReadByte(aNextOffset);
+    aRecord.mTimeDelta = ReadVarint(aNextOffset);
+
+    if (aRecord.mFlags & kFlagLiteralRloc)
+    {
+        aRecord.mRlocIndex = kNotInDictionary;
+        aRecord.mRloc16    = ReadUint16(aNextOffset);
+    }
+    else
+    {
+        aRecord.mRlocIndex = ReadByte(aNextOffset);
+        aRecord.mRloc16    = mRlocDictionary.Get(aRecord.mRlocIndex);
+    }
+}
+
+void MessageHistoryLog::Parse(uint16_t aOffset, Record &aRecord) const
+{
+    MessageInfo &info = aRecord.mInfo;
+    uint16_t     offset;
+
+    ParseHeader(aOffset, aRecord, offset);
+
+    memset(&info, 0, sizeof(info));
+
+    info.mNeighborRloc16  = aRecord.mRloc16;
+    info.mPayloadLength   = static_cast<uint16_t>(ReadVarint(offset));
+    info.mPriority        = (aRecord.mFlags & kFlagPriorityMask);
+    info.mLinkSecurity    = (aRecord.mFlags & kFlagLinkSecurity);
+    info.mTxSuccess       = (aRecord.mFlags & kFlagTxSuccess);
+    info.mRadioIeee802154 = (aRecord.mFlags & kFlagRadio154);
+    info.mRadioTrelUdp6   = (aRecord.mFlags & kFlagRadioTrel);
+
+    if (aRecord.mFormat & kFormatLiteralSrc)
+    {
+        aRecord.mSourceIndex = kNotInDictionary;
+        ReadBytes(offset, &info.mSource.mAddress, sizeof(Ip6::Address));
+    }
+    else
+    {
+        aRecord.mSourceIndex  = ReadByte(offset);
+        info.mSource.mAddress = mAddressDictionary.Get(aRecord.mSourceIndex);
+    }
+
+    if (aRecord.mFormat & kFormatLiteralDst)
+    {
+        aRecord.mDestinationIndex = kNotInDictionary;
+        ReadBytes(offset, &info.mDestination.mAddress, sizeof(Ip6::Address));
+    }
+    else
+    {
+        aRecord.mDestinationIndex  = ReadByte(offset);
+        info.mDestination.mAddress = mAddressDictionary.Get(aRecord.mDestinationIndex);
+    }
+
+    switch (aRecord.mFormat & kFormatProtoMask)
+    {
+    case kFormatUdp:
+    case kFormatTcp:
+        info.mIpProto           = ((aRecord.mFormat & kFormatProtoMask) == kFormatUdp) ? Ip6::kProtoUdp : Ip6::kProtoTcp;
+        info.mSource.mPort      = ReadUint16(offset);
+        info.mDestination.mPort = ReadUint16(offset);
+        info.mChecksum          = ReadUint16(offset);
+        break;
+    case kFormatIcmp6:
+        info.mIpProto   = Ip6::kProtoIcmp6;
+        info.mIcmp6Type = ReadByte(offset);
+        info.mChecksum  = ReadUint16(offset);
+        break;
+    default:
+        info.mIpProto = ReadByte(offset);
+        break;
+    }
+
+    info.mAveRxRss = (aRecord.mFlags & kFlagHasRss) ? static_cast<int8_t>(ReadByte(offset)) : Radio::kInvalidRssi;
+
+    aRecord.mLength = ReadByte(offset);
+}
+
+void MessageHistoryLog::RemoveOldest(void)
+{
+    Record   record;
+    uint16_t offset;
+
+    OT_ASSERT(mNumRecords > 0);
+
+    Parse(mOldestOffset, record);
+
+    if (record.mRlocIndex == kNotInDictionary)
+    {
+        mNumLiteralRlocs--;
+    }
+    else
+    {
+        mRlocDictionary.Release(record.mRlocIndex);
+    }
+
+    if (record.mSourceIndex != kNotInDictionary)
+    {
+        mAddressDictionary.Release(record.mSourceIndex);
+    }
+
+    if (record.mDestinationIndex != kNotInDictionary)
+    {
+        mAddressDictionary.Release(record.mDestinationIndex);
+    }
+
+    if (mSpillCallback.IsSet())
+    {
+        uint32_t age = static_cast<uint32_t>(Min<uint64_t>(GetNewestAge(TimerMilli::GetNow()) + mSpanTime, kMaxAge));
+
+        mSpillCallback.Invoke(&record.mInfo, mIsTx, age);
+    }
+
+    mOldestOffset = Advance(mOldestOffset, record.mLength + 1);
+    mUsedSize     = mUsedSize - record.mLength - 1;
+    mNumRecords--;
+
+    if (mNumRecords > 0)
+    {
+        // The time delta of the new oldest record is no longer part
+        // of the time spanned by the log.
+
+        ParseHeader(mOldestOffset, record, offset);
+        mSpanTime -= record.mTimeDelta;
+    }
+}
+
+const MessageHistoryLog::MessageInfo *MessageHistoryLog::Read(otHistoryTrackerIterator &aIterator,
+                                                               const MessageFilter      *aFilter,
+                                                               uint32_t                 &aEntryAge)
+{
+    const MessageInfo *entry         = nullptr;
+    bool               matchNeighbor = (aFilter != nullptr) && aFilter->mMatchNeighbor;
+    Record             record;
+
+    if (aIterator.mCursorOffset == kCursorNotStarted)
+    {
+        aIterator.mCursorOffset = kCursorEnded;
+
+        VerifyOrExit(mNumRecords > 0);
+
+        // A neighbor which is neither in the dictionary nor stored
+        // in full in any record cannot match any record.
+
+        VerifyOrExit(!matchNeighbor || (mNumLiteralRlocs > 0) ||
+                     (mRlocDictionary.Find(aFilter->mNeighborRloc16) != kNotInDictionary));
+
+        aIterator.mCursorOffset = mNewestOffset;
+        aIterator.mData16       = mNextSequence - 1;
+        aIterator.mCursorAge    = GetNewestAge(TimeMilli(aIterator.mData32));
+    }
+
+    while (aIterator.mCursorOffset != kCursorEnded)
+    {
+        uint16_t offset = aIterator.mCursorOffset;
+        uint32_t age    = aIterator.mCursorAge;
+        uint16_t nextOffset;
+
+        // The record under the cursor may have been dropped (to make
+        // room for new ones) since the previous call.
+
+        if (!IsValid(aIterator.mData16) || ((aFilter != nullptr) && (age > aFilter->mMaxAge)))
+        {
+            aIterator.mCursorOffset = kCursorEnded;
+            break;
+        }
+
+        ParseHeader(offset, record, nextOffset);
+        MoveToOlder(aIterator, record.mTimeDelta);
+
+        if (!matchNeighbor || (record.mRloc16 == aFilter->mNeighborRloc16))
+        {
+            Parse(offset, record);
+            mEntry    = record.mInfo;
+            aEntryAge = age;
+            entry     = &mEntry;
+            break;
+        }
+    }
+
+exit:
+    return entry;
+}
+
+void MessageHistoryLog::UpdateAgedEntries(void)
+{
+    if ((mNumRecords > 0) && !mIsNewestDistantPast && (TimerMilli::GetNow() - mNewestTime >= kMaxAge))
+    {
+        mIsNewestDistantPast = true;
+    }
+}
+
+uint32_t MessageHistoryLog::GetNewestAge(TimeMilli aTime) const
+{
+    uint32_t age = kMaxAge;
+
+    if (!mIsNewestDistantPast)
+    {
+        // The newest record may have been added after `aTime` (e.g.,
+        // after an iterator was initialized).
+
+        age = (aTime >= mNewestTime) ? Min(aTime - mNewestTime, kMaxAge) : 0;
+    }
+
+    return age;
+}
+
+bool MessageHistoryLog::IsValid(uint16_t aSequence) const
+{
+    // Records are numbered in the order they are added. The valid
+    // sequence numbers are the `mNumRecords` ones before
+    // `mNextSequence`.
+
+    return static_cast<uint16_t>(mNextSequence - 1 - aSequence) < mNumRecords;
+}
+
+void MessageHistoryLog::MoveToOlder(otHistoryTrackerIterator &aIterator, uint32_t aTimeDelta) const
+{
+    uint16_t trailerOffset;
+
+    if (static_cast<uint16_t>(mNextSequence - aIterator.mData16) >= mNumRecords)
+    {
+        // The cursor is at the oldest record.
+        aIterator.mCursorOffset = kCursorEnded;
+        ExitNow();
+    }
+
+    trailerOffset           = Retreat(aIterator.mCursorOffset, 1);
+    aIterator.mCursorOffset = Retreat(trailerOffset, mBuffer[trailerOffset]);
+    aIterator.mData16--;
+    aIterator.mCursorAge = (aTimeDelta >= kMaxAge - aIterator.mCursorAge) ? kMaxAge : aIterator.mCursorAge + aTimeDelta;
+
+exit:
+    return;
+}
+
+uint16_t MessageHistoryLog::Advance(uint16_t aOffset, uint16_t aLength) const
+{
+    uint32_t offset = static_cast<uint32_t>(aOffset) + aLength;
+
+    offset -= (offset >= mBufferSize) ? mBufferSize : 0;
+
+    return static_cast<uint16_t>(offset);
+}
+
+uint16_t MessageHistoryLog::Retreat(uint16_t aOffset, uint16_t aLength) const
+{
+    return (aOffset >= aLength) ? (aOffset - aLength) : static_cast<uint16_t>(aOffset + mBufferSize - aLength);
+}
+
+uint8_t MessageHistoryLog::ReadByte(uint16_t &aOffset) const
+{
+    uint8_t byte = mBuffer[aOffset];
+
+    aOffset = Advance(aOffset, 1);
+
+    return byte;
+}
+
+uint16_t MessageHistoryLog::ReadUint16(uint16_t &aOffset) const
+{
+    uint16_t value = static_cast<uint16_t>(ReadByte(aOffset) << 8);
+
+    return value | ReadByte(aOffset);
+}
+
+uint32_t MessageHistoryLog::ReadVarint(uint16_t &aOffset) const
+{
+    // Little-endian base 128: 7 bits per byte, MSB set on all but
+    // the last byte.
+
+    uint32_t value = 0;
+
+    for (uint8_t shift = 0; shift < 32; shift += 7)
+    {
+        uint8_t byte = ReadByte(aOffset);
+
+        value |= static_cast<uint32_t>(byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0)
+        {
+            break;
+        }
+    }
+
+    return value;
+}
+
+void MessageHistoryLog::ReadBytes(uint16_t &aOffset, void *aBytes, uint16_t aLength) const
+{
+    uint8_t *bytes = static_cast<uint8_t *>(aBytes);
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        bytes[i] = ReadByte(aOffset);
+    }
+}
+
+uint8_t *MessageHistoryLog::WriteVarint(uint32_t aValue, uint8_t *aCursor)
+{
+    do
+    {
+        uint8_t byte = aValue & 0x7f;
+
+        aValue >>= 7;
+        *aCursor++ = (aValue != 0) ? (byte | 0x80) : byte;
+    } while (aValue != 0);
+
+    return aCursor;
+}
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
@@ -0,0 +1,323 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the compact RX/TX message history log.
+ */
+
+#ifndef MESSAGE_HISTORY_LOG_HPP_
+#define MESSAGE_HISTORY_LOG_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+
+#include <openthread/history_tracker.h>
+
+#include "common/callback.hpp"
+#include "common/code_utils.hpp"
+#include "common/non_copyable.hpp"
+#include "common/timer.hpp"
+#include "net/ip6_address.hpp"
+
+namespace ot {
+namespace Utils {
+
+/**
+ * Implements a compact log of RX or TX message history entries.
+ *
+ * Entries are appended as variable-length records to a caller-provided byte buffer used as a ring. When the buffer is
+ * full, the oldest records are dropped (after being passed to the spill callback, if set).
+ *
+ * Each record stores the time since the previous (older) record as a variable-length integer, the flags and the
+ * protocol in two bit-packed bytes, and the neighbor RLOC16 and the source and destination IPv6 addresses as one-byte
+ * indexes into reference-counted dictionaries (or in full when a dictionary is full). Fields which do not apply to the
+ * IP protocol (e.g., ports of an ICMPv6 message) are omitted. Every record ends with its length so that the log can be
+ * read from the newest record to the oldest.
+ *
+ */
+class MessageHistoryLog : private NonCopyable
+{
+public:
+    typedef otHistoryTrackerMessageInfo          MessageInfo;   ///< RX/TX IPv6 message info.
+    typedef otHistoryTrackerMessageFilter        MessageFilter; ///< Message filter.
+    typedef otHistoryTrackerMessageSpillCallback SpillCallback; ///< Spill callback.
+
+    static constexpr uint32_t kMaxAge = OT_HISTORY_TRACKER_MAX_AGE; ///< Max entry age (in msec).
+
+    /**
+     * The `mCursorOffset` of an `otHistoryTrackerIterator` which has not yet been used with a log.
+     *
+     */
+    static constexpr uint16_t kCursorNotStarted = 0xffff;
+
+    /**
+     * Maximum supported buffer size (in bytes).
+     *
+     */
+    static constexpr uint16_t kMaxBufferSize = 0xfff0;
+
+    /**
+     * Minimum supported buffer size (in bytes).
+     *
+     */
+    static constexpr uint16_t kMinBufferSize = 128;
+
+    /**
+     * Initializes the `MessageHistoryLog`.
+     *
+     * @param[in] aBuffer   A pointer to the buffer to store the records in.
+     * @param[in] aSize     The size of @p aBuffer (in bytes). MUST be at least `kMinBufferSize` and at most
+     *                      `kMaxBufferSize`.
+     * @param[in] aIsTx     Indicates whether the log holds TX (TRUE) or RX (FALSE) history (passed to spill callback).
+     *
+     */
+    MessageHistoryLog(uint8_t *aBuffer, uint16_t aSize, bool aIsTx);
+
+    /**
+     * Removes all entries from the log.
+     *
+     * The spill callback is not invoked for the removed entries.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * Returns the number of entries in the log.
+     *
+     * @returns The number of entries.
+     *
+     */
+    uint16_t GetSize(void) const { return mNumRecords; }
+
+    /**
+     * Returns the number of bytes used by the entries in the log.
+     *
+     * @returns The number of used bytes.
+     *
+     */
+    uint16_t GetUsedBytes(void) const { return mUsedSize; }
+
+    /**
+     * Sets the callback invoked with the oldest entry when it is dropped to make room for a new one.
+     *
+     * @param[in] aCallback  The callback (can be `nullptr`).
+     * @param[in] aContext   An arbitrary context used with @p aCallback.
+     *
+     */
+    void SetSpillCallback(SpillCallback aCallback, void *aContext) { mSpillCallback.Set(aCallback, aContext); }
+
+    /**
+     * Adds a new entry to the log, dropping the oldest entries as needed.
+     *
+     * The entry is recorded at the current time. Ports are only kept for UDP and TCP, the ICMPv6 type only for ICMPv6
+     * and the checksum only for UDP, TCP and ICMPv6 (other values are read back as zero).
+     *
+     * @param[in] aInfo  The message info.
+     *
+     */
+    void Add(const MessageInfo &aInfo);
+
+    /**
+     * Reads the next entry (from newest to oldest) matching an optional filter.
+     *
+     * @p aIterator MUST be initialized with `mData32` set to its init time and `mCursorOffset` set to
+     * `kCursorNotStarted`. The same @p aFilter MUST be used for all calls with an iterator.
+     *
+     * Reading stops at the first entry older than `mMaxAge` of @p aFilter. When matching a neighbor, records of other
+     * neighbors are skipped by looking only at their headers, and the read ends immediately if the neighbor does not
+     * appear in the log at all.
+     *
+     * @param[in,out] aIterator  The iterator.
+     * @param[in]     aFilter    A pointer to a filter, or `nullptr` to read all entries.
+     * @param[out]    aEntryAge  A reference to output the entry's age (duration in msec from when the entry was
+     *                           recorded to the iterator init time), `kMaxAge` for entries older than max age.
+     *
+     * @returns A pointer to the entry (valid until the next call) or `nullptr` if no more matching entries.
+     *
+     */
+    const MessageInfo *Read(otHistoryTrackerIterator &aIterator, const MessageFilter *aFilter, uint32_t &aEntryAge);
+
+    /**
+     * Marks the newest entry as distant past if it is older than `kMaxAge`.
+     *
+     * MUST be called at an interval shorter than `2^32 - kMaxAge` msec so that the ages of the entries stay correct
+     * when the millisecond time wraps.
+     *
+     */
+    void UpdateAgedEntries(void);
+
+private:
+    static constexpr uint8_t  kDictionarySize  = OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_DICTIONARY_SIZE;
+    static constexpr uint8_t  kNotInDictionary = 0xff;
+    static constexpr uint16_t kCursorEnded     = 0xfffe;
+
+    // Flags and format, time delta, RLOC16, payload length, addresses, ports and checksum, RSS.
+    static constexpr uint8_t kMaxRecordSize = 2 + 5 + 2 + 3 + 2 * sizeof(Ip6::Address) + 6 + 1;
+
+    static_assert(kDictionarySize > 0 && kDictionarySize < kNotInDictionary, "Invalid dictionary size");
+
+    // Record flags (first byte).
+    static constexpr uint8_t kFlagPriorityMask = 0x03;
+    static constexpr uint8_t kFlagLinkSecurity = 1 << 2;
+    static constexpr uint8_t kFlagTxSuccess    = 1 << 3;
+    static constexpr uint8_t kFlagRadio154     = 1 << 4;
+    static constexpr uint8_t kFlagRadioTrel    = 1 << 5;
+    static constexpr uint8_t kFlagHasRss       = 1 << 6;
+    static constexpr uint8_t kFlagLiteralRloc  = 1 << 7;
+
+    // Record format (second byte).
+    static constexpr uint8_t kFormatProtoMask  = 0x03;
+    static constexpr uint8_t kFormatUdp        = 0;
+    static constexpr uint8_t kFormatTcp        = 1;
+    static constexpr uint8_t kFormatIcmp6      = 2;
+    static constexpr uint8_t kFormatOther      = 3;
+    static constexpr uint8_t kFormatLiteralSrc = 1 << 2;
+    static constexpr uint8_t kFormatLiteralDst = 1 << 3;
+
+    // Reference counted dictionary of `Type` values.
+    template <typename Type> class Dictionary
+    {
+    public:
+        void Clear(void)
+        {
+            for (Entry &entry : mEntries)
+            {
+                entry.mRefCount = 0;
+            }
+        }
+
+        uint8_t Find(const Type &aValue) const
+        {
+            uint8_t index = kNotInDictionary;
+
+            for (uint8_t i = 0; i < kDictionarySize; i++)
+            {
+                if ((mEntries[i].mRefCount > 0) && (mEntries[i].mValue == aValue))
+                {
+                    index = i;
+                    break;
+                }
+            }
+
+            return index;
+        }
+
+        uint8_t Acquire(const Type &aValue)
+        {
+            uint8_t index = Find(aValue);
+
+            if (index == kNotInDictionary)
+            {
+                for (uint8_t i = 0; i < kDictionarySize; i++)
+                {
+                    if (mEntries[i].mRefCount == 0)
+                    {
+                        mEntries[i].mValue = aValue;
+                        index              = i;
+                        break;
+                    }
+                }
+
+                VerifyOrExit(index != kNotInDictionary);
+            }
+
+            mEntries[index].mRefCount++;
+
+        exit:
+            return index;
+        }
+
+        void        Release(uint8_t aIndex) { mEntries[aIndex].mRefCount--; }
+        const Type &Get(uint8_t aIndex) const { return mEntries[aIndex].mValue; }
+
+    private:
+        struct Entry
+        {
+            Type     mValue;
+            uint16_t mRefCount;
+        };
+
+        Entry mEntries[kDictionarySize];
+    };
+
+    struct Record
+    {
+        uint8_t     mFlags;
+        uint8_t     mFormat;
+        uint16_t    mLength; // Excluding the trailer length byte.
+        uint32_t    mTimeDelta;
+        uint16_t    mRloc16;
+        uint8_t     mRlocIndex;
+        uint8_t     mSourceIndex;
+        uint8_t     mDestinationIndex;
+        MessageInfo mInfo;
+    };
+
+    uint16_t Encode(const MessageInfo &aInfo, uint32_t aTimeDelta, uint8_t *aRecord);
+    void     ParseHeader(uint16_t aOffset, Record &aRecord, uint16_t &aNextOffset) const;
+    void     Parse(uint16_t aOffset, Record &aRecord) const;
+    void     RemoveOldest(void);
+    uint32_t GetNewestAge(TimeMilli aTime) const;
+    bool     IsValid(uint16_t aSequence) const;
+    void     MoveToOlder(otHistoryTrackerIterator &aIterator, uint32_t aTimeDelta) const;
+    uint16_t Advance(uint16_t aOffset, uint16_t aLength) const;
+    uint16_t Retreat(uint16_t aOffset, uint16_t aLength) const;
+    uint8_t  ReadByte(uint16_t &aOffset) const;
+    uint16_t ReadUint16(uint16_t &aOffset) const;
+    uint32_t ReadVarint(uint16_t &aOffset) const;
+    void     ReadBytes(uint16_t &aOffset, void *aBytes, uint16_t aLength) const;
+
+    static uint8_t *WriteVarint(uint32_t aValue, uint8_t *aCursor);
+
+    uint8_t                 *mBuffer;
+    uint16_t                 mBufferSize;
+    uint16_t                 mUsedSize;
+    uint16_t                 mOldestOffset;
+    uint16_t                 mNewestOffset;
+    uint16_t                 mTailOffset;
+    uint16_t                 mNumRecords;
+    uint16_t                 mNextSequence;
+    uint16_t                 mNumLiteralRlocs;
+    bool                     mIsTx;
+    bool                     mIsNewestDistantPast;
+    TimeMilli                mNewestTime;
+    uint64_t                 mSpanTime; // Sum of time deltas of all records but the oldest.
+    Callback<SpillCallback>  mSpillCallback;
+    Dictionary<uint16_t>     mRlocDictionary;
+    Dictionary<Ip6::Address> mAddressDictionary;
+    MessageInfo              mEntry;
+};
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+
+#endif // MESSAGE_HISTORY_LOG_HPP_
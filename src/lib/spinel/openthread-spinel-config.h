@@ -66,4 +66,16 @@
 #ifndef OPENTHREAD_SPINEL_CONFIG_ABORT_ON_UNEXPECTED_RCP_RESET_ENABLE
 #define OPENTHREAD_SPINEL_CONFIG_ABORT_ON_UNEXPECTED_RCP_RESET_ENABLE 0
 #endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE
+ *
+ * Defines the max number of queued received radio frames handed together to the RX frame batch handler (see
+ * `RadioSpinel::SetRxFrameBatchHandler()`) before they are passed to OpenThread one by one.
+ * 0 means to disable RX frame batching.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE
+#define OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE 0
+#endif
 #endif // OPENTHREAD_SPINEL_CONFIG_H_
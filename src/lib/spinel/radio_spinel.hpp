@@ -744,6 +744,36 @@ public:
      */
     bool HasPendingFrame(void) const { return mRxFrameBuffer.HasSavedFrame(); }
 
+#if OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE > 0
+    /**
+     * Pointer to a function which pre-processes a batch of received radio frames.
+     *
+     * The handler is given the radio frames queued by one pass of `Process()` (up to
+     * `OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE` frames) before they are passed, one by one and in order, to
+     * `otPlatRadioReceiveDone()`. The handler may modify the frames in place. Frames with a zero `mLength` failed to
+     * parse and must be ignored.
+     *
+     * @param[in] aFrames     An array of received radio frames.
+     * @param[in] aNumFrames  The number of frames in @p aFrames.
+     * @param[in] aContext    The context given to `SetRxFrameBatchHandler()`.
+     *
+     */
+    typedef void (*RxFrameBatchHandler)(otRadioFrame *aFrames, uint16_t aNumFrames, void *aContext);
+
+    /**
+     * Sets the handler pre-processing batches of received radio frames.
+     *
+     * @param[in] aHandler  The handler, or `nullptr` to pass the received frames on without pre-processing.
+     * @param[in] aContext  An arbitrary context passed to @p aHandler.
+     *
+     */
+    void SetRxFrameBatchHandler(RxFrameBatchHandler aHandler, void *aContext)
+    {
+        mRxFrameBatchHandler = aHandler;
+        mRxFrameBatchContext = aContext;
+    }
+#endif
+
     /**
      * Returns the next timepoint to recalculate RCP time offset.
      *
@@ -964,6 +994,14 @@ private:
      */
     void ProcessFrameQueue(void);
 
+#if OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE > 0
+    /**
+     * Parses the radio frames in the frame queue into the RX frame batch and passes them to the batch handler.
+     *
+     */
+    void PrepareRxFrameBatch(void);
+#endif
+
     spinel_tid_t GetNextTid(void);
     void         FreeTid(spinel_tid_t tid) { mCmdTidsInUse &= ~(1 << tid); }
 
@@ -1016,7 +1054,7 @@ private:
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
 
-    void RadioReceive(void);
+    void RadioReceive(otRadioFrame &aFrame);
 
     void TransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otError aError);
 
@@ -1061,6 +1099,15 @@ private:
     otRadioFrame  mAckRadioFrame;
     otRadioFrame *mTransmitFrame; ///< Points to the frame to send
 
+#if OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE > 0
+    RxFrameBatchHandler mRxFrameBatchHandler;
+    void               *mRxFrameBatchContext;
+    uint16_t            mRxFrameBatchLength;
+    const uint8_t      *mRxFrameBatchSources[OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE]; ///< Saved spinel frames.
+    otRadioFrame        mRxFrameBatch[OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE];
+    uint8_t             mRxFrameBatchPsdus[OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE][OT_RADIO_FRAME_MAX_SIZE];
+#endif
+
     otExtAddress mExtendedAddress;
     uint16_t     mShortAddress;
     uint16_t     mPanId;
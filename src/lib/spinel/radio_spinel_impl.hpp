@@ -177,6 +177,11 @@ RadioSpinel<InterfaceType>::RadioSpinel(void)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
     , mTransmitFrame(nullptr)
+#if OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE > 0
+    , mRxFrameBatchHandler(nullptr)
+    , mRxFrameBatchContext(nullptr)
+    , mRxFrameBatchLength(0)
+#endif
     , mShortAddress(0)
     , mPanId(0xffff)
     , mRadioCaps(0)
@@ -210,6 +215,13 @@ RadioSpinel<InterfaceType>::RadioSpinel(void)
 {
     mVersion[0] = '\0';
     memset(&mRadioSpinelMetrics, 0, sizeof(mRadioSpinelMetrics));
+
+#if OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE > 0
+    for (uint16_t i = 0; i < OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE; i++)
+    {
+        mRxFrameBatch[i].mPsdu = mRxFrameBatchPsdus[i];
+    }
+#endif
 }
 
 template <typename InterfaceType>
@@ -686,7 +698,7 @@ void RadioSpinel<InterfaceType>::HandleValueIs(spinel_prop_key_t aKey, const uin
     if (aKey == SPINEL_PROP_STREAM_RAW)
     {
         SuccessOrExit(error = ParseRadioFrame(mRxRadioFrame, aBuffer, aLength, unpacked));
-        RadioReceive();
+        RadioReceive(mRxRadioFrame);
     }
     else if (aKey == SPINEL_PROP_LAST_STATUS)
     {
@@ -840,6 +852,7 @@ otError RadioSpinel<InterfaceType>::ParseRadioFrame(otRadioFrame   &aFrame,
 
         aFrame.mInfo.mRxInfo.mAckedWithFramePending = ((flags & SPINEL_MD_FLAG_ACKED_FP) != 0);
         aFrame.mInfo.mRxInfo.mAckedWithSecEnhAck    = ((flags & SPINEL_MD_FLAG_ACKED_SEC) != 0);
+        aFrame.mInfo.mRxInfo.mIsSecurityProcessed   = false;
     }
     else if (receiveError < OT_NUM_ERRORS)
     {
@@ -860,16 +873,85 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::ProcessFrameQ
 {
     uint8_t *frame = nullptr;
     uint16_t length;
+#if OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE > 0
+    uint16_t batchIndex = 0;
+
+    PrepareRxFrameBatch();
+#endif
 
     while (mRxFrameBuffer.GetNextSavedFrame(frame, length) == OT_ERROR_NONE)
     {
+#if OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE > 0
+        if (batchIndex < mRxFrameBatchLength && frame == mRxFrameBatchSources[batchIndex])
+        {
+            otRadioFrame &radioFrame = mRxFrameBatch[batchIndex++];
+
+            // A frame which failed to parse was already logged and
+            // counted by `PrepareRxFrameBatch()`.
+            if (radioFrame.mLength != 0)
+            {
+                RadioReceive(radioFrame);
+            }
+
+            continue;
+        }
+#endif
+
         HandleNotification(frame, length);
     }
 
+#if OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE > 0
+    mRxFrameBatchLength = 0;
+#endif
+
     mRxFrameBuffer.ClearSavedFrames();
 }
 
-template <typename InterfaceType> void RadioSpinel<InterfaceType>::RadioReceive(void)
+#if OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE > 0
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::PrepareRxFrameBatch(void)
+{
+    uint8_t *frame = nullptr;
+    uint16_t length;
+
+    mRxFrameBatchLength = 0;
+
+    VerifyOrExit(mRxFrameBatchHandler != nullptr);
+
+    while (mRxFrameBatchLength < OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE &&
+           mRxFrameBuffer.GetNextSavedFrame(frame, length) == OT_ERROR_NONE)
+    {
+        otRadioFrame     &radioFrame = mRxFrameBatch[mRxFrameBatchLength];
+        spinel_prop_key_t key;
+        spinel_size_t     len  = 0;
+        uint8_t          *data = nullptr;
+        uint32_t          cmd;
+        uint8_t           header;
+        spinel_ssize_t    unpacked;
+
+        unpacked = spinel_datatype_unpack(frame, length, "CiiD", &header, &cmd, &key, &data, &len);
+
+        if (unpacked <= 0 || cmd != SPINEL_CMD_PROP_VALUE_IS || key != SPINEL_PROP_STREAM_RAW)
+        {
+            continue;
+        }
+
+        if (ParseRadioFrame(radioFrame, data, static_cast<uint16_t>(len), unpacked) != OT_ERROR_NONE)
+        {
+            radioFrame.mLength = 0;
+        }
+
+        mRxFrameBatchSources[mRxFrameBatchLength++] = frame;
+    }
+
+    VerifyOrExit(mRxFrameBatchLength > 0);
+    mRxFrameBatchHandler(mRxFrameBatch, mRxFrameBatchLength, mRxFrameBatchContext);
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE > 0
+
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::RadioReceive(otRadioFrame &aFrame)
 {
     if (!mIsPromiscuous)
     {
@@ -889,12 +971,12 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::RadioReceive(
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
     if (otPlatDiagModeGet())
     {
-        otPlatDiagRadioReceiveDone(mInstance, &mRxRadioFrame, OT_ERROR_NONE);
+        otPlatDiagRadioReceiveDone(mInstance, &aFrame, OT_ERROR_NONE);
     }
     else
 #endif
     {
-        otPlatRadioReceiveDone(mInstance, &mRxRadioFrame, OT_ERROR_NONE);
+        otPlatRadioReceiveDone(mInstance, &aFrame, OT_ERROR_NONE);
     }
 
 exit:
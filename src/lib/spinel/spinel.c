@@ -1223,6 +1223,8 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         {SPINEL_PROP_TRNG_RAW_32, "TRNG_RAW_32"},
         {SPINEL_PROP_UNSOL_UPDATE_FILTER, "UNSOL_UPDATE_FILTER"},
         {SPINEL_PROP_UNSOL_UPDATE_LIST, "UNSOL_UPDATE_LIST"},
+        {SPINEL_PROP_UNSOL_UPDATE_BATCH_ENABLE, "UNSOL_UPDATE_BATCH_ENABLE"},
+        {SPINEL_PROP_LATENCY_TRACE_SAMPLE_INTERVAL, "LATENCY_TRACE_SAMPLE_INTERVAL"},
         {SPINEL_PROP_PHY_ENABLED, "PHY_ENABLED"},
         {SPINEL_PROP_PHY_CHAN, "PHY_CHAN"},
         {SPINEL_PROP_PHY_CHAN_SUPPORTED, "PHY_CHAN_SUPPORTED"},
@@ -1483,6 +1485,9 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         {SPINEL_PROP_CNTR_MLE_COUNTERS, "CNTR_MLE_COUNTERS"},
         {SPINEL_PROP_CNTR_ALL_IP_COUNTERS, "CNTR_ALL_IP_COUNTERS"},
         {SPINEL_PROP_CNTR_MAC_RETRY_HISTOGRAM, "CNTR_MAC_RETRY_HISTOGRAM"},
+        {SPINEL_PROP_CNTR_NCP_TX_BUFFER, "CNTR_NCP_TX_BUFFER"},
+        {SPINEL_PROP_CNTR_UNSOL_UPDATE_BATCH, "CNTR_UNSOL_UPDATE_BATCH"},
+        {SPINEL_PROP_CNTR_LATENCY_TRACE, "CNTR_LATENCY_TRACE"},
         {SPINEL_PROP_NEST_STREAM_MFG, "NEST_STREAM_MFG"},
         {SPINEL_PROP_DEBUG_TEST_ASSERT, "DEBUG_TEST_ASSERT"},
         {SPINEL_PROP_DEBUG_NCP_LOG_LEVEL, "DEBUG_NCP_LOG_LEVEL"},
@@ -1622,6 +1627,8 @@ const char *spinel_capability_to_cstr(spinel_capability_t capability)
         {SPINEL_CAP_SRP_CLIENT, "SRP_CLIENT"},
         {SPINEL_CAP_DUA, "DUA"},
         {SPINEL_CAP_REFERENCE_DEVICE, "REFERENCE_DEVICE"},
+        {SPINEL_CAP_UNSOL_UPDATE_BATCH, "UNSOL_UPDATE_BATCH"},
+        {SPINEL_CAP_LATENCY_TRACE, "LATENCY_TRACE"},
         {SPINEL_CAP_ERROR_RATE_TRACKING, "ERROR_RATE_TRACKING"},
         {SPINEL_CAP_THREAD_COMMISSIONER, "THREAD_COMMISSIONER"},
         {SPINEL_CAP_THREAD_TMF_PROXY, "THREAD_TMF_PROXY"},
@@ -1304,6 +1304,8 @@ enum
     SPINEL_CAP_SRP_CLIENT              = (SPINEL_CAP_OPENTHREAD__BEGIN + 14),
     SPINEL_CAP_DUA                     = (SPINEL_CAP_OPENTHREAD__BEGIN + 15),
     SPINEL_CAP_REFERENCE_DEVICE        = (SPINEL_CAP_OPENTHREAD__BEGIN + 16),
+    SPINEL_CAP_UNSOL_UPDATE_BATCH      = (SPINEL_CAP_OPENTHREAD__BEGIN + 17),
+    SPINEL_CAP_LATENCY_TRACE           = (SPINEL_CAP_OPENTHREAD__BEGIN + 18),
     SPINEL_CAP_OPENTHREAD__END         = 640,
 
     SPINEL_CAP_THREAD__BEGIN          = 1024,
@@ -1718,6 +1720,38 @@ enum
      */
     SPINEL_PROP_UNSOL_UPDATE_LIST = SPINEL_PROP_BASE_EXT__BEGIN + 9,
 
+    /// Unsolicited update batching enable
+    /** Format: `b`
+     *  Type: Read-Write
+     *  Required capability: `CAP_UNSOL_UPDATE_BATCH`
+     *
+     * The host sets this property to `true` to indicate that it can parse
+     * `CMD_PROP_VALUES_ARE` frames. When enabled, the NCP may combine
+     * multiple pending unsolicited property updates into a single
+     * `CMD_PROP_VALUES_ARE` frame instead of sending a separate
+     * `CMD_PROP_VALUE_IS` frame for each property.
+     *
+     * The `CMD_PROP_VALUES_ARE` frame payload has the format `A(t(iD))`,
+     * i.e., an array of structs, each containing the property key followed
+     * by the property value (same encoding as in `CMD_PROP_VALUE_IS`).
+     *
+     * `PROP_LAST_STATUS` updates are always sent as separate frames.
+     *
+     * This property is `false` after reset.
+     *
+     */
+    SPINEL_PROP_UNSOL_UPDATE_BATCH_ENABLE = SPINEL_PROP_BASE_EXT__BEGIN + 10,
+
+    /// Latency trace sampling interval
+    /** Format: `S` (read-write)
+     *  Required capability: `CAP_LATENCY_TRACE`
+     *
+     * One out of every given number of messages is traced (timestamped
+     * at each stage of the forwarding path). Zero disables tracing.
+     *
+     */
+    SPINEL_PROP_LATENCY_TRACE_SAMPLE_INTERVAL = SPINEL_PROP_BASE_EXT__BEGIN + 11,
+
     SPINEL_PROP_BASE_EXT__END = 0x1100,
 
     SPINEL_PROP_PHY__BEGIN         = 0x20,
@@ -4764,6 +4798,64 @@ enum
      */
     SPINEL_PROP_CNTR_MAC_RETRY_HISTOGRAM = SPINEL_PROP_CNTR__BEGIN + 404,
 
+    /// NCP TX frame buffer queue counters.
+    /** Format: t(SSSLL)t(SSSLL) (Read-write)
+     *
+     * The contents include two structs, first one corresponds to the
+     * high priority queue (responses and property update notifications),
+     * second one corresponds to the low priority queue (stream data
+     * such as IPv6 frames and logs).
+     *
+     * Each structure includes:
+     *
+     *   'S': NumFrames     (The number of frames currently in the queue).
+     *   'S': NumBytes      (The number of buffer bytes used by queued frames).
+     *   'S': MaxNumBytes   (The maximum number of buffer bytes used by queued frames).
+     *   'L': AddedFrames   (The number of frames added to the queue).
+     *   'L': DroppedFrames (The number of frames dropped due to lack of buffer space or queue limit).
+     *
+     * Writing to this property with any value would reset the cumulative counters
+     * (MaxNumBytes, AddedFrames and DroppedFrames).
+     *
+     */
+    SPINEL_PROP_CNTR_NCP_TX_BUFFER = SPINEL_PROP_CNTR__BEGIN + 405,
+
+    /// Unsolicited update batching counters.
+    /** Format: LL (Read-write)
+     *  Required capability: `CAP_UNSOL_UPDATE_BATCH`
+     *
+     * The contents include:
+     *
+     *   'L': BatchFrames   (The number of `CMD_PROP_VALUES_ARE` batch frames sent).
+     *   'L': SavedFrames   (The number of frames saved by batching property updates).
+     *
+     * Writing to this property with any value would reset the counters.
+     *
+     */
+    SPINEL_PROP_CNTR_UNSOL_UPDATE_BATCH = SPINEL_PROP_CNTR__BEGIN + 406,
+
+    /// Latency trace statistics.
+    /** Format: LA(t(LLXA(L))) (Read-write)
+     *  Required capability: `CAP_LATENCY_TRACE`
+     *
+     * The contents include:
+     *
+     *   'L': TracedMessages  (The number of traced messages).
+     *
+     * followed by an array of structs, one per trace stage (in order:
+     * Enqueue, RouteResolved, FramePrepared, RadioStart, TxDone, Rx,
+     * Reassembled, Delivered), each including:
+     *
+     *   'L': Count           (The number of latencies recorded).
+     *   'L': MaxLatency      (The maximum latency in microseconds).
+     *   'X': TotalLatency    (The sum of all latencies in microseconds).
+     *   'A(L)': Histogram    (The latency histogram, see `otTraceStageStats`).
+     *
+     * Writing to this property with any value would reset the statistics.
+     *
+     */
+    SPINEL_PROP_CNTR_LATENCY_TRACE = SPINEL_PROP_CNTR__BEGIN + 407,
+
     SPINEL_PROP_CNTR__END = 0x800,
 
     SPINEL_PROP_RCP_EXT__BEGIN = 0x800,
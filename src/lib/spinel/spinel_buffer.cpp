@@ -34,6 +34,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/num_utils.hpp"
 
 namespace ot {
 namespace Spinel {
@@ -56,6 +57,10 @@ Buffer::Buffer(uint8_t *aBuffer, uint16_t aBufferLength)
 
     SetFrameAddedCallback(nullptr, nullptr);
     SetFrameRemovedCallback(nullptr, nullptr);
+    SetPriorityWeights(0, 1);
+    SetPriorityMaxLength(kPriorityLow, 0);
+    SetPriorityMaxLength(kPriorityHigh, 0);
+    ResetCounters();
     Clear();
 }
 
@@ -84,6 +89,14 @@ void Buffer::Clear(void)
     mReadSegmentTail               = mBuffer;
     mReadPointer                   = mBuffer;
 
+    mScheduledPriority = kPriorityHigh;
+    mScheduledCount    = 0;
+
+    for (PriorityCounters &counters : mCounters)
+    {
+        counters.mNumFrames = 0;
+    }
+
 #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
     mReadMessage       = nullptr;
     mReadMessageOffset = 0;
@@ -123,6 +136,31 @@ void Buffer::SetFrameRemovedCallback(BufferCallback aFrameRemovedCallback, void
     mFrameRemovedContext  = aFrameRemovedContext;
 }
 
+void Buffer::SetPriorityWeights(uint8_t aHighWeight, uint8_t aLowWeight)
+{
+    mPriorityWeight[kPriorityHigh] = aHighWeight;
+    mPriorityWeight[kPriorityLow]  = (aLowWeight == 0) ? 1 : aLowWeight;
+}
+
+void Buffer::SetPriorityMaxLength(Priority aPriority, uint16_t aMaxLength) { mPriorityMaxLength[aPriority] = aMaxLength; }
+
+void Buffer::GetPriorityCounters(Priority aPriority, PriorityCounters &aCounters) const
+{
+    aCounters           = mCounters[aPriority];
+    aCounters.mNumBytes = GetQueuedLength(aPriority);
+}
+
+void Buffer::ResetCounters(void)
+{
+    for (PriorityCounters &counters : mCounters)
+    {
+        counters.mNumBytes      = 0;
+        counters.mMaxNumBytes   = 0;
+        counters.mAddedFrames   = 0;
+        counters.mDroppedFrames = 0;
+    }
+}
+
 // Returns an updated buffer pointer by moving forward/backward (based on `aDirection`) from `aBufPtr` by a given
 // offset. The resulting buffer pointer is ensured to stay within the `mBuffer` boundaries.
 uint8_t *Buffer::GetUpdatedBufPtr(uint8_t *aBufPtr, uint16_t aOffset, Direction aDirection) const
@@ -230,8 +268,12 @@ otError Buffer::InFrameAppend(uint8_t aByte)
 
     newTail = GetUpdatedBufPtr(mWriteSegmentTail, 1, mWriteDirection);
 
-    // Ensure the `newTail` has not reached the `mWriteFrameStart` for other direction (other priority level).
-    if (newTail != mWriteFrameStart[(mWriteDirection == kForward) ? kBackward : kForward])
+    // Ensure the `newTail` has not reached the `mWriteFrameStart` for other direction (other priority level), and
+    // that the priority level of the frame stays within its length limit (if any).
+    if ((newTail != mWriteFrameStart[(mWriteDirection == kForward) ? kBackward : kForward]) &&
+        ((mPriorityMaxLength[mWriteDirection] == 0) ||
+         (GetDistance(mReadFrameStart[mWriteDirection], newTail, mWriteDirection) <=
+          mPriorityMaxLength[mWriteDirection])))
     {
         *mWriteSegmentTail = aByte;
         mWriteSegmentTail  = newTail;
@@ -239,6 +281,7 @@ otError Buffer::InFrameAppend(uint8_t aByte)
     else
     {
         error = OT_ERROR_NO_BUFS;
+        mCounters[mWriteDirection].mDroppedFrames++;
         InFrameDiscard();
     }
 
@@ -513,9 +556,20 @@ otError Buffer::InFrameEnd(void)
     // Save and use the frame start pointer as the tag associated with the frame.
     mWriteFrameTag = mWriteFrameStart[mWriteDirection];
 
+    if (mWriteFrameStart[mWriteDirection] != mWriteSegmentHead)
+    {
+        PriorityCounters &counters = mCounters[mWriteDirection];
+
+        counters.mNumFrames++;
+        counters.mAddedFrames++;
+    }
+
     // Update the frame start pointer to current segment head to be ready for next frame.
     mWriteFrameStart[mWriteDirection] = mWriteSegmentHead;
 
+    mCounters[mWriteDirection].mMaxNumBytes =
+        Max(mCounters[mWriteDirection].mMaxNumBytes, GetQueuedLength(static_cast<Priority>(mWriteDirection)));
+
 #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
     // Move all the messages from the frame queue to the main queue.
     while ((message = otMessageQueueGetHead(&mWriteFrameMessageQueue)) != nullptr)
@@ -542,11 +596,49 @@ bool Buffer::HasFrame(Priority aPriority) const { return mReadFrameStart[aPriori
 
 bool Buffer::IsEmpty(void) const { return !HasFrame(kPriorityHigh) && !HasFrame(kPriorityLow); }
 
+// Returns the number of buffer bytes used by the fully written frames of a given priority.
+uint16_t Buffer::GetQueuedLength(Priority aPriority) const
+{
+    return GetDistance(mReadFrameStart[aPriority], mWriteFrameStart[aPriority], static_cast<Direction>(aPriority));
+}
+
 void Buffer::OutFrameSelectReadDirection(void)
 {
-    if (mReadState == kReadStateNotActive)
+    VerifyOrExit(mReadState == kReadStateNotActive);
+
+    if (!HasFrame(kPriorityHigh))
     {
-        mReadDirection = HasFrame(kPriorityHigh) ? kBackward : kForward;
+        mReadDirection = kForward;
+    }
+    else if (!HasFrame(kPriorityLow) || (mPriorityWeight[kPriorityHigh] == 0))
+    {
+        mReadDirection = kBackward;
+    }
+    else
+    {
+        // Both priority levels have frames, follow the weighted round-robin turn.
+        mReadDirection = static_cast<Direction>(mScheduledPriority);
+    }
+
+exit:
+    return;
+}
+
+// Updates the weighted round-robin turn after a frame of the given priority is removed.
+void Buffer::UpdateScheduleOnRemove(Priority aPriority)
+{
+    if (mScheduledPriority != aPriority)
+    {
+        mScheduledPriority = aPriority;
+        mScheduledCount    = 0;
+    }
+
+    mScheduledCount++;
+
+    if (mScheduledCount >= mPriorityWeight[aPriority])
+    {
+        mScheduledPriority = (aPriority == kPriorityHigh) ? kPriorityLow : kPriorityHigh;
+        mScheduledCount    = 0;
     }
 }
 
@@ -836,6 +928,9 @@ otError Buffer::OutFrameRemove(void)
 
     mReadFrameStart[mReadDirection] = bufPtr;
 
+    mCounters[mReadDirection].mNumFrames--;
+    UpdateScheduleOnRemove(static_cast<Priority>(mReadDirection));
+
     UpdateReadWriteStartPointers();
 
     mReadState       = kReadStateNotActive;
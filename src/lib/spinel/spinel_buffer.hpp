@@ -45,8 +45,10 @@ namespace Spinel {
  *
  * A frame can consist of a sequence of data bytes and/or the content of an `otMessage` or a combination of the two.
  * `Buffer` implements priority FIFO logic for storing and reading frames. Two priority levels of high and low
- * are supported. Within same priority level first-in-first-out order is preserved. High priority frames are read
- * ahead of any low priority ones.
+ * are supported. Within same priority level first-in-first-out order is preserved. By default high priority frames
+ * are read ahead of any low priority ones. Optionally, the two priority levels can be served in a weighted
+ * round-robin order (see `SetPriorityWeights()`) and the buffer space used by each priority level can be limited
+ * (see `SetPriorityMaxLength()`).
  *
  */
 class Buffer
@@ -65,6 +67,19 @@ public:
         kPriorityHigh = 1, ///< Indicates high priority for a frame.
     };
 
+    /**
+     * Represents the queue counters of a priority level in the `Buffer`.
+     *
+     */
+    struct PriorityCounters
+    {
+        uint16_t mNumFrames;     ///< Number of frames currently in the queue.
+        uint16_t mNumBytes;      ///< Number of buffer bytes currently used by the queued frames.
+        uint16_t mMaxNumBytes;   ///< Maximum number of buffer bytes used by the queued frames (high-water mark).
+        uint32_t mAddedFrames;   ///< Number of frames successfully added.
+        uint32_t mDroppedFrames; ///< Number of frames discarded due to insufficient buffer space or length limit.
+    };
+
     /**
      * Defines the (abstract) frame tag type. The tag is a unique value (within currently queued frames) associated
      * with a frame in the `Buffer`. Frame tags can be compared with one another using operator `==`.
@@ -153,6 +168,51 @@ public:
      */
     void SetFrameRemovedCallback(BufferCallback aFrameRemovedCallback, void *aFrameRemovedContext);
 
+    /**
+     * Sets the weights used to schedule reading of frames between the two priority levels.
+     *
+     * When both priority levels have frames, up to @p aHighWeight high priority frames are read followed by up to
+     * @p aLowWeight low priority frames, and so on (weighted round-robin). If @p aHighWeight is zero, high priority
+     * frames are always read ahead of any low priority ones (strict priority, which is the default behavior).
+     *
+     * A change in weights does not affect a current output frame (a frame prepared with `OutFrameBegin()`).
+     *
+     * @param[in] aHighWeight           The weight (number of frames per round) of the high priority level.
+     * @param[in] aLowWeight            The weight (number of frames per round) of the low priority level. Zero is
+     *                                  treated as one.
+     *
+     */
+    void SetPriorityWeights(uint8_t aHighWeight, uint8_t aLowWeight);
+
+    /**
+     * Sets the maximum number of buffer bytes which frames of a given priority level can occupy.
+     *
+     * Limiting the length of one priority level reserves the rest of the buffer for the other level. If writing to
+     * an input frame would make its priority level exceed the limit, the frame is discarded and `OT_ERROR_NO_BUFS` is
+     * returned (same as when the buffer is full). By default there is no limit.
+     *
+     * @param[in] aPriority             The priority level.
+     * @param[in] aMaxLength            The maximum number of bytes. Zero indicates no limit.
+     *
+     */
+    void SetPriorityMaxLength(Priority aPriority, uint16_t aMaxLength);
+
+    /**
+     * Gets the queue counters of a given priority level.
+     *
+     * @param[in]  aPriority            The priority level.
+     * @param[out] aCounters            A reference to a `PriorityCounters` to output the counters.
+     *
+     */
+    void GetPriorityCounters(Priority aPriority, PriorityCounters &aCounters) const;
+
+    /**
+     * Resets the cumulative counters (number of added and dropped frames, and the high-water mark) of both priority
+     * levels.
+     *
+     */
+    void ResetCounters(void);
+
     /**
      * Begins a new input frame (InFrame) to be added/written to the frame buffer.
 
@@ -602,8 +662,10 @@ private:
     uint16_t ReadUint16At(uint8_t *aBufPtr, Direction aDirection);
     void     WriteUint16At(uint8_t *aBufPtr, uint16_t aValue, Direction aDirection);
 
-    bool HasFrame(Priority aPriority) const;
-    void UpdateReadWriteStartPointers(void);
+    bool     HasFrame(Priority aPriority) const;
+    uint16_t GetQueuedLength(Priority aPriority) const;
+    void     UpdateReadWriteStartPointers(void);
+    void     UpdateScheduleOnRemove(Priority aPriority);
 
     otError InFrameAppend(uint8_t aByte);
     otError InFrameBeginSegment(void);
@@ -629,6 +691,12 @@ private:
     BufferCallback mFrameRemovedCallback; // Callback to signal when a frame is removed.
     void          *mFrameRemovedContext;  // Context passed to `mFrameRemovedCallback`.
 
+    uint8_t          mPriorityWeight[kNumPrios];    // Weighted round-robin weights (zero high weight: strict).
+    uint16_t         mPriorityMaxLength[kNumPrios]; // Max number of bytes used per priority (zero for no limit).
+    Priority         mScheduledPriority;            // Priority level which currently has the read turn.
+    uint8_t          mScheduledCount;               // Number of frames read in the current turn.
+    PriorityCounters mCounters[kNumPrios];          // Queue counters per priority level.
+
     Direction mWriteDirection;             // Direction (priority) for current frame being read.
     uint8_t  *mWriteFrameStart[kNumPrios]; // Pointer to start of current frame being written.
     uint8_t  *mWriteSegmentHead;           // Pointer to start of current segment in the frame being written.
@@ -48,31 +48,29 @@ otError Encoder::BeginFrame(Spinel::Buffer::Priority aPriority)
 
 otError Encoder::BeginFrame(uint8_t aHeader, unsigned int aCommand)
 {
-    otError error = OT_ERROR_NONE;
-
     // Non-zero TID indicates this is a response to a spinel command.
 
-    if (SPINEL_HEADER_GET_TID(aHeader) != 0)
-    {
-        SuccessOrExit(error = BeginFrame(Spinel::Buffer::kPriorityHigh));
-    }
-    else
-    {
-        SuccessOrExit(error = BeginFrame(Spinel::Buffer::kPriorityLow));
-    }
-
-    SuccessOrExit(error = WriteUint8(aHeader));
-    SuccessOrExit(error = WriteUintPacked(aCommand));
-
-exit:
-    return error;
+    return BeginFrame((SPINEL_HEADER_GET_TID(aHeader) != 0) ? Spinel::Buffer::kPriorityHigh
+                                                            : Spinel::Buffer::kPriorityLow,
+                      aHeader, aCommand);
 }
 
 otError Encoder::BeginFrame(uint8_t aHeader, unsigned int aCommand, spinel_prop_key_t aKey)
 {
-    otError error = OT_ERROR_NONE;
+    otError                  error    = OT_ERROR_NONE;
+    Spinel::Buffer::Priority priority = Spinel::Buffer::kPriorityHigh;
+
+    // Unsolicited frames (zero TID) carrying stream data (e.g., IPv6
+    // or raw frames, logs) use the low priority level. All other
+    // frames (responses and property update notifications) use the
+    // high priority level so that they are not held behind bulk data.
+
+    if ((SPINEL_HEADER_GET_TID(aHeader) == 0) && IsStreamProperty(aKey))
+    {
+        priority = Spinel::Buffer::kPriorityLow;
+    }
 
-    SuccessOrExit(error = BeginFrame(aHeader, aCommand));
+    SuccessOrExit(error = BeginFrame(priority, aHeader, aCommand));
 
     // The write position is saved before writing the property key,
     // so that if fetching the property fails and we need to
@@ -87,6 +85,41 @@ exit:
     return error;
 }
 
+otError Encoder::BeginFrame(Spinel::Buffer::Priority aPriority, uint8_t aHeader, unsigned int aCommand)
+{
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = BeginFrame(aPriority));
+    SuccessOrExit(error = WriteUint8(aHeader));
+    SuccessOrExit(error = WriteUintPacked(aCommand));
+
+exit:
+    return error;
+}
+
+bool Encoder::IsStreamProperty(spinel_prop_key_t aKey)
+{
+    bool isStream = false;
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_STREAM_DEBUG:
+    case SPINEL_PROP_STREAM_RAW:
+    case SPINEL_PROP_STREAM_NET:
+    case SPINEL_PROP_STREAM_NET_INSECURE:
+    case SPINEL_PROP_STREAM_LOG:
+    case SPINEL_PROP_THREAD_UDP_FORWARD_STREAM:
+    case SPINEL_PROP_NEST_STREAM_MFG:
+        isStream = true;
+        break;
+
+    default:
+        break;
+    }
+
+    return isStream;
+}
+
 otError Encoder::OverwriteWithLastStatusError(spinel_status_t aStatus)
 {
     otError error = OT_ERROR_NONE;
@@ -103,8 +103,10 @@ public:
      * If there is a previous frame being written (for which `EndFrame()` has not yet been called), calling
      * `BeginFrame()` will discard and clear the previous unfinished frame.
      *
-     * The spinel transaction ID (TID) in the given spinel header is used to determine the priority level of the new
-     * frame. Non-zero TID value indicates that the frame is a response and therefore it uses higher priority level.
+     * The spinel transaction ID (TID) in the given spinel header and the property key are used to determine the
+     * priority level of the new frame. Unsolicited frames (zero TID) for stream properties (e.g., IPv6 data, raw
+     * frames, logs) use the low priority level. All other frames (responses and property update notifications) use
+     * the higher priority level.
      *
      * Saves the write position before the property key (see also `SavePosition()`) so that if fetching the
      * property fails and the property key should be switched to `LAST_STATUS` with an error status, the saved
@@ -683,6 +685,9 @@ private:
         kMaxNestedStructs     = 4,  ///< Maximum number of nested structs.
     };
 
+    otError     BeginFrame(Spinel::Buffer::Priority aPriority, uint8_t aHeader, unsigned int aCommand);
+    static bool IsStreamProperty(spinel_prop_key_t aKey);
+
     Spinel::Buffer               &mNcpBuffer;
     Spinel::Buffer::WritePosition mStructPosition[kMaxNestedStructs];
     uint8_t                       mNumOpenStructs;
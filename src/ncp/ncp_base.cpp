@@ -200,6 +200,9 @@ static spinel_status_t ResetReasonToSpinelStatus(otPlatResetReason aReason)
 // MARK: Class Boilerplate
 // ----------------------------------------------------------------------------
 
+static_assert(OPENTHREAD_CONFIG_NCP_TX_BUFFER_HIGH_PRIORITY_RESERVED_SIZE < OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE,
+              "NCP TX buffer high priority reserved size must be smaller than the TX buffer size");
+
 NcpBase *NcpBase::sNcpInstance = nullptr;
 
 NcpBase::NcpBase(Instance *aInstance)
@@ -258,6 +261,9 @@ NcpBase::NcpBase(Instance *aInstance)
     , mRxSpinelOutOfOrderTidCounter(0)
     , mTxSpinelFrameCounter(0)
     , mDidInitialUpdates(false)
+    , mUnsolUpdateBatchEnabled(false)
+    , mUnsolUpdateBatchFrameCounter(0)
+    , mUnsolUpdateBatchSavedFrameCounter(0)
     , mLogTimestampBase(0)
 {
     OT_ASSERT(mInstance != nullptr);
@@ -265,6 +271,9 @@ NcpBase::NcpBase(Instance *aInstance)
     sNcpInstance = this;
 
     mTxFrameBuffer.SetFrameRemovedCallback(&NcpBase::HandleFrameRemovedFromNcpBuffer, this);
+    mTxFrameBuffer.SetPriorityWeights(OPENTHREAD_CONFIG_NCP_TX_BUFFER_HIGH_PRIORITY_WEIGHT, 1);
+    mTxFrameBuffer.SetPriorityMaxLength(Spinel::Buffer::kPriorityLow,
+                                        kTxBufferSize - OPENTHREAD_CONFIG_NCP_TX_BUFFER_HIGH_PRIORITY_RESERVED_SIZE);
 
     memset(&mResponseQueue, 0, sizeof(mResponseQueue));
 
@@ -310,6 +319,11 @@ void NcpBase::ResetCounters(void)
     mRxSpinelOutOfOrderTidCounter = 0;
     mTxSpinelFrameCounter         = 0;
 
+    mTxFrameBuffer.ResetCounters();
+
+    mUnsolUpdateBatchFrameCounter      = 0;
+    mUnsolUpdateBatchSavedFrameCounter = 0;
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     mInboundSecureIpFrameCounter    = 0;
     mInboundInsecureIpFrameCounter  = 0;
@@ -837,6 +851,12 @@ void NcpBase::UpdateChangedProps(void)
 
     VerifyOrExit(!mChangedPropsSet.IsEmpty());
 
+    if (mUnsolUpdateBatchEnabled && mDidInitialUpdates)
+    {
+        SuccessOrExit(WriteChangedPropsBatchFrame());
+        VerifyOrExit(!mChangedPropsSet.IsEmpty());
+    }
+
     entry = mChangedPropsSet.GetSupportedEntries(numEntries);
 
     for (uint8_t index = 0; index < numEntries; index++, entry++)
@@ -872,6 +892,118 @@ exit:
     mDidInitialUpdates = true;
 }
 
+otError NcpBase::WriteChangedPropsBatchFrame(void)
+{
+    // Writes a `VALUES_ARE` frame containing as many of the changed
+    // properties (other than `LAST_STATUS`) as fit in a single spinel
+    // frame. The entries included in the frame are removed from the
+    // changed set, the remaining ones are left to be sent as separate
+    // `VALUE_IS` frames by the caller.
+
+    otError                       error = OT_ERROR_NONE;
+    uint8_t                       numEntries;
+    uint8_t                       numCandidates = 0;
+    uint8_t                       numBatched    = 0;
+    uint64_t                      batchedMask   = 0;
+    const ChangedPropsSet::Entry *entry;
+    Spinel::Buffer::WritePosition startPosition;
+
+    entry = mChangedPropsSet.GetSupportedEntries(numEntries);
+
+    for (uint8_t index = 0; index < numEntries; index++)
+    {
+        if (mChangedPropsSet.IsEntryChanged(index) && (entry[index].mPropKey != SPINEL_PROP_LAST_STATUS))
+        {
+            numCandidates++;
+        }
+    }
+
+    // A batch is only beneficial with two or more property updates.
+    VerifyOrExit(numCandidates >= 2);
+
+    SuccessOrExit(error = mEncoder.BeginFrame(Spinel::Buffer::kPriorityHigh));
+    SuccessOrExit(error = mEncoder.WriteUint8(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0));
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CMD_PROP_VALUES_ARE));
+    SuccessOrExit(error = mTxFrameBuffer.InFrameGetPosition(startPosition));
+
+    for (uint8_t index = 0; index < numEntries; index++, entry++)
+    {
+        PropertyHandler handler;
+
+        if (!mChangedPropsSet.IsEntryChanged(index) || (entry->mPropKey == SPINEL_PROP_LAST_STATUS))
+        {
+            continue;
+        }
+
+        handler = FindGetPropertyHandler(entry->mPropKey);
+
+        if (handler == nullptr)
+        {
+            continue;
+        }
+
+        SuccessOrExit(error = mEncoder.SavePosition());
+
+        error = mEncoder.OpenStruct();
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = mEncoder.WriteUintPacked(entry->mPropKey);
+        }
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = (this->*handler)();
+        }
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = mEncoder.CloseStruct();
+        }
+
+        if ((error == OT_ERROR_NONE) &&
+            (mTxFrameBuffer.InFrameGetDistance(startPosition) > SPINEL_FRAME_MAX_COMMAND_PAYLOAD_SIZE))
+        {
+            error = OT_ERROR_NO_BUFS;
+        }
+
+        if (error != OT_ERROR_NONE)
+        {
+            // Drop this entry from the batch (it is sent later in its
+            // own frame). If the frame itself was discarded (e.g., the
+            // buffer ran out of space) `ResetToSaved()` fails and we
+            // give up on batching.
+
+            SuccessOrExit(error = mEncoder.ResetToSaved());
+            continue;
+        }
+
+        batchedMask |= (1ULL << index);
+        numBatched++;
+    }
+
+    // If fewer than two entries fit, the batch is not worth sending.
+    // The unfinished frame is discarded when the next frame begins
+    // and the caller sends the property updates individually.
+    VerifyOrExit(numBatched >= 2);
+
+    SuccessOrExit(error = mEncoder.EndFrame());
+
+    for (uint8_t index = 0; index < numEntries; index++)
+    {
+        if (batchedMask & (1ULL << index))
+        {
+            mChangedPropsSet.RemoveEntry(index);
+        }
+    }
+
+    mUnsolUpdateBatchFrameCounter++;
+    mUnsolUpdateBatchSavedFrameCounter += numBatched - 1;
+
+exit:
+    return error;
+}
+
 // ----------------------------------------------------------------------------
 // MARK: Inbound Command Handler
 // ----------------------------------------------------------------------------
@@ -1955,6 +2087,12 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_REFERENCE_DEVICE));
 #endif
 
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_UNSOL_UPDATE_BATCH));
+
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_LATENCY_TRACE));
+#endif
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_THREAD_BACKBONE_ROUTER));
 #endif
@@ -2180,6 +2318,35 @@ exit:
     return error;
 }
 
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_UNSOL_UPDATE_BATCH_ENABLE>(void)
+{
+    return mEncoder.WriteBool(mUnsolUpdateBatchEnabled);
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_UNSOL_UPDATE_BATCH_ENABLE>(void)
+{
+    return mDecoder.ReadBool(mUnsolUpdateBatchEnabled);
+}
+
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_UNSOL_UPDATE_BATCH>(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mEncoder.WriteUint32(mUnsolUpdateBatchFrameCounter));
+    SuccessOrExit(error = mEncoder.WriteUint32(mUnsolUpdateBatchSavedFrameCounter));
+
+exit:
+    return error;
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_UNSOL_UPDATE_BATCH>(void)
+{
+    mUnsolUpdateBatchFrameCounter      = 0;
+    mUnsolUpdateBatchSavedFrameCounter = 0;
+
+    return OT_ERROR_NONE;
+}
+
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_RSSI>(void)
 {
     return mEncoder.WriteInt8(otPlatRadioGetRssi(mInstance));
@@ -231,6 +231,7 @@ protected:
 
     static void UpdateChangedProps(Tasklet &aTasklet);
     void        UpdateChangedProps(void);
+    otError     WriteChangedPropsBatchFrame(void);
 
     static void HandleFrameRemovedFromNcpBuffer(void                    *aContext,
                                                 Spinel::Buffer::FrameTag aFrameTag,
@@ -635,6 +636,10 @@ protected:
 
     bool mDidInitialUpdates;
 
+    bool     mUnsolUpdateBatchEnabled;           // Whether host accepts batched (`VALUES_ARE`) updates.
+    uint32_t mUnsolUpdateBatchFrameCounter;      // Number of sent batched property update frames.
+    uint32_t mUnsolUpdateBatchSavedFrameCounter; // Number of frames saved by batching property updates.
+
     uint64_t mLogTimestampBase; // Timestamp base used for logging
 };
 
@@ -206,6 +206,11 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_ALL_IP_COUNTERS),
 #if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_MAC_RETRY_HISTOGRAM),
+#endif
+        OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_NCP_TX_BUFFER),
+        OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_UNSOL_UPDATE_BATCH),
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+        OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_LATENCY_TRACE),
 #endif
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 #if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
@@ -220,6 +225,10 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_UNSOL_UPDATE_FILTER),
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_UNSOL_UPDATE_LIST),
+        OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_UNSOL_UPDATE_BATCH_ENABLE),
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+        OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_LATENCY_TRACE_SAMPLE_INTERVAL),
+#endif
 #if OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_ENABLE),
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECTED),
@@ -479,6 +488,11 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
         OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CNTR_ALL_IP_COUNTERS),
 #if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
         OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CNTR_MAC_RETRY_HISTOGRAM),
+#endif
+        OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CNTR_NCP_TX_BUFFER),
+        OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CNTR_UNSOL_UPDATE_BATCH),
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+        OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CNTR_LATENCY_TRACE),
 #endif
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 #if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
@@ -490,6 +504,10 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
 #endif // OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
         OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_UNSOL_UPDATE_FILTER),
+        OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_UNSOL_UPDATE_BATCH_ENABLE),
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+        OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_LATENCY_TRACE_SAMPLE_INTERVAL),
+#endif
 #if OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
         OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_ENABLE),
         OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_RSSI_THRESHOLD),
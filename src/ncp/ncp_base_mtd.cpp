@@ -64,6 +64,9 @@
 #if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_ENABLE
 #include <openthread/srp_client_buffers.h>
 #endif
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+#include <openthread/trace.h>
+#endif
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 #include <openthread/trel.h>
 #endif
@@ -2873,6 +2876,94 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_ALL_IP_COUNTERS>
     return OT_ERROR_NONE;
 }
 
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_NCP_TX_BUFFER>(void)
+{
+    static const Spinel::Buffer::Priority kPriorities[] = {Spinel::Buffer::kPriorityHigh,
+                                                           Spinel::Buffer::kPriorityLow};
+
+    otError                          error = OT_ERROR_NONE;
+    Spinel::Buffer::PriorityCounters counters;
+
+    for (Spinel::Buffer::Priority priority : kPriorities)
+    {
+        mTxFrameBuffer.GetPriorityCounters(priority, counters);
+
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUint16(counters.mNumFrames));
+        SuccessOrExit(error = mEncoder.WriteUint16(counters.mNumBytes));
+        SuccessOrExit(error = mEncoder.WriteUint16(counters.mMaxNumBytes));
+        SuccessOrExit(error = mEncoder.WriteUint32(counters.mAddedFrames));
+        SuccessOrExit(error = mEncoder.WriteUint32(counters.mDroppedFrames));
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+exit:
+    return error;
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_NCP_TX_BUFFER>(void)
+{
+    mTxFrameBuffer.ResetCounters();
+
+    return OT_ERROR_NONE;
+}
+
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_LATENCY_TRACE_SAMPLE_INTERVAL>(void)
+{
+    return mEncoder.WriteUint16(otTraceGetSampleInterval(mInstance));
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_LATENCY_TRACE_SAMPLE_INTERVAL>(void)
+{
+    uint16_t interval;
+    otError  error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mDecoder.ReadUint16(interval));
+    otTraceSetSampleInterval(mInstance, interval);
+
+exit:
+    return error;
+}
+
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_LATENCY_TRACE>(void)
+{
+    otError           error = OT_ERROR_NONE;
+    otTraceStageStats stats;
+
+    SuccessOrExit(error = mEncoder.WriteUint32(otTraceGetNumTracedMessages(mInstance)));
+
+    for (uint8_t stage = 0; stage < OT_TRACE_NUM_STAGES; stage++)
+    {
+        SuccessOrExit(error = otTraceGetStageStats(mInstance, static_cast<otTraceStage>(stage), &stats));
+
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUint32(stats.mCount));
+        SuccessOrExit(error = mEncoder.WriteUint32(stats.mMaxLatency));
+        SuccessOrExit(error = mEncoder.WriteUint64(stats.mTotalLatency));
+
+        for (uint32_t binCount : stats.mHistogram)
+        {
+            SuccessOrExit(error = mEncoder.WriteUint32(binCount));
+        }
+
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+exit:
+    return error;
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_LATENCY_TRACE>(void)
+{
+    otTraceResetStats(mInstance);
+
+    return OT_ERROR_NONE;
+}
+
+#endif // OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+
 #if OPENTHREAD_CONFIG_MAC_FILTER_ENABLE
 
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_ALLOWLIST>(void)
@@ -69,6 +69,30 @@
 #define OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE 2048
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_TX_BUFFER_HIGH_PRIORITY_WEIGHT
+ *
+ * The number of high priority frames (responses and property update notifications) read from the NCP message buffer
+ * for every low priority frame (stream data) when both are pending (weighted round-robin).
+ *
+ * Zero makes high priority frames always go ahead of any low priority ones (strict priority).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_TX_BUFFER_HIGH_PRIORITY_WEIGHT
+#define OPENTHREAD_CONFIG_NCP_TX_BUFFER_HIGH_PRIORITY_WEIGHT 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_TX_BUFFER_HIGH_PRIORITY_RESERVED_SIZE
+ *
+ * The number of bytes in the NCP message buffer which low priority frames (stream data) cannot use, reserving them
+ * for high priority frames (responses and property update notifications).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_TX_BUFFER_HIGH_PRIORITY_RESERVED_SIZE
+#define OPENTHREAD_CONFIG_NCP_TX_BUFFER_HIGH_PRIORITY_RESERVED_SIZE 256
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_HDLC_TX_CHUNK_SIZE
  *
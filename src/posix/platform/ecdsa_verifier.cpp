@@ -0,0 +1,424 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the thread verifying ECDSA signatures outside of the OpenThread thread.
+ */
+
+#include "openthread-posix-config.h"
+#include "platform-posix.h"
+
+#if OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <mbedtls/bignum.h>
+#include <mbedtls/ecdsa.h>
+
+#include <openthread/logging.h>
+
+#include "common/code_utils.hpp"
+#include "posix/platform/ecdsa_verifier.hpp"
+
+#if !OPENTHREAD_CONFIG_ECDSA_ENABLE
+#error "OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE requires OPENTHREAD_CONFIG_ECDSA_ENABLE"
+#endif
+
+#if !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+#error "OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE requires OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE"
+#endif
+
+namespace ot {
+namespace Posix {
+
+EcdsaVerifier &EcdsaVerifier::Get(void)
+{
+    static EcdsaVerifier sInstance;
+
+    return sInstance;
+}
+
+EcdsaVerifier::EcdsaVerifier(void)
+    : mRunning(false)
+    , mStopping(false)
+    , mNextSequence(0)
+    , mKeyUseCounter(0)
+{
+    pthread_mutex_init(&mMutex, nullptr);
+    pthread_cond_init(&mQueueCond, nullptr);
+    mWakeFds[0] = -1;
+    mWakeFds[1] = -1;
+    memset(mJobs, 0, sizeof(mJobs));
+    memset(mKeyCache, 0, sizeof(mKeyCache));
+    memset(&mCounters, 0, sizeof(mCounters));
+}
+
+void EcdsaVerifier::SetUp(void)
+{
+    // mbedTLS allocates through `otPlatCAlloc()` here, so the worker
+    // relies on the external (thread-safe) heap.
+    mbedtls_ecp_group_init(&mGroup);
+    VerifyOrDie(mbedtls_ecp_group_load(&mGroup, MBEDTLS_ECP_DP_SECP256R1) == 0, OT_EXIT_FAILURE);
+
+    VerifyOrDie(pipe(mWakeFds) == 0, OT_EXIT_ERROR_ERRNO);
+
+    for (int fd : mWakeFds)
+    {
+        VerifyOrDie(fcntl(fd, F_SETFL, O_NONBLOCK) == 0, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(fcntl(fd, F_SETFD, FD_CLOEXEC) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    mStopping = false;
+    VerifyOrDie(pthread_create(&mWorker, nullptr, HandleWorker, this) == 0, OT_EXIT_ERROR_ERRNO);
+    mRunning = true;
+
+    Mainloop::Manager::Get().Add(*this);
+
+    otLogInfoPlat("ECDSA verifier: %u job slots, %u cached keys", kNumJobs, kKeyCacheSize);
+}
+
+void EcdsaVerifier::TearDown(void)
+{
+    VerifyOrExit(mRunning);
+
+    Mainloop::Manager::Get().Remove(*this);
+
+    pthread_mutex_lock(&mMutex);
+    mStopping = true;
+    pthread_cond_signal(&mQueueCond);
+    pthread_mutex_unlock(&mMutex);
+
+    pthread_join(mWorker, nullptr);
+    mRunning = false;
+
+    // The OpenThread instance is being finalized, outstanding
+    // verifications are dropped without being reported.
+    memset(mJobs, 0, sizeof(mJobs));
+
+    ClearKeyCache();
+    mbedtls_ecp_group_free(&mGroup);
+
+    close(mWakeFds[0]);
+    close(mWakeFds[1]);
+    mWakeFds[0] = -1;
+    mWakeFds[1] = -1;
+
+exit:
+    return;
+}
+
+otError EcdsaVerifier::Start(otInstance                       *aInstance,
+                             const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                             const otPlatCryptoSha256Hash     *aHash,
+                             const otPlatCryptoEcdsaSignature *aSignature,
+                             void                             *aContext)
+{
+    otError error = OT_ERROR_BUSY;
+
+    VerifyOrExit(mRunning, error = OT_ERROR_INVALID_STATE);
+
+    pthread_mutex_lock(&mMutex);
+
+    for (Job &job : mJobs)
+    {
+        if (job.mState != kJobFree)
+        {
+            continue;
+        }
+
+        job.mSequence  = mNextSequence++;
+        job.mInstance  = aInstance;
+        job.mContext   = aContext;
+        job.mPublicKey = *aPublicKey;
+        job.mHash      = *aHash;
+        job.mSignature = *aSignature;
+        job.mState     = kJobQueued;
+
+        pthread_cond_signal(&mQueueCond);
+        error = OT_ERROR_NONE;
+        break;
+    }
+
+    pthread_mutex_unlock(&mMutex);
+
+    if (error == OT_ERROR_BUSY)
+    {
+        mCounters.mBusy++;
+    }
+
+exit:
+    return error;
+}
+
+void EcdsaVerifier::Update(otSysMainloopContext &aContext)
+{
+    VerifyOrExit(mRunning);
+
+    FD_SET(mWakeFds[0], &aContext.mReadFdSet);
+
+    if (aContext.mMaxFd < mWakeFds[0])
+    {
+        aContext.mMaxFd = mWakeFds[0];
+    }
+
+exit:
+    return;
+}
+
+void EcdsaVerifier::Process(const otSysMainloopContext &aContext)
+{
+    uint8_t buffer[16];
+
+    VerifyOrExit(mRunning && FD_ISSET(mWakeFds[0], &aContext.mReadFdSet));
+
+    while (read(mWakeFds[0], buffer, sizeof(buffer)) > 0)
+    {
+    }
+
+    // The lock is released before reporting each outcome since
+    // OpenThread may start another verification from the callback.
+
+    while (true)
+    {
+        Job  *job;
+        Job   done;
+        bool  found = false;
+
+        pthread_mutex_lock(&mMutex);
+
+        job = FindOldestJob(kJobDone);
+
+        if (job != nullptr)
+        {
+            done        = *job;
+            job->mState = kJobFree;
+            found       = true;
+        }
+
+        pthread_mutex_unlock(&mMutex);
+
+        if (!found)
+        {
+            break;
+        }
+
+        if (done.mError == OT_ERROR_NONE)
+        {
+            mCounters.mVerified++;
+        }
+        else
+        {
+            mCounters.mFailed++;
+        }
+
+        if (done.mKeyCacheHit)
+        {
+            mCounters.mKeyCacheHits++;
+        }
+        else
+        {
+            mCounters.mKeyCacheMisses++;
+        }
+
+        otPlatCryptoEcdsaVerifyDone(done.mInstance, done.mContext, done.mError);
+    }
+
+exit:
+    return;
+}
+
+EcdsaVerifier::Job *EcdsaVerifier::FindOldestJob(JobState aState)
+{
+    Job *oldest = nullptr;
+
+    for (Job &job : mJobs)
+    {
+        // Sequence numbers are compared by their distance so that
+        // the order is kept when they wrap around.
+        if ((job.mState == aState) &&
+            ((oldest == nullptr) || static_cast<int32_t>(job.mSequence - oldest->mSequence) < 0))
+        {
+            oldest = &job;
+        }
+    }
+
+    return oldest;
+}
+
+void EcdsaVerifier::VerifyJob(Job &aJob)
+{
+    const mbedtls_ecp_point *point;
+    mbedtls_mpi              r;
+    mbedtls_mpi              s;
+
+    mbedtls_mpi_init(&r);
+    mbedtls_mpi_init(&s);
+
+    point = FindOrParseKey(aJob.mPublicKey, aJob.mKeyCacheHit);
+    VerifyOrExit(point != nullptr, aJob.mError = OT_ERROR_INVALID_ARGS);
+
+    VerifyOrExit(mbedtls_mpi_read_binary(&r, aJob.mSignature.m8, kCoordinateSize) == 0,
+                 aJob.mError = OT_ERROR_NO_BUFS);
+    VerifyOrExit(mbedtls_mpi_read_binary(&s, aJob.mSignature.m8 + kCoordinateSize, kCoordinateSize) == 0,
+                 aJob.mError = OT_ERROR_NO_BUFS);
+
+    aJob.mError = (mbedtls_ecdsa_verify(&mGroup, aJob.mHash.m8, sizeof(aJob.mHash.m8), point, &r, &s) == 0)
+                      ? OT_ERROR_NONE
+                      : OT_ERROR_SECURITY;
+
+exit:
+    mbedtls_mpi_free(&s);
+    mbedtls_mpi_free(&r);
+}
+
+const mbedtls_ecp_point *EcdsaVerifier::FindOrParseKey(const otPlatCryptoEcdsaPublicKey &aPublicKey, bool &aCacheHit)
+{
+    CachedKey *entry = nullptr;
+    uint8_t    encoded[1 + OT_CRYPTO_ECDSA_PUBLIC_KEY_SIZE];
+
+    mKeyUseCounter++;
+    aCacheHit = false;
+
+    for (CachedKey &cachedKey : mKeyCache)
+    {
+        if (cachedKey.mIsValid && memcmp(cachedKey.mPublicKey.m8, aPublicKey.m8, sizeof(aPublicKey.m8)) == 0)
+        {
+            cachedKey.mLastUse = mKeyUseCounter;
+            aCacheHit          = true;
+            ExitNow(entry = &cachedKey);
+        }
+
+        // Use a free entry, or else the least recently used one.
+        if ((entry == nullptr) || (entry->mIsValid && (!cachedKey.mIsValid || cachedKey.mLastUse < entry->mLastUse)))
+        {
+            entry = &cachedKey;
+        }
+    }
+
+    if (entry->mIsValid)
+    {
+        mbedtls_ecp_point_free(&entry->mPoint);
+        entry->mIsValid = false;
+    }
+
+    encoded[0] = kUncompressedTag;
+    memcpy(&encoded[1], aPublicKey.m8, sizeof(aPublicKey.m8));
+
+    mbedtls_ecp_point_init(&entry->mPoint);
+
+    if ((mbedtls_ecp_point_read_binary(&mGroup, &entry->mPoint, encoded, sizeof(encoded)) != 0) ||
+        (mbedtls_ecp_check_pubkey(&mGroup, &entry->mPoint) != 0))
+    {
+        mbedtls_ecp_point_free(&entry->mPoint);
+        ExitNow(entry = nullptr);
+    }
+
+    entry->mPublicKey = aPublicKey;
+    entry->mLastUse   = mKeyUseCounter;
+    entry->mIsValid   = true;
+
+exit:
+    return (entry != nullptr) ? &entry->mPoint : nullptr;
+}
+
+void EcdsaVerifier::ClearKeyCache(void)
+{
+    for (CachedKey &cachedKey : mKeyCache)
+    {
+        if (cachedKey.mIsValid)
+        {
+            mbedtls_ecp_point_free(&cachedKey.mPoint);
+            cachedKey.mIsValid = false;
+        }
+    }
+}
+
+void *EcdsaVerifier::HandleWorker(void *aContext)
+{
+    static_cast<EcdsaVerifier *>(aContext)->RunWorker();
+
+    return nullptr;
+}
+
+void EcdsaVerifier::RunWorker(void)
+{
+    static const uint8_t kWakeUp = 1;
+
+    pthread_mutex_lock(&mMutex);
+
+    while (true)
+    {
+        Job *job = nullptr;
+
+        while (!mStopping && (job = FindOldestJob(kJobQueued)) == nullptr)
+        {
+            pthread_cond_wait(&mQueueCond, &mMutex);
+        }
+
+        if (mStopping)
+        {
+            break;
+        }
+
+        job->mState = kJobVerifying;
+        pthread_mutex_unlock(&mMutex);
+
+        VerifyJob(*job);
+
+        pthread_mutex_lock(&mMutex);
+        job->mState = kJobDone;
+
+        // A full pipe already guarantees a wake-up of the main loop.
+        IgnoreReturnValue(write(mWakeFds[1], &kWakeUp, sizeof(kWakeUp)));
+    }
+
+    pthread_mutex_unlock(&mMutex);
+}
+
+} // namespace Posix
+} // namespace ot
+
+otError otPlatCryptoEcdsaVerifyStart(otInstance                       *aInstance,
+                                     const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                     const otPlatCryptoSha256Hash     *aHash,
+                                     const otPlatCryptoEcdsaSignature *aSignature,
+                                     void                             *aContext)
+{
+    return ot::Posix::EcdsaVerifier::Get().Start(aInstance, aPublicKey, aHash, aSignature, aContext);
+}
+
+const otSysEcdsaVerifierCounters *otSysGetEcdsaVerifierCounters(void)
+{
+    return &ot::Posix::EcdsaVerifier::Get().GetCounters();
+}
+
+void otSysResetEcdsaVerifierCounters(void) { ot::Posix::EcdsaVerifier::Get().ResetCounters(); }
+
+#endif // OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
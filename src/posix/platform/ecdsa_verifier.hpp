@@ -0,0 +1,205 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the thread verifying ECDSA signatures outside of the OpenThread thread.
+ */
+
+#ifndef OT_POSIX_PLATFORM_ECDSA_VERIFIER_HPP_
+#define OT_POSIX_PLATFORM_ECDSA_VERIFIER_HPP_
+
+#include "openthread-posix-config.h"
+
+#if OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <mbedtls/ecp.h>
+
+#include <openthread/instance.h>
+#include <openthread/openthread-system.h>
+#include <openthread/platform/crypto.h>
+
+#include "core/common/non_copyable.hpp"
+#include "posix/platform/mainloop.hpp"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * Verifies ECDSA P-256 signatures on a worker thread.
+ *
+ * Implements `otPlatCryptoEcdsaVerifyStart()`. Requests are copied into a fixed number of job slots and verified in
+ * order by the worker thread. The outcome is reported from the main loop through `otPlatCryptoEcdsaVerifyDone()`.
+ *
+ * The worker keeps the curve parameters loaded and caches the decoded and validated points of the most recently used
+ * public keys, so that repeated updates signed with the same key only cost the signature check itself.
+ *
+ */
+class EcdsaVerifier : public Mainloop::Source, private NonCopyable
+{
+public:
+    /**
+     * Returns the ECDSA verifier.
+     *
+     * @returns The ECDSA verifier.
+     *
+     */
+    static EcdsaVerifier &Get(void);
+
+    /**
+     * Starts the worker thread and registers the verifier in the main loop.
+     *
+     */
+    void SetUp(void);
+
+    /**
+     * Stops the worker thread and drops all outstanding verifications.
+     *
+     */
+    void TearDown(void);
+
+    /**
+     * Queues a signature verification.
+     *
+     * @param[in]  aInstance   The OpenThread instance to report the outcome to.
+     * @param[in]  aPublicKey  The public key.
+     * @param[in]  aHash       The SHA-256 hash of the signed message.
+     * @param[in]  aSignature  The signature.
+     * @param[in]  aContext    An arbitrary context passed back in `otPlatCryptoEcdsaVerifyDone()`.
+     *
+     * @retval OT_ERROR_NONE           The verification is queued.
+     * @retval OT_ERROR_BUSY           All job slots are in use.
+     * @retval OT_ERROR_INVALID_STATE  The worker thread is not running.
+     *
+     */
+    otError Start(otInstance                       *aInstance,
+                  const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                  const otPlatCryptoSha256Hash     *aHash,
+                  const otPlatCryptoEcdsaSignature *aSignature,
+                  void                             *aContext);
+
+    /**
+     * Updates the fd_set for the main loop.
+     *
+     * @param[in,out]  aContext  A reference to the mainloop context.
+     *
+     */
+    void Update(otSysMainloopContext &aContext) override;
+
+    /**
+     * Reports the completed verifications to OpenThread.
+     *
+     * @param[in]  aContext  A reference to the mainloop context.
+     *
+     */
+    void Process(const otSysMainloopContext &aContext) override;
+
+    /**
+     * Returns the ECDSA verifier counters.
+     *
+     * @returns The ECDSA verifier counters.
+     *
+     */
+    const otSysEcdsaVerifierCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the ECDSA verifier counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
+private:
+    static constexpr uint8_t kNumJobs         = OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_QUEUE_SIZE;
+    static constexpr uint8_t kKeyCacheSize    = OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_KEY_CACHE_SIZE;
+    static constexpr uint8_t kCoordinateSize  = OT_CRYPTO_ECDSA_PUBLIC_KEY_SIZE / 2;
+    static constexpr uint8_t kUncompressedTag = 0x04; // SEC 1 uncompressed point format.
+
+    enum JobState : uint8_t
+    {
+        kJobFree,
+        kJobQueued,
+        kJobVerifying,
+        kJobDone,
+    };
+
+    struct Job
+    {
+        JobState                   mState;
+        uint32_t                   mSequence; // Orders the queued jobs.
+        otInstance                *mInstance;
+        void                      *mContext;
+        otPlatCryptoEcdsaPublicKey mPublicKey;
+        otPlatCryptoSha256Hash     mHash;
+        otPlatCryptoEcdsaSignature mSignature;
+        otError                    mError;
+        bool                       mKeyCacheHit;
+    };
+
+    // Only accessed by the worker thread.
+    struct CachedKey
+    {
+        otPlatCryptoEcdsaPublicKey mPublicKey;
+        mbedtls_ecp_point          mPoint;
+        uint32_t                   mLastUse;
+        bool                       mIsValid;
+    };
+
+    EcdsaVerifier(void);
+
+    Job                     *FindOldestJob(JobState aState);
+    void                     VerifyJob(Job &aJob);
+    const mbedtls_ecp_point *FindOrParseKey(const otPlatCryptoEcdsaPublicKey &aPublicKey, bool &aCacheHit);
+    void                     ClearKeyCache(void);
+    void                     RunWorker(void);
+    static void             *HandleWorker(void *aContext);
+
+    pthread_t       mWorker;
+    pthread_mutex_t mMutex;
+    pthread_cond_t  mQueueCond;
+    int             mWakeFds[2]; // Pipe waking up the main loop when a job is done.
+    bool            mRunning;
+    bool            mStopping;
+    uint32_t        mNextSequence;
+    Job             mJobs[kNumJobs];
+
+    mbedtls_ecp_group mGroup;
+    uint32_t          mKeyUseCounter;
+    CachedKey         mKeyCache[kKeyCacheSize];
+
+    otSysEcdsaVerifierCounters mCounters;
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+#endif // OT_POSIX_PLATFORM_ECDSA_VERIFIER_HPP_
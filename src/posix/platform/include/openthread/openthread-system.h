@@ -242,6 +242,122 @@ typedef struct otSysInfraNetIfAddressCounters
  */
 void otSysCountInfraNetifAddresses(otSysInfraNetIfAddressCounters *aAddressCounters);
 
+/**
+ * Represents the socket-level counters of a POSIX datagram transport (platform UDP or TREL).
+ *
+ */
+typedef struct otSysSocketCounters
+{
+    uint32_t mRxDatagrams;      ///< The number of datagrams received.
+    uint32_t mRxBatches;        ///< The number of receive calls which returned at least one datagram.
+    uint32_t mRxKernelDrops;    ///< The number of datagrams dropped by the kernel on full socket receive queues.
+    uint32_t mRxLocalDrops;     ///< The number of received datagrams dropped before reaching the stack.
+    uint32_t mRxMaxQueuedBytes; ///< The largest receive queue backlog (in bytes) seen after a full receive batch.
+    uint32_t mTxDatagrams;      ///< The number of datagrams sent.
+    uint32_t mTxBatches;        ///< The number of send calls which sent at least one datagram.
+    uint32_t mTxFailures;       ///< The number of datagrams which failed to be sent.
+    uint16_t mRxMaxBatchSize;   ///< The largest number of datagrams returned by a single receive call.
+} otSysSocketCounters;
+
+/**
+ * Returns the socket-level counters of the platform UDP sockets.
+ *
+ * Requires `OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE`.
+ *
+ * @returns A pointer to the platform UDP socket counters.
+ *
+ */
+const otSysSocketCounters *otSysGetUdpCounters(void);
+
+/**
+ * Resets the socket-level counters of the platform UDP sockets.
+ *
+ * Requires `OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE`.
+ *
+ */
+void otSysResetUdpCounters(void);
+
+/**
+ * Returns the socket-level counters of the TREL socket.
+ *
+ * Requires `OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE`.
+ *
+ * @returns A pointer to the TREL socket counters.
+ *
+ */
+const otSysSocketCounters *otSysGetTrelCounters(void);
+
+/**
+ * Resets the socket-level counters of the TREL socket.
+ *
+ * Requires `OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE`.
+ *
+ */
+void otSysResetTrelCounters(void);
+
+/**
+ * Represents the counters of the pool of threads decrypting bursts of received radio frames.
+ *
+ */
+typedef struct otSysRxCryptoCounters
+{
+    uint32_t mBatches;         ///< The number of received frame batches with at least one frame to decrypt.
+    uint32_t mFrames;          ///< The number of received secured frames.
+    uint32_t mDecryptedFrames; ///< The number of frames decrypted and authenticated before reaching OpenThread.
+    uint32_t mFailedFrames;    ///< The number of frames which failed the MIC check (left to OpenThread).
+    uint32_t mSkippedFrames;   ///< The number of secured frames with an unknown key or source (left to OpenThread).
+    uint16_t mMaxBatchSize;    ///< The largest number of frames decrypted from a single batch.
+} otSysRxCryptoCounters;
+
+/**
+ * Returns the counters of the RX crypto worker pool.
+ *
+ * Requires `OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE`.
+ *
+ * @returns A pointer to the RX crypto counters.
+ *
+ */
+const otSysRxCryptoCounters *otSysGetRxCryptoCounters(void);
+
+/**
+ * Resets the counters of the RX crypto worker pool.
+ *
+ * Requires `OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE`.
+ *
+ */
+void otSysResetRxCryptoCounters(void);
+
+/**
+ * Represents the counters of the thread verifying ECDSA signatures.
+ *
+ */
+typedef struct otSysEcdsaVerifierCounters
+{
+    uint32_t mVerified;       ///< The number of valid signatures.
+    uint32_t mFailed;         ///< The number of signatures which failed verification.
+    uint32_t mBusy;           ///< The number of verifications refused because all job slots were in use.
+    uint32_t mKeyCacheHits;   ///< The number of verifications using an already decoded public key.
+    uint32_t mKeyCacheMisses; ///< The number of verifications which had to decode the public key.
+} otSysEcdsaVerifierCounters;
+
+/**
+ * Returns the counters of the ECDSA verifier thread.
+ *
+ * Requires `OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE`.
+ *
+ * @returns A pointer to the ECDSA verifier counters.
+ *
+ */
+const otSysEcdsaVerifierCounters *otSysGetEcdsaVerifierCounters(void);
+
+/**
+ * Resets the counters of the ECDSA verifier thread.
+ *
+ * Requires `OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE`.
+ *
+ */
+void otSysResetEcdsaVerifierCounters(void);
+
 #ifdef __cplusplus
 } // end of extern "C"
 #endif
@@ -74,6 +74,28 @@
 #define OPENTHREAD_CONFIG_NCP_HDLC_ENABLE 1
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
+#ifndef OPENTHREAD_CONFIG_MAC_PLATFORM_RX_DECRYPTION_ENABLE
+#define OPENTHREAD_CONFIG_MAC_PLATFORM_RX_DECRYPTION_ENABLE 1
+#endif
+
+#ifndef OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE
+#define OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE 32
+#endif
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE 1
+#endif
+
+// The verifier thread uses mbedTLS, which allocates from the OpenThread
+// heap. The internal heap may only be used by the OpenThread thread.
+#ifndef OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+#define OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE 1
+#endif
+#endif
+
 #ifndef OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE
 #define OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE 1
 #endif
@@ -308,6 +308,90 @@
 #define OPENTHREAD_POSIX_CONFIG_TREL_UDP_PORT 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_TREL_RX_BATCH_SIZE
+ *
+ * This setting configures the maximum number of TREL datagrams read from the socket in one main loop iteration.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_TREL_RX_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_TREL_RX_BATCH_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
+ *
+ * Define as 1 to decrypt and authenticate bursts of received 802.15.4 frames on a pool of worker threads before they
+ * are passed to OpenThread.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_DEFAULT_WORKERS
+ *
+ * This setting configures the number of RX crypto worker threads used when the radio URL does not specify
+ * `rx-crypto-workers`.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_DEFAULT_WORKERS
+#define OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_DEFAULT_WORKERS 2
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_MAX_WORKERS
+ *
+ * This setting configures the maximum number of RX crypto worker threads.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_MAX_WORKERS
+#define OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_MAX_WORKERS 8
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+ *
+ * Define as 1 to verify ECDSA signatures (e.g., of SRP updates) on a worker thread through
+ * `otPlatCryptoEcdsaVerifyStart()`.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_QUEUE_SIZE
+ *
+ * This setting configures the maximum number of signature verifications queued on the ECDSA verifier thread.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_QUEUE_SIZE
+#define OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_QUEUE_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_KEY_CACHE_SIZE
+ *
+ * This setting configures the number of decoded public keys cached by the ECDSA verifier thread.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_KEY_CACHE_SIZE
+#define OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_KEY_CACHE_SIZE 32
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE
+ *
+ * This setting configures the maximum number of datagrams read from each ready platform UDP socket in one main
+ * loop iteration.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE 8
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_NAT64_CIDR
  *
@@ -41,6 +41,7 @@
 #include "common/new.hpp"
 #include "lib/spinel/radio_spinel.hpp"
 #include "posix/platform/radio.hpp"
+#include "posix/platform/rx_crypto.hpp"
 #include "utils/parse_cmdline.hpp"
 
 #if OPENTHREAD_POSIX_CONFIG_RCP_BUS == OT_POSIX_RCP_BUS_UART
@@ -118,6 +119,26 @@ void Radio::Init(void)
     SuccessOrDie(sRadioSpinel.GetSpinelInterface().Init(mRadioUrl));
     sRadioSpinel.Init(resetRadio, skipCompatibilityCheck);
 
+#if OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
+    {
+        const char *rxCryptoWorkers = mRadioUrl.GetValue("rx-crypto-workers");
+        long        numWorkers      = OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_DEFAULT_WORKERS;
+
+        if (rxCryptoWorkers != nullptr)
+        {
+            numWorkers = strtol(rxCryptoWorkers, nullptr, 0);
+            VerifyOrDie(0 <= numWorkers && numWorkers <= OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_MAX_WORKERS,
+                        OT_EXIT_INVALID_ARGUMENTS);
+        }
+
+        if (numWorkers > 0)
+        {
+            RxCrypto::Get().Init(static_cast<uint8_t>(numWorkers));
+            sRadioSpinel.SetRxFrameBatchHandler(RxCrypto::HandleRxFrameBatch, &RxCrypto::Get());
+        }
+    }
+#endif
+
     parameterValue = mRadioUrl.GetValue("fem-lnagain");
     if (parameterValue != nullptr)
     {
@@ -208,7 +229,14 @@ void *Radio::GetSpinelInstance(void) { return &sRadioSpinel; }
 } // namespace Posix
 } // namespace ot
 
-void platformRadioDeinit(void) { sRadioSpinel.Deinit(); }
+void platformRadioDeinit(void)
+{
+#if OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
+    sRadioSpinel.SetRxFrameBatchHandler(nullptr, nullptr);
+    ot::Posix::RxCrypto::Get().Deinit();
+#endif
+    sRadioSpinel.Deinit();
+}
 
 void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
 {
@@ -786,6 +814,9 @@ void otPlatRadioSetMacKey(otInstance             *aInstance,
                           otRadioKeyType          aKeyType)
 {
     SuccessOrDie(sRadioSpinel.SetMacKey(aKeyIdMode, aKeyId, aPrevKey, aCurrKey, aNextKey));
+#if OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
+    ot::Posix::RxCrypto::Get().SetMacKey(aKeyIdMode, aKeyId, aPrevKey, aCurrKey, aNextKey, aKeyType);
+#endif
     OT_UNUSED_VARIABLE(aInstance);
     OT_UNUSED_VARIABLE(aKeyType);
 }
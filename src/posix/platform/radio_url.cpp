@@ -95,7 +95,15 @@ const char *otSysGetRadioUrlHelpString(void)
 #define OT_RADIO_URL_HELP_MAX_POWER_TABLE
 #endif
 
-    return "RadioURL:\n" OT_RADIO_URL_HELP_BUS OT_RADIO_URL_HELP_MAX_POWER_TABLE
+#if OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
+#define OT_RADIO_URL_HELP_RX_CRYPTO                                                               \
+    "    rx-crypto-workers[=n]         Number of threads decrypting bursts of received frames.\n" \
+    "                                  0 leaves all decryption to OpenThread.\n"
+#else
+#define OT_RADIO_URL_HELP_RX_CRYPTO
+#endif
+
+    return "RadioURL:\n" OT_RADIO_URL_HELP_BUS OT_RADIO_URL_HELP_MAX_POWER_TABLE OT_RADIO_URL_HELP_RX_CRYPTO
            "    region[=region-code]          Set the radio's region code. The region code must be an\n"
            "                                  ISO 3166 alpha-2 code.\n"
            "    cca-threshold[=dbm]           Set the radio's CCA ED threshold in dBm measured at antenna connector.\n"
@@ -0,0 +1,420 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the pool of threads decrypting bursts of received radio frames.
+ */
+
+#include "openthread-posix-config.h"
+#include "platform-posix.h"
+
+#if OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
+
+#include <openthread/logging.h>
+#include <openthread/thread.h>
+
+#include "common/code_utils.hpp"
+#include "posix/platform/rx_crypto.hpp"
+
+namespace ot {
+namespace Posix {
+
+RxCrypto &RxCrypto::Get(void)
+{
+    static RxCrypto sInstance;
+
+    return sInstance;
+}
+
+RxCrypto::RxCrypto(void)
+    : mNumWorkers(0)
+    , mGeneration(0)
+    , mNumBusyWorkers(0)
+    , mStopping(false)
+    , mNextJob(0)
+    , mNumJobs(0)
+    , mHasKeys(false)
+    , mKeyId(0)
+    , mNeighborsValid(false)
+    , mNumNeighbors(0)
+{
+    pthread_mutex_init(&mMutex, nullptr);
+    pthread_cond_init(&mStartCond, nullptr);
+    pthread_cond_init(&mDoneCond, nullptr);
+    memset(&mCounters, 0, sizeof(mCounters));
+}
+
+void RxCrypto::Init(uint8_t aNumWorkers)
+{
+    VerifyOrDie(aNumWorkers <= OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_MAX_WORKERS, OT_EXIT_INVALID_ARGUMENTS);
+
+    // Workers start from generation zero, see `RunWorker()`.
+    mStopping   = false;
+    mGeneration = 0;
+
+    for (mNumWorkers = 0; mNumWorkers < aNumWorkers; mNumWorkers++)
+    {
+        VerifyOrDie(pthread_create(&mWorkers[mNumWorkers], nullptr, HandleWorker, this) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    otLogInfoPlat("RX crypto: %u worker threads", mNumWorkers);
+}
+
+void RxCrypto::Deinit(void)
+{
+    pthread_mutex_lock(&mMutex);
+    mStopping = true;
+    pthread_cond_broadcast(&mStartCond);
+    pthread_mutex_unlock(&mMutex);
+
+    for (uint8_t i = 0; i < mNumWorkers; i++)
+    {
+        pthread_join(mWorkers[i], nullptr);
+    }
+
+    mNumWorkers = 0;
+    mHasKeys    = false;
+
+    for (Mac::KeyMaterial &key : mKeys)
+    {
+        key.Clear();
+    }
+}
+
+void RxCrypto::SetMacKey(uint8_t                 aKeyIdMode,
+                         uint8_t                 aKeyId,
+                         const otMacKeyMaterial *aPrevKey,
+                         const otMacKeyMaterial *aCurrKey,
+                         const otMacKeyMaterial *aNextKey,
+                         otRadioKeyType          aKeyType)
+{
+    // Keys are only read by the workers while the OpenThread thread
+    // waits in `ProcessBatch()`, so no locking is needed here.
+
+    VerifyOrExit(aKeyIdMode == Mac::Frame::kKeyIdMode1);
+
+    // Key references can only be used by the crypto backend they
+    // belong to, leave the frames to OpenThread in that case.
+    mHasKeys = (aKeyType == OT_KEY_TYPE_LITERAL_KEY);
+    VerifyOrExit(mHasKeys);
+
+    mKeyId          = aKeyId;
+    mKeys[kPrevKey] = static_cast<const Mac::KeyMaterial &>(*aPrevKey);
+    mKeys[kCurrKey] = static_cast<const Mac::KeyMaterial &>(*aCurrKey);
+    mKeys[kNextKey] = static_cast<const Mac::KeyMaterial &>(*aNextKey);
+
+exit:
+    return;
+}
+
+void RxCrypto::HandleRxFrameBatch(otRadioFrame *aFrames, uint16_t aNumFrames, void *aContext)
+{
+    static_cast<RxCrypto *>(aContext)->ProcessBatch(aFrames, aNumFrames);
+}
+
+void RxCrypto::ProcessBatch(otRadioFrame *aFrames, uint16_t aNumFrames)
+{
+    VerifyOrExit(mHasKeys);
+
+    mNumJobs        = 0;
+    mNeighborsValid = false;
+
+    for (uint16_t i = 0; i < aNumFrames && mNumJobs < kMaxJobs; i++)
+    {
+        if (PrepareJob(aFrames[i], mJobs[mNumJobs]))
+        {
+            mNumJobs++;
+        }
+    }
+
+    VerifyOrExit(mNumJobs > 0);
+
+    mNextJob.store(0);
+
+    if (mNumWorkers == 0 || mNumJobs < kMinParallelJobs)
+    {
+        RunJobs();
+    }
+    else
+    {
+        pthread_mutex_lock(&mMutex);
+        mGeneration++;
+        mNumBusyWorkers = mNumWorkers;
+        pthread_cond_broadcast(&mStartCond);
+        pthread_mutex_unlock(&mMutex);
+
+        // The OpenThread thread takes its share of the jobs as well.
+        RunJobs();
+
+        pthread_mutex_lock(&mMutex);
+
+        while (mNumBusyWorkers > 0)
+        {
+            pthread_cond_wait(&mDoneCond, &mMutex);
+        }
+
+        pthread_mutex_unlock(&mMutex);
+    }
+
+    mCounters.mBatches++;
+
+    if (mNumJobs > mCounters.mMaxBatchSize)
+    {
+        mCounters.mMaxBatchSize = mNumJobs;
+    }
+
+    for (uint16_t i = 0; i < mNumJobs; i++)
+    {
+        if (mJobs[i].mDecrypted)
+        {
+            mCounters.mDecryptedFrames++;
+        }
+        else
+        {
+            mCounters.mFailedFrames++;
+        }
+    }
+
+exit:
+    return;
+}
+
+bool RxCrypto::PrepareJob(otRadioFrame &aFrame, Job &aJob)
+{
+    const Mac::RxFrame &frame   = static_cast<const Mac::RxFrame &>(aFrame);
+    bool                success = false;
+    uint8_t             securityLevel;
+    uint8_t             keyIdMode;
+
+    VerifyOrExit(aFrame.mLength != 0 && frame.GetSecurityEnabled());
+
+    mCounters.mFrames++;
+
+    VerifyOrExit(frame.GetSecurityLevel(securityLevel) == kErrorNone &&
+                     securityLevel == Mac::Frame::kSecurityEncMic32,
+                 mCounters.mSkippedFrames++);
+    VerifyOrExit(frame.GetKeyIdMode(keyIdMode) == kErrorNone && keyIdMode == Mac::Frame::kKeyIdMode1,
+                 mCounters.mSkippedFrames++);
+    VerifyOrExit(FindKey(frame, aJob.mKey), mCounters.mSkippedFrames++);
+    VerifyOrExit(FindSrcAddress(frame, aJob.mSrcAddress), mCounters.mSkippedFrames++);
+
+    aJob.mFrame     = &aFrame;
+    aJob.mDecrypted = false;
+    success         = true;
+
+exit:
+    return success;
+}
+
+bool RxCrypto::FindKey(const Mac::RxFrame &aFrame, const Mac::KeyMaterial *&aKey) const
+{
+    // Key Index values are `(KeySequence & 0x7f) + 1`, `mKeyId` is
+    // the one of the current key.
+
+    bool    found = false;
+    uint8_t keyId;
+    uint8_t sequence;
+
+    VerifyOrExit(aFrame.GetKeyId(keyId) == kErrorNone);
+
+    keyId--;
+    sequence = static_cast<uint8_t>(mKeyId - 1);
+
+    if (keyId == (sequence & 0x7f))
+    {
+        aKey = &mKeys[kCurrKey];
+    }
+    else if (keyId == ((sequence - 1) & 0x7f))
+    {
+        aKey = &mKeys[kPrevKey];
+    }
+    else if (keyId == ((sequence + 1) & 0x7f))
+    {
+        aKey = &mKeys[kNextKey];
+    }
+    else
+    {
+        ExitNow();
+    }
+
+    found = true;
+
+exit:
+    return found;
+}
+
+bool RxCrypto::FindSrcAddress(const Mac::RxFrame &aFrame, Mac::ExtAddress &aExtAddress)
+{
+    bool         found = false;
+    Mac::Address srcAddress;
+
+    VerifyOrExit(aFrame.GetSrcAddr(srcAddress) == kErrorNone);
+
+    if (srcAddress.IsExtended())
+    {
+        aExtAddress = srcAddress.GetExtended();
+        ExitNow(found = true);
+    }
+
+    VerifyOrExit(srcAddress.IsShort());
+
+    // Like OpenThread, resolve a short source address through the
+    // neighbor table. The table is read at most once per batch, on
+    // the OpenThread thread.
+
+    if (!mNeighborsValid)
+    {
+        UpdateNeighbors();
+    }
+
+    for (uint16_t i = 0; i < mNumNeighbors; i++)
+    {
+        if (mNeighbors[i].mShortAddress == srcAddress.GetShort())
+        {
+            aExtAddress = mNeighbors[i].mExtAddress;
+            ExitNow(found = true);
+        }
+    }
+
+exit:
+    return found;
+}
+
+void RxCrypto::UpdateNeighbors(void)
+{
+    otNeighborInfoIterator iterator = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         neighborInfo;
+    otRouterInfo           parentInfo;
+
+    mNumNeighbors   = 0;
+    mNeighborsValid = true;
+
+    VerifyOrExit(gInstance != nullptr);
+
+    while (mNumNeighbors < kMaxNeighbors &&
+           otThreadGetNextNeighborInfo(gInstance, &iterator, &neighborInfo) == OT_ERROR_NONE)
+    {
+        mNeighbors[mNumNeighbors].mShortAddress = neighborInfo.mRloc16;
+        mNeighbors[mNumNeighbors].mExtAddress   = AsCoreType(&neighborInfo.mExtAddress);
+        mNumNeighbors++;
+    }
+
+    if (mNumNeighbors < kMaxNeighbors && otThreadGetDeviceRole(gInstance) == OT_DEVICE_ROLE_CHILD &&
+        otThreadGetParentInfo(gInstance, &parentInfo) == OT_ERROR_NONE)
+    {
+        mNeighbors[mNumNeighbors].mShortAddress = parentInfo.mRloc16;
+        mNeighbors[mNumNeighbors].mExtAddress   = AsCoreType(&parentInfo.mExtAddress);
+        mNumNeighbors++;
+    }
+
+exit:
+    return;
+}
+
+void RxCrypto::RunJobs(void)
+{
+    uint16_t index;
+
+    while ((index = mNextJob.fetch_add(1)) < mNumJobs)
+    {
+        ProcessJob(mJobs[index]);
+    }
+}
+
+void RxCrypto::ProcessJob(Job &aJob)
+{
+    // Decrypt a copy so that the frame is left untouched (for
+    // OpenThread to process it) if the MIC check fails.
+
+    uint8_t       psdu[OT_RADIO_FRAME_MAX_SIZE];
+    otRadioFrame  copy  = *aJob.mFrame;
+    Mac::RxFrame &frame = static_cast<Mac::RxFrame &>(copy);
+
+    copy.mPsdu = psdu;
+    memcpy(psdu, aJob.mFrame->mPsdu, aJob.mFrame->mLength);
+
+    SuccessOrExit(frame.ProcessReceiveAesCcm(aJob.mSrcAddress, *aJob.mKey));
+
+    memcpy(aJob.mFrame->mPsdu, psdu, aJob.mFrame->mLength);
+    aJob.mFrame->mInfo.mRxInfo.mIsSecurityProcessed = true;
+    aJob.mDecrypted                                 = true;
+
+exit:
+    return;
+}
+
+void *RxCrypto::HandleWorker(void *aContext)
+{
+    static_cast<RxCrypto *>(aContext)->RunWorker();
+
+    return nullptr;
+}
+
+void RxCrypto::RunWorker(void)
+{
+    uint32_t generation = 0;
+
+    pthread_mutex_lock(&mMutex);
+
+    while (true)
+    {
+        while (!mStopping && generation == mGeneration)
+        {
+            pthread_cond_wait(&mStartCond, &mMutex);
+        }
+
+        if (mStopping)
+        {
+            break;
+        }
+
+        generation = mGeneration;
+        pthread_mutex_unlock(&mMutex);
+
+        RunJobs();
+
+        pthread_mutex_lock(&mMutex);
+
+        if (--mNumBusyWorkers == 0)
+        {
+            pthread_cond_signal(&mDoneCond);
+        }
+    }
+
+    pthread_mutex_unlock(&mMutex);
+}
+
+} // namespace Posix
+} // namespace ot
+
+const otSysRxCryptoCounters *otSysGetRxCryptoCounters(void) { return &ot::Posix::RxCrypto::Get().GetCounters(); }
+
+void otSysResetRxCryptoCounters(void) { ot::Posix::RxCrypto::Get().ResetCounters(); }
+
+#endif // OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
@@ -0,0 +1,208 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the pool of threads decrypting bursts of received radio frames.
+ */
+
+#ifndef OT_POSIX_PLATFORM_RX_CRYPTO_HPP_
+#define OT_POSIX_PLATFORM_RX_CRYPTO_HPP_
+
+#include "openthread-posix-config.h"
+
+#if OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
+
+#include <atomic>
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <openthread/openthread-system.h>
+#include <openthread/platform/radio.h>
+
+#include "core/common/non_copyable.hpp"
+#include "core/mac/mac_frame.hpp"
+#include "core/mac/mac_types.hpp"
+#include "lib/spinel/openthread-spinel-config.h"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * Decrypts and authenticates bursts of received 802.15.4 frames on a pool of worker threads.
+ *
+ * The radio driver hands over all the frames it has queued before passing them, in order, to OpenThread. Frames
+ * using Key ID Mode 1 whose source is a known neighbor are decrypted in parallel with the MAC keys last given by
+ * `otPlatRadioSetMacKey()`. A frame which passes the MIC check is replaced by its plaintext and marked as
+ * `mIsSecurityProcessed`, so that OpenThread only performs the key sequence and frame counter checks. Any other frame
+ * is left untouched.
+ *
+ */
+class RxCrypto : private NonCopyable
+{
+public:
+    /**
+     * Returns the RX crypto worker pool.
+     *
+     * @returns The RX crypto worker pool.
+     *
+     */
+    static RxCrypto &Get(void);
+
+    /**
+     * Starts the worker threads.
+     *
+     * @param[in]  aNumWorkers  The number of worker threads, at most `OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_MAX_WORKERS`.
+     *
+     */
+    void Init(uint8_t aNumWorkers);
+
+    /**
+     * Stops the worker threads and clears the MAC keys.
+     *
+     */
+    void Deinit(void);
+
+    /**
+     * Updates the MAC keys used to decrypt received frames.
+     *
+     * @param[in]  aKeyIdMode  The key ID mode.
+     * @param[in]  aKeyId      The key index of the current key.
+     * @param[in]  aPrevKey    The previous MAC key.
+     * @param[in]  aCurrKey    The current MAC key.
+     * @param[in]  aNextKey    The next MAC key.
+     * @param[in]  aKeyType    The key type.
+     *
+     */
+    void SetMacKey(uint8_t                 aKeyIdMode,
+                   uint8_t                 aKeyId,
+                   const otMacKeyMaterial *aPrevKey,
+                   const otMacKeyMaterial *aCurrKey,
+                   const otMacKeyMaterial *aNextKey,
+                   otRadioKeyType          aKeyType);
+
+    /**
+     * Decrypts a batch of received radio frames, blocking until all of them are processed.
+     *
+     * Matches `RadioSpinel::RxFrameBatchHandler`.
+     *
+     * @param[in]  aFrames     An array of received radio frames.
+     * @param[in]  aNumFrames  The number of frames in @p aFrames.
+     * @param[in]  aContext    A pointer to the `RxCrypto` instance.
+     *
+     */
+    static void HandleRxFrameBatch(otRadioFrame *aFrames, uint16_t aNumFrames, void *aContext);
+
+    /**
+     * Returns the RX crypto counters.
+     *
+     * @returns The RX crypto counters.
+     *
+     */
+    const otSysRxCryptoCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the RX crypto counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
+private:
+    static constexpr uint16_t kMaxJobs = OPENTHREAD_SPINEL_CONFIG_RX_FRAME_BATCH_SIZE;
+
+    // Batches smaller than this are decrypted on the caller's
+    // thread, waking up the workers would cost more than it saves.
+    static constexpr uint16_t kMinParallelJobs = 4;
+
+    static constexpr uint16_t kMaxNeighbors =
+        OPENTHREAD_CONFIG_MLE_MAX_ROUTERS + OPENTHREAD_CONFIG_MLE_MAX_CHILDREN + 1;
+
+    enum KeyIndex : uint8_t
+    {
+        kPrevKey,
+        kCurrKey,
+        kNextKey,
+        kNumKeys,
+    };
+
+    struct Job
+    {
+        otRadioFrame           *mFrame;
+        const Mac::KeyMaterial *mKey;
+        Mac::ExtAddress         mSrcAddress;
+        bool                    mDecrypted;
+    };
+
+    struct Neighbor
+    {
+        uint16_t        mShortAddress;
+        Mac::ExtAddress mExtAddress;
+    };
+
+    RxCrypto(void);
+
+    void  ProcessBatch(otRadioFrame *aFrames, uint16_t aNumFrames);
+    bool  PrepareJob(otRadioFrame &aFrame, Job &aJob);
+    bool  FindKey(const Mac::RxFrame &aFrame, const Mac::KeyMaterial *&aKey) const;
+    bool  FindSrcAddress(const Mac::RxFrame &aFrame, Mac::ExtAddress &aExtAddress);
+    void  UpdateNeighbors(void);
+    void  RunJobs(void);
+    void  RunWorker(void);
+    void  ProcessJob(Job &aJob);
+    static void *HandleWorker(void *aContext);
+
+    uint8_t         mNumWorkers;
+    pthread_t       mWorkers[OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_MAX_WORKERS];
+    pthread_mutex_t mMutex;
+    pthread_cond_t  mStartCond;
+    pthread_cond_t  mDoneCond;
+    uint32_t        mGeneration;
+    uint8_t         mNumBusyWorkers;
+    bool            mStopping;
+
+    std::atomic<uint16_t> mNextJob;
+    uint16_t              mNumJobs;
+    Job                   mJobs[kMaxJobs];
+
+    bool             mHasKeys;
+    uint8_t          mKeyId;
+    Mac::KeyMaterial mKeys[kNumKeys];
+
+    bool     mNeighborsValid;
+    uint16_t mNumNeighbors;
+    Neighbor mNeighbors[kMaxNeighbors];
+
+    otSysRxCryptoCounters mCounters;
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_POSIX_CONFIG_RX_CRYPTO_ENABLE
+#endif // OT_POSIX_PLATFORM_RX_CRYPTO_HPP_
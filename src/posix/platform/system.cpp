@@ -50,6 +50,7 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "posix/platform/daemon.hpp"
+#include "posix/platform/ecdsa_verifier.hpp"
 #include "posix/platform/firewall.hpp"
 #include "posix/platform/infra_if.hpp"
 #include "posix/platform/mainloop.hpp"
@@ -188,6 +189,10 @@ void platformSetUp(void)
     ot::Posix::Daemon::Get().SetUp();
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+    ot::Posix::EcdsaVerifier::Get().SetUp();
+#endif
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE || OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     SuccessOrDie(otSetStateChangedCallback(gInstance, processStateChange, gInstance));
 #endif
@@ -215,6 +220,10 @@ void platformTearDown(void)
 {
     VerifyOrExit(!gDryRun);
 
+#if OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+    ot::Posix::EcdsaVerifier::Get().TearDown();
+#endif
+
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
     ot::Posix::Daemon::Get().TearDown();
 #endif
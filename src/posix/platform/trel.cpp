@@ -47,12 +47,15 @@
 
 #include "radio_url.hpp"
 #include "system.hpp"
+#include "utils.hpp"
 #include "common/code_utils.hpp"
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 
 #define TREL_MAX_PACKET_SIZE 1400
 #define TREL_PACKET_POOL_SIZE 5
+#define TREL_RX_BATCH_SIZE OPENTHREAD_POSIX_CONFIG_TREL_RX_BATCH_SIZE
+#define TREL_RX_CONTROL_SIZE 64
 
 typedef struct TxPacket
 {
@@ -62,11 +65,21 @@ typedef struct TxPacket
     otSockAddr       mDestSockAddr;
 } TxPacket;
 
-static uint8_t   sRxPacketBuffer[TREL_MAX_PACKET_SIZE];
-static uint16_t  sRxPacketLength;
-static TxPacket  sTxPacketPool[TREL_PACKET_POOL_SIZE];
-static TxPacket *sFreeTxPacketHead;  // A singly linked list of free/available `TxPacket` from pool.
-static TxPacket *sTxPacketQueueTail; // A circular linked list for queued tx packets.
+typedef struct RxPacket
+{
+    struct sockaddr_in6 mSockAddr;
+    struct iovec        mIov;
+    uint8_t             mBuffer[TREL_MAX_PACKET_SIZE];
+    uint8_t             mControl[TREL_RX_CONTROL_SIZE];
+} RxPacket;
+
+static RxPacket                  sRxPackets[TREL_RX_BATCH_SIZE];
+static ot::Posix::MultiMsgHeader sRxHeaders[TREL_RX_BATCH_SIZE];
+static uint32_t                  sRxDropCount;       // Last cumulative kernel drop count reported on `sSocket`.
+static otSysSocketCounters       sCounters;
+static TxPacket                  sTxPacketPool[TREL_PACKET_POOL_SIZE];
+static TxPacket                 *sFreeTxPacketHead;  // A singly linked list of free/available `TxPacket` from pool.
+static TxPacket                 *sTxPacketQueueTail; // A circular linked list for queued tx packets.
 
 static char sInterfaceName[IFNAMSIZ + 1];
 static bool sInitialized = false;
@@ -154,6 +167,40 @@ static void PrepareSocket(uint16_t &aUdpPort)
     }
 
     aUdpPort = ntohs(sockAddr.sin6_port);
+
+    sRxDropCount = 0;
+
+    if (ot::Posix::EnableRxDropCounter(sSocket) == OT_ERROR_FAILED)
+    {
+        otLogWarnPlat("[trel] Failed to enable socket drop counter");
+    }
+}
+
+static void ToSockAddrIn6(const otSockAddr *aSockAddr, struct sockaddr_in6 *aSockAddrIn6)
+{
+    memset(aSockAddrIn6, 0, sizeof(*aSockAddrIn6));
+    aSockAddrIn6->sin6_family = AF_INET6;
+    aSockAddrIn6->sin6_port   = htons(aSockAddr->mPort);
+    memcpy(&aSockAddrIn6->sin6_addr, &aSockAddr->mAddress, sizeof(otIp6Address));
+}
+
+static otError SendErrorFromErrno(int aErrno)
+{
+    otError error;
+
+    switch (aErrno)
+    {
+    case ENETUNREACH:
+    case ENETDOWN:
+    case EHOSTUNREACH:
+        error = OT_ERROR_ABORT;
+        break;
+
+    default:
+        error = OT_ERROR_INVALID_STATE;
+    }
+
+    return error;
 }
 
 static otError SendPacket(const uint8_t *aBuffer, uint16_t aLength, const otSockAddr *aDestSockAddr)
@@ -164,62 +211,119 @@ static otError SendPacket(const uint8_t *aBuffer, uint16_t aLength, const otSock
 
     VerifyOrExit(sSocket >= 0, error = OT_ERROR_INVALID_STATE);
 
-    memset(&sockAddr, 0, sizeof(sockAddr));
-    sockAddr.sin6_family = AF_INET6;
-    sockAddr.sin6_port   = htons(aDestSockAddr->mPort);
-    memcpy(&sockAddr.sin6_addr, &aDestSockAddr->mAddress, sizeof(otIp6Address));
+    ToSockAddrIn6(aDestSockAddr, &sockAddr);
 
     ret = sendto(sSocket, aBuffer, aLength, 0, (struct sockaddr *)&sockAddr, sizeof(sockAddr));
 
     if (ret != aLength)
     {
         otLogDebgPlat("[trel] SendPacket() -- sendto() failed errno %d", errno);
-
-        switch (errno)
-        {
-        case ENETUNREACH:
-        case ENETDOWN:
-        case EHOSTUNREACH:
-            error = OT_ERROR_ABORT;
-            break;
-
-        default:
-            error = OT_ERROR_INVALID_STATE;
-        }
+        error = SendErrorFromErrno(errno);
+    }
+    else
+    {
+        sCounters.mTxDatagrams++;
+        sCounters.mTxBatches++;
     }
 
 exit:
     otLogDebgPlat("[trel] SendPacket([%s]:%u) err:%s pkt:%s", Ip6AddrToString(&aDestSockAddr->mAddress),
                   aDestSockAddr->mPort, otThreadErrorToString(error), BufferToString(aBuffer, aLength));
 
+    if (error == OT_ERROR_ABORT)
+    {
+        sCounters.mTxFailures++;
+    }
+
     return error;
 }
 
-static void ReceivePacket(int aSocket, otInstance *aInstance)
+static void ReceivePackets(int aSocket, otInstance *aInstance)
 {
-    struct sockaddr_in6 sockAddr;
-    socklen_t           sockAddrLen = sizeof(sockAddr);
-    ssize_t             ret;
+    int count;
 
-    memset(&sockAddr, 0, sizeof(sockAddr));
+    for (uint16_t index = 0; index < TREL_RX_BATCH_SIZE; index++)
+    {
+        struct msghdr *msg = &sRxHeaders[index].msg_hdr;
+
+        msg->msg_namelen    = sizeof(sRxPackets[index].mSockAddr);
+        msg->msg_controllen = sizeof(sRxPackets[index].mControl);
+        msg->msg_flags      = 0;
+    }
+
+    count = ot::Posix::ReceiveDatagrams(aSocket, sRxHeaders, TREL_RX_BATCH_SIZE);
 
-    ret = recvfrom(aSocket, (char *)sRxPacketBuffer, sizeof(sRxPacketBuffer), 0, (struct sockaddr *)&sockAddr,
-                   &sockAddrLen);
-    VerifyOrDie(ret >= 0, OT_EXIT_ERROR_ERRNO);
+    if (count < 0)
+    {
+        VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, OT_EXIT_ERROR_ERRNO);
+        ExitNow();
+    }
+
+    sCounters.mRxDatagrams += (uint32_t)count;
+    sCounters.mRxBatches++;
+
+    if (count > sCounters.mRxMaxBatchSize)
+    {
+        sCounters.mRxMaxBatchSize = (uint16_t)count;
+    }
 
-    sRxPacketLength = (uint16_t)(ret);
+    if (count == TREL_RX_BATCH_SIZE)
+    {
+        uint32_t queued = ot::Posix::GetRxQueuedBytes(aSocket);
+
+        if (queued > sCounters.mRxMaxQueuedBytes)
+        {
+            sCounters.mRxMaxQueuedBytes = queued;
+        }
+    }
 
-    if (sRxPacketLength > sizeof(sRxPacketBuffer))
+    for (int index = 0; index < count; index++)
     {
-        sRxPacketLength = sizeof(sRxPacketLength);
+        RxPacket *packet = &sRxPackets[index];
+        uint16_t  length = (uint16_t)sRxHeaders[index].msg_len;
+        uint32_t  dropCount;
+
+        if (ot::Posix::GetRxDropCount(sRxHeaders[index].msg_hdr, dropCount))
+        {
+            sCounters.mRxKernelDrops += dropCount - sRxDropCount;
+            sRxDropCount = dropCount;
+        }
+
+        otLogDebgPlat("[trel] ReceivePackets() - received from [%s]:%d, id:%d, pkt:%s",
+                      Ip6AddrToString(&packet->mSockAddr.sin6_addr), ntohs(packet->mSockAddr.sin6_port),
+                      packet->mSockAddr.sin6_scope_id, BufferToString(packet->mBuffer, length));
+
+        // The handler may disable TREL (closing the socket), in which
+        // case the rest of the batch is dropped.
+
+        if (!sEnabled)
+        {
+            sCounters.mRxLocalDrops++;
+            continue;
+        }
+
+        otPlatTrelHandleReceived(aInstance, packet->mBuffer, length);
     }
 
-    otLogDebgPlat("[trel] ReceivePacket() - received from [%s]:%d, id:%d, pkt:%s", Ip6AddrToString(&sockAddr.sin6_addr),
-                  ntohs(sockAddr.sin6_port), sockAddr.sin6_scope_id, BufferToString(sRxPacketBuffer, sRxPacketLength));
+exit:
+    return;
+}
 
-    if (sEnabled)
+static void InitRxPackets(void)
+{
+    for (uint16_t index = 0; index < TREL_RX_BATCH_SIZE; index++)
     {
-        otPlatTrelHandleReceived(aInstance, sRxPacketBuffer, sRxPacketLength);
+        RxPacket      *packet = &sRxPackets[index];
+        struct msghdr *msg    = &sRxHeaders[index].msg_hdr;
+
+        packet->mIov.iov_base = packet->mBuffer;
+        packet->mIov.iov_len  = sizeof(packet->mBuffer);
+
+        memset(msg, 0, sizeof(*msg));
+        msg->msg_name    = &packet->mSockAddr;
+        msg->msg_iov     = &packet->mIov;
+        msg->msg_iovlen  = 1;
+        msg->msg_control = packet->mControl;
     }
 }
 
@@ -239,35 +343,92 @@ static void InitPacketQueue(void)
     }
 }
 
+static void DequeuePacket(void)
+{
+    TxPacket *packet = sTxPacketQueueTail->mNext; // tail->mNext is the head of the list.
+
+    // Remove the `packet` from the packet queue (circular
+    // linked list).
+
+    if (packet == sTxPacketQueueTail)
+    {
+        sTxPacketQueueTail = NULL;
+    }
+    else
+    {
+        sTxPacketQueueTail->mNext = packet->mNext;
+    }
+
+    // Add the `packet` to the free packet singly linked list.
+
+    packet->mNext     = sFreeTxPacketHead;
+    sFreeTxPacketHead = packet;
+}
+
 static void SendQueuedPackets(void)
 {
+    // All queued packets are handed to the socket in one batch
+    // (`sendmmsg()` where available). Packets are removed from the
+    // queue as they are sent. A packet which fails with a "would
+    // block" error stays queued (with the ones after it) until the
+    // socket becomes writable again, while a packet failing for any
+    // other reason (e.g., network is down) is dropped.
+
     while (sTxPacketQueueTail != NULL)
     {
-        TxPacket *packet = sTxPacketQueueTail->mNext; // tail->mNext is the head of the list.
+        ot::Posix::MultiMsgHeader headers[TREL_PACKET_POOL_SIZE];
+        struct sockaddr_in6       sockAddrs[TREL_PACKET_POOL_SIZE];
+        struct iovec              iovs[TREL_PACKET_POOL_SIZE];
+        TxPacket                 *packet = sTxPacketQueueTail;
+        unsigned int              count  = 0;
+        int                       sent;
+
+        VerifyOrExit(sSocket >= 0);
 
-        if (SendPacket(packet->mBuffer, packet->mLength, &packet->mDestSockAddr) == OT_ERROR_INVALID_STATE)
+        do
         {
-            otLogDebgPlat("[trel] SendQueuedPackets() - SendPacket() would block");
-            break;
-        }
+            packet = packet->mNext;
 
-        // Remove the `packet` from the packet queue (circular
-        // linked list).
+            ToSockAddrIn6(&packet->mDestSockAddr, &sockAddrs[count]);
+            iovs[count].iov_base = packet->mBuffer;
+            iovs[count].iov_len  = packet->mLength;
 
-        if (packet == sTxPacketQueueTail)
-        {
-            sTxPacketQueueTail = NULL;
-        }
-        else
+            memset(&headers[count], 0, sizeof(headers[count]));
+            headers[count].msg_hdr.msg_name    = &sockAddrs[count];
+            headers[count].msg_hdr.msg_namelen = sizeof(sockAddrs[count]);
+            headers[count].msg_hdr.msg_iov     = &iovs[count];
+            headers[count].msg_hdr.msg_iovlen  = 1;
+            count++;
+        } while (packet != sTxPacketQueueTail);
+
+        sent = ot::Posix::SendDatagrams(sSocket, headers, count);
+
+        if (sent < 0)
         {
-            sTxPacketQueueTail->mNext = packet->mNext;
+            otLogDebgPlat("[trel] SendQueuedPackets() -- send failed errno %d", errno);
+
+            if (SendErrorFromErrno(errno) == OT_ERROR_INVALID_STATE)
+            {
+                otLogDebgPlat("[trel] SendQueuedPackets() - send would block");
+                ExitNow();
+            }
+
+            sCounters.mTxFailures++;
+            DequeuePacket();
+            continue;
         }
 
-        // Add the `packet` to the free packet singly linked list.
+        sCounters.mTxDatagrams += (uint32_t)sent;
+        sCounters.mTxBatches++;
 
-        packet->mNext     = sFreeTxPacketHead;
-        sFreeTxPacketHead = packet;
+        while (sent-- > 0)
+        {
+            DequeuePacket();
+        }
     }
+
+exit:
+    return;
 }
 
 static void EnqueuePacket(const uint8_t *aBuffer, uint16_t aLength, const otSockAddr *aDestSockAddr)
@@ -277,7 +438,10 @@ static void EnqueuePacket(const uint8_t *aBuffer, uint16_t aLength, const otSock
     // Allocate an available packet entry (from the free packet list)
     // and copy the packet content into it.
 
-    VerifyOrExit(sFreeTxPacketHead != NULL, otLogWarnPlat("[trel] EnqueuePacket failed, queue is full"));
+    VerifyOrExit(sFreeTxPacketHead != NULL, {
+        otLogWarnPlat("[trel] EnqueuePacket failed, queue is full");
+        sCounters.mTxFailures++;
+    });
     packet            = sFreeTxPacketHead;
     sFreeTxPacketHead = sFreeTxPacketHead->mNext;
 
@@ -505,6 +669,7 @@ void platformTrelInit(const char *aTrelUrl)
     trelDnssdInitialize(sInterfaceName);
 
     InitPacketQueue();
+    InitRxPackets();
     sInitialized = true;
 }
 
@@ -556,7 +721,7 @@ void platformTrelProcess(otInstance *aInstance, const otSysMainloopContext *aCon
 
     if (FD_ISSET(sSocket, &aContext->mReadFdSet))
     {
-        ReceivePacket(sSocket, aInstance);
+        ReceivePackets(sSocket, aInstance);
     }
 
     trelDnssdProcess(aInstance, aContext);
@@ -565,4 +730,8 @@ exit:
     return;
 }
 
+const otSysSocketCounters *otSysGetTrelCounters(void) { return &sCounters; }
+
+void otSysResetTrelCounters(void) { memset(&sCounters, 0, sizeof(sCounters)); }
+
 #endif // #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
@@ -58,6 +58,7 @@
 #include "posix/platform/ip6_utils.hpp"
 #include "posix/platform/mainloop.hpp"
 #include "posix/platform/udp.hpp"
+#include "posix/platform/utils.hpp"
 
 using namespace ot::Posix::Ip6Utils;
 
@@ -165,30 +166,12 @@ exit:
     return error;
 }
 
-otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageInfo &aMessageInfo)
+void parseReceivedPacket(const struct msghdr &aMsg, otMessageInfo &aMessageInfo)
 {
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kMaxUdpSize];
-    struct iovec        iov;
-    struct msghdr       msg;
-    ssize_t             rval;
-
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
+    const struct sockaddr_in6 &peerAddr = *static_cast<const struct sockaddr_in6 *>(aMsg.msg_name);
 
-    rval = recvmsg(aFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("recvmsg"));
-    aLength = static_cast<uint16_t>(rval);
-
-    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&aMsg); cmsg != nullptr;
+         cmsg                 = CMSG_NXTHDR(const_cast<struct msghdr *>(&aMsg), cmsg))
     {
         if (cmsg->cmsg_level == IPPROTO_IPV6)
         {
@@ -213,9 +196,6 @@ otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageIn
 
     aMessageInfo.mPeerPort = ntohs(peerAddr.sin6_port);
     memcpy(&aMessageInfo.mPeerAddr, &peerAddr.sin6_addr, sizeof(aMessageInfo.mPeerAddr));
-
-exit:
-    return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
 }
 
 } // namespace
@@ -248,6 +228,7 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
     fd = FdFromHandle(aUdpSocket->mHandle);
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
+    ot::Posix::Udp::Get().HandleSocketClosed(fd);
     aUdpSocket->mHandle = nullptr;
 
 exit:
@@ -280,6 +261,11 @@ otError otPlatUdpBind(otUdpSocket *aUdpSocket)
         VerifyOrExit(0 == setsockopt(fd, IPPROTO_IPV6, IPV6_RECVPKTINFO, &on, sizeof(on)), error = OT_ERROR_FAILED);
     }
 
+    if (ot::Posix::EnableRxDropCounter(fd) == OT_ERROR_FAILED)
+    {
+        otLogWarnPlat("Failed to enable UDP socket drop counter: %s", strerror(errno));
+    }
+
 exit:
     if (error == OT_ERROR_FAILED)
     {
@@ -434,6 +420,7 @@ otError otPlatUdpSend(otUdpSocket *aUdpSocket, otMessage *aMessage, const otMess
     }
 
     error = transmitPacket(fd, payload, len, *aMessageInfo);
+    ot::Posix::Udp::Get().HandleTransmit(error);
 
     if (aMessageInfo->mMulticastLoop)
     {
@@ -595,52 +582,247 @@ Udp &Udp::Get(void)
     return sInstance;
 }
 
+Udp::Udp(void)
+    : mLastServedFd(-1)
+{
+    memset(&mCounters, 0, sizeof(mCounters));
+
+    for (DropTracker &tracker : mDropTrackers)
+    {
+        tracker.mFd = -1;
+    }
+
+    for (uint16_t i = 0; i < kRxBatchSize; i++)
+    {
+        RxSlot        &slot = mRxSlots[i];
+        struct msghdr &msg  = mRxHeaders[i].msg_hdr;
+
+        slot.mIov.iov_base = slot.mPayload;
+        slot.mIov.iov_len  = sizeof(slot.mPayload);
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name    = &slot.mPeerAddr;
+        msg.msg_iov     = &slot.mIov;
+        msg.msg_iovlen  = 1;
+        msg.msg_control = slot.mControl;
+    }
+}
+
 void Udp::Process(const otSysMainloopContext &aContext)
 {
-    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    // Serve every ready socket once per iteration, each for at most
+    // one receive batch, starting after the socket served last so
+    // that a busy socket cannot starve the others. The handlers may
+    // open or close sockets, so only file descriptors are remembered
+    // here and the socket is looked up again before each delivery.
+
+    int     readyFds[kMaxReadySockets];
+    uint8_t numReady     = 0;
+    uint8_t start        = 0;
+    bool    passedLast   = false;
+    bool    startIsFound = false;
 
     for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
     {
         int fd = FdFromHandle(socket->mHandle);
 
-        if (fd > 0 && FD_ISSET(fd, &aContext.mReadFdSet))
+        if (fd > 0 && FD_ISSET(fd, &aContext.mReadFdSet) && numReady < kMaxReadySockets)
         {
-            otMessageInfo messageInfo;
-            otMessage    *message = nullptr;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
-
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
-
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
+            if (passedLast && !startIsFound)
             {
-                continue;
+                start        = numReady;
+                startIsFound = true;
             }
 
-            message = otUdpNewMessage(gInstance, &msgSettings);
+            readyFds[numReady++] = fd;
+        }
 
-            if (message == nullptr)
-            {
-                continue;
-            }
+        if (fd == mLastServedFd)
+        {
+            passedLast = true;
+        }
+    }
 
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
-            {
-                otMessageFree(message);
-                continue;
-            }
+    for (uint8_t i = 0; i < numReady; i++)
+    {
+        mLastServedFd = readyFds[(start + i) % numReady];
+        ProcessSocket(mLastServedFd);
+    }
+}
+
+void Udp::ProcessSocket(int aFd)
+{
+    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    int               count;
+
+    for (uint16_t i = 0; i < kRxBatchSize; i++)
+    {
+        struct msghdr &msg = mRxHeaders[i].msg_hdr;
+
+        msg.msg_namelen    = sizeof(mRxSlots[i].mPeerAddr);
+        msg.msg_controllen = sizeof(mRxSlots[i].mControl);
+        msg.msg_flags      = 0;
+    }
 
-            socket->mHandler(socket->mContext, message, &messageInfo);
+    count = ReceiveDatagrams(aFd, mRxHeaders, kRxBatchSize);
+
+    if (count < 0)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            perror("recvmsg");
+        }
+
+        ExitNow();
+    }
+
+    mCounters.mRxDatagrams += static_cast<uint32_t>(count);
+    mCounters.mRxBatches++;
+
+    if (count > mCounters.mRxMaxBatchSize)
+    {
+        mCounters.mRxMaxBatchSize = static_cast<uint16_t>(count);
+    }
+
+    if (count == kRxBatchSize)
+    {
+        uint32_t queued = GetRxQueuedBytes(aFd);
+
+        if (queued > mCounters.mRxMaxQueuedBytes)
+        {
+            mCounters.mRxMaxQueuedBytes = queued;
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        const struct msghdr &msg    = mRxHeaders[i].msg_hdr;
+        uint16_t             length = static_cast<uint16_t>(mRxHeaders[i].msg_len);
+        otUdpSocket         *socket;
+        otMessageInfo        messageInfo;
+        otMessage           *message;
+        uint32_t             dropCount;
+
+        if (GetRxDropCount(msg, dropCount))
+        {
+            UpdateDropCount(aFd, dropCount);
+        }
+
+        socket = FindSocket(aFd);
+
+        if (length == 0 || socket == nullptr)
+        {
+            mCounters.mRxLocalDrops++;
+            continue;
+        }
+
+        memset(&messageInfo, 0, sizeof(messageInfo));
+        messageInfo.mSockPort = socket->mSockName.mPort;
+        parseReceivedPacket(msg, messageInfo);
+
+        message = otUdpNewMessage(gInstance, &msgSettings);
+
+        if (message == nullptr)
+        {
+            mCounters.mRxLocalDrops++;
+            continue;
+        }
+
+        if (otMessageAppend(message, mRxSlots[i].mPayload, length) != OT_ERROR_NONE)
+        {
             otMessageFree(message);
-            // only process one socket a time
+            mCounters.mRxLocalDrops++;
+            continue;
+        }
+
+        socket->mHandler(socket->mContext, message, &messageInfo);
+        otMessageFree(message);
+    }
+
+exit:
+    return;
+}
+
+otUdpSocket *Udp::FindSocket(int aFd) const
+{
+    otUdpSocket *socket = otUdpGetSockets(gInstance);
+
+    for (; socket != nullptr; socket = socket->mNext)
+    {
+        if (socket->mHandle != nullptr && FdFromHandle(socket->mHandle) == aFd)
+        {
+            break;
+        }
+    }
+
+    return socket;
+}
+
+void Udp::UpdateDropCount(int aFd, uint32_t aDropCount)
+{
+    // `SO_RXQ_OVFL` reports a cumulative per-socket counter, so the
+    // last value seen on each socket is kept to accumulate deltas.
+
+    DropTracker *tracker = nullptr;
+
+    for (DropTracker &entry : mDropTrackers)
+    {
+        if (entry.mFd == aFd)
+        {
+            tracker = &entry;
             break;
         }
+
+        if (tracker == nullptr && entry.mFd == -1)
+        {
+            tracker = &entry;
+        }
+    }
+
+    VerifyOrExit(tracker != nullptr);
+
+    if (tracker->mFd != aFd)
+    {
+        tracker->mFd        = aFd;
+        tracker->mDropCount = 0;
     }
 
+    mCounters.mRxKernelDrops += aDropCount - tracker->mDropCount;
+    tracker->mDropCount = aDropCount;
+
+exit:
     return;
 }
 
+void Udp::HandleSocketClosed(int aFd)
+{
+    for (DropTracker &tracker : mDropTrackers)
+    {
+        if (tracker.mFd == aFd)
+        {
+            tracker.mFd = -1;
+        }
+    }
+}
+
+void Udp::HandleTransmit(otError aError)
+{
+    if (aError == OT_ERROR_NONE)
+    {
+        mCounters.mTxDatagrams++;
+        mCounters.mTxBatches++;
+    }
+    else
+    {
+        mCounters.mTxFailures++;
+    }
+}
+
 } // namespace Posix
 } // namespace ot
+
+const otSysSocketCounters *otSysGetUdpCounters(void) { return &ot::Posix::Udp::Get().GetCounters(); }
+
+void otSysResetUdpCounters(void) { ot::Posix::Udp::Get().ResetCounters(); }
+
 #endif // #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
@@ -28,8 +28,19 @@
 #ifndef OT_POSIX_PLATFORM_UDP_HPP_
 #define OT_POSIX_PLATFORM_UDP_HPP_
 
+#include "openthread-posix-config.h"
+
+#include <netinet/in.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/uio.h>
+
+#include <openthread/openthread-system.h>
+#include <openthread/udp.h>
+
 #include "core/common/non_copyable.hpp"
 #include "posix/platform/mainloop.hpp"
+#include "posix/platform/utils.hpp"
 
 namespace ot {
 namespace Posix {
@@ -45,6 +56,71 @@ public:
     void Deinit(void);
     void Update(otSysMainloopContext &aContext) override;
     void Process(const otSysMainloopContext &aContext) override;
+
+    /**
+     * Returns the socket-level counters of the platform UDP sockets.
+     *
+     * @returns The socket counters.
+     *
+     */
+    const otSysSocketCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the socket-level counters of the platform UDP sockets.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
+    /**
+     * Updates the counters after a datagram transmission.
+     *
+     * @param[in]  aError  The outcome of the transmission.
+     *
+     */
+    void HandleTransmit(otError aError);
+
+    /**
+     * Forgets the kernel drop counter tracked for a socket which is being closed.
+     *
+     * @param[in]  aFd  The file descriptor of the socket.
+     *
+     */
+    void HandleSocketClosed(int aFd);
+
+private:
+    static constexpr uint16_t kRxBatchSize       = OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE;
+    static constexpr uint16_t kMaxUdpSize        = 1280;
+    static constexpr uint16_t kControlBufferSize = 128;
+    static constexpr uint8_t  kMaxReadySockets   = 16;
+    static constexpr uint8_t  kMaxDropTrackers   = 16;
+
+    static_assert(kRxBatchSize > 0, "OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE must be non-zero");
+
+    struct RxSlot
+    {
+        struct sockaddr_in6 mPeerAddr;
+        struct iovec        mIov;
+        uint8_t             mPayload[kMaxUdpSize];
+        uint8_t             mControl[kControlBufferSize];
+    };
+
+    struct DropTracker
+    {
+        int      mFd;
+        uint32_t mDropCount;
+    };
+
+    Udp(void);
+
+    void         ProcessSocket(int aFd);
+    void         UpdateDropCount(int aFd, uint32_t aDropCount);
+    otUdpSocket *FindSocket(int aFd) const;
+
+    otSysSocketCounters mCounters;
+    int                 mLastServedFd;
+    DropTracker         mDropTrackers[kMaxDropTrackers];
+    MultiMsgHeader      mRxHeaders[kRxBatchSize];
+    RxSlot              mRxSlots[kRxBatchSize];
 };
 
 } // namespace Posix
@@ -36,6 +36,9 @@
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef __linux__
+#include <linux/sock_diag.h>
+#endif
 
 #include <openthread/logging.h>
 
@@ -85,5 +88,111 @@ exit:
     return error;
 }
 
+int ReceiveDatagrams(int aFd, MultiMsgHeader *aHeaders, unsigned int aCount)
+{
+#ifdef __linux__
+    return recvmmsg(aFd, aHeaders, aCount, MSG_DONTWAIT, nullptr);
+#else
+    unsigned int received = 0;
+
+    for (; received < aCount; received++)
+    {
+        ssize_t rval = recvmsg(aFd, &aHeaders[received].msg_hdr, MSG_DONTWAIT);
+
+        if (rval < 0)
+        {
+            break;
+        }
+
+        aHeaders[received].msg_len = static_cast<unsigned int>(rval);
+    }
+
+    return (received > 0) ? static_cast<int>(received) : -1;
+#endif
+}
+
+int SendDatagrams(int aFd, MultiMsgHeader *aHeaders, unsigned int aCount)
+{
+#ifdef __linux__
+    return sendmmsg(aFd, aHeaders, aCount, MSG_DONTWAIT);
+#else
+    unsigned int sent = 0;
+
+    for (; sent < aCount; sent++)
+    {
+        ssize_t rval = sendmsg(aFd, &aHeaders[sent].msg_hdr, MSG_DONTWAIT);
+
+        if (rval < 0)
+        {
+            break;
+        }
+
+        aHeaders[sent].msg_len = static_cast<unsigned int>(rval);
+    }
+
+    return (sent > 0) ? static_cast<int>(sent) : -1;
+#endif
+}
+
+otError EnableRxDropCounter(int aFd)
+{
+    otError error = OT_ERROR_NONE;
+
+#ifdef SO_RXQ_OVFL
+    int on = 1;
+
+    VerifyOrExit(setsockopt(aFd, SOL_SOCKET, SO_RXQ_OVFL, &on, sizeof(on)) == 0, error = OT_ERROR_FAILED);
+#else
+    OT_UNUSED_VARIABLE(aFd);
+    ExitNow(error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+bool GetRxDropCount(const struct msghdr &aHeader, uint32_t &aDropCount)
+{
+    bool found = false;
+
+#ifdef SO_RXQ_OVFL
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&aHeader); cmsg != nullptr;
+         cmsg                 = CMSG_NXTHDR(const_cast<struct msghdr *>(&aHeader), cmsg))
+    {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL)
+        {
+            memcpy(&aDropCount, CMSG_DATA(cmsg), sizeof(aDropCount));
+            found = true;
+            break;
+        }
+    }
+#else
+    OT_UNUSED_VARIABLE(aHeader);
+    OT_UNUSED_VARIABLE(aDropCount);
+#endif
+
+    return found;
+}
+
+uint32_t GetRxQueuedBytes(int aFd)
+{
+    uint32_t queued = 0;
+
+#if defined(__linux__) && defined(SO_MEMINFO)
+    uint32_t  memInfo[SK_MEMINFO_VARS];
+    socklen_t length = sizeof(memInfo);
+
+    if (getsockopt(aFd, SOL_SOCKET, SO_MEMINFO, memInfo, &length) == 0 &&
+        length > SK_MEMINFO_RMEM_ALLOC * sizeof(uint32_t))
+    {
+        queued = memInfo[SK_MEMINFO_RMEM_ALLOC];
+    }
+#else
+    OT_UNUSED_VARIABLE(aFd);
+#endif
+
+    return queued;
+}
+
 } // namespace Posix
 } // namespace ot
@@ -29,6 +29,9 @@
 #ifndef OT_POSIX_PLATFORM_UTILS_HPP_
 #define OT_POSIX_PLATFORM_UTILS_HPP_
 
+#include <stdint.h>
+#include <sys/socket.h>
+
 #include "openthread/error.h"
 
 namespace ot {
@@ -46,6 +49,82 @@ namespace Posix {
  */
 otError ExecuteCommand(const char *aFormat, ...);
 
+#ifdef __linux__
+typedef struct mmsghdr MultiMsgHeader;
+#else
+/**
+ * Mirrors `struct mmsghdr` on platforms without `recvmmsg()`/`sendmmsg()`.
+ *
+ */
+struct MultiMsgHeader
+{
+    struct msghdr msg_hdr; ///< The message header.
+    unsigned int  msg_len; ///< The number of bytes transferred for this message.
+};
+#endif
+
+/**
+ * Receives up to @p aCount datagrams from a socket without blocking.
+ *
+ * Uses a single `recvmmsg()` call where available and falls back to calling `recvmsg()` in a loop otherwise.
+ *
+ * @param[in]     aFd       The socket file descriptor.
+ * @param[in,out] aHeaders  An array of @p aCount message headers. `msg_len` is set for each received datagram.
+ * @param[in]     aCount    The maximum number of datagrams to receive.
+ *
+ * @returns The number of datagrams received, or -1 if none was received (`errno` is set).
+ *
+ */
+int ReceiveDatagrams(int aFd, MultiMsgHeader *aHeaders, unsigned int aCount);
+
+/**
+ * Sends up to @p aCount datagrams on a socket without blocking.
+ *
+ * Uses a single `sendmmsg()` call where available and falls back to calling `sendmsg()` in a loop otherwise.
+ *
+ * @param[in]     aFd       The socket file descriptor.
+ * @param[in,out] aHeaders  An array of @p aCount message headers. `msg_len` is set for each sent datagram.
+ * @param[in]     aCount    The number of datagrams to send.
+ *
+ * @returns The number of datagrams sent, or -1 if none was sent (`errno` is set).
+ *
+ */
+int SendDatagrams(int aFd, MultiMsgHeader *aHeaders, unsigned int aCount);
+
+/**
+ * Enables reporting of the kernel receive queue drop counter (`SO_RXQ_OVFL`) on a socket.
+ *
+ * @param[in]  aFd  The socket file descriptor.
+ *
+ * @retval OT_ERROR_NONE             Successfully enabled the drop counter.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The platform does not support `SO_RXQ_OVFL`.
+ * @retval OT_ERROR_FAILED           Failed to set the socket option.
+ *
+ */
+otError EnableRxDropCounter(int aFd);
+
+/**
+ * Reads the kernel receive queue drop counter from the ancillary data of a received datagram.
+ *
+ * @param[in]  aHeader     The message header of the received datagram.
+ * @param[out] aDropCount  The cumulative number of datagrams the kernel dropped on the socket.
+ *
+ * @retval TRUE   The drop counter was found and @p aDropCount is updated.
+ * @retval FALSE  The datagram carries no drop counter.
+ *
+ */
+bool GetRxDropCount(const struct msghdr &aHeader, uint32_t &aDropCount);
+
+/**
+ * Returns the number of bytes queued in the receive buffer of a socket.
+ *
+ * @param[in]  aFd  The socket file descriptor.
+ *
+ * @returns The number of bytes allocated to the receive queue, or 0 if it is unknown on this platform.
+ *
+ */
+uint32_t GetRxQueuedBytes(int aFd);
+
 } // namespace Posix
 } // namespace ot
 
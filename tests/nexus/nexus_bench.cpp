@@ -0,0 +1,1121 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the nexus benchmark: attach time, routing convergence, partition merge, TMF
+ *   transaction bursts, diagnostic polls, Network Data propagation and Multicast Listener Registration of a large
+ *   simulated topology.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include <openthread/backbone_router.h>
+#include <openthread/backbone_router_ftd.h>
+#include <openthread/border_router.h>
+#include <openthread/ip6.h>
+#include <openthread/message.h>
+#include <openthread/netdata.h>
+#include <openthread/netdiag.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "mac/mac_types.hpp"
+
+#include "nexus_core.hpp"
+#include "nexus_node.hpp"
+#include "nexus_radio_model.hpp"
+
+namespace ot {
+namespace Nexus {
+
+enum Topology : uint8_t
+{
+    kTopologyGrid,
+    kTopologyLine,
+    kTopologyMesh,
+};
+
+struct Options
+{
+    uint16_t mNumNodes;
+    uint64_t mSeed;
+    Topology mTopology;
+    uint32_t mSpacing;
+    uint32_t mRange;
+    uint8_t  mLossPercent;
+    uint32_t mTimeout;
+    uint16_t mTransactions;
+    bool     mAttach;
+    bool     mConverge;
+    bool     mMerge;
+    bool     mTmfBurst;
+    bool     mDiagPoll;
+    bool     mNetData;
+    bool     mMlr;
+    bool     mVerbose;
+};
+
+static void PrintUsage(const char *aProgram)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  -n, --nodes <num>          number of nodes (default: 64)\n"
+            "  -s, --seed <num>           random seed (default: 1)\n"
+            "  -t, --topology <type>      grid, line or mesh (default: grid)\n"
+            "  -d, --spacing <num>        distance between neighbouring nodes (default: 10)\n"
+            "  -r, --range <num>          radio range for grid/line (default: 25)\n"
+            "  -l, --loss <percent>       frame loss at the edge of the range (default: 10)\n"
+            "  -c, --scenario <name>      attach, converge, merge, tmf-burst, diag-poll, netdata, mlr or all\n"
+            "                             (default: all)\n"
+            "  -T, --timeout <seconds>    timeout of each phase (default: 1200)\n"
+            "  -x, --transactions <num>   outstanding TMF transactions of tmf-burst (default: 200)\n"
+            "  -v, --verbose              print OpenThread logs\n",
+            aProgram);
+}
+
+static bool ParseOptions(int aArgCount, char *aArgVector[], Options &aOptions)
+{
+    static const struct option kOptions[] = {
+        {"nodes", required_argument, nullptr, 'n'},    {"seed", required_argument, nullptr, 's'},
+        {"topology", required_argument, nullptr, 't'}, {"spacing", required_argument, nullptr, 'd'},
+        {"range", required_argument, nullptr, 'r'},    {"loss", required_argument, nullptr, 'l'},
+        {"scenario", required_argument, nullptr, 'c'}, {"timeout", required_argument, nullptr, 'T'},
+        {"transactions", required_argument, nullptr, 'x'}, {"verbose", no_argument, nullptr, 'v'},
+        {"help", no_argument, nullptr, 'h'},           {nullptr, 0, nullptr, 0},
+    };
+
+    bool        ok       = true;
+    const char *scenario = "all";
+    int         option;
+
+    aOptions.mNumNodes    = 64;
+    aOptions.mSeed        = 1;
+    aOptions.mTopology    = kTopologyGrid;
+    aOptions.mSpacing     = 10;
+    aOptions.mRange       = 25;
+    aOptions.mLossPercent = 10;
+    aOptions.mTimeout      = 1200;
+    aOptions.mTransactions = 200;
+    aOptions.mVerbose      = false;
+
+    while ((option = getopt_long(aArgCount, aArgVector, "n:s:t:d:r:l:c:T:x:vh", kOptions, nullptr)) != -1)
+    {
+        switch (option)
+        {
+        case 'n':
+            aOptions.mNumNodes = static_cast<uint16_t>(strtoul(optarg, nullptr, 0));
+            break;
+        case 's':
+            aOptions.mSeed = strtoull(optarg, nullptr, 0);
+            break;
+        case 't':
+            if (strcmp(optarg, "grid") == 0)
+            {
+                aOptions.mTopology = kTopologyGrid;
+            }
+            else if (strcmp(optarg, "line") == 0)
+            {
+                aOptions.mTopology = kTopologyLine;
+            }
+            else if (strcmp(optarg, "mesh") == 0)
+            {
+                aOptions.mTopology = kTopologyMesh;
+            }
+            else
+            {
+                ok = false;
+            }
+            break;
+        case 'd':
+            aOptions.mSpacing = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+        case 'r':
+            aOptions.mRange = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+        case 'l':
+            aOptions.mLossPercent = static_cast<uint8_t>(strtoul(optarg, nullptr, 0));
+            break;
+        case 'c':
+            scenario = optarg;
+            break;
+        case 'T':
+            aOptions.mTimeout = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+        case 'x':
+            aOptions.mTransactions = static_cast<uint16_t>(strtoul(optarg, nullptr, 0));
+            break;
+        case 'v':
+            aOptions.mVerbose = true;
+            break;
+        default:
+            ok = false;
+            break;
+        }
+    }
+
+    aOptions.mAttach   = (strcmp(scenario, "attach") == 0) || (strcmp(scenario, "all") == 0);
+    aOptions.mConverge = (strcmp(scenario, "converge") == 0) || (strcmp(scenario, "all") == 0);
+    aOptions.mMerge    = (strcmp(scenario, "merge") == 0) || (strcmp(scenario, "all") == 0);
+    aOptions.mTmfBurst = (strcmp(scenario, "tmf-burst") == 0) || (strcmp(scenario, "all") == 0);
+    aOptions.mDiagPoll = (strcmp(scenario, "diag-poll") == 0) || (strcmp(scenario, "all") == 0);
+    aOptions.mNetData  = (strcmp(scenario, "netdata") == 0) || (strcmp(scenario, "all") == 0);
+    aOptions.mMlr      = (strcmp(scenario, "mlr") == 0) || (strcmp(scenario, "all") == 0);
+
+    if (!(aOptions.mAttach || aOptions.mConverge || aOptions.mMerge || aOptions.mTmfBurst || aOptions.mDiagPoll ||
+          aOptions.mNetData || aOptions.mMlr) ||
+        aOptions.mNumNodes < 2 || optind != aArgCount)
+    {
+        ok = false;
+    }
+
+    return ok;
+}
+
+class Bench
+{
+public:
+    explicit Bench(const Options &aOptions)
+        : mOptions(aOptions)
+        , mCore(aOptions.mSeed)
+        , mMeshModel(aOptions.mLossPercent)
+        , mDiskModel(aOptions.mRange, aOptions.mLossPercent)
+    {
+        mCore.SetLogEnabled(aOptions.mVerbose);
+        mCore.SetRadioModel((aOptions.mTopology == kTopologyMesh) ? static_cast<RadioModel &>(mMeshModel)
+                                                                   : static_cast<RadioModel &>(mDiskModel));
+        CreateTopology();
+    }
+
+    bool RunAttach(void);
+    bool RunConverge(void);
+    bool RunMerge(void);
+    bool RunTmfBurst(void);
+    bool RunDiagPoll(void);
+    bool RunNetData(void);
+    bool RunMlr(void);
+    void PrintCounters(double aWallTime);
+
+private:
+    static void HandleDiagnosticGetResponse(otError              aError,
+                                            otMessage           *aMessage,
+                                            const otMessageInfo *aMessageInfo,
+                                            void                *aContext);
+    static void HandleDiagnosticAnswer(otError              aError,
+                                       otMessage           *aMessage,
+                                       const otMessageInfo *aMessageInfo,
+                                       void                *aContext);
+
+    void     CreateTopology(void);
+    bool     FormAndJoin(void);
+    bool     AreAllAttached(void);
+    uint32_t CountPartitions(void);
+    bool     IsRoutingConverged(void);
+    Node    *FindLeader(void);
+    bool     IsNetDataSynced(uint8_t aPrevVersion);
+    bool     ToggleOnMeshPrefix(Node &aNode, uint8_t aBorderRouterIndex, uint8_t aPrefixIndex);
+    bool     IsPrimaryBackboneRouterKnown(bool aKnown);
+    uint32_t CountMulticastListeners(Node &aNode);
+    void     ResetRegistrationCounters(void);
+    void     PrintRegistrationCounters(const char *aName);
+    void     PrintPhase(const char *aName, bool aSuccess, uint64_t aStartMs);
+    void     PrintAttachPercentiles(void);
+
+    uint32_t GetTimeoutMs(void) const { return mOptions.mTimeout * 1000; }
+
+    const Options &mOptions;
+    Core           mCore;
+    FullMeshModel  mMeshModel;
+    UnitDiskModel  mDiskModel;
+    bool           mStarted      = false;
+    uint32_t       mNumResponses = 0;
+    uint32_t       mNumFailures  = 0;
+    uint32_t       mAnswerBytes  = 0;
+
+    std::vector<uint16_t> mAnsweredRloc16s;
+};
+
+void Bench::CreateTopology(void)
+{
+    uint16_t columns = static_cast<uint16_t>(ceil(sqrt(static_cast<double>(mOptions.mNumNodes))));
+
+    for (uint16_t i = 0; i < mOptions.mNumNodes; i++)
+    {
+        Node &node = mCore.CreateNode();
+
+        switch (mOptions.mTopology)
+        {
+        case kTopologyGrid:
+            node.SetPosition(static_cast<int32_t>((i % columns) * mOptions.mSpacing),
+                             static_cast<int32_t>((i / columns) * mOptions.mSpacing));
+            break;
+        case kTopologyLine:
+            node.SetPosition(static_cast<int32_t>(i * mOptions.mSpacing), 0);
+            break;
+        case kTopologyMesh:
+            break;
+        }
+
+        // Group 0 is the first half of the nodes (by position) and
+        // group 1 the second half; used by the merge scenario.
+        node.SetGroup((i < mOptions.mNumNodes / 2) ? 0 : 1);
+    }
+}
+
+bool Bench::AreAllAttached(void)
+{
+    bool allAttached = true;
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        if (!mCore.GetNode(i).IsAttached())
+        {
+            allAttached = false;
+            break;
+        }
+    }
+
+    return allAttached;
+}
+
+uint32_t Bench::CountPartitions(void)
+{
+    std::vector<uint32_t> partitionIds;
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        Node &node = mCore.GetNode(i);
+
+        if (node.IsAttached() &&
+            std::find(partitionIds.begin(), partitionIds.end(), node.GetPartitionId()) == partitionIds.end())
+        {
+            partitionIds.push_back(node.GetPartitionId());
+        }
+    }
+
+    return static_cast<uint32_t>(partitionIds.size());
+}
+
+bool Bench::IsRoutingConverged(void)
+{
+    bool converged = true;
+
+    for (uint16_t i = 0; converged && i < mCore.GetNumNodes(); i++)
+    {
+        Node       &node     = mCore.GetNode(i);
+        otInstance &instance = node.GetInstance();
+
+        if (!node.IsRouterOrLeader())
+        {
+            continue;
+        }
+
+        for (uint8_t routerId = 0; routerId <= otThreadGetMaxRouterId(&instance); routerId++)
+        {
+            uint16_t nextHop;
+            uint8_t  pathCost;
+
+            if (!otThreadIsRouterIdAllocated(&instance, routerId) || (routerId == (node.GetRloc16() >> 10)))
+            {
+                continue;
+            }
+
+            otThreadGetNextHopAndPathCost(&instance, static_cast<uint16_t>(routerId << 10), &nextHop, &pathCost);
+
+            if (nextHop == Mac::kShortAddrInvalid)
+            {
+                converged = false;
+                break;
+            }
+        }
+    }
+
+    return converged;
+}
+
+Node *Bench::FindLeader(void)
+{
+    Node *leader = nullptr;
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        if (mCore.GetNode(i).GetRole() == OT_DEVICE_ROLE_LEADER)
+        {
+            leader = &mCore.GetNode(i);
+            break;
+        }
+    }
+
+    return leader;
+}
+
+bool Bench::IsNetDataSynced(uint8_t aPrevVersion)
+{
+    // Indicates whether the leader has moved past `aPrevVersion` and
+    // all nodes have its Network Data.
+
+    Node *leader = FindLeader();
+    bool  synced = true;
+
+    VerifyOrExit((leader != nullptr) && (otNetDataGetVersion(&leader->GetInstance()) != aPrevVersion),
+                 synced = false);
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        Node &node = mCore.GetNode(i);
+
+        if (!node.IsAttached() || (node.GetPartitionId() != leader->GetPartitionId()) ||
+            (otNetDataGetVersion(&node.GetInstance()) != otNetDataGetVersion(&leader->GetInstance())))
+        {
+            synced = false;
+            break;
+        }
+    }
+
+exit:
+    return synced;
+}
+
+bool Bench::ToggleOnMeshPrefix(Node &aNode, uint8_t aBorderRouterIndex, uint8_t aPrefixIndex)
+{
+    // Adds the prefix `fd00:<br>:<index>::/64` to the local Network
+    // Data of `aNode` or removes it if present, then registers it.
+
+    otBorderRouterConfig config;
+    bool                 success = true;
+
+    memset(&config, 0, sizeof(config));
+    config.mPrefix.mPrefix.mFields.m8[0] = 0xfd;
+    config.mPrefix.mPrefix.mFields.m8[3] = aBorderRouterIndex;
+    config.mPrefix.mPrefix.mFields.m8[5] = aPrefixIndex;
+    config.mPrefix.mLength               = 64;
+    config.mPreferred                    = true;
+    config.mOnMesh                       = true;
+    config.mStable                       = true;
+
+    if (otBorderRouterRemoveOnMeshPrefix(&aNode.GetInstance(), &config.mPrefix) == OT_ERROR_NOT_FOUND)
+    {
+        VerifyOrExit(otBorderRouterAddOnMeshPrefix(&aNode.GetInstance(), &config) == OT_ERROR_NONE, success = false);
+    }
+
+    VerifyOrExit(otBorderRouterRegister(&aNode.GetInstance()) == OT_ERROR_NONE, success = false);
+
+exit:
+    return success;
+}
+
+void Bench::PrintPhase(const char *aName, bool aSuccess, uint64_t aStartMs)
+{
+    uint32_t routers = 0;
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        routers += mCore.GetNode(i).IsRouterOrLeader() ? 1 : 0;
+    }
+
+    printf("%-10s %-8s %10.3f s  (partitions: %lu, routers: %lu)\n", aName, aSuccess ? "done" : "TIMEOUT",
+           static_cast<double>(mCore.GetNowMs() - aStartMs) / 1000, static_cast<unsigned long>(CountPartitions()),
+           static_cast<unsigned long>(routers));
+}
+
+void Bench::PrintAttachPercentiles(void)
+{
+    std::vector<uint64_t> times;
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        if (mCore.GetNode(i).GetFirstAttachTime() != 0)
+        {
+            times.push_back(mCore.GetNode(i).GetFirstAttachTime());
+        }
+    }
+
+    VerifyOrExit(!times.empty());
+    std::sort(times.begin(), times.end());
+
+    printf("first attach (s): p50 %.3f  p90 %.3f  p99 %.3f  max %.3f\n",
+           static_cast<double>(times[times.size() * 50 / 100]) / 1000,
+           static_cast<double>(times[times.size() * 90 / 100]) / 1000,
+           static_cast<double>(times[times.size() * 99 / 100]) / 1000, static_cast<double>(times.back()) / 1000);
+
+exit:
+    return;
+}
+
+bool Bench::FormAndJoin(void)
+{
+    otOperationalDataset dataset;
+    bool                 success = true;
+
+    VerifyOrExit(!mStarted);
+    mStarted = true;
+
+    VerifyOrExit(mCore.GetNode(0).CreateDataset(dataset) == kErrorNone, success = false);
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        VerifyOrExit(mCore.GetNode(i).Join(dataset) == kErrorNone, success = false);
+    }
+
+exit:
+    return success;
+}
+
+bool Bench::RunAttach(void)
+{
+    uint64_t start   = mCore.GetNowMs();
+    bool     success = FormAndJoin();
+
+    VerifyOrExit(success);
+    success = mCore.AdvanceTimeUntil([this]() { return AreAllAttached() && CountPartitions() == 1; }, GetTimeoutMs());
+    PrintPhase("attach", success, start);
+    PrintAttachPercentiles();
+
+exit:
+    return success;
+}
+
+bool Bench::RunConverge(void)
+{
+    uint64_t start   = mCore.GetNowMs();
+    bool     success = FormAndJoin();
+
+    VerifyOrExit(success);
+    success = mCore.AdvanceTimeUntil(
+        [this]() { return AreAllAttached() && CountPartitions() == 1 && IsRoutingConverged(); }, GetTimeoutMs());
+    PrintPhase("converge", success, start);
+
+exit:
+    return success;
+}
+
+bool Bench::RunMerge(void)
+{
+    uint64_t start;
+    bool     success;
+
+    // Let each group form its own partition, then hear each other.
+    mCore.SetGroupsIsolated(true);
+
+    start   = mCore.GetNowMs();
+    success = FormAndJoin();
+    VerifyOrExit(success);
+
+    success = mCore.AdvanceTimeUntil([this]() { return AreAllAttached() && CountPartitions() == 2; }, GetTimeoutMs());
+    PrintPhase("split", success, start);
+    VerifyOrExit(success);
+
+    mCore.SetGroupsIsolated(false);
+
+    start   = mCore.GetNowMs();
+    success = mCore.AdvanceTimeUntil([this]() { return AreAllAttached() && CountPartitions() == 1; }, GetTimeoutMs());
+    PrintPhase("merge", success, start);
+
+exit:
+    mCore.SetGroupsIsolated(false);
+    return success;
+}
+
+bool Bench::RunTmfBurst(void)
+{
+    static const uint8_t kTlvTypes[] = {OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS};
+
+    uint64_t           start;
+    bool               success;
+    Node              *leader = nullptr;
+    Node              *sender = nullptr;
+    const otIp6Address *leaderRloc;
+    uint32_t           numSent = 0;
+
+    success = FormAndJoin();
+    VerifyOrExit(success);
+
+    success = mCore.AdvanceTimeUntil([this]() { return AreAllAttached() && CountPartitions() == 1; }, GetTimeoutMs());
+    VerifyOrExit(success);
+
+    // The node farthest (by index) from the leader sends all the
+    // requests at once, so that they are all outstanding together
+    // and the leader answers (and caches) them in a burst.
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        Node &node = mCore.GetNode(i);
+
+        if (node.GetRole() == OT_DEVICE_ROLE_LEADER)
+        {
+            leader = &node;
+        }
+        else
+        {
+            sender = &node;
+        }
+    }
+
+    VerifyOrExit((leader != nullptr) && (sender != nullptr), success = false);
+    leaderRloc = otThreadGetRloc(&leader->GetInstance());
+
+    mNumResponses = 0;
+    mNumFailures  = 0;
+
+    {
+        auto wallStart = std::chrono::steady_clock::now();
+
+        start = mCore.GetNowMs();
+
+        for (uint16_t i = 0; i < mOptions.mTransactions; i++)
+        {
+            if (otThreadSendDiagnosticGet(&sender->GetInstance(), leaderRloc, kTlvTypes, sizeof(kTlvTypes),
+                                          HandleDiagnosticGetResponse, this) == OT_ERROR_NONE)
+            {
+                numSent++;
+            }
+        }
+
+        success = mCore.AdvanceTimeUntil([this, numSent]() { return mNumResponses + mNumFailures >= numSent; },
+                                         GetTimeoutMs());
+
+        PrintPhase("tmf-burst", success, start);
+        printf("tmf-burst: sent %lu/%u, responses %lu, failures %lu, wall %.3f s\n",
+               static_cast<unsigned long>(numSent), mOptions.mTransactions, static_cast<unsigned long>(mNumResponses),
+               static_cast<unsigned long>(mNumFailures),
+               std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count());
+    }
+
+    success = success && (numSent == mOptions.mTransactions) && (mNumFailures == 0);
+
+exit:
+    return success;
+}
+
+bool Bench::RunDiagPoll(void)
+{
+    // The leader polls every node with a single realm-local multicast
+    // query asking for the tables that grow with the network. A node
+    // is done once its last answer has been received.
+
+    static const uint8_t kTlvTypes[] = {
+        OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS,         OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS,
+        OT_NETWORK_DIAGNOSTIC_TLV_ROUTE,               OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST,
+        OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE,         OT_NETWORK_DIAGNOSTIC_TLV_CHILD,
+        OT_NETWORK_DIAGNOSTIC_TLV_CHILD_IP6_ADDR_LIST, OT_NETWORK_DIAGNOSTIC_TLV_ROUTER_NEIGHBOR,
+    };
+
+    uint64_t     start;
+    bool         success;
+    Node        *leader = nullptr;
+    otIp6Address destination;
+    otBufferInfo bufferInfo;
+    uint16_t     maxServerBuffers = 0;
+    uint16_t     leaderBuffers    = 0;
+
+    success = FormAndJoin();
+    VerifyOrExit(success);
+
+    success = mCore.AdvanceTimeUntil([this]() { return AreAllAttached() && CountPartitions() == 1; }, GetTimeoutMs());
+    VerifyOrExit(success);
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        Node &node = mCore.GetNode(i);
+
+        if (node.GetRole() == OT_DEVICE_ROLE_LEADER)
+        {
+            leader = &node;
+        }
+
+        otMessageResetBufferInfo(&node.GetInstance());
+    }
+
+    VerifyOrExit(leader != nullptr, success = false);
+    VerifyOrExit(otIp6AddressFromString("ff03::1", &destination) == OT_ERROR_NONE, success = false);
+
+    mNumResponses = 0;
+    mNumFailures  = 0;
+    mAnswerBytes  = 0;
+    mAnsweredRloc16s.clear();
+
+    {
+        auto wallStart = std::chrono::steady_clock::now();
+
+        start = mCore.GetNowMs();
+
+        VerifyOrExit(otThreadSendDiagnosticQuery(&leader->GetInstance(), &destination, kTlvTypes, sizeof(kTlvTypes),
+                                                 HandleDiagnosticAnswer, this) == OT_ERROR_NONE,
+                     success = false);
+
+        success = mCore.AdvanceTimeUntil(
+            [this]() { return mAnsweredRloc16s.size() >= mCore.GetNumNodes(); }, GetTimeoutMs());
+
+        PrintPhase("diag-poll", success, start);
+
+        for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+        {
+            Node &node = mCore.GetNode(i);
+
+            otMessageGetBufferInfo(&node.GetInstance(), &bufferInfo);
+
+            if (&node == leader)
+            {
+                leaderBuffers = bufferInfo.mMaxUsedBuffers;
+            }
+            else
+            {
+                maxServerBuffers = std::max(maxServerBuffers, bufferInfo.mMaxUsedBuffers);
+            }
+        }
+
+        printf("diag-poll: nodes %lu/%u, answers %lu, bytes %lu, failures %lu, %.1f answers/s, wall %.3f s\n",
+               static_cast<unsigned long>(mAnsweredRloc16s.size()), mCore.GetNumNodes(),
+               static_cast<unsigned long>(mNumResponses), static_cast<unsigned long>(mAnswerBytes),
+               static_cast<unsigned long>(mNumFailures),
+               (mCore.GetNowMs() > start) ? mNumResponses * 1000.0 / (mCore.GetNowMs() - start) : 0.0,
+               std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count());
+        printf("diag-poll: max used buffers: leader %u, other nodes %u\n", leaderBuffers, maxServerBuffers);
+    }
+
+exit:
+    return success;
+}
+
+bool Bench::RunNetData(void)
+{
+    // A few routers act as border routers, each with a fixed set of
+    // on-mesh prefixes. Each round one of them adds or removes one
+    // more prefix, and the benchmark measures the time until every
+    // node has the new Network Data. Nodes that missed the multicast
+    // Data Response request the Network Data from a neighbor, which
+    // (with `OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE`) answers with a
+    // delta when it can.
+
+    static constexpr uint8_t  kNumBorderRouters = 3;
+    static constexpr uint8_t  kNumFixedPrefixes = 2;
+    static constexpr uint16_t kNumRounds        = 30;
+
+    uint64_t            start;
+    bool                success;
+    Node               *leader;
+    uint8_t             version;
+    std::vector<Node *> borderRouters;
+
+    success = FormAndJoin();
+    VerifyOrExit(success);
+
+    success = mCore.AdvanceTimeUntil([this]() { return AreAllAttached() && CountPartitions() == 1; }, GetTimeoutMs());
+    VerifyOrExit(success);
+
+    leader = FindLeader();
+    VerifyOrExit(leader != nullptr, success = false);
+    version = otNetDataGetVersion(&leader->GetInstance());
+
+    for (uint16_t i = 0; (i < mCore.GetNumNodes()) && (borderRouters.size() < kNumBorderRouters); i++)
+    {
+        if (mCore.GetNode(i).IsRouterOrLeader())
+        {
+            borderRouters.push_back(&mCore.GetNode(i));
+        }
+    }
+
+    for (uint8_t br = 0; br < borderRouters.size(); br++)
+    {
+        for (uint8_t prefix = 0; prefix < kNumFixedPrefixes; prefix++)
+        {
+            VerifyOrExit(ToggleOnMeshPrefix(*borderRouters[br], br, prefix), success = false);
+        }
+    }
+
+    success = mCore.AdvanceTimeUntil([this, version]() { return IsNetDataSynced(version); }, GetTimeoutMs());
+    VerifyOrExit(success);
+
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        otNetDataResetDeltaCounters(&mCore.GetNode(i).GetInstance());
+    }
+#endif
+
+    {
+        auto wallStart = std::chrono::steady_clock::now();
+
+        start = mCore.GetNowMs();
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            uint8_t br = static_cast<uint8_t>(round % borderRouters.size());
+
+            version = otNetDataGetVersion(&leader->GetInstance());
+            VerifyOrExit(ToggleOnMeshPrefix(*borderRouters[br], br, kNumFixedPrefixes), success = false);
+
+            success =
+                mCore.AdvanceTimeUntil([this, version]() { return IsNetDataSynced(version); }, GetTimeoutMs());
+            VerifyOrExit(success);
+        }
+
+        PrintPhase("netdata", success, start);
+        printf("netdata: rounds %u, border routers %u, length %u, %.3f s/round, wall %.3f s\n", kNumRounds,
+               static_cast<unsigned>(borderRouters.size()), otNetDataGetLength(&borderRouters[0]->GetInstance()),
+               static_cast<double>(mCore.GetNowMs() - start) / 1000 / kNumRounds,
+               std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count());
+    }
+
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+    {
+        otNetDataDeltaCounters total;
+
+        memset(&total, 0, sizeof(total));
+
+        for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+        {
+            const otNetDataDeltaCounters *counters = otNetDataGetDeltaCounters(&mCore.GetNode(i).GetInstance());
+
+            total.mDeltasSent += counters->mDeltasSent;
+            total.mFullFallbacks += counters->mFullFallbacks;
+            total.mDeltaBytesSent += counters->mDeltaBytesSent;
+            total.mBytesSaved += counters->mBytesSaved;
+            total.mDeltasApplied += counters->mDeltasApplied;
+            total.mDeltaFailures += counters->mDeltaFailures;
+        }
+
+        printf("netdata: deltas sent %lu, full fallbacks %lu, delta bytes %lu, bytes saved %lu (%.1f%%), "
+               "applied %lu, failures %lu\n",
+               static_cast<unsigned long>(total.mDeltasSent), static_cast<unsigned long>(total.mFullFallbacks),
+               static_cast<unsigned long>(total.mDeltaBytesSent), static_cast<unsigned long>(total.mBytesSaved),
+               (total.mBytesSaved > 0)
+                   ? 100.0 * total.mBytesSaved / (total.mBytesSaved + total.mDeltaBytesSent)
+                   : 0.0,
+               static_cast<unsigned long>(total.mDeltasApplied), static_cast<unsigned long>(total.mDeltaFailures));
+    }
+#endif
+
+exit:
+    return success;
+}
+
+bool Bench::IsPrimaryBackboneRouterKnown(bool aKnown)
+{
+    bool                   matches = true;
+    otBackboneRouterConfig config;
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        if ((otBackboneRouterGetPrimary(&mCore.GetNode(i).GetInstance(), &config) == OT_ERROR_NONE) != aKnown)
+        {
+            matches = false;
+            break;
+        }
+    }
+
+    return matches;
+}
+
+uint32_t Bench::CountMulticastListeners(Node &aNode)
+{
+    uint32_t                                  count    = 0;
+    otBackboneRouterMulticastListenerIterator iterator = OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ITERATOR_INIT;
+    otBackboneRouterMulticastListenerInfo     info;
+
+    while (otBackboneRouterMulticastListenerGetNext(&aNode.GetInstance(), &iterator, &info) == OT_ERROR_NONE)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void Bench::ResetRegistrationCounters(void)
+{
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        otBackboneRouterResetRegistrationCounters(&mCore.GetNode(i).GetInstance());
+    }
+}
+
+void Bench::PrintRegistrationCounters(const char *aName)
+{
+    otBackboneRouterRegistrationCounters total;
+
+    memset(&total, 0, sizeof(total));
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        const otBackboneRouterRegistrationCounters *counters =
+            otBackboneRouterGetMlrCounters(&mCore.GetNode(i).GetInstance());
+
+        total.mRequests += counters->mRequests;
+        total.mAddresses += counters->mAddresses;
+        total.mSuccesses += counters->mSuccesses;
+        total.mFailures += counters->mFailures;
+        total.mTotalLatency += counters->mTotalLatency;
+        total.mMaxLatency = std::max(total.mMaxLatency, counters->mMaxLatency);
+    }
+
+    printf("%s: requests %lu, addresses %lu (%.2f/request), successes %lu, failures %lu, latency avg %.3f s, "
+           "max %.3f s\n",
+           aName, static_cast<unsigned long>(total.mRequests), static_cast<unsigned long>(total.mAddresses),
+           (total.mRequests > 0) ? static_cast<double>(total.mAddresses) / total.mRequests : 0.0,
+           static_cast<unsigned long>(total.mSuccesses), static_cast<unsigned long>(total.mFailures),
+           (total.mSuccesses > 0) ? static_cast<double>(total.mTotalLatency) / 1000 / total.mSuccesses : 0.0,
+           static_cast<double>(total.mMaxLatency) / 1000);
+}
+
+bool Bench::RunMlr(void)
+{
+    // Every other node is a rx-on-when-idle MED whose parent registers
+    // its multicast subscriptions with the Primary Backbone Router (the
+    // leader). The first phase measures the time until the Multicast
+    // Listeners Table holds every subscription, the second one the
+    // time to rebuild the table after the Backbone Router restarts.
+    // With `OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE` the
+    // registrations queued within a short window share one MLR.req.
+
+    static constexpr uint8_t kGroupsPerNode = 2;
+
+    const uint32_t numListeners = static_cast<uint32_t>(mCore.GetNumNodes()) * kGroupsPerNode;
+    uint64_t       start;
+    bool           success;
+    Node          *leader;
+
+    for (uint16_t i = 1; i < mCore.GetNumNodes(); i += 2)
+    {
+        otLinkModeConfig mode;
+
+        mode.mRxOnWhenIdle = true;
+        mode.mDeviceType   = false;
+        mode.mNetworkData  = false;
+        VerifyOrExit(otThreadSetLinkMode(&mCore.GetNode(i).GetInstance(), mode) == OT_ERROR_NONE, success = false);
+    }
+
+    success = FormAndJoin();
+    VerifyOrExit(success);
+
+    success = mCore.AdvanceTimeUntil([this]() { return AreAllAttached() && CountPartitions() == 1; }, GetTimeoutMs());
+    VerifyOrExit(success);
+
+    leader = FindLeader();
+    VerifyOrExit(leader != nullptr, success = false);
+
+    otBackboneRouterSetEnabled(&leader->GetInstance(), true);
+
+    success = mCore.AdvanceTimeUntil([this]() { return IsPrimaryBackboneRouterKnown(true); }, GetTimeoutMs());
+    VerifyOrExit(success);
+
+    ResetRegistrationCounters();
+    start = mCore.GetNowMs();
+
+    for (uint16_t i = 0; i < mCore.GetNumNodes(); i++)
+    {
+        for (uint8_t group = 0; group < kGroupsPerNode; group++)
+        {
+            otIp6Address address;
+
+            memset(&address, 0, sizeof(address));
+            address.mFields.m8[0]  = 0xff;
+            address.mFields.m8[1]  = 0x05;
+            address.mFields.m8[12] = static_cast<uint8_t>(i >> 8);
+            address.mFields.m8[13] = static_cast<uint8_t>(i & 0xff);
+            address.mFields.m8[15] = static_cast<uint8_t>(group + 1);
+
+            VerifyOrExit(otIp6SubscribeMulticastAddress(&mCore.GetNode(i).GetInstance(), &address) == OT_ERROR_NONE,
+                         success = false);
+        }
+    }
+
+    success = mCore.AdvanceTimeUntil(
+        [this, leader, numListeners]() { return CountMulticastListeners(*leader) >= numListeners; }, GetTimeoutMs());
+    PrintPhase("mlr", success, start);
+    PrintRegistrationCounters("mlr");
+    VerifyOrExit(success);
+
+    // Restart the Backbone Router once every node noticed it is gone,
+    // so that all subscriptions are registered again.
+    otBackboneRouterSetEnabled(&leader->GetInstance(), false);
+
+    success = mCore.AdvanceTimeUntil([this]() { return IsPrimaryBackboneRouterKnown(false); }, GetTimeoutMs());
+    VerifyOrExit(success);
+
+    ResetRegistrationCounters();
+    start = mCore.GetNowMs();
+
+    otBackboneRouterSetEnabled(&leader->GetInstance(), true);
+
+    success = mCore.AdvanceTimeUntil(
+        [this, leader, numListeners]() { return CountMulticastListeners(*leader) >= numListeners; }, GetTimeoutMs());
+    PrintPhase("mlr-rereg", success, start);
+    PrintRegistrationCounters("mlr-rereg");
+
+exit:
+    return success;
+}
+
+void Bench::HandleDiagnosticAnswer(otError              aError,
+                                   otMessage           *aMessage,
+                                   const otMessageInfo *aMessageInfo,
+                                   void                *aContext)
+{
+    Bench                  *bench = static_cast<Bench *>(aContext);
+    otNetworkDiagAnswerInfo answerInfo;
+    uint16_t                rloc16;
+
+    if (aError != OT_ERROR_NONE)
+    {
+        bench->mNumFailures++;
+        ExitNow();
+    }
+
+    bench->mNumResponses++;
+    bench->mAnswerBytes += otMessageGetLength(aMessage) - otMessageGetOffset(aMessage);
+
+    VerifyOrExit(otThreadGetDiagnosticAnswerInfo(aMessage, &answerInfo) == OT_ERROR_NONE);
+    VerifyOrExit(answerInfo.mIsLast);
+
+    rloc16 = static_cast<uint16_t>((aMessageInfo->mPeerAddr.mFields.m8[14] << 8) |
+                                   aMessageInfo->mPeerAddr.mFields.m8[15]);
+
+    if (std::find(bench->mAnsweredRloc16s.begin(), bench->mAnsweredRloc16s.end(), rloc16) ==
+        bench->mAnsweredRloc16s.end())
+    {
+        bench->mAnsweredRloc16s.push_back(rloc16);
+    }
+
+exit:
+    return;
+}
+
+void Bench::HandleDiagnosticGetResponse(otError              aError,
+                                        otMessage           *aMessage,
+                                        const otMessageInfo *aMessageInfo,
+                                        void                *aContext)
+{
+    Bench *bench = static_cast<Bench *>(aContext);
+
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    if (aError == OT_ERROR_NONE)
+    {
+        bench->mNumResponses++;
+    }
+    else
+    {
+        bench->mNumFailures++;
+    }
+}
+
+void Bench::PrintCounters(double aWallTime)
+{
+    const Core::Counters &counters = mCore.GetCounters();
+
+    printf("virtual %.3f s, wall %.3f s, %llu events (%.0f/s), frames sent %llu, received %llu, lost %llu, "
+           "acks %llu\n",
+           static_cast<double>(mCore.GetNowMs()) / 1000, aWallTime, static_cast<unsigned long long>(counters.mEvents),
+           (aWallTime > 0) ? static_cast<double>(counters.mEvents) / aWallTime : 0.0,
+           static_cast<unsigned long long>(counters.mFramesSent),
+           static_cast<unsigned long long>(counters.mFramesReceived),
+           static_cast<unsigned long long>(counters.mFramesLost),
+           static_cast<unsigned long long>(counters.mAcksReceived));
+}
+
+static bool RunScenario(const Options &aOptions, bool (Bench::*aScenario)(void))
+{
+    auto  start = std::chrono::steady_clock::now();
+    Bench bench(aOptions);
+    bool  success;
+
+    success = (bench.*aScenario)();
+    bench.PrintCounters(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    return success;
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(int aArgCount, char *aArgVector[])
+{
+    using namespace ot::Nexus;
+
+    Options options;
+    bool    success = true;
+    auto    start   = std::chrono::steady_clock::now();
+
+    if (!ParseOptions(aArgCount, aArgVector, options))
+    {
+        PrintUsage(aArgVector[0]);
+        return EXIT_FAILURE;
+    }
+
+    printf("nodes: %u, seed: %llu\n", options.mNumNodes, static_cast<unsigned long long>(options.mSeed));
+
+    // Each scenario starts from a fresh network so that their results
+    // do not depend on the scenarios run before.
+    if (options.mAttach)
+    {
+        success &= RunScenario(options, &Bench::RunAttach);
+    }
+
+    if (options.mConverge)
+    {
+        success &= RunScenario(options, &Bench::RunConverge);
+    }
+
+    if (options.mMerge)
+    {
+        success &= RunScenario(options, &Bench::RunMerge);
+    }
+
+    if (options.mTmfBurst)
+    {
+        success &= RunScenario(options, &Bench::RunTmfBurst);
+    }
+
+    if (options.mDiagPoll)
+    {
+        success &= RunScenario(options, &Bench::RunDiagPoll);
+    }
+
+    if (options.mNetData)
+    {
+        success &= RunScenario(options, &Bench::RunNetData);
+    }
+
+    if (options.mMlr)
+    {
+        success &= RunScenario(options, &Bench::RunMlr);
+    }
+
+    printf("wall time: %.3f s\n",
+           std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,88 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the compile-time configuration constants for the nexus in-process simulator.
+ */
+
+#ifndef OPENTHREAD_CORE_NEXUS_CONFIG_H_
+#define OPENTHREAD_CORE_NEXUS_CONFIG_H_
+
+#define OPENTHREAD_CONFIG_PLATFORM_INFO "NEXUS"
+
+// All nodes live in one process, each owning an `otInstance`.
+#define OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE 1
+
+#define OPENTHREAD_CONFIG_LOG_OUTPUT OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
+
+#define OPENTHREAD_CONFIG_LOG_LEVEL OT_LOG_LEVEL_NOTE
+
+#define OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE 1
+
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 0
+
+// Keep the per-node footprint small so that thousands of instances fit in memory.
+#define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 32
+
+// Message buffers come from the (external) heap so that a node only pays for the buffers it actually uses, while
+// the TMF burst benchmark can still keep hundreds of transactions outstanding on a single node.
+#define OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE 1
+
+#define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 256
+
+#define OPENTHREAD_CONFIG_TMF_NETDIAG_CLIENT_ENABLE 1
+
+// Border routers add and remove prefixes in the netdata benchmark.
+#define OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE 1
+
+// Can be disabled from the build command line to compare with full Network Data transfers.
+#ifndef OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE 1
+#endif
+
+// The leader acts as the Primary Backbone Router in the mlr benchmark. Only multicast routing is used, so ND proxying
+// stays disabled to keep the per-node footprint small.
+#define OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE 1
+#define OPENTHREAD_CONFIG_BACKBONE_ROUTER_DUA_NDPROXYING_ENABLE 0
+#define OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE 1
+#define OPENTHREAD_CONFIG_MLR_ENABLE 1
+#define OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS 256
+
+// Can be disabled from the build command line to compare with unbatched registrations.
+#ifndef OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE
+#define OPENTHREAD_CONFIG_BBR_REGISTRATION_BATCHING_ENABLE 1
+#endif
+
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES 16
+
+#define OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE 0
+
+#define OPENTHREAD_CONFIG_LOG_PREPEND_UPTIME 0
+
+#endif // OPENTHREAD_CORE_NEXUS_CONFIG_H_
@@ -0,0 +1,308 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the core of the nexus simulator.
+ */
+
+#include "nexus_core.hpp"
+
+#include <algorithm>
+
+#include <openthread/tasklet.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Nexus {
+
+Core *Core::sCore = nullptr;
+
+Core::Core(uint64_t aSeed)
+    : mDefaultRadioModel(0)
+    , mRadioModel(&mDefaultRadioModel)
+    , mRandom(aSeed)
+    , mNow(0)
+    , mNextSequence(0)
+    , mActiveNode(nullptr)
+    , mGroupsIsolated(false)
+    , mLogEnabled(false)
+{
+    OT_ASSERT(sCore == nullptr);
+
+    memset(&mCounters, 0, sizeof(mCounters));
+    sCore = this;
+}
+
+Core::~Core(void)
+{
+    for (Node *node : mNodes)
+    {
+        delete node;
+    }
+
+    sCore = nullptr;
+}
+
+Node &Core::CreateNode(void)
+{
+    Node *node = new Node(static_cast<uint16_t>(mNodes.size() + 1));
+
+    mNodes.push_back(node);
+    ProcessTasklets();
+
+    return *node;
+}
+
+void Core::AdvanceTime(uint32_t aDuration) { ProcessEvents(mNow + static_cast<uint64_t>(aDuration) * 1000); }
+
+void Core::UpdateAlarm(Node &aNode)
+{
+    Alarm &alarm = aNode.GetAlarm();
+
+    alarm.mGeneration++;
+
+    if (alarm.mIsRunning)
+    {
+        PushEvent(alarm.mFireTime, aNode, alarm.mGeneration, kEventAlarm);
+    }
+}
+
+void Core::StartTransmit(Node &aNode)
+{
+    Radio   &radio   = aNode.GetRadio();
+    uint64_t airTime = kTurnaroundTime + (kPhyHeaderSize + radio.mTxFrame.GetLength()) * kByteTime;
+
+    if (radio.mTxFrame.GetAckRequest())
+    {
+        airTime += kTurnaroundTime + (kPhyHeaderSize + kAckSize) * kByteTime;
+    }
+
+    radio.mTxGeneration++;
+    PushEvent(mNow + airTime, aNode, radio.mTxGeneration, kEventTxDone);
+}
+
+void Core::SignalTasklets(Node &aNode) { mPendingTasklets.push_back(&aNode); }
+
+void Core::RequestReset(Node &aNode)
+{
+    // The instance cannot be torn down from within its own call
+    // stack, so the reset is deferred to an event.
+
+    PushEvent(mNow, aNode, 0, kEventReset);
+}
+
+void Core::HandleAttach(Node &aNode)
+{
+    if (aNode.mFirstAttachTime == 0)
+    {
+        aNode.mFirstAttachTime = GetNowMs();
+    }
+}
+
+void Core::PushEvent(uint64_t aTime, Node &aNode, uint32_t aGeneration, EventType aType)
+{
+    Event event;
+
+    event.mTime       = aTime;
+    event.mSequence   = mNextSequence++;
+    event.mNode       = &aNode;
+    event.mGeneration = aGeneration;
+    event.mType       = aType;
+
+    mEvents.push_back(event);
+    std::push_heap(mEvents.begin(), mEvents.end());
+}
+
+void Core::ProcessEvents(uint64_t aUntil)
+{
+    ProcessTasklets();
+
+    while (!mEvents.empty() && mEvents.front().mTime <= aUntil)
+    {
+        Event event = mEvents.front();
+
+        std::pop_heap(mEvents.begin(), mEvents.end());
+        mEvents.pop_back();
+
+        if (!IsEventValid(event))
+        {
+            continue;
+        }
+
+        mNow = std::max(mNow, event.mTime);
+        mCounters.mEvents++;
+        mActiveNode = event.mNode;
+
+        switch (event.mType)
+        {
+        case kEventAlarm:
+            event.mNode->GetAlarm().mIsRunning = false;
+            otPlatAlarmMilliFired(&event.mNode->GetInstance());
+            break;
+        case kEventTxDone:
+            HandleTxDone(*event.mNode);
+            break;
+        case kEventReset:
+            event.mNode->Reset();
+            break;
+        }
+
+        mActiveNode = nullptr;
+        ProcessTasklets();
+    }
+
+    mNow = std::max(mNow, aUntil);
+}
+
+bool Core::IsEventValid(const Event &aEvent) const
+{
+    // Events are invalidated lazily: restarting or stopping an
+    // alarm, or starting a new transmission, bumps the generation.
+
+    bool isValid = false;
+
+    switch (aEvent.mType)
+    {
+    case kEventAlarm:
+        isValid = (aEvent.mGeneration == aEvent.mNode->GetAlarm().mGeneration);
+        break;
+    case kEventTxDone:
+        isValid = (aEvent.mGeneration == aEvent.mNode->GetRadio().mTxGeneration);
+        break;
+    case kEventReset:
+        isValid = true;
+        break;
+    }
+
+    return isValid;
+}
+
+void Core::ProcessTasklets(void)
+{
+    // A node may signal again while its tasklets run, so the list is
+    // drained by swapping it out until nothing is left pending.
+
+    std::vector<Node *> pending;
+
+    while (!mPendingTasklets.empty())
+    {
+        pending.swap(mPendingTasklets);
+
+        for (Node *node : pending)
+        {
+            if (otTaskletsArePending(&node->GetInstance()))
+            {
+                mActiveNode = node;
+                mCounters.mTaskletRuns++;
+                otTaskletsProcess(&node->GetInstance());
+            }
+        }
+
+        pending.clear();
+    }
+
+    mActiveNode = nullptr;
+}
+
+void Core::HandleTxDone(Node &aNode)
+{
+    Radio        &txRadio  = aNode.GetRadio();
+    Mac::TxFrame &frame    = txRadio.mTxFrame;
+    bool          ackValid = false;
+    Error         error    = kErrorNone;
+
+    otPlatRadioTxStarted(&aNode.GetInstance(), &frame);
+    mCounters.mFramesSent++;
+
+    for (Node *rxNode : mNodes)
+    {
+        Radio &rxRadio = rxNode->GetRadio();
+        int8_t rssi;
+
+        if (rxNode == &aNode || !rxRadio.IsListeningOn(frame.GetChannel()))
+        {
+            continue;
+        }
+
+        if (!IsReceived(aNode, *rxNode, rssi))
+        {
+            mCounters.mFramesLost++;
+            continue;
+        }
+
+        if (!rxRadio.PrepareReceive(frame, rssi, mNow))
+        {
+            continue;
+        }
+
+        if (rxRadio.HasAck() && !ackValid && IsReceived(*rxNode, aNode, rssi))
+        {
+            const Mac::TxFrame &ack = rxRadio.GetAckFrame();
+
+            memcpy(txRadio.mAckRxFrame.mPsdu, ack.GetPsdu(), ack.GetLength());
+            txRadio.mAckRxFrame.mLength                  = ack.GetLength();
+            txRadio.mAckRxFrame.mChannel                 = frame.GetChannel();
+            txRadio.mAckRxFrame.mInfo.mRxInfo.mRssi      = rssi;
+            txRadio.mAckRxFrame.mInfo.mRxInfo.mLqi       = OT_RADIO_LQI_NONE;
+            txRadio.mAckRxFrame.mInfo.mRxInfo.mTimestamp = mNow;
+            ackValid                                     = true;
+        }
+
+        mActiveNode = rxNode;
+        mCounters.mFramesReceived++;
+        otPlatRadioReceiveDone(&rxNode->GetInstance(), &rxRadio.mRxFrame, OT_ERROR_NONE);
+        mActiveNode = &aNode;
+    }
+
+    if (frame.GetAckRequest())
+    {
+        error = ackValid ? kErrorNone : kErrorNoAck;
+        mCounters.mAcksReceived += ackValid ? 1 : 0;
+    }
+
+    txRadio.mState = OT_RADIO_STATE_RECEIVE;
+    otPlatRadioTxDone(&aNode.GetInstance(), &frame, ackValid ? &txRadio.mAckRxFrame : nullptr, error);
+}
+
+bool Core::IsReceived(const Node &aTxNode, const Node &aRxNode, int8_t &aRssi)
+{
+    bool received = false;
+
+    VerifyOrExit(!mGroupsIsolated || (aTxNode.GetGroup() == aRxNode.GetGroup()));
+    received = mRadioModel->IsReceived(aTxNode, aRxNode, mRandom, aRssi);
+
+exit:
+    return received;
+}
+
+} // namespace Nexus
+} // namespace ot
@@ -0,0 +1,261 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines the core of the nexus simulator: the node set, the discrete-event queue and the virtual clock.
+ */
+
+#ifndef OT_NEXUS_CORE_HPP_
+#define OT_NEXUS_CORE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+#include <vector>
+
+#include "common/non_copyable.hpp"
+
+#include "nexus_node.hpp"
+#include "nexus_radio_model.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * Represents the simulator core.
+ *
+ * A single `Core` exists at a time. It owns the nodes and drives them from one discrete-event queue over a shared
+ * virtual clock: alarm expirations and frame transmissions are events, and tasklets of all nodes are run to
+ * completion after each event. Frames are delivered at the end of their air time to every listening node which the
+ * `RadioModel` links to the sender. A run is fully determined by the seed.
+ *
+ */
+class Core : private NonCopyable
+{
+public:
+    static constexpr uint32_t kDefaultCheckInterval = 50; ///< Default interval (ms) to check a wait condition.
+
+    /**
+     * Represents the simulator counters.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mEvents;         ///< Number of events processed.
+        uint64_t mTaskletRuns;    ///< Number of `otTaskletsProcess()` calls.
+        uint64_t mFramesSent;     ///< Number of frames transmitted (acks excluded).
+        uint64_t mFramesReceived; ///< Number of frame receptions reported to a MAC.
+        uint64_t mFramesLost;     ///< Number of (frame, listener) pairs dropped by the radio model.
+        uint64_t mAcksReceived;   ///< Number of acks received by transmitters.
+    };
+
+    /**
+     * Initializes the simulator.
+     *
+     * @param[in] aSeed  The seed of all randomness in the run.
+     *
+     */
+    explicit Core(uint64_t aSeed);
+
+    /**
+     * Destroys the simulator and all of its nodes.
+     *
+     */
+    ~Core(void);
+
+    /**
+     * Returns the current simulator.
+     *
+     * @returns The simulator.
+     *
+     */
+    static Core &Get(void) { return *sCore; }
+
+    /**
+     * Creates a new node (with its OpenThread instance).
+     *
+     * @returns The new node.
+     *
+     */
+    Node &CreateNode(void);
+
+    uint16_t GetNumNodes(void) const { return static_cast<uint16_t>(mNodes.size()); }
+    Node    &GetNode(uint16_t aIndex) { return *mNodes[aIndex]; }
+
+    /**
+     * Sets the radio model. The default model is a loss-free full mesh.
+     *
+     * @param[in] aRadioModel  The radio model (MUST outlive its use by the simulator).
+     *
+     */
+    void SetRadioModel(RadioModel &aRadioModel) { mRadioModel = &aRadioModel; }
+
+    /**
+     * Isolates or joins node groups. Isolated groups cannot hear each other, whatever the radio model.
+     *
+     * @param[in] aIsolated  TRUE to isolate the groups, FALSE to join them.
+     *
+     */
+    void SetGroupsIsolated(bool aIsolated) { mGroupsIsolated = aIsolated; }
+
+    Random         &GetRandom(void) { return mRandom; }
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Returns the virtual time.
+     *
+     * @returns The virtual time in microseconds.
+     *
+     */
+    uint64_t GetNow(void) const { return mNow; }
+
+    /**
+     * Returns the virtual time.
+     *
+     * @returns The virtual time in milliseconds.
+     *
+     */
+    uint64_t GetNowMs(void) const { return mNow / 1000; }
+
+    /**
+     * Runs the simulation for a given duration of virtual time.
+     *
+     * @param[in] aDuration  The duration in milliseconds.
+     *
+     */
+    void AdvanceTime(uint32_t aDuration);
+
+    /**
+     * Runs the simulation until a condition holds or a timeout expires.
+     *
+     * @param[in] aCondition      A callable returning `true` once the condition holds.
+     * @param[in] aTimeout        The timeout in milliseconds.
+     * @param[in] aCheckInterval  The interval in milliseconds between checks of the condition.
+     *
+     * @retval TRUE   The condition holds.
+     * @retval FALSE  The timeout expired first.
+     *
+     */
+    template <typename ConditionType>
+    bool AdvanceTimeUntil(ConditionType aCondition, uint32_t aTimeout, uint32_t aCheckInterval = kDefaultCheckInterval)
+    {
+        uint32_t elapsed = 0;
+        bool     holds;
+
+        while (!(holds = aCondition()) && elapsed < aTimeout)
+        {
+            uint32_t step = (aTimeout - elapsed < aCheckInterval) ? aTimeout - elapsed : aCheckInterval;
+
+            AdvanceTime(step);
+            elapsed += step;
+        }
+
+        return holds;
+    }
+
+    /**
+     * Enables or disables logs output (prefixed with the virtual time and node id).
+     *
+     * @param[in] aEnabled  TRUE to print the logs, FALSE to drop them.
+     *
+     */
+    void SetLogEnabled(bool aEnabled) { mLogEnabled = aEnabled; }
+    bool IsLogEnabled(void) const { return mLogEnabled; }
+
+    /**
+     * Returns the node currently running code, if any.
+     *
+     * @returns The active node, or `nullptr`.
+     *
+     */
+    Node *GetActiveNode(void) const { return mActiveNode; }
+
+    // Hooks used by the platform implementation.
+    void UpdateAlarm(Node &aNode);
+    void StartTransmit(Node &aNode);
+    void SignalTasklets(Node &aNode);
+    void RequestReset(Node &aNode);
+    void HandleAttach(Node &aNode);
+
+private:
+    static constexpr uint32_t kTurnaroundTime = 192; // aTurnaroundTime (in microseconds).
+    static constexpr uint32_t kByteTime       = 32;  // Air time of one byte at 250 kbps (in microseconds).
+    static constexpr uint32_t kPhyHeaderSize  = 6;   // SHR + PHR (in bytes).
+    static constexpr uint32_t kAckSize        = 5;   // Imm-Ack PSDU (in bytes).
+
+    enum EventType : uint8_t
+    {
+        kEventAlarm,
+        kEventTxDone,
+        kEventReset,
+    };
+
+    struct Event
+    {
+        // Orders the queue as a min-heap by time, then by insertion
+        // sequence so that simultaneous events run in FIFO order.
+        bool operator<(const Event &aOther) const
+        {
+            return (mTime != aOther.mTime) ? (mTime > aOther.mTime) : (mSequence > aOther.mSequence);
+        }
+
+        uint64_t  mTime;
+        uint64_t  mSequence;
+        Node     *mNode;
+        uint32_t  mGeneration;
+        EventType mType;
+    };
+
+    void PushEvent(uint64_t aTime, Node &aNode, uint32_t aGeneration, EventType aType);
+    void ProcessEvents(uint64_t aUntil);
+    bool IsEventValid(const Event &aEvent) const;
+    void ProcessTasklets(void);
+    void HandleTxDone(Node &aNode);
+    bool IsReceived(const Node &aTxNode, const Node &aRxNode, int8_t &aRssi);
+
+    static Core *sCore;
+
+    FullMeshModel       mDefaultRadioModel;
+    RadioModel         *mRadioModel;
+    Random              mRandom;
+    uint64_t            mNow;
+    uint64_t            mNextSequence;
+    Node               *mActiveNode;
+    bool                mGroupsIsolated;
+    bool                mLogEnabled;
+    Counters            mCounters;
+    std::vector<Node *> mNodes;
+    std::vector<Event>  mEvents;
+    std::vector<Node *> mPendingTasklets;
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // OT_NEXUS_CORE_HPP_
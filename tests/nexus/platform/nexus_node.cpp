@@ -0,0 +1,436 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a simulated node of the nexus simulator.
+ */
+
+#include "nexus_node.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <openthread/dataset_ftd.h>
+#include <openthread/ip6.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+
+#include "nexus_core.hpp"
+
+namespace ot {
+namespace Nexus {
+
+//---------------------------------------------------------------------------------------------------------------------
+// Radio
+
+Radio::Radio(void)
+{
+    mTxFrame.mPsdu    = mTxPsdu;
+    mRxFrame.mPsdu    = mRxPsdu;
+    mAckFrame.mPsdu   = mAckPsdu;
+    mAckRxFrame.mPsdu = mAckRxPsdu;
+    mTxGeneration     = 0;
+
+    Reset();
+}
+
+void Radio::Reset(void)
+{
+    mState              = OT_RADIO_STATE_DISABLED;
+    mChannel            = OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN;
+    mPromiscuous        = false;
+    mSrcMatchEnabled    = false;
+    mTxPower            = 0;
+    mPanId              = Mac::kPanIdBroadcast;
+    mShortAddress       = Mac::kShortAddrInvalid;
+    mHasAck             = false;
+    mSrcMatchShortCount = 0;
+    mSrcMatchExtCount   = 0;
+    mTxGeneration++;
+    memset(&mExtAddress, 0, sizeof(mExtAddress));
+}
+
+bool Radio::PrepareReceive(const Mac::TxFrame &aFrame, int8_t aRssi, uint64_t aNow)
+{
+    bool accept = false;
+
+    mHasAck = false;
+
+    memcpy(mRxFrame.mPsdu, aFrame.GetPsdu(), aFrame.GetLength());
+    mRxFrame.mLength                              = aFrame.GetLength();
+    mRxFrame.mChannel                             = aFrame.GetChannel();
+    mRxFrame.mInfo.mRxInfo.mTimestamp             = aNow;
+    mRxFrame.mInfo.mRxInfo.mRssi                  = aRssi;
+    mRxFrame.mInfo.mRxInfo.mLqi                   = OT_RADIO_LQI_NONE;
+    mRxFrame.mInfo.mRxInfo.mAckedWithFramePending = false;
+    mRxFrame.mInfo.mRxInfo.mAckedWithSecEnhAck    = false;
+    mRxFrame.mInfo.mRxInfo.mIsSecurityProcessed   = false;
+
+    // A promiscuous radio reports every frame and never acks.
+    VerifyOrExit(!mPromiscuous, accept = true);
+
+    VerifyOrExit(DoesAddrMatch(mRxFrame));
+    accept = true;
+
+    if (mRxFrame.GetAckRequest())
+    {
+        bool framePending = HasFramePending(mRxFrame);
+
+        mRxFrame.mInfo.mRxInfo.mAckedWithFramePending = framePending;
+
+        // Enh-Acks are sent without security and IEs. The nexus
+        // configuration leaves out the features (CSL, link metrics,
+        // time sync) which need them.
+
+        if (mRxFrame.IsVersion2015())
+        {
+            SuccessOrExit(mAckFrame.GenerateEnhAck(mRxFrame, framePending, nullptr, 0));
+        }
+        else
+        {
+            mAckFrame.GenerateImmAck(mRxFrame, framePending);
+        }
+
+        mHasAck = true;
+    }
+
+exit:
+    return accept;
+}
+
+bool Radio::DoesAddrMatch(const Mac::RxFrame &aFrame) const
+{
+    bool         matches = true;
+    Mac::Address dst;
+    Mac::PanId   panId;
+
+    SuccessOrExit(aFrame.GetDstAddr(dst));
+
+    switch (dst.GetType())
+    {
+    case Mac::Address::kTypeShort:
+        VerifyOrExit(dst.GetShort() == Mac::kShortAddrBroadcast || dst.GetShort() == mShortAddress, matches = false);
+        break;
+
+    case Mac::Address::kTypeExtended:
+    {
+        Mac::ExtAddress extAddress;
+
+        extAddress.Set(mExtAddress.m8, Mac::ExtAddress::kReverseByteOrder);
+        VerifyOrExit(dst.GetExtended() == extAddress, matches = false);
+        break;
+    }
+
+    case Mac::Address::kTypeNone:
+        break;
+    }
+
+    SuccessOrExit(aFrame.GetDstPanId(panId));
+    VerifyOrExit(panId == Mac::kPanIdBroadcast || panId == mPanId, matches = false);
+
+exit:
+    return matches;
+}
+
+bool Radio::HasFramePending(const Mac::RxFrame &aFrame) const
+{
+    bool         framePending = false;
+    Mac::Address src;
+
+    VerifyOrExit((aFrame.IsVersion2015() && aFrame.GetType() == Mac::Frame::kTypeMacCmd) ||
+                 aFrame.GetType() == Mac::Frame::kTypeData || aFrame.IsDataRequestCommand());
+
+    // With source match disabled, every ack sets the frame pending bit.
+    VerifyOrExit(mSrcMatchEnabled, framePending = true);
+
+    SuccessOrExit(aFrame.GetSrcAddr(src));
+
+    switch (src.GetType())
+    {
+    case Mac::Address::kTypeShort:
+        for (uint16_t i = 0; i < mSrcMatchShortCount; i++)
+        {
+            VerifyOrExit(mSrcMatchShort[i] != src.GetShort(), framePending = true);
+        }
+        break;
+
+    case Mac::Address::kTypeExtended:
+    {
+        otExtAddress extAddress;
+
+        // Extended source match entries are given in reverse byte order.
+        src.GetExtended().CopyTo(extAddress.m8, Mac::ExtAddress::kReverseByteOrder);
+
+        for (uint16_t i = 0; i < mSrcMatchExtCount; i++)
+        {
+            VerifyOrExit(memcmp(&mSrcMatchExt[i], &extAddress, sizeof(extAddress)) != 0, framePending = true);
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+
+exit:
+    return framePending;
+}
+
+Error Radio::AddSrcMatchShortEntry(uint16_t aShortAddress)
+{
+    Error error = kErrorNone;
+
+    IgnoreError(ClearSrcMatchShortEntry(aShortAddress));
+    VerifyOrExit(mSrcMatchShortCount < kMaxSrcMatchEntries, error = kErrorNoBufs);
+    mSrcMatchShort[mSrcMatchShortCount++] = aShortAddress;
+
+exit:
+    return error;
+}
+
+Error Radio::AddSrcMatchExtEntry(const otExtAddress &aExtAddress)
+{
+    Error error = kErrorNone;
+
+    IgnoreError(ClearSrcMatchExtEntry(aExtAddress));
+    VerifyOrExit(mSrcMatchExtCount < kMaxSrcMatchEntries, error = kErrorNoBufs);
+    mSrcMatchExt[mSrcMatchExtCount++] = aExtAddress;
+
+exit:
+    return error;
+}
+
+Error Radio::ClearSrcMatchShortEntry(uint16_t aShortAddress)
+{
+    Error error = kErrorNotFound;
+
+    for (uint16_t i = 0; i < mSrcMatchShortCount; i++)
+    {
+        if (mSrcMatchShort[i] == aShortAddress)
+        {
+            mSrcMatchShort[i] = mSrcMatchShort[--mSrcMatchShortCount];
+            error             = kErrorNone;
+            break;
+        }
+    }
+
+    return error;
+}
+
+Error Radio::ClearSrcMatchExtEntry(const otExtAddress &aExtAddress)
+{
+    Error error = kErrorNotFound;
+
+    for (uint16_t i = 0; i < mSrcMatchExtCount; i++)
+    {
+        if (memcmp(&mSrcMatchExt[i], &aExtAddress, sizeof(aExtAddress)) == 0)
+        {
+            mSrcMatchExt[i] = mSrcMatchExt[--mSrcMatchExtCount];
+            error           = kErrorNone;
+            break;
+        }
+    }
+
+    return error;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Settings
+
+Error Settings::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const
+{
+    Error error = kErrorNotFound;
+
+    for (const Entry &entry : mEntries)
+    {
+        if (entry.mKey != aKey)
+        {
+            continue;
+        }
+
+        if (aIndex-- > 0)
+        {
+            continue;
+        }
+
+        if (aValueLength != nullptr)
+        {
+            uint16_t length = static_cast<uint16_t>(entry.mValue.size());
+
+            if (aValue != nullptr)
+            {
+                memcpy(aValue, entry.mValue.data(), (length < *aValueLength) ? length : *aValueLength);
+            }
+
+            *aValueLength = length;
+        }
+
+        error = kErrorNone;
+        break;
+    }
+
+    return error;
+}
+
+Error Settings::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    IgnoreError(Delete(aKey, -1));
+
+    return Add(aKey, aValue, aValueLength);
+}
+
+Error Settings::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    Entry entry;
+
+    entry.mKey = aKey;
+    entry.mValue.assign(aValue, aValue + aValueLength);
+    mEntries.push_back(entry);
+
+    return kErrorNone;
+}
+
+Error Settings::Delete(uint16_t aKey, int aIndex)
+{
+    Error error = kErrorNotFound;
+
+    for (auto it = mEntries.begin(); it != mEntries.end();)
+    {
+        if (it->mKey == aKey && (aIndex == -1 || aIndex-- == 0))
+        {
+            it    = mEntries.erase(it);
+            error = kErrorNone;
+
+            if (aIndex != -1)
+            {
+                break;
+            }
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return error;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Node
+
+Node::Node(uint16_t aId)
+    : mId(aId)
+    , mGroup(0)
+    , mX(0)
+    , mY(0)
+    , mFirstAttachTime(0)
+    , mInstanceSize(0)
+    , mBuffer(nullptr)
+    , mInstance(nullptr)
+{
+    size_t size = 0;
+
+    memset(&mAlarm, 0, sizeof(mAlarm));
+
+    IgnoreReturnValue(otInstanceInit(nullptr, &size));
+    mInstanceSize = size;
+    mBuffer       = static_cast<uint8_t *>(calloc(1, kInstanceOffset + mInstanceSize));
+    OT_ASSERT(mBuffer != nullptr);
+    *reinterpret_cast<Node **>(mBuffer) = this;
+
+    Init();
+}
+
+Node::~Node(void)
+{
+    Finalize();
+    free(mBuffer);
+}
+
+void Node::Init(void)
+{
+    size_t size = mInstanceSize;
+
+    mInstance = otInstanceInit(mBuffer + kInstanceOffset, &size);
+    OT_ASSERT(mInstance != nullptr);
+
+    IgnoreError(otSetStateChangedCallback(mInstance, HandleStateChanged, this));
+}
+
+void Node::Finalize(void)
+{
+    otInstanceFinalize(mInstance);
+
+    // With multiple instances, `otInstanceFinalize()` leaves the
+    // instance object in place. It is destroyed here so that shared
+    // state (e.g. the random manager) is released and re-seeded by
+    // the next instance, keeping runs reproducible.
+    static_cast<Instance *>(mInstance)->~Instance();
+}
+
+void Node::Reset(void)
+{
+    // Settings survive a reset, everything else restarts from scratch.
+
+    Finalize();
+
+    mAlarm.mIsRunning = false;
+    mAlarm.mGeneration++;
+    mRadio.Reset();
+
+    Init();
+}
+
+Error Node::CreateDataset(otOperationalDataset &aDataset) { return otDatasetCreateNewNetwork(mInstance, &aDataset); }
+
+Error Node::Join(const otOperationalDataset &aDataset)
+{
+    Error error;
+
+    SuccessOrExit(error = otDatasetSetActive(mInstance, &aDataset));
+    SuccessOrExit(error = otIp6SetEnabled(mInstance, true));
+    error = otThreadSetEnabled(mInstance, true);
+
+exit:
+    return error;
+}
+
+void Node::HandleStateChanged(otChangedFlags aFlags, void *aContext)
+{
+    Node *node = static_cast<Node *>(aContext);
+
+    if ((aFlags & OT_CHANGED_THREAD_ROLE) && node->IsAttached())
+    {
+        Core::Get().HandleAttach(*node);
+    }
+}
+
+} // namespace Nexus
+} // namespace ot
@@ -0,0 +1,305 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines a simulated node of the nexus simulator.
+ */
+
+#ifndef OT_NEXUS_NODE_HPP_
+#define OT_NEXUS_NODE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+#include <vector>
+
+#include <openthread/dataset.h>
+#include <openthread/instance.h>
+#include <openthread/thread.h>
+#include <openthread/platform/radio.h>
+
+#include "common/error.hpp"
+#include "common/non_copyable.hpp"
+#include "mac/mac_frame.hpp"
+
+namespace ot {
+namespace Nexus {
+
+class Core;
+
+/**
+ * Represents the millisecond alarm of a node.
+ *
+ */
+struct Alarm
+{
+    bool     mIsRunning;  ///< Whether the alarm is running.
+    uint32_t mGeneration; ///< Incremented on every start/stop, invalidating events already queued.
+    uint64_t mFireTime;   ///< The fire time (in microseconds of virtual time).
+};
+
+/**
+ * Represents the radio of a node.
+ *
+ */
+class Radio : private NonCopyable
+{
+public:
+    static constexpr uint16_t kMaxSrcMatchEntries = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+
+    /**
+     * Initializes the radio.
+     *
+     */
+    Radio(void);
+
+    /**
+     * Resets the radio to its power-on state.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * Indicates whether the radio is receiving on a given channel.
+     *
+     * @param[in] aChannel  The channel.
+     *
+     * @retval TRUE   The radio is in receive state on @p aChannel.
+     * @retval FALSE  The radio is not listening on @p aChannel.
+     *
+     */
+    bool IsListeningOn(uint8_t aChannel) const { return (mState == OT_RADIO_STATE_RECEIVE) && (mChannel == aChannel); }
+
+    /**
+     * Prepares the receive frame (and the ack, if any) for a frame heard on the air.
+     *
+     * @param[in] aFrame  The frame on the air.
+     * @param[in] aRssi   The RSSI of the frame.
+     * @param[in] aNow    The current time (in microseconds).
+     *
+     * @retval TRUE   The frame passes the address filter and should be reported to the MAC.
+     * @retval FALSE  The frame is filtered out.
+     *
+     */
+    bool PrepareReceive(const Mac::TxFrame &aFrame, int8_t aRssi, uint64_t aNow);
+
+    /**
+     * Indicates whether an ack was generated by the last call to `PrepareReceive()`.
+     *
+     * @retval TRUE   `GetAckFrame()` holds the ack.
+     * @retval FALSE  No ack was generated.
+     *
+     */
+    bool HasAck(void) const { return mHasAck; }
+
+    /**
+     * Returns the ack generated by the last call to `PrepareReceive()`.
+     *
+     * @returns The ack frame.
+     *
+     */
+    const Mac::TxFrame &GetAckFrame(void) const { return mAckFrame; }
+
+    Error AddSrcMatchShortEntry(uint16_t aShortAddress);
+    Error AddSrcMatchExtEntry(const otExtAddress &aExtAddress);
+    Error ClearSrcMatchShortEntry(uint16_t aShortAddress);
+    Error ClearSrcMatchExtEntry(const otExtAddress &aExtAddress);
+    void  ClearSrcMatchShortEntries(void) { mSrcMatchShortCount = 0; }
+    void  ClearSrcMatchExtEntries(void) { mSrcMatchExtCount = 0; }
+
+    otRadioState   mState;
+    uint8_t        mChannel;
+    bool           mPromiscuous;
+    bool           mSrcMatchEnabled;
+    int8_t         mTxPower;
+    otPanId        mPanId;
+    otShortAddress mShortAddress;
+    otExtAddress   mExtAddress; ///< In the byte order of the frames (reversed).
+    uint32_t       mTxGeneration;
+    Mac::TxFrame   mTxFrame;
+    Mac::RxFrame   mRxFrame;
+    Mac::RxFrame   mAckRxFrame; ///< The ack received for the last transmitted frame.
+
+private:
+    bool DoesAddrMatch(const Mac::RxFrame &aFrame) const;
+    bool HasFramePending(const Mac::RxFrame &aFrame) const;
+
+    bool         mHasAck;
+    uint16_t     mSrcMatchShortCount;
+    uint16_t     mSrcMatchExtCount;
+    uint16_t     mSrcMatchShort[kMaxSrcMatchEntries];
+    otExtAddress mSrcMatchExt[kMaxSrcMatchEntries];
+    Mac::TxFrame mAckFrame;
+    uint8_t      mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t      mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t      mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t      mAckRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+};
+
+/**
+ * Represents the non-volatile settings of a node (kept in memory).
+ *
+ */
+class Settings : private NonCopyable
+{
+public:
+    Error Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const;
+    Error Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength);
+    Error Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength);
+    Error Delete(uint16_t aKey, int aIndex);
+    void  Wipe(void) { mEntries.clear(); }
+
+private:
+    struct Entry
+    {
+        uint16_t             mKey;
+        std::vector<uint8_t> mValue;
+    };
+
+    std::vector<Entry> mEntries;
+};
+
+/**
+ * Represents a simulated node, owning an OpenThread instance.
+ *
+ */
+class Node : private NonCopyable
+{
+    friend class Core;
+
+public:
+    /**
+     * Returns the node owning a given OpenThread instance.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     *
+     * @returns The node.
+     *
+     */
+    static Node &From(otInstance *aInstance)
+    {
+        return **reinterpret_cast<Node **>(reinterpret_cast<uint8_t *>(aInstance) - kInstanceOffset);
+    }
+
+    otInstance &GetInstance(void) const { return *mInstance; }
+    uint16_t    GetId(void) const { return mId; }
+    int32_t     GetX(void) const { return mX; }
+    int32_t     GetY(void) const { return mY; }
+    uint8_t     GetGroup(void) const { return mGroup; }
+    Alarm      &GetAlarm(void) { return mAlarm; }
+    Radio      &GetRadio(void) { return mRadio; }
+    Settings   &GetSettings(void) { return mSettings; }
+
+    /**
+     * Sets the position of the node (used by position-based radio models).
+     *
+     * @param[in] aX  The X coordinate.
+     * @param[in] aY  The Y coordinate.
+     *
+     */
+    void SetPosition(int32_t aX, int32_t aY)
+    {
+        mX = aX;
+        mY = aY;
+    }
+
+    /**
+     * Sets the group of the node.
+     *
+     * Nodes in different groups cannot hear each other while groups are isolated (`Core::SetGroupsIsolated()`).
+     *
+     * @param[in] aGroup  The group.
+     *
+     */
+    void SetGroup(uint8_t aGroup) { mGroup = aGroup; }
+
+    /**
+     * Creates a new Operational Dataset with random parameters (drawn from the simulator seed).
+     *
+     * @param[out] aDataset  The new dataset.
+     *
+     * @retval kErrorNone  Successfully created the dataset.
+     *
+     */
+    Error CreateDataset(otOperationalDataset &aDataset);
+
+    /**
+     * Brings up the interface and starts Thread using @p aDataset as Active Operational Dataset.
+     *
+     * @param[in] aDataset  The dataset.
+     *
+     * @retval kErrorNone  Successfully started Thread.
+     *
+     */
+    Error Join(const otOperationalDataset &aDataset);
+
+    otDeviceRole GetRole(void) const { return otThreadGetDeviceRole(mInstance); }
+    bool         IsAttached(void) const { return GetRole() >= OT_DEVICE_ROLE_CHILD; }
+    bool         IsRouterOrLeader(void) const { return GetRole() >= OT_DEVICE_ROLE_ROUTER; }
+    uint32_t     GetPartitionId(void) const { return otThreadGetPartitionId(mInstance); }
+    uint16_t     GetRloc16(void) const { return otThreadGetRloc16(mInstance); }
+
+    /**
+     * Returns the time (in milliseconds of virtual time) at which the node first attached, or zero if it never did.
+     *
+     * @returns The first attach time.
+     *
+     */
+    uint64_t GetFirstAttachTime(void) const { return mFirstAttachTime; }
+
+private:
+    // The `Node` pointer is stored right in front of the instance
+    // so that `From()` is a constant-time lookup.
+    static constexpr size_t kInstanceOffset = 16;
+
+    Node(uint16_t aId);
+    ~Node(void);
+
+    void        Init(void);
+    void        Finalize(void);
+    void        Reset(void);
+    static void HandleStateChanged(otChangedFlags aFlags, void *aContext);
+
+    uint16_t    mId;
+    uint8_t     mGroup;
+    int32_t     mX;
+    int32_t     mY;
+    uint64_t    mFirstAttachTime;
+    size_t      mInstanceSize;
+    uint8_t    *mBuffer;
+    otInstance *mInstance;
+    Alarm       mAlarm;
+    Radio       mRadio;
+    Settings    mSettings;
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // OT_NEXUS_NODE_HPP_
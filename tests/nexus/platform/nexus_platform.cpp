@@ -0,0 +1,378 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the OpenThread platform abstraction on top of the nexus simulator.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <openthread/tasklet.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/entropy.h>
+#include <openthread/platform/logging.h>
+#include <openthread/platform/memory.h>
+#include <openthread/platform/misc.h>
+#include <openthread/platform/radio.h>
+#include <openthread/platform/settings.h>
+
+#include "common/code_utils.hpp"
+
+#include "nexus_core.hpp"
+#include "nexus_node.hpp"
+
+using namespace ot;
+using namespace ot::Nexus;
+
+extern "C" {
+
+//---------------------------------------------------------------------------------------------------------------------
+// Tasklets, memory and misc
+
+void otTaskletsSignalPending(otInstance *aInstance) { Core::Get().SignalTasklets(Node::From(aInstance)); }
+
+void *otPlatCAlloc(size_t aNum, size_t aSize) { return calloc(aNum, aSize); }
+
+void otPlatFree(void *aPtr) { free(aPtr); }
+
+void otPlatReset(otInstance *aInstance) { Core::Get().RequestReset(Node::From(aInstance)); }
+
+otPlatResetReason otPlatGetResetReason(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_PLAT_RESET_REASON_POWER_ON;
+}
+
+void otPlatWakeHost(void) {}
+
+void otPlatAssertFail(const char *aFilename, int aLineNumber)
+{
+    fprintf(stderr, "assert failed at %s:%d\n", aFilename, aLineNumber);
+    abort();
+}
+
+otError otPlatEntropyGet(uint8_t *aOutput, uint16_t aOutputLength)
+{
+    for (uint16_t i = 0; i < aOutputLength; i++)
+    {
+        aOutput[i] = static_cast<uint8_t>(Core::Get().GetRandom().GetUint32());
+    }
+
+    return OT_ERROR_NONE;
+}
+
+void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    Core   &core = Core::Get();
+    Node   *node = core.GetActiveNode();
+    va_list args;
+
+    OT_UNUSED_VARIABLE(aLogLevel);
+    OT_UNUSED_VARIABLE(aLogRegion);
+
+    VerifyOrExit(core.IsLogEnabled());
+
+    printf("%10.3f ", static_cast<double>(core.GetNow()) / 1000000);
+
+    if (node != nullptr)
+    {
+        printf("[%04u] ", node->GetId());
+    }
+
+    va_start(args, aFormat);
+    vprintf(aFormat, args);
+    va_end(args);
+    printf("\n");
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Alarm
+
+uint32_t otPlatAlarmMilliGetNow(void) { return static_cast<uint32_t>(Core::Get().GetNowMs()); }
+
+void otPlatAlarmMilliStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    Core  &core  = Core::Get();
+    Node  &node  = Node::From(aInstance);
+    Alarm &alarm = node.GetAlarm();
+
+    // `aT0 + aDt` is relative to the 32-bit wrapping millisecond
+    // clock, so it is converted to an offset from now.
+    int32_t remaining = static_cast<int32_t>(aT0 + aDt - otPlatAlarmMilliGetNow());
+
+    alarm.mIsRunning = true;
+    alarm.mFireTime  = core.GetNow() + ((remaining > 0) ? static_cast<uint64_t>(remaining) * 1000 : 0);
+    core.UpdateAlarm(node);
+}
+
+void otPlatAlarmMilliStop(otInstance *aInstance)
+{
+    Node &node = Node::From(aInstance);
+
+    node.GetAlarm().mIsRunning = false;
+    Core::Get().UpdateAlarm(node);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Settings
+
+void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, uint16_t aSensitiveKeysLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aSensitiveKeys);
+    OT_UNUSED_VARIABLE(aSensitiveKeysLength);
+}
+
+void otPlatSettingsDeinit(otInstance *aInstance) { OT_UNUSED_VARIABLE(aInstance); }
+
+otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    return Node::From(aInstance).GetSettings().Get(aKey, aIndex, aValue, aValueLength);
+}
+
+otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    return Node::From(aInstance).GetSettings().Set(aKey, aValue, aValueLength);
+}
+
+otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    return Node::From(aInstance).GetSettings().Add(aKey, aValue, aValueLength);
+}
+
+otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+{
+    return Node::From(aInstance).GetSettings().Delete(aKey, aIndex);
+}
+
+void otPlatSettingsWipe(otInstance *aInstance) { Node::From(aInstance).GetSettings().Wipe(); }
+
+//---------------------------------------------------------------------------------------------------------------------
+// Radio
+
+otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    // Acks are delivered with `otPlatRadioTxDone()`. CSMA-CA,
+    // retransmissions, security and energy scan are left to the
+    // software implementation in `SubMac`.
+    return OT_RADIO_CAPS_ACK_TIMEOUT;
+}
+
+const char *otPlatRadioGetVersionString(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return "NEXUS";
+}
+
+int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return -100;
+}
+
+void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
+{
+    uint16_t id = Node::From(aInstance).GetId();
+
+    aIeeeEui64[0] = 0x18;
+    aIeeeEui64[1] = 0xb4;
+    aIeeeEui64[2] = 0x30;
+    aIeeeEui64[3] = 0x00;
+    aIeeeEui64[4] = 0x00;
+    aIeeeEui64[5] = 0x00;
+    aIeeeEui64[6] = static_cast<uint8_t>(id >> 8);
+    aIeeeEui64[7] = static_cast<uint8_t>(id & 0xff);
+}
+
+void otPlatRadioSetPanId(otInstance *aInstance, otPanId aPanId) { Node::From(aInstance).GetRadio().mPanId = aPanId; }
+
+void otPlatRadioSetExtendedAddress(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    Node::From(aInstance).GetRadio().mExtAddress = *aExtAddress;
+}
+
+void otPlatRadioSetShortAddress(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    Node::From(aInstance).GetRadio().mShortAddress = aShortAddress;
+}
+
+bool otPlatRadioGetPromiscuous(otInstance *aInstance) { return Node::From(aInstance).GetRadio().mPromiscuous; }
+
+void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
+{
+    Node::From(aInstance).GetRadio().mPromiscuous = aEnable;
+}
+
+otError otPlatRadioGetTransmitPower(otInstance *aInstance, int8_t *aPower)
+{
+    *aPower = Node::From(aInstance).GetRadio().mTxPower;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioSetTransmitPower(otInstance *aInstance, int8_t aPower)
+{
+    Node::From(aInstance).GetRadio().mTxPower = aPower;
+
+    return OT_ERROR_NONE;
+}
+
+otRadioState otPlatRadioGetState(otInstance *aInstance) { return Node::From(aInstance).GetRadio().mState; }
+
+bool otPlatRadioIsEnabled(otInstance *aInstance)
+{
+    return Node::From(aInstance).GetRadio().mState != OT_RADIO_STATE_DISABLED;
+}
+
+otError otPlatRadioEnable(otInstance *aInstance)
+{
+    Radio &radio = Node::From(aInstance).GetRadio();
+
+    if (radio.mState == OT_RADIO_STATE_DISABLED)
+    {
+        radio.mState = OT_RADIO_STATE_SLEEP;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioDisable(otInstance *aInstance)
+{
+    Node::From(aInstance).GetRadio().mState = OT_RADIO_STATE_DISABLED;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioSleep(otInstance *aInstance)
+{
+    Radio  &radio = Node::From(aInstance).GetRadio();
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(radio.mState == OT_RADIO_STATE_SLEEP || radio.mState == OT_RADIO_STATE_RECEIVE,
+                 error = OT_ERROR_INVALID_STATE);
+    radio.mState = OT_RADIO_STATE_SLEEP;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
+{
+    Radio  &radio = Node::From(aInstance).GetRadio();
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(radio.mState != OT_RADIO_STATE_DISABLED, error = OT_ERROR_INVALID_STATE);
+    radio.mState   = OT_RADIO_STATE_RECEIVE;
+    radio.mChannel = aChannel;
+
+exit:
+    return error;
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance) { return &Node::From(aInstance).GetRadio().mTxFrame; }
+
+otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    Node   &node  = Node::From(aInstance);
+    Radio  &radio = node.GetRadio();
+    otError error = OT_ERROR_NONE;
+
+    OT_ASSERT(aFrame == &radio.mTxFrame);
+    OT_UNUSED_VARIABLE(aFrame);
+
+    VerifyOrExit(radio.mState == OT_RADIO_STATE_RECEIVE, error = OT_ERROR_INVALID_STATE);
+    radio.mState = OT_RADIO_STATE_TRANSMIT;
+    Core::Get().StartTransmit(node);
+
+exit:
+    return error;
+}
+
+int8_t otPlatRadioGetRssi(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return -100;
+}
+
+otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aScanChannel);
+    OT_UNUSED_VARIABLE(aScanDuration);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+void otPlatRadioEnableSrcMatch(otInstance *aInstance, bool aEnable)
+{
+    Node::From(aInstance).GetRadio().mSrcMatchEnabled = aEnable;
+}
+
+otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    return Node::From(aInstance).GetRadio().AddSrcMatchShortEntry(aShortAddress);
+}
+
+otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    return Node::From(aInstance).GetRadio().AddSrcMatchExtEntry(*aExtAddress);
+}
+
+otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    return Node::From(aInstance).GetRadio().ClearSrcMatchShortEntry(aShortAddress);
+}
+
+otError otPlatRadioClearSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    return Node::From(aInstance).GetRadio().ClearSrcMatchExtEntry(*aExtAddress);
+}
+
+void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance)
+{
+    Node::From(aInstance).GetRadio().ClearSrcMatchShortEntries();
+}
+
+void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
+{
+    Node::From(aInstance).GetRadio().ClearSrcMatchExtEntries();
+}
+
+} // extern "C"
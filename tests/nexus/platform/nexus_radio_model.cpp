@@ -0,0 +1,99 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the radio propagation models of the nexus simulator.
+ */
+
+#include "nexus_radio_model.hpp"
+
+#include <math.h>
+
+#include "nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+uint32_t Random::GetUint32(void)
+{
+    mState ^= mState >> 12;
+    mState ^= mState << 25;
+    mState ^= mState >> 27;
+
+    return static_cast<uint32_t>((mState * 0x2545f4914f6cdd1dull) >> 32);
+}
+
+bool FullMeshModel::IsReceived(const Node &aTxNode, const Node &aRxNode, Random &aRandom, int8_t &aRssi)
+{
+    bool received = (aRandom.GetUint32InRange(100) >= mLossPercent);
+
+    OT_UNUSED_VARIABLE(aTxNode);
+    OT_UNUSED_VARIABLE(aRxNode);
+
+    aRssi = kRssi;
+
+    return received;
+}
+
+UnitDiskModel::UnitDiskModel(uint32_t aRange, uint8_t aEdgeLossPercent)
+    : mRangeSquared(static_cast<uint64_t>(aRange) * aRange)
+    , mRange(aRange)
+    , mEdgeLossPercent(aEdgeLossPercent)
+{
+}
+
+bool UnitDiskModel::IsReceived(const Node &aTxNode, const Node &aRxNode, Random &aRandom, int8_t &aRssi)
+{
+    bool     received = false;
+    int64_t  dx       = static_cast<int64_t>(aTxNode.GetX()) - aRxNode.GetX();
+    int64_t  dy       = static_cast<int64_t>(aTxNode.GetY()) - aRxNode.GetY();
+    uint64_t distanceSquared;
+    double   ratio;
+    uint32_t lossPercent;
+
+    distanceSquared = static_cast<uint64_t>(dx * dx + dy * dy);
+    VerifyOrExit(distanceSquared <= mRangeSquared);
+
+    ratio = (mRange == 0) ? 0 : sqrt(static_cast<double>(distanceSquared)) / mRange;
+
+    // Loss grows linearly from zero at half the range up to
+    // `mEdgeLossPercent` at the edge of the range.
+
+    lossPercent = (ratio <= 0.5) ? 0 : static_cast<uint32_t>((ratio - 0.5) * 2 * mEdgeLossPercent);
+    VerifyOrExit(aRandom.GetUint32InRange(100) >= lossPercent);
+
+    aRssi    = static_cast<int8_t>(kRssiAtZero + (kRssiAtRange - kRssiAtZero) * ratio);
+    received = true;
+
+exit:
+    return received;
+}
+
+} // namespace Nexus
+} // namespace ot
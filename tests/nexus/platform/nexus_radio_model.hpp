@@ -0,0 +1,177 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines the radio propagation models of the nexus simulator.
+ */
+
+#ifndef OT_NEXUS_RADIO_MODEL_HPP_
+#define OT_NEXUS_RADIO_MODEL_HPP_
+
+#include <stdint.h>
+
+namespace ot {
+namespace Nexus {
+
+class Node;
+
+/**
+ * Implements a seeded pseudo-random number generator (xorshift64*).
+ *
+ * All randomness in the simulator is drawn from it so that a run is fully determined by its seed.
+ *
+ */
+class Random
+{
+public:
+    /**
+     * Initializes the generator.
+     *
+     * @param[in] aSeed  The seed (a zero seed is replaced by a fixed non-zero value).
+     *
+     */
+    explicit Random(uint64_t aSeed) { SetSeed(aSeed); }
+
+    /**
+     * Re-seeds the generator.
+     *
+     * @param[in] aSeed  The seed (a zero seed is replaced by a fixed non-zero value).
+     *
+     */
+    void SetSeed(uint64_t aSeed) { mState = (aSeed != 0) ? aSeed : 0x9e3779b97f4a7c15ull; }
+
+    /**
+     * Returns the next 32-bit random value.
+     *
+     * @returns A random value.
+     *
+     */
+    uint32_t GetUint32(void);
+
+    /**
+     * Returns a random value in the range [0, @p aMax).
+     *
+     * @param[in] aMax  The exclusive upper bound (MUST be non-zero).
+     *
+     * @returns A random value smaller than @p aMax.
+     *
+     */
+    uint32_t GetUint32InRange(uint32_t aMax) { return GetUint32() % aMax; }
+
+private:
+    uint64_t mState;
+};
+
+/**
+ * Represents a radio propagation and loss model.
+ *
+ * The model is consulted for every (transmitter, listener) pair of a frame, and for the reverse direction of an ack.
+ *
+ */
+class RadioModel
+{
+public:
+    virtual ~RadioModel(void) = default;
+
+    /**
+     * Indicates whether a frame sent by @p aTxNode is received by @p aRxNode.
+     *
+     * @param[in]  aTxNode  The transmitting node.
+     * @param[in]  aRxNode  The listening node.
+     * @param[in]  aRandom  The random number generator to draw losses from.
+     * @param[out] aRssi    The RSSI of the received frame (set only when returning TRUE).
+     *
+     * @retval TRUE   The frame is received.
+     * @retval FALSE  The frame is lost.
+     *
+     */
+    virtual bool IsReceived(const Node &aTxNode, const Node &aRxNode, Random &aRandom, int8_t &aRssi) = 0;
+};
+
+/**
+ * Implements a model in which every node hears every other node, losing each frame with a fixed probability.
+ *
+ */
+class FullMeshModel : public RadioModel
+{
+public:
+    /**
+     * Initializes the model.
+     *
+     * @param[in] aLossPercent  The probability (in percent) of losing a frame.
+     *
+     */
+    explicit FullMeshModel(uint8_t aLossPercent = 0)
+        : mLossPercent(aLossPercent)
+    {
+    }
+
+    bool IsReceived(const Node &aTxNode, const Node &aRxNode, Random &aRandom, int8_t &aRssi) override;
+
+private:
+    static constexpr int8_t kRssi = -40;
+
+    uint8_t mLossPercent;
+};
+
+/**
+ * Implements a unit-disk model over the node positions.
+ *
+ * Nodes within `aRange` of each other are linked. The RSSI falls linearly from -30 dBm at distance zero to -90 dBm at
+ * the edge of the range. Frames are lost with `aEdgeLossPercent` probability at the edge of the range, and with a
+ * probability decreasing linearly to zero at half the range.
+ *
+ */
+class UnitDiskModel : public RadioModel
+{
+public:
+    /**
+     * Initializes the model.
+     *
+     * @param[in] aRange            The radio range (in position units).
+     * @param[in] aEdgeLossPercent  The probability (in percent) of losing a frame at the edge of the range.
+     *
+     */
+    UnitDiskModel(uint32_t aRange, uint8_t aEdgeLossPercent);
+
+    bool IsReceived(const Node &aTxNode, const Node &aRxNode, Random &aRandom, int8_t &aRssi) override;
+
+private:
+    static constexpr int8_t kRssiAtZero  = -30;
+    static constexpr int8_t kRssiAtRange = -90;
+
+    uint64_t mRangeSquared;
+    uint32_t mRange;
+    uint8_t  mEdgeLossPercent;
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // OT_NEXUS_RADIO_MODEL_HPP_
@@ -0,0 +1,136 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/thread.h>
+
+#include "test_util.h"
+
+#include "nexus_core.hpp"
+#include "nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint16_t kNumNodes      = 8;
+static constexpr uint32_t kFormTimeout   = 20 * 1000;
+static constexpr uint32_t kAttachTimeout = 60 * 1000;
+
+struct RunResult
+{
+    uint64_t mEvents;
+    uint16_t mRloc16[kNumNodes];
+};
+
+static bool AreAllAttached(Core &aCore)
+{
+    bool allAttached = true;
+
+    for (uint16_t i = 0; i < aCore.GetNumNodes(); i++)
+    {
+        if (!aCore.GetNode(i).IsAttached())
+        {
+            allAttached = false;
+            break;
+        }
+    }
+
+    return allAttached;
+}
+
+static RunResult RunFormJoin(uint64_t aSeed)
+{
+    Core                 core(aSeed);
+    otOperationalDataset dataset;
+    RunResult            result;
+
+    for (uint16_t i = 0; i < kNumNodes; i++)
+    {
+        core.CreateNode();
+    }
+
+    Node &leader = core.GetNode(0);
+
+    SuccessOrQuit(leader.CreateDataset(dataset));
+    SuccessOrQuit(leader.Join(dataset));
+
+    VerifyOrQuit(core.AdvanceTimeUntil([&]() { return leader.GetRole() == OT_DEVICE_ROLE_LEADER; }, kFormTimeout));
+
+    for (uint16_t i = 1; i < kNumNodes; i++)
+    {
+        SuccessOrQuit(core.GetNode(i).Join(dataset));
+    }
+
+    VerifyOrQuit(core.AdvanceTimeUntil([&]() { return AreAllAttached(core); }, kAttachTimeout));
+
+    for (uint16_t i = 0; i < kNumNodes; i++)
+    {
+        Node &node = core.GetNode(i);
+
+        VerifyOrQuit(node.GetPartitionId() == leader.GetPartitionId());
+        VerifyOrQuit(node.GetFirstAttachTime() != 0);
+        result.mRloc16[i] = node.GetRloc16();
+    }
+
+    VerifyOrQuit(core.GetCounters().mFramesSent > 0);
+    VerifyOrQuit(core.GetCounters().mAcksReceived > 0);
+
+    result.mEvents = core.GetCounters().mEvents;
+
+    printf("seed %llu: %u nodes attached at %llu ms after %llu events\n", static_cast<unsigned long long>(aSeed),
+           kNumNodes, static_cast<unsigned long long>(core.GetNowMs()),
+           static_cast<unsigned long long>(result.mEvents));
+
+    return result;
+}
+
+void TestFormJoin(void)
+{
+    RunResult first  = RunFormJoin(1);
+    RunResult second = RunFormJoin(1);
+
+    // A run is fully determined by its seed.
+    VerifyOrQuit(first.mEvents == second.mEvents);
+    VerifyOrQuit(memcmp(first.mRloc16, second.mRloc16, sizeof(first.mRloc16)) == 0);
+
+    RunFormJoin(2);
+
+    printf("TestFormJoin passed\n");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestFormJoin();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -156,6 +156,8 @@
 
 #define OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE 1
 
+#define OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE 1
+
 #define OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE 1
 
 #define OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_ENABLE 1
@@ -28,12 +28,15 @@
 
 #include "test_platform.h"
 
+#include <chrono>
+
 #include <openthread/config.h>
 
 #include "test_util.h"
 #include "common/array.hpp"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "common/num_utils.hpp"
 #include "thread/child_table.hpp"
 
 namespace ot {
@@ -393,11 +396,463 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+// Returns the multicast address `ff05::<aGroup>:<aChildIndex>`.
+static Ip6::Address ChildMulticastAddress(uint16_t aChildIndex, uint16_t aGroup)
+{
+    Ip6::Address address;
+
+    SuccessOrQuit(address.FromString("ff05::"));
+    address.mFields.m16[6] = Encoding::BigEndian::HostSwap16(aGroup);
+    address.mFields.m16[7] = Encoding::BigEndian::HostSwap16(aChildIndex);
+
+    return address;
+}
+
+// Adds all children as sleepy children each registering `aNumGroups` multicast addresses.
+static void AddSleepyChildrenWithMulticastAddresses(ChildTable &aTable, uint16_t aNumGroups)
+{
+    aTable.Clear();
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        Child *child = aTable.GetNewChild();
+
+        VerifyOrQuit(child != nullptr);
+        child->SetState(Child::kStateValid);
+        child->SetRloc16(0x8000 + index);
+
+        for (uint16_t group = 0; group < aNumGroups; group++)
+        {
+            SuccessOrQuit(child->AddIp6Address(ChildMulticastAddress(index, group)));
+        }
+    }
+}
+
+void TestChildTableMulticastLookup(void)
+{
+    static constexpr uint16_t kNumGroups = 2;
+
+    ChildTable *table;
+    Child      *child;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("TestChildTableMulticastLookup()");
+
+    AddSleepyChildrenWithMulticastAddresses(*table, kNumGroups);
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        for (uint16_t group = 0; group < kNumGroups; group++)
+        {
+            VerifyOrQuit(table->HasSleepyChildWithAddress(ChildMulticastAddress(index, group)));
+        }
+
+        VerifyOrQuit(!table->HasSleepyChildWithAddress(ChildMulticastAddress(index, kNumGroups)));
+    }
+
+    // Address removal and re-registration
+
+    child = table->GetChildAtIndex(0);
+    VerifyOrQuit(child != nullptr);
+
+    SuccessOrQuit(child->RemoveIp6Address(ChildMulticastAddress(0, 0)));
+    VerifyOrQuit(!table->HasSleepyChildWithAddress(ChildMulticastAddress(0, 0)));
+    VerifyOrQuit(table->HasSleepyChildWithAddress(ChildMulticastAddress(0, 1)));
+
+    child->ClearIp6Addresses();
+    VerifyOrQuit(!table->HasSleepyChildWithAddress(ChildMulticastAddress(0, 1)));
+
+    SuccessOrQuit(child->AddIp6Address(ChildMulticastAddress(0, kNumGroups)));
+    VerifyOrQuit(table->HasSleepyChildWithAddress(ChildMulticastAddress(0, kNumGroups)));
+
+    // A child that is not sleepy (or not valid) is not matched even
+    // though its address is still in the filter.
+
+    child->SetDeviceMode(Mle::DeviceMode(Mle::DeviceMode::kModeRxOnWhenIdle));
+    VerifyOrQuit(!table->HasSleepyChildWithAddress(ChildMulticastAddress(0, kNumGroups)));
+
+    child = table->GetChildAtIndex(1);
+    VerifyOrQuit(child != nullptr);
+    child->SetState(Child::kStateInvalid);
+    VerifyOrQuit(!table->HasSleepyChildWithAddress(ChildMulticastAddress(1, 0)));
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void BenchmarkChildTableMulticastLookup(void)
+{
+    // Simulates multicast datagrams received by a parent with all its
+    // children (`OPENTHREAD_CONFIG_MLE_MAX_CHILDREN`) being sleepy and
+    // registered to some multicast groups. Most datagrams are for
+    // groups which no child is registered to. The lookup using the
+    // child table (with its multicast filter) is compared with a plain
+    // scan of the registered child addresses.
+
+    static constexpr uint16_t kNumGroups  = 2;
+    static constexpr uint16_t kNumLookups = 20000;
+
+    using Clock = std::chrono::steady_clock;
+
+    ChildTable       *table;
+    uint32_t          numScanHits  = 0;
+    uint32_t          numTableHits = 0;
+    Clock::duration   scanDuration;
+    Clock::duration   tableDuration;
+    Clock::time_point start;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("BenchmarkChildTableMulticastLookup()");
+
+    AddSleepyChildrenWithMulticastAddresses(*table, kNumGroups);
+
+    // One in every 16 lookups is for a registered address.
+
+    start = Clock::now();
+
+    for (uint16_t num = 0; num < kNumLookups; num++)
+    {
+        Ip6::Address address = ChildMulticastAddress(num % kMaxChildren, ((num % 16) == 0) ? 0 : (num % 16) + 100);
+
+        for (const Child &child : table->Iterate(Child::kInStateValidOrRestoring))
+        {
+            if (!child.IsRxOnWhenIdle() && child.HasIp6Address(address))
+            {
+                numScanHits++;
+                break;
+            }
+        }
+    }
+
+    scanDuration = Clock::now() - start;
+    start        = Clock::now();
+
+    for (uint16_t num = 0; num < kNumLookups; num++)
+    {
+        Ip6::Address address = ChildMulticastAddress(num % kMaxChildren, ((num % 16) == 0) ? 0 : (num % 16) + 100);
+
+        if (table->HasSleepyChildWithAddress(address))
+        {
+            numTableHits++;
+        }
+    }
+
+    tableDuration = Clock::now() - start;
+
+    VerifyOrQuit(numScanHits == numTableHits);
+    VerifyOrQuit(numTableHits == (kNumLookups + 15) / 16);
+
+    printf("\n  %u sleepy children, %u multicast addresses each, %u lookups", kMaxChildren, kNumGroups, kNumLookups);
+    printf("\n  child address scan: %lld usec",
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(scanDuration).count()));
+    printf("\n  child table with multicast filter: %lld usec",
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(tableDuration).count()));
+
+    printf("\n -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+// Finds a child matching `aMatcher` by checking all child table entries in order.
+static Child *FindChildByScan(ChildTable &aTable, const Child::AddressMatcher &aMatcher)
+{
+    Child *match = nullptr;
+
+    for (uint16_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        Child *child = aTable.GetChildAtIndex(index);
+
+        if (child->Matches(aMatcher))
+        {
+            match = child;
+            break;
+        }
+    }
+
+    return match;
+}
+
+static Mac::ExtAddress ChildExtAddress(uint16_t aIndex, uint8_t aVersion)
+{
+    Mac::ExtAddress extAddress;
+
+    extAddress.m8[0] = 0x12;
+    extAddress.m8[1] = aVersion;
+    extAddress.m8[2] = static_cast<uint8_t>(aIndex >> 8);
+    extAddress.m8[3] = static_cast<uint8_t>(aIndex & 0xff);
+    extAddress.m8[4] = static_cast<uint8_t>((aIndex * 37) & 0xff);
+    extAddress.m8[5] = 0x5a;
+    extAddress.m8[6] = static_cast<uint8_t>((aIndex * 101) & 0xff);
+    extAddress.m8[7] = static_cast<uint8_t>(aVersion ^ 0xa5);
+
+    return extAddress;
+}
+
+// Verifies that `FindChild()` (which may use the address index) finds the same entry as a scan of the table.
+static void VerifyChildLookups(ChildTable &aTable, uint16_t aRloc16, const Mac::ExtAddress &aExtAddress)
+{
+    const Child::StateFilter kFilters[] = {
+        Child::kInStateValid,
+        Child::kInStateValidOrRestoring,
+        Child::kInStateChildIdRequest,
+        Child::kInStateValidOrAttaching,
+        Child::kInStateInvalid,
+        Child::kInStateAnyExceptInvalid,
+        Child::kInStateAnyExceptValidOrRestoring,
+        Child::kInStateAny,
+    };
+
+    for (Child::StateFilter filter : kFilters)
+    {
+        Mac::Address macAddress;
+
+        VerifyOrQuit(aTable.FindChild(aRloc16, filter) ==
+                     FindChildByScan(aTable, Child::AddressMatcher(aRloc16, filter)));
+        VerifyOrQuit(aTable.FindChild(aExtAddress, filter) ==
+                     FindChildByScan(aTable, Child::AddressMatcher(aExtAddress, filter)));
+
+        macAddress.SetShort(aRloc16);
+        VerifyOrQuit(aTable.FindChild(macAddress, filter) ==
+                     FindChildByScan(aTable, Child::AddressMatcher(macAddress, filter)));
+
+        macAddress.SetExtended(aExtAddress);
+        VerifyOrQuit(aTable.FindChild(macAddress, filter) ==
+                     FindChildByScan(aTable, Child::AddressMatcher(macAddress, filter)));
+    }
+}
+
+static void VerifyAllChildLookups(ChildTable &aTable, uint8_t aMaxVersion)
+{
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        for (uint8_t version = 0; version <= aMaxVersion; version++)
+        {
+            VerifyChildLookups(aTable, 0x8000 + (version << 9) + index, ChildExtAddress(index, version));
+        }
+    }
+}
+
+void TestChildTableAddressIndex(void)
+{
+    const Child::State kStates[] = {
+        Child::kStateValid,          Child::kStateInvalid,       Child::kStateRestored, Child::kStateChildIdRequest,
+        Child::kStateParentResponse, Child::kStateParentRequest, Child::kStateValid,    Child::kStateChildUpdateRequest,
+    };
+
+    ChildTable *table;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("TestChildTableAddressIndex()");
+
+    // Set the addresses before or after the state of the children so
+    // entries are added to the index in both ways.
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        Child *child = table->GetChildAtIndex(index);
+
+        if ((index % 2) == 0)
+        {
+            child->SetRloc16(0x8000 + index);
+            child->SetExtAddress(ChildExtAddress(index, 0));
+            child->SetState(kStates[index % GetArrayLength(kStates)]);
+        }
+        else
+        {
+            child->SetState(kStates[index % GetArrayLength(kStates)]);
+            child->SetRloc16(0x8000 + index);
+            child->SetExtAddress(ChildExtAddress(index, 0));
+        }
+    }
+
+    VerifyAllChildLookups(*table, 0);
+
+    // Change the state, the RLOC16 or the extended address of children.
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        Child *child = table->GetChildAtIndex(index);
+
+        switch (index % 4)
+        {
+        case 0:
+            child->SetState(kStates[(index + 1) % GetArrayLength(kStates)]);
+            break;
+        case 1:
+            child->SetRloc16(0x8000 + (1 << 9) + index);
+            break;
+        case 2:
+            child->SetExtAddress(ChildExtAddress(index, 1));
+            break;
+        case 3:
+            child->Clear();
+            break;
+        }
+    }
+
+    VerifyAllChildLookups(*table, 1);
+
+    // Re-use the cleared entries and then clear the table.
+
+    for (Child *child = table->GetNewChild(); child != nullptr; child = table->GetNewChild())
+    {
+        uint16_t index = table->GetChildIndex(*child);
+
+        child->SetState(Child::kStateValid);
+        child->SetRloc16(0x8000 + index);
+        child->SetExtAddress(ChildExtAddress(index, 0));
+
+        VerifyOrQuit(table->FindChild(0x8000 + index, Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(ChildExtAddress(index, 0), Child::kInStateValid) == child);
+    }
+
+    VerifyAllChildLookups(*table, 1);
+
+    table->Clear();
+
+    VerifyOrQuit(!table->HasChildren(Child::kInStateAnyExceptInvalid));
+    VerifyAllChildLookups(*table, 1);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void BenchmarkChildTableAddressLookup(void)
+{
+    // Simulates the neighbor lookup done by the MAC layer for every
+    // received frame on a parent with a given number of children.
+    // Half the frames use the extended source address and the other
+    // half the short one. The lookup through the child table (using
+    // its address index) is compared with a scan of all entries.
+
+    static constexpr uint16_t kNumChildrenList[] = {64, 256, 511};
+    static constexpr uint32_t kNumLookups        = 100000;
+
+    using Clock = std::chrono::steady_clock;
+
+    ChildTable *table;
+    uint16_t    lastNumChildren = 0;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("BenchmarkChildTableAddressLookup()");
+
+    for (uint16_t numChildren : kNumChildrenList)
+    {
+        uint32_t          numScanHits  = 0;
+        uint32_t          numTableHits = 0;
+        Clock::duration   scanDuration;
+        Clock::duration   tableDuration;
+        Clock::time_point start;
+
+        numChildren = Min<uint16_t>(numChildren, kMaxChildren);
+
+        if (numChildren == lastNumChildren)
+        {
+            continue;
+        }
+
+        lastNumChildren = numChildren;
+        table->Clear();
+
+        for (uint16_t index = 0; index < numChildren; index++)
+        {
+            Child *child = table->GetNewChild();
+
+            VerifyOrQuit(child != nullptr);
+            child->SetState(Child::kStateValid);
+            child->SetRloc16(0x8000 + index);
+            child->SetExtAddress(ChildExtAddress(index, 0));
+        }
+
+        start = Clock::now();
+
+        for (uint32_t num = 0; num < kNumLookups; num++)
+        {
+            uint16_t     index = static_cast<uint16_t>((num * 7919) % numChildren);
+            Mac::Address macAddress;
+
+            if ((num % 2) == 0)
+            {
+                macAddress.SetExtended(ChildExtAddress(index, 0));
+            }
+            else
+            {
+                macAddress.SetShort(0x8000 + index);
+            }
+
+            if (FindChildByScan(*table, Child::AddressMatcher(macAddress, Child::kInStateValid)) != nullptr)
+            {
+                numScanHits++;
+            }
+        }
+
+        scanDuration = Clock::now() - start;
+        start        = Clock::now();
+
+        for (uint32_t num = 0; num < kNumLookups; num++)
+        {
+            uint16_t     index = static_cast<uint16_t>((num * 7919) % numChildren);
+            Mac::Address macAddress;
+
+            if ((num % 2) == 0)
+            {
+                macAddress.SetExtended(ChildExtAddress(index, 0));
+            }
+            else
+            {
+                macAddress.SetShort(0x8000 + index);
+            }
+
+            if (table->FindChild(macAddress, Child::kInStateValid) != nullptr)
+            {
+                numTableHits++;
+            }
+        }
+
+        tableDuration = Clock::now() - start;
+
+        VerifyOrQuit(numScanHits == kNumLookups);
+        VerifyOrQuit(numTableHits == kNumLookups);
+
+        printf("\n  %u children, %lu lookups", numChildren, static_cast<unsigned long>(kNumLookups));
+        printf("\n  child table scan: %lld usec",
+               static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(scanDuration).count()));
+        printf("\n  child table with address index: %lld usec",
+               static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(tableDuration).count()));
+    }
+
+    printf("\n -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableMulticastLookup();
+    ot::BenchmarkChildTableMulticastLookup();
+    ot::TestChildTableAddressIndex();
+    ot::BenchmarkChildTableAddressLookup();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -0,0 +1,382 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <string.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "coap/coap.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+
+namespace ot {
+
+static constexpr uint16_t kCoapPort = OT_DEFAULT_COAP_PORT;
+
+static Instance *sInstance;
+
+class TestCoap : public Coap::CoapBase
+{
+public:
+    explicit TestCoap(Instance &aInstance)
+        : CoapBase(aInstance, &TestCoap::Send)
+        , mNumSent(0)
+        , mLastType(Coap::kTypeConfirmable)
+        , mLastCode(Coap::kCodeEmpty)
+        , mLastMessageId(0)
+        , mLastTokenLength(0)
+    {
+    }
+
+    using CoapBase::Receive;
+
+    uint16_t GetNumPendingRequests(void) const
+    {
+        MessageQueue::Info info;
+
+        memset(&info, 0, sizeof(info));
+        GetRequestMessages().GetInfo(info);
+
+        return info.mNumMessages;
+    }
+
+    uint16_t GetNumCachedResponses(void) const
+    {
+        MessageQueue::Info info;
+
+        memset(&info, 0, sizeof(info));
+        GetCachedResponses().GetInfo(info);
+
+        return info.mNumMessages;
+    }
+
+    uint8_t GetNumUsedRequestPartitions(void) const
+    {
+        uint8_t count = 0;
+
+        for (const Coap::MessageQueue &queue : GetRequestMessages())
+        {
+            count += (queue.GetHead() != nullptr) ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    uint32_t   mNumSent;
+    Coap::Type mLastType;
+    Coap::Code mLastCode;
+    uint16_t   mLastMessageId;
+    uint8_t    mLastToken[Coap::Message::kMaxTokenLength];
+    uint8_t    mLastTokenLength;
+
+private:
+    static Error Send(CoapBase &aCoapBase, ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        OT_UNUSED_VARIABLE(aMessageInfo);
+
+        return static_cast<TestCoap &>(aCoapBase).HandleSend(AsCoapMessage(&aMessage));
+    }
+
+    Error HandleSend(Coap::Message &aMessage)
+    {
+        SuccessOrQuit(aMessage.ParseHeader());
+
+        mNumSent++;
+        mLastType        = static_cast<Coap::Type>(aMessage.GetType());
+        mLastCode        = static_cast<Coap::Code>(aMessage.GetCode());
+        mLastMessageId   = aMessage.GetMessageId();
+        mLastTokenLength = aMessage.GetTokenLength();
+        memcpy(mLastToken, AsConst(aMessage).GetToken(), mLastTokenLength);
+
+        aMessage.Free();
+
+        return kErrorNone;
+    }
+};
+
+struct Transaction
+{
+    static void HandleResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, Error aResult)
+    {
+        OT_UNUSED_VARIABLE(aMessageInfo);
+
+        Transaction *transaction = static_cast<Transaction *>(aContext);
+
+        transaction->mNumResponses++;
+        transaction->mResult = aResult;
+        transaction->mCode   = (aMessage != nullptr) ? AsCoapMessage(aMessage).GetCode() : 0;
+    }
+
+    uint16_t mMessageId;
+    uint8_t  mToken[Coap::Message::kMaxTokenLength];
+    uint8_t  mTokenLength;
+    uint16_t mNumResponses;
+    Error    mResult;
+    uint8_t  mCode;
+};
+
+static void PrepareMessageInfo(Ip6::MessageInfo &aMessageInfo, uint16_t aPeerPort)
+{
+    aMessageInfo.Clear();
+    SuccessOrQuit(aMessageInfo.GetPeerAddr().FromString("fd00::1"));
+    SuccessOrQuit(aMessageInfo.GetSockAddr().FromString("fd00::2"));
+    aMessageInfo.SetPeerPort(aPeerPort);
+    aMessageInfo.SetSockPort(kCoapPort);
+}
+
+static void SendRequest(TestCoap &aCoap, Coap::Type aType, Transaction &aTransaction)
+{
+    Coap::Message   *message = aCoap.NewMessage();
+    Ip6::MessageInfo messageInfo;
+
+    PrepareMessageInfo(messageInfo, kCoapPort);
+
+    VerifyOrQuit(message != nullptr);
+    message->Init(aType, Coap::kCodePost);
+    SuccessOrQuit(message->GenerateRandomToken(Coap::Message::kDefaultTokenLength));
+    SuccessOrQuit(message->AppendUriPathOptions("t"));
+
+    memset(&aTransaction, 0, sizeof(aTransaction));
+    SuccessOrQuit(aCoap.SendMessage(*message, messageInfo, Transaction::HandleResponse, &aTransaction));
+
+    aTransaction.mMessageId   = aCoap.mLastMessageId;
+    aTransaction.mTokenLength = aCoap.mLastTokenLength;
+    memcpy(aTransaction.mToken, aCoap.mLastToken, aTransaction.mTokenLength);
+}
+
+static void ReceiveMessage(TestCoap          &aCoap,
+                           Coap::Type         aType,
+                           Coap::Code         aCode,
+                           uint16_t           aMessageId,
+                           const Transaction *aTransaction,
+                           uint16_t           aPeerPort = kCoapPort)
+{
+    Coap::Message   *message = aCoap.NewMessage();
+    Ip6::MessageInfo messageInfo;
+
+    PrepareMessageInfo(messageInfo, aPeerPort);
+
+    VerifyOrQuit(message != nullptr);
+    message->Init(aType, aCode);
+    message->SetMessageId(aMessageId);
+
+    if (aTransaction != nullptr)
+    {
+        SuccessOrQuit(message->SetToken(aTransaction->mToken, aTransaction->mTokenLength));
+    }
+
+    if (message->IsRequest())
+    {
+        SuccessOrQuit(message->AppendUriPathOptions("t"));
+    }
+
+    message->Finish();
+    aCoap.Receive(*message, messageInfo);
+    message->Free();
+}
+
+void TestPiggybackedResponses(void)
+{
+    static constexpr uint16_t kNumRequests = 12;
+
+    TestCoap    coap(*sInstance);
+    Transaction transactions[kNumRequests];
+    Transaction unknown;
+
+    printf("TestPiggybackedResponses");
+
+    for (Transaction &transaction : transactions)
+    {
+        SendRequest(coap, Coap::kTypeConfirmable, transaction);
+    }
+
+    VerifyOrQuit(coap.mNumSent == kNumRequests);
+    VerifyOrQuit(coap.GetNumPendingRequests() == kNumRequests);
+    VerifyOrQuit((Coap::PartitionedMessageQueue::kNumPartitions == 1) || (coap.GetNumUsedRequestPartitions() > 1));
+
+    // An ACK whose token matches no request is ignored.
+    memset(&unknown, 0, sizeof(unknown));
+    unknown.mTokenLength = Coap::Message::kDefaultTokenLength;
+    memset(unknown.mToken, 0xee, unknown.mTokenLength);
+    ReceiveMessage(coap, Coap::kTypeAck, Coap::kCodeChanged, transactions[0].mMessageId, &unknown);
+    VerifyOrQuit(coap.GetNumPendingRequests() == kNumRequests);
+
+    for (uint16_t i = kNumRequests; i > 0; i--)
+    {
+        Transaction &transaction = transactions[i - 1];
+
+        ReceiveMessage(coap, Coap::kTypeAck, Coap::kCodeChanged, transaction.mMessageId, &transaction);
+
+        VerifyOrQuit(transaction.mNumResponses == 1);
+        VerifyOrQuit(transaction.mResult == kErrorNone);
+        VerifyOrQuit(transaction.mCode == Coap::kCodeChanged);
+        VerifyOrQuit(coap.GetNumPendingRequests() == i - 1);
+    }
+
+    // A duplicate response finds no request anymore.
+    ReceiveMessage(coap, Coap::kTypeAck, Coap::kCodeChanged, transactions[0].mMessageId, &transactions[0]);
+    VerifyOrQuit(transactions[0].mNumResponses == 1);
+
+    for (const Transaction &transaction : transactions)
+    {
+        VerifyOrQuit(transaction.mNumResponses == 1);
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestSeparateResponsesAndReset(void)
+{
+    static constexpr uint16_t kResponseMessageId = 0x4000;
+
+    TestCoap    coap(*sInstance);
+    Transaction confirmable;
+    Transaction nonConfirmable;
+    Transaction reset;
+
+    printf("TestSeparateResponsesAndReset");
+
+    SendRequest(coap, Coap::kTypeConfirmable, confirmable);
+    SendRequest(coap, Coap::kTypeNonConfirmable, nonConfirmable);
+    SendRequest(coap, Coap::kTypeConfirmable, reset);
+    VerifyOrQuit(coap.GetNumPendingRequests() == 3);
+
+    // Empty ACK (no token) is matched by the Message ID.
+    ReceiveMessage(coap, Coap::kTypeAck, Coap::kCodeEmpty, confirmable.mMessageId, nullptr);
+    VerifyOrQuit(confirmable.mNumResponses == 0);
+    VerifyOrQuit(coap.GetNumPendingRequests() == 3);
+
+    // Separate response is matched by the token, and acknowledged.
+    ReceiveMessage(coap, Coap::kTypeConfirmable, Coap::kCodeChanged, kResponseMessageId, &confirmable);
+    VerifyOrQuit(confirmable.mNumResponses == 1);
+    VerifyOrQuit(confirmable.mResult == kErrorNone);
+    VerifyOrQuit(coap.mLastType == Coap::kTypeAck);
+    VerifyOrQuit(coap.mLastMessageId == kResponseMessageId);
+
+    ReceiveMessage(coap, Coap::kTypeNonConfirmable, Coap::kCodeChanged, kResponseMessageId + 1, &nonConfirmable);
+    VerifyOrQuit(nonConfirmable.mNumResponses == 1);
+    VerifyOrQuit(nonConfirmable.mResult == kErrorNone);
+
+    // Reset (no token) is matched by the Message ID.
+    ReceiveMessage(coap, Coap::kTypeReset, Coap::kCodeEmpty, reset.mMessageId, nullptr);
+    VerifyOrQuit(reset.mNumResponses == 1);
+    VerifyOrQuit(reset.mResult == kErrorAbort);
+
+    VerifyOrQuit(coap.GetNumPendingRequests() == 0);
+
+    // A separate response matching no request is rejected with a reset.
+    ReceiveMessage(coap, Coap::kTypeConfirmable, Coap::kCodeChanged, kResponseMessageId + 2, &confirmable);
+    VerifyOrQuit(confirmable.mNumResponses == 1);
+    VerifyOrQuit(coap.mLastType == Coap::kTypeReset);
+    VerifyOrQuit(coap.mLastMessageId == kResponseMessageId + 2);
+
+    printf(" -- PASS\n");
+}
+
+static uint16_t sNumRequestsHandled;
+
+static void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    TestCoap      &coap     = *static_cast<TestCoap *>(aContext);
+    Coap::Message *response = coap.NewMessage();
+
+    sNumRequestsHandled++;
+
+    VerifyOrQuit(response != nullptr);
+    SuccessOrQuit(response->SetDefaultResponseHeader(AsCoapMessage(aMessage)));
+    SuccessOrQuit(coap.SendMessage(*response, AsCoreType(aMessageInfo)));
+}
+
+void TestResponseCache(void)
+{
+    static constexpr uint16_t kMaxCachedResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
+    static constexpr uint16_t kNumRequests        = kMaxCachedResponses + 4;
+    static constexpr uint16_t kFirstMessageId     = 0x100;
+    static constexpr uint16_t kOtherPeerPort      = 1234;
+
+    TestCoap       coap(*sInstance);
+    Coap::Resource resource("t", HandleRequest, &coap);
+
+    printf("TestResponseCache");
+
+    coap.AddResource(resource);
+    sNumRequestsHandled = 0;
+
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        ReceiveMessage(coap, Coap::kTypeConfirmable, Coap::kCodePost, kFirstMessageId + i, nullptr);
+        VerifyOrQuit(sNumRequestsHandled == i + 1);
+        VerifyOrQuit(coap.mLastType == Coap::kTypeAck);
+        VerifyOrQuit(coap.mLastMessageId == kFirstMessageId + i);
+    }
+
+    VerifyOrQuit(coap.GetNumCachedResponses() == kMaxCachedResponses);
+
+    // A duplicate of a recent request is answered from the cache.
+    ReceiveMessage(coap, Coap::kTypeConfirmable, Coap::kCodePost, kFirstMessageId + kNumRequests - 1, nullptr);
+    VerifyOrQuit(sNumRequestsHandled == kNumRequests);
+    VerifyOrQuit(coap.mLastType == Coap::kTypeAck);
+    VerifyOrQuit(coap.mLastMessageId == kFirstMessageId + kNumRequests - 1);
+
+    // The response to the first request was evicted from the cache.
+    ReceiveMessage(coap, Coap::kTypeConfirmable, Coap::kCodePost, kFirstMessageId, nullptr);
+    VerifyOrQuit(sNumRequestsHandled == kNumRequests + 1);
+    VerifyOrQuit(coap.GetNumCachedResponses() == kMaxCachedResponses);
+
+    // Same Message ID from another endpoint is not a duplicate.
+    ReceiveMessage(coap, Coap::kTypeConfirmable, Coap::kCodePost, kFirstMessageId + kNumRequests - 1, nullptr,
+                   kOtherPeerPort);
+    VerifyOrQuit(sNumRequestsHandled == kNumRequests + 2);
+
+    coap.ClearRequestsAndResponses();
+    VerifyOrQuit(coap.GetNumCachedResponses() == 0);
+
+    coap.RemoveResource(resource);
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::sInstance = testInitInstance();
+    VerifyOrQuit(ot::sInstance != nullptr);
+
+    ot::TestPiggybackedResponses();
+    ot::TestSeparateResponsesAndReset();
+    ot::TestResponseCache();
+
+    testFreeInstance(ot::sInstance);
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,622 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <chrono>
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/time.hpp"
+#include "meshcop/dtls.hpp"
+#include "meshcop/dtls_server.hpp"
+
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+
+namespace ot {
+namespace MeshCoP {
+
+// Clients and the server exchange datagrams through an in-process
+// loopback transport, which queues them so that neither side is
+// re-entered while mbedtls is processing a record.
+
+static constexpr uint16_t kServerPort     = 5684;
+static constexpr uint16_t kClientBasePort = 49152;
+static constexpr uint16_t kNumClients     = DtlsServer::kMaxSessions + 1;
+static constexpr uint16_t kMaxDatagrams   = 256;
+
+static const uint8_t kPsk[] = {'J', '0', '1', 'N', 'M', 'E'};
+
+struct Client
+{
+    Dtls    *mDtls;
+    uint16_t mPort;
+    bool     mConnected;
+    uint16_t mNumReceived;
+};
+
+struct Datagram
+{
+    Message *mMessage;
+    Client  *mClient; // Sending or receiving client.
+    bool     mToServer;
+    uint16_t mSpoofedPort;
+};
+
+static Instance   *sInstance;
+static uint32_t    sNow;
+static uint32_t    sAlarmTime;
+static bool        sAlarmOn;
+static Dtls       *sConfig;
+static DtlsServer *sServer;
+static Client      sClients[kNumClients];
+static Datagram    sDatagrams[kMaxDatagrams];
+static uint16_t    sDatagramHead;
+static uint16_t    sNumDatagrams;
+static uint16_t    sNumServerConnected;
+static uint16_t    sNumServerReceived;
+static Message    *sCapturedClientHello;
+static size_t      sHeapBaseline;
+static size_t      sPeakHeapInUse;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+static size_t sHeapInUse;
+
+void *otPlatCAlloc(size_t aNum, size_t aSize)
+{
+    size_t  size = aNum * aSize;
+    size_t *ptr  = static_cast<size_t *>(calloc(1, sizeof(size_t) + size));
+
+    VerifyOrQuit(ptr != nullptr);
+    *ptr = size;
+    sHeapInUse += size;
+
+    return ptr + 1;
+}
+
+void otPlatFree(void *aPtr)
+{
+    if (aPtr != nullptr)
+    {
+        size_t *ptr = static_cast<size_t *>(aPtr) - 1;
+
+        sHeapInUse -= *ptr;
+        free(ptr);
+    }
+}
+#endif
+
+} // extern "C"
+
+static size_t GetHeapInUse(void)
+{
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    return sHeapInUse;
+#else
+    return Instance::GetHeap().GetCapacity() - Instance::GetHeap().GetFreeSize();
+#endif
+}
+
+static Ip6::Address GetClientAddress(uint16_t aPort)
+{
+    Ip6::Address address;
+
+    // Each client (or spoofed peer) uses its own address.
+    SuccessOrQuit(address.FromString("fd00::1"));
+    address.mFields.m16[7] = Encoding::BigEndian::HostSwap16(aPort);
+
+    return address;
+}
+
+static Ip6::Address GetServerAddress(void)
+{
+    Ip6::Address address;
+
+    SuccessOrQuit(address.FromString("fd00::ff"));
+
+    return address;
+}
+
+static void QueueDatagram(Message &aMessage, Client *aClient, bool aToServer, uint16_t aSpoofedPort = 0)
+{
+    Datagram &datagram = sDatagrams[(sDatagramHead + sNumDatagrams) % kMaxDatagrams];
+
+    VerifyOrQuit(sNumDatagrams < kMaxDatagrams);
+
+    datagram.mMessage     = &aMessage;
+    datagram.mClient      = aClient;
+    datagram.mToServer    = aToServer;
+    datagram.mSpoofedPort = aSpoofedPort;
+    sNumDatagrams++;
+}
+
+static void DeliverDatagram(void)
+{
+    Datagram         datagram = sDatagrams[sDatagramHead];
+    Ip6::MessageInfo messageInfo;
+
+    sDatagramHead = (sDatagramHead + 1) % kMaxDatagrams;
+    sNumDatagrams--;
+
+    if (datagram.mToServer)
+    {
+        uint16_t port = (datagram.mClient != nullptr) ? datagram.mClient->mPort : datagram.mSpoofedPort;
+
+        messageInfo.SetPeerAddr(GetClientAddress(port));
+        messageInfo.SetPeerPort(port);
+        messageInfo.SetSockAddr(GetServerAddress());
+        messageInfo.SetSockPort(kServerPort);
+
+        if (sServer->IsRunning())
+        {
+            sServer->HandleUdpReceive(*datagram.mMessage, messageInfo);
+        }
+    }
+    else if (datagram.mClient != nullptr)
+    {
+        messageInfo.SetPeerAddr(GetServerAddress());
+        messageInfo.SetPeerPort(kServerPort);
+        messageInfo.SetSockAddr(GetClientAddress(datagram.mClient->mPort));
+        messageInfo.SetSockPort(datagram.mClient->mPort);
+
+        datagram.mClient->mDtls->HandleUdpReceive(*datagram.mMessage, messageInfo);
+    }
+
+    datagram.mMessage->Free();
+}
+
+static void Pump(void)
+{
+    // Delivers all queued datagrams and runs the tasklets until
+    // the exchange settles (time does not advance).
+
+    do
+    {
+        otTaskletsProcess(sInstance);
+
+        if (sNumDatagrams > 0)
+        {
+            DeliverDatagram();
+        }
+
+        sPeakHeapInUse = Max(sPeakHeapInUse, GetHeapInUse());
+    } while ((sNumDatagrams > 0) || otTaskletsArePending(sInstance));
+}
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    Pump();
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        sNow = sAlarmTime;
+        otPlatAlarmMilliFired(sInstance);
+        Pump();
+    }
+
+    sNow = time;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Server callbacks
+
+static Error HandleServerTransmit(void *aContext, Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Client *client = nullptr;
+
+    VerifyOrQuit(aContext == sServer);
+
+    for (Client &entry : sClients)
+    {
+        if ((entry.mDtls != nullptr) && (entry.mPort == aMessageInfo.GetPeerPort()))
+        {
+            client = &entry;
+            break;
+        }
+    }
+
+    // Datagrams to unknown (spoofed) peers are dropped.
+    QueueDatagram(aMessage, client, /* aToServer */ false);
+
+    return kErrorNone;
+}
+
+static void HandleServerConnected(void *aContext, DtlsServer::Session &aSession, bool aConnected)
+{
+    VerifyOrQuit(aContext == sServer);
+
+    printf("  Server session with port %u %s\n", aSession.GetPeerSockAddr().GetPort(),
+           aConnected ? "connected" : "disconnected");
+
+    if (aConnected)
+    {
+        sNumServerConnected++;
+    }
+    else
+    {
+        sNumServerConnected--;
+    }
+}
+
+static void HandleServerReceive(void *aContext, DtlsServer::Session &aSession, uint8_t *aBuf, uint16_t aLength)
+{
+    Message *message;
+
+    VerifyOrQuit(aContext == sServer);
+
+    sNumServerReceived++;
+
+    // Echo the payload back to the peer.
+    message = sInstance->Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->AppendBytes(aBuf, aLength));
+    SuccessOrQuit(sServer->Send(*message, aSession.GetMessageInfo()));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Client callbacks
+
+static Error HandleClientTransmit(void *aContext, Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Client *client = static_cast<Client *>(aContext);
+
+    VerifyOrQuit(aMessageInfo.GetPeerPort() == kServerPort);
+
+    if ((client == &sClients[kNumClients - 1]) && (sCapturedClientHello == nullptr))
+    {
+        // The first datagram of a client is its ClientHello without a cookie.
+        sCapturedClientHello = aMessage.Clone();
+        VerifyOrQuit(sCapturedClientHello != nullptr);
+    }
+
+    QueueDatagram(aMessage, client, /* aToServer */ true);
+
+    return kErrorNone;
+}
+
+static void HandleClientConnected(void *aContext, bool aConnected)
+{
+    static_cast<Client *>(aContext)->mConnected = aConnected;
+}
+
+static void HandleClientReceive(void *aContext, uint8_t *aBuf, uint16_t aLength)
+{
+    Client *client = static_cast<Client *>(aContext);
+    char    expected[16];
+
+    snprintf(expected, sizeof(expected), "hello %u", client->mPort);
+
+    VerifyOrQuit(aLength == strlen(expected));
+    VerifyOrQuit(memcmp(aBuf, expected, aLength) == 0);
+
+    client->mNumReceived++;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+static void InitTest(void)
+{
+    sNow                 = 0;
+    sAlarmOn             = false;
+    sDatagramHead        = 0;
+    sNumDatagrams        = 0;
+    sNumServerConnected  = 0;
+    sNumServerReceived   = 0;
+    sCapturedClientHello = nullptr;
+
+    sInstance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != nullptr);
+
+    sConfig = new Dtls(*sInstance, /* aLayerTwoSecurity */ false);
+    SuccessOrQuit(sConfig->SetPsk(kPsk, sizeof(kPsk)));
+
+    sServer = new DtlsServer(*sInstance, *sConfig);
+
+    memset(sClients, 0, sizeof(sClients));
+
+    for (uint16_t i = 0; i < kNumClients; i++)
+    {
+        sClients[i].mDtls = new Dtls(*sInstance, /* aLayerTwoSecurity */ false);
+        sClients[i].mPort = kClientBasePort + i;
+    }
+
+    sHeapBaseline  = GetHeapInUse();
+    sPeakHeapInUse = sHeapBaseline;
+}
+
+static void FinalizeTest(void)
+{
+    sServer->Stop();
+
+    for (Client &client : sClients)
+    {
+        client.mDtls->Close();
+    }
+
+    while (sNumDatagrams > 0)
+    {
+        sNumDatagrams--;
+        sDatagrams[sDatagramHead].mMessage->Free();
+        sDatagramHead = (sDatagramHead + 1) % kMaxDatagrams;
+    }
+
+    if (sCapturedClientHello != nullptr)
+    {
+        sCapturedClientHello->Free();
+    }
+
+    for (Client &client : sClients)
+    {
+        delete client.mDtls;
+    }
+
+    delete sServer;
+    delete sConfig;
+
+    VerifyOrQuit(GetHeapInUse() == sHeapBaseline);
+
+    testFreeInstance(sInstance);
+}
+
+static void StartClient(Client &aClient)
+{
+    Ip6::SockAddr serverSockAddr(GetServerAddress(), kServerPort);
+
+    SuccessOrQuit(aClient.mDtls->Open(HandleClientReceive, HandleClientConnected, &aClient));
+    SuccessOrQuit(aClient.mDtls->SetPsk(kPsk, sizeof(kPsk)));
+    SuccessOrQuit(aClient.mDtls->Bind(HandleClientTransmit, &aClient));
+    SuccessOrQuit(aClient.mDtls->Connect(serverSockAddr));
+}
+
+static void SendFromClient(Client &aClient)
+{
+    Message *message = sInstance->Get<MessagePool>().Allocate(Message::kTypeOther);
+    char     payload[16];
+
+    snprintf(payload, sizeof(payload), "hello %u", aClient.mPort);
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->AppendBytes(payload, static_cast<uint16_t>(strlen(payload))));
+    SuccessOrQuit(aClient.mDtls->Send(*message, message->GetLength()));
+}
+
+
+void TestDtlsServer(void)
+{
+    static constexpr uint16_t kNumSpoofedPeers = 100;
+
+    Client &lastClient = sClients[kNumClients - 1];
+    size_t  heapInUse;
+
+    printf("\nTestDtlsServer()\n");
+
+    InitTest();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start the server.
+
+    SuccessOrQuit(sServer->Start(HandleServerTransmit, HandleServerReceive, HandleServerConnected, sServer));
+    VerifyOrQuit(sServer->IsRunning());
+    VerifyOrQuit(sServer->Start(HandleServerTransmit, HandleServerReceive, HandleServerConnected, sServer) ==
+                 kErrorAlready);
+    VerifyOrQuit(sServer->GetNumSessions() == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Connect `kMaxSessions` clients concurrently. Each one first gets
+    // a HelloVerifyRequest and then completes its handshake.
+
+    for (uint16_t i = 0; i < DtlsServer::kMaxSessions; i++)
+    {
+        StartClient(sClients[i]);
+    }
+
+    Pump();
+
+    for (uint16_t i = 0; i < DtlsServer::kMaxSessions; i++)
+    {
+        VerifyOrQuit(sClients[i].mConnected);
+        VerifyOrQuit(sClients[i].mDtls->IsConnected());
+    }
+
+    VerifyOrQuit(sServer->GetNumSessions() == DtlsServer::kMaxSessions);
+    VerifyOrQuit(sNumServerConnected == DtlsServer::kMaxSessions);
+    VerifyOrQuit(sServer->GetCounters().mHelloVerifyRequests == DtlsServer::kMaxSessions);
+    VerifyOrQuit(sServer->GetCounters().mSessionsStarted == DtlsServer::kMaxSessions);
+    VerifyOrQuit(sServer->GetCounters().mSessionsConnected == DtlsServer::kMaxSessions);
+    VerifyOrQuit(sServer->GetCounters().mSessionsRejected == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Exchange data in all sessions. The server echoes the payload.
+
+    for (uint16_t i = 0; i < DtlsServer::kMaxSessions; i++)
+    {
+        SendFromClient(sClients[i]);
+    }
+
+    Pump();
+
+    VerifyOrQuit(sNumServerReceived == DtlsServer::kMaxSessions);
+
+    for (uint16_t i = 0; i < DtlsServer::kMaxSessions; i++)
+    {
+        VerifyOrQuit(sClients[i].mNumReceived == 1);
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // All sessions are in use. The next client passes the cookie
+    // exchange but is rejected without allocating a session.
+
+    StartClient(lastClient);
+    Pump();
+
+    VerifyOrQuit(!lastClient.mConnected);
+    VerifyOrQuit(sServer->GetNumSessions() == DtlsServer::kMaxSessions);
+    VerifyOrQuit(sServer->GetCounters().mHelloVerifyRequests == DtlsServer::kMaxSessions + 1);
+    VerifyOrQuit(sServer->GetCounters().mSessionsStarted == DtlsServer::kMaxSessions);
+    VerifyOrQuit(sServer->GetCounters().mSessionsRejected == 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Replay the cookie-less ClientHello from many spoofed peers. Each
+    // one is answered statelessly and no memory is allocated.
+
+    VerifyOrQuit(sCapturedClientHello != nullptr);
+
+    heapInUse = GetHeapInUse();
+
+    for (uint16_t i = 0; i < kNumSpoofedPeers; i++)
+    {
+        Message *message = sCapturedClientHello->Clone();
+
+        VerifyOrQuit(message != nullptr);
+        QueueDatagram(*message, nullptr, /* aToServer */ true, /* aSpoofedPort */ 1000 + i);
+        Pump();
+    }
+
+    VerifyOrQuit(GetHeapInUse() == heapInUse);
+    VerifyOrQuit(sServer->GetNumSessions() == DtlsServer::kMaxSessions);
+    VerifyOrQuit(sServer->GetCounters().mHelloVerifyRequests == DtlsServer::kMaxSessions + 1 + kNumSpoofedPeers);
+    VerifyOrQuit(sServer->GetCounters().mSessionsStarted == DtlsServer::kMaxSessions);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disconnect the first client. Its session is freed once the close
+    // notify is received, and the rejected client gets in when it
+    // retransmits its ClientHello.
+
+    sClients[0].mDtls->Disconnect();
+    AdvanceTime(10 * 1000);
+
+    VerifyOrQuit(sNumServerConnected == DtlsServer::kMaxSessions);
+    VerifyOrQuit(lastClient.mConnected);
+    VerifyOrQuit(sServer->GetNumSessions() == DtlsServer::kMaxSessions);
+    VerifyOrQuit(sServer->GetCounters().mSessionsStarted == DtlsServer::kMaxSessions + 1);
+    VerifyOrQuit(sServer->GetCounters().mSessionsConnected == DtlsServer::kMaxSessions + 1);
+
+    SendFromClient(lastClient);
+    Pump();
+    VerifyOrQuit(lastClient.mNumReceived == 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Stop the server, which frees all sessions.
+
+    sServer->Stop();
+    VerifyOrQuit(!sServer->IsRunning());
+    VerifyOrQuit(sServer->GetNumSessions() == 0);
+
+    FinalizeTest();
+
+    printf("\nTestDtlsServer() -- PASS\n");
+}
+
+void BenchmarkDtlsServer(void)
+{
+    // Runs `kMaxSessions` concurrent handshakes and measures their
+    // duration, along with the heap used by the server per session.
+
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point start;
+    Clock::duration   duration;
+    size_t            heapWithSessions;
+    size_t            serverHeap;
+
+    printf("\nBenchmarkDtlsServer()\n");
+
+    InitTest();
+
+    SuccessOrQuit(sServer->Start(HandleServerTransmit, HandleServerReceive, HandleServerConnected, sServer));
+
+    start = Clock::now();
+
+    for (uint16_t i = 0; i < DtlsServer::kMaxSessions; i++)
+    {
+        StartClient(sClients[i]);
+    }
+
+    Pump();
+
+    duration = Clock::now() - start;
+
+    VerifyOrQuit(sNumServerConnected == DtlsServer::kMaxSessions);
+
+    // The clients share the heap, so the server's share is measured
+    // by stopping the server while the clients are still connected.
+
+    heapWithSessions = GetHeapInUse();
+    sServer->Stop();
+    serverHeap = heapWithSessions - GetHeapInUse();
+
+    printf("  %u concurrent handshakes in %lld ms\n", DtlsServer::kMaxSessions,
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()));
+    printf("  Session object size: %lu bytes\n", static_cast<unsigned long>(DtlsServer::GetSessionSize()));
+    printf("  Server heap per connected session: %lu bytes\n",
+           static_cast<unsigned long>(serverHeap / DtlsServer::kMaxSessions));
+    printf("  Peak heap in use (server and clients): %lu bytes\n",
+           static_cast<unsigned long>(sPeakHeapInUse - sHeapBaseline));
+
+    FinalizeTest();
+
+    printf("\nBenchmarkDtlsServer() -- PASS\n");
+}
+
+} // namespace MeshCoP
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_DTLS_SERVER_ENABLE
+    ot::MeshCoP::TestDtlsServer();
+    ot::MeshCoP::BenchmarkDtlsServer();
+    printf("All tests passed\n");
+#else
+    printf("DTLS server is not enabled\n");
+#endif
+
+    return 0;
+}
@@ -0,0 +1,342 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "thread/child_table.hpp"
+#include "thread/indirect_queue_table.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+static Instance *sInstance;
+
+static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+static constexpr uint16_t kNumEntries  = OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES;
+
+static Child &GetChild(uint16_t aChildIndex)
+{
+    Child *child = sInstance->Get<ChildTable>().GetChildAtIndex(aChildIndex);
+
+    VerifyOrQuit(child != nullptr);
+    return *child;
+}
+
+static Message *NewMessage(Message::Type aType, Message::Priority aPriority)
+{
+    Message *message = sInstance->Get<MessagePool>().Allocate(aType, 0, Message::Settings(aPriority));
+
+    VerifyOrQuit(message != nullptr);
+    return message;
+}
+
+// Removes the head of the child's queue and verifies it matches `aMessage`.
+static void VerifyAndRemoveHead(IndirectQueueTable &aTable, const Child &aChild, Message *aMessage)
+{
+    VerifyOrQuit(aTable.GetHead(aChild) == aMessage);
+    aTable.Remove(*aMessage, aChild);
+}
+
+void TestIndirectQueueTable(void)
+{
+    IndirectQueueTable table(*sInstance);
+    Child             &child0 = GetChild(0);
+    Child             &child1 = GetChild(1);
+    Message           *low1   = NewMessage(Message::kTypeIp6, Message::kPriorityLow);
+    Message           *low2   = NewMessage(Message::kTypeIp6, Message::kPriorityLow);
+    Message           *normal = NewMessage(Message::kTypeIp6, Message::kPriorityNormal);
+    Message           *net    = NewMessage(Message::kTypeIp6, Message::kPriorityNet);
+    Message           *supervision;
+
+    printf("TestIndirectQueueTable()");
+
+    VerifyOrQuit(table.GetNumFreeEntries() == kNumEntries);
+    VerifyOrQuit(table.GetHead(child0) == nullptr);
+    VerifyOrQuit(!table.IsOverflowed(child0));
+
+    // Messages are kept in send queue order: higher priority first
+    // and then in the order they were added.
+
+    SuccessOrQuit(table.Add(*low1, child0));
+    SuccessOrQuit(table.Add(*normal, child0));
+    SuccessOrQuit(table.Add(*low2, child0));
+    SuccessOrQuit(table.Add(*net, child0));
+    SuccessOrQuit(table.Add(*low2, child1));
+    SuccessOrQuit(table.Add(*low1, child1));
+
+    VerifyOrQuit(table.GetNumFreeEntries() == kNumEntries - 6);
+    VerifyOrQuit(table.FindMessage(child0, Message::kTypeSupervision) == nullptr);
+
+    VerifyAndRemoveHead(table, child0, net);
+    VerifyAndRemoveHead(table, child0, normal);
+    VerifyAndRemoveHead(table, child0, low1);
+    VerifyAndRemoveHead(table, child0, low2);
+    VerifyOrQuit(table.GetHead(child0) == nullptr);
+
+    VerifyAndRemoveHead(table, child1, low2);
+    VerifyAndRemoveHead(table, child1, low1);
+    VerifyOrQuit(table.GetHead(child1) == nullptr);
+
+    VerifyOrQuit(table.GetNumFreeEntries() == kNumEntries);
+
+    // Removing a message which is not in the queue is a no-op.
+    table.Remove(*low1, child0);
+    VerifyOrQuit(table.GetNumFreeEntries() == kNumEntries);
+
+    // Find a message by type and the oldest message.
+
+    supervision = NewMessage(Message::kTypeSupervision, Message::kPriorityNormal);
+
+    low1->SetTimestamp(TimeMilli(3000));
+    low2->SetTimestamp(TimeMilli(1000));
+    supervision->SetTimestamp(TimeMilli(2000));
+
+    SuccessOrQuit(table.Add(*low1, child0));
+    SuccessOrQuit(table.Add(*supervision, child0));
+    SuccessOrQuit(table.Add(*low2, child0));
+
+    VerifyOrQuit(table.GetHead(child0) == supervision);
+    VerifyOrQuit(table.FindMessage(child0, Message::kTypeSupervision) == supervision);
+    VerifyOrQuit(table.FindMessage(child0, Message::kTypeIp6) == low1);
+    VerifyOrQuit(table.FindOldestMessage(child0) == low2);
+    VerifyOrQuit(table.FindOldestMessage(child1) == nullptr);
+
+    table.RemoveAll(child0);
+    VerifyOrQuit(table.GetHead(child0) == nullptr);
+    VerifyOrQuit(table.GetNumFreeEntries() == kNumEntries);
+
+    // Exhaust all entries by adding the same (multicast) message to
+    // all children, repeatedly, until an `Add()` fails.
+
+    {
+        Message *multicast[(kNumEntries / kMaxChildren) + 1];
+        uint16_t numAdded     = 0;
+        uint16_t overflowed   = kMaxChildren;
+        uint8_t  numMulticast = 0;
+
+        while (overflowed == kMaxChildren)
+        {
+            VerifyOrQuit(numMulticast < GetArrayLength(multicast));
+            multicast[numMulticast] = NewMessage(Message::kTypeIp6, Message::kPriorityNormal);
+
+            for (uint16_t index = 0; index < kMaxChildren; index++)
+            {
+                Error error = table.Add(*multicast[numMulticast], GetChild(index));
+
+                if (error == kErrorNoBufs)
+                {
+                    overflowed = index;
+                    break;
+                }
+
+                SuccessOrQuit(error);
+                numAdded++;
+            }
+
+            numMulticast++;
+        }
+
+        VerifyOrQuit(numAdded == kNumEntries);
+        VerifyOrQuit(table.IsOverflowed(GetChild(overflowed)));
+        VerifyOrQuit(table.GetHead(GetChild(overflowed)) == nullptr);
+
+        // The entries of the overflowed child are released.
+        VerifyOrQuit(table.GetNumFreeEntries() == numMulticast - 1);
+
+        // Further adds for the overflowed child are rejected until
+        // its queue is cleared.
+        VerifyOrQuit(table.Add(*low1, GetChild(overflowed)) == kErrorAlready);
+
+        table.RemoveAll(GetChild(overflowed));
+        VerifyOrQuit(!table.IsOverflowed(GetChild(overflowed)));
+        SuccessOrQuit(table.Add(*low1, GetChild(overflowed)));
+        VerifyOrQuit(table.GetHead(GetChild(overflowed)) == low1);
+
+        table.Clear();
+        VerifyOrQuit(table.GetNumFreeEntries() == kNumEntries);
+
+        for (uint16_t index = 0; index < kMaxChildren; index++)
+        {
+            VerifyOrQuit(table.GetHead(GetChild(index)) == nullptr);
+            VerifyOrQuit(!table.IsOverflowed(GetChild(index)));
+        }
+
+        for (uint8_t i = 0; i < numMulticast; i++)
+        {
+            multicast[i]->Free();
+        }
+    }
+
+    low1->Free();
+    low2->Free();
+    normal->Free();
+    net->Free();
+    supervision->Free();
+
+    printf(" -- PASS\n");
+}
+
+void BenchmarkIndirectQueueTable(void)
+{
+    // Simulates all children (`OPENTHREAD_CONFIG_MLE_MAX_CHILDREN`) as
+    // sleepy children polling against a loaded send queue. Each poll
+    // looks up the next indirect message for the child, either by
+    // scanning the send queue (checking the message child mask) or
+    // from `IndirectQueueTable`. Both are verified to give the same
+    // result.
+
+    static constexpr uint16_t kNumMessages = 32;
+    static constexpr uint16_t kNumRounds   = 200;
+
+    using Clock = std::chrono::steady_clock;
+
+    IndirectQueueTable table(*sInstance);
+    PriorityQueue      sendQueue;
+    Message           *messages[kNumMessages];
+    Message           *multicast;
+    uint32_t           numFound = 0;
+    Clock::duration    scanDuration;
+    Clock::duration    tableDuration;
+    Clock::time_point  start;
+
+    printf("BenchmarkIndirectQueueTable()");
+
+    // Unicast messages with mixed priorities for a subset of children,
+    // and a multicast message for all children at the tail of the queue.
+
+    for (uint16_t i = 0; i < kNumMessages; i++)
+    {
+        Child &child = GetChild((i * 7) % kMaxChildren);
+
+        messages[i] = NewMessage(Message::kTypeIp6, static_cast<Message::Priority>(i % Message::kNumPriorities));
+        sendQueue.Enqueue(*messages[i]);
+        messages[i]->SetChildMask(sInstance->Get<ChildTable>().GetChildIndex(child));
+        SuccessOrQuit(table.Add(*messages[i], child));
+    }
+
+    multicast = NewMessage(Message::kTypeIp6, Message::kPriorityLow);
+    sendQueue.Enqueue(*multicast);
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        multicast->SetChildMask(index);
+        SuccessOrQuit(table.Add(*multicast, GetChild(index)));
+    }
+
+    start = Clock::now();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t index = 0; index < kMaxChildren; index++)
+        {
+            Message *found = nullptr;
+
+            for (Message &message : sendQueue)
+            {
+                if (message.GetChildMask(index))
+                {
+                    found = &message;
+                    break;
+                }
+            }
+
+            numFound += (found != nullptr) ? 1 : 0;
+        }
+    }
+
+    scanDuration = Clock::now() - start;
+    start        = Clock::now();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t index = 0; index < kMaxChildren; index++)
+        {
+            numFound -= (table.GetHead(GetChild(index)) != nullptr) ? 1 : 0;
+        }
+    }
+
+    tableDuration = Clock::now() - start;
+
+    VerifyOrQuit(numFound == 0);
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        Message *found = nullptr;
+
+        for (Message &message : sendQueue)
+        {
+            if (message.GetChildMask(index))
+            {
+                found = &message;
+                break;
+            }
+        }
+
+        VerifyOrQuit(table.GetHead(GetChild(index)) == found);
+    }
+
+    printf("\n  %u children, %u queued messages, %u polls per child", kMaxChildren, kNumMessages + 1, kNumRounds);
+    printf("\n  send queue scan: %lld usec",
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(scanDuration).count()));
+    printf("\n  indirect queue table: %lld usec",
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(tableDuration).count()));
+
+    table.Clear();
+    sendQueue.DequeueAndFreeAll();
+
+    printf("\n -- PASS\n");
+}
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::sInstance = testInitInstance();
+    VerifyOrQuit(ot::sInstance != nullptr);
+
+    ot::TestIndirectQueueTable();
+    ot::BenchmarkIndirectQueueTable();
+
+    testFreeInstance(ot::sInstance);
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
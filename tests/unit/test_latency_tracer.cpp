@@ -0,0 +1,272 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "utils/latency_tracer.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+
+static Instance *sInstance;
+static uint32_t  sNow; // Current time in microseconds.
+
+extern "C" {
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow / 1000; }
+uint32_t otPlatAlarmMicroGetNow(void) { return sNow; }
+
+} // extern "C"
+
+static void AdvanceTime(uint32_t aDuration)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    sNow += aDuration;
+#else
+    // Round to the millisecond resolution of the clock used by the tracer.
+    sNow += (aDuration / 1000) * 1000;
+#endif
+}
+
+static uint32_t ExpectedLatency(uint32_t aDuration)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    return aDuration;
+#else
+    return (aDuration / 1000) * 1000;
+#endif
+}
+
+static Message *NewMessage(void)
+{
+    Message *message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+    VerifyOrQuit(message != nullptr);
+    return message;
+}
+
+void TestStageStats(void)
+{
+    Utils::LatencyTracer::StageStats stats;
+
+    printf("TestStageStats");
+
+    stats.Clear();
+
+    stats.Record(0);
+    stats.Record(127);
+    VerifyOrQuit(stats.mHistogram[0] == 2);
+
+    stats.Record(128);
+    stats.Record(255);
+    VerifyOrQuit(stats.mHistogram[1] == 2);
+
+    stats.Record(256);
+    VerifyOrQuit(stats.mHistogram[2] == 1);
+
+    stats.Record(5000);
+    VerifyOrQuit(stats.mHistogram[6] == 1);
+
+    stats.Record(0xffffffff);
+    VerifyOrQuit(stats.mHistogram[OT_TRACE_HISTOGRAM_NUM_BINS - 1] == 1);
+
+    VerifyOrQuit(stats.mCount == 7);
+    VerifyOrQuit(stats.mMaxLatency == 0xffffffff);
+    VerifyOrQuit(stats.mTotalLatency == 0xffffffffull + 0 + 127 + 128 + 255 + 256 + 5000);
+
+    printf(" -- PASS\n");
+}
+
+void TestSampling(void)
+{
+    Utils::LatencyTracer &tracer = sInstance->Get<Utils::LatencyTracer>();
+    Message              *messages[8];
+    uint8_t               numTraced = 0;
+
+    printf("TestSampling");
+
+    VerifyOrQuit(tracer.GetSampleInterval() == OPENTHREAD_CONFIG_LATENCY_TRACER_DEFAULT_SAMPLE_INTERVAL);
+
+    tracer.SetSampleInterval(4);
+    tracer.ResetStats();
+
+    for (Message *&message : messages)
+    {
+        message = NewMessage();
+        tracer.Start(*message);
+
+        if (message->IsTraced())
+        {
+            numTraced++;
+        }
+    }
+
+    VerifyOrQuit(numTraced == 2);
+    VerifyOrQuit(tracer.GetNumTracedMessages() == 2);
+    VerifyOrQuit(messages[3]->IsTraced());
+    VerifyOrQuit(messages[7]->IsTraced());
+
+    // A traced message is not restarted (and not counted twice).
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        tracer.Start(*messages[3]);
+    }
+
+    VerifyOrQuit(tracer.GetNumTracedMessages() == 2);
+
+    // Untraced messages do not record any stage.
+    tracer.Mark(*messages[0], Utils::LatencyTracer::kStageDelivered);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageDelivered).mCount == 0);
+
+    tracer.SetSampleInterval(0);
+    tracer.Start(*messages[0]);
+    tracer.HandleEnqueue(*messages[0]);
+    VerifyOrQuit(!messages[0]->IsTraced());
+
+    for (Message *message : messages)
+    {
+        message->Free();
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestForwardingPath(void)
+{
+    Utils::LatencyTracer &tracer = sInstance->Get<Utils::LatencyTracer>();
+    Message              *message;
+
+    printf("TestForwardingPath");
+
+    tracer.SetSampleInterval(1);
+    tracer.ResetStats();
+
+    message = NewMessage();
+    tracer.HandleEnqueue(*message);
+    VerifyOrQuit(message->IsTraced());
+    VerifyOrQuit(tracer.GetNumTracedMessages() == 1);
+
+    AdvanceTime(300);
+    tracer.Mark(*message, Utils::LatencyTracer::kStageRouteResolved);
+
+    AdvanceTime(2000);
+    tracer.HandleFramePrepared(*message);
+
+    AdvanceTime(1000);
+    tracer.HandleRadioTxStart();
+
+    // Retries of the same frame are not recorded again.
+    AdvanceTime(4000);
+    tracer.HandleRadioTxStart();
+
+    AdvanceTime(1000);
+    tracer.HandleFrameSent(message);
+
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageEnqueue).mCount == 0);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageRouteResolved).mCount == 1);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageRouteResolved).mMaxLatency == ExpectedLatency(300));
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageFramePrepared).mMaxLatency ==
+                 ExpectedLatency(2000));
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageRadioStart).mCount == 1);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageRadioStart).mMaxLatency == ExpectedLatency(1000));
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageTxDone).mCount == 1);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageTxDone).mMaxLatency == ExpectedLatency(5000));
+
+    // A frame of an untraced message must not be attributed to the
+    // traced one.
+    {
+        Message *other = NewMessage();
+
+        tracer.SetSampleInterval(0);
+        tracer.HandleFramePrepared(*other);
+        tracer.HandleRadioTxStart();
+        tracer.HandleFrameSent(other);
+        other->Free();
+    }
+
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageRadioStart).mCount == 1);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageTxDone).mCount == 1);
+
+    // The message being removed while its frame is sent.
+    tracer.HandleFramePrepared(*message);
+    tracer.HandleRadioTxStart();
+    tracer.HandleFrameSent(nullptr);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageRadioStart).mCount == 2);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageTxDone).mCount == 1);
+
+    // A frame sent without reaching the radio counts from its preparation.
+    tracer.HandleFramePrepared(*message);
+    AdvanceTime(3000);
+    tracer.HandleFrameSent(message);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageTxDone).mCount == 2);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageTxDone).mTotalLatency ==
+                 ExpectedLatency(5000) + ExpectedLatency(3000));
+
+    AdvanceTime(1000);
+    tracer.Mark(*message, Utils::LatencyTracer::kStageDelivered);
+    VerifyOrQuit(tracer.GetStageStats(Utils::LatencyTracer::kStageDelivered).mCount == 1);
+
+    tracer.ResetStats();
+    VerifyOrQuit(tracer.GetNumTracedMessages() == 0);
+
+    for (uint8_t stage = 0; stage < Utils::LatencyTracer::kNumStages; stage++)
+    {
+        VerifyOrQuit(tracer.GetStageStats(static_cast<Utils::LatencyTracer::Stage>(stage)).mCount == 0);
+    }
+
+    message->Free();
+
+    printf(" -- PASS\n");
+}
+
+#endif // OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_LATENCY_TRACER_ENABLE
+    ot::sInstance = testInitInstance();
+    VerifyOrQuit(ot::sInstance != nullptr);
+
+    ot::TestStageStats();
+    ot::TestSampling();
+    ot::TestForwardingPath();
+
+    testFreeInstance(ot::sInstance);
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -28,6 +28,8 @@
 
 #include "test_lowpan.hpp"
 
+#include <chrono>
+
 #include "test_platform.h"
 #include "test_util.hpp"
 
@@ -1762,6 +1764,198 @@ static void TestErrorReservedNhc6(void)
  * @section Main test.
  **************************************************************************************************/
 
+static void TestContextUpdate(void)
+{
+    // Replaces the Network Data so that context 1 maps to a different
+    // prefix and checks that compression and decompression follow it.
+
+    uint8_t mockNetworkData[] = {
+        0x0c, // MLE Network Data Type
+        0x10, // MLE Network Data Length
+
+        // Prefix 2001:2:0:3::/64
+        0x03, 0x0e,                                                             // Prefix TLV
+        0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x07, 0x02, // 6LoWPAN Context ID TLV
+        0x11, 0x40,                                                             // Context ID = 1, C = TRUE
+    };
+
+    Message *message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+    printf("TestContextUpdate()\n");
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->AppendBytes(mockNetworkData, sizeof(mockNetworkData)));
+    SuccessOrQuit(
+        sInstance->Get<NetworkData::Leader>().SetNetworkData(1, 1, NetworkData::kStableSubset, *message, 2, 0x10));
+    message->Free();
+
+    {
+        TestIphcVector testVector("Stateful compression follows the updated context 1");
+
+        testVector.SetMacSource(sTestMacSourceDefaultLong);
+        testVector.SetMacDestination(sTestMacDestinationDefaultLong);
+        testVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault), Ip6::kProtoIcmp6, 64, "2001:2:0:3::1",
+                               "2001:2:0:3::2");
+
+        uint8_t iphc[] = {0x7a, 0xd5, 0x11, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02};
+        testVector.SetIphcHeader(iphc, sizeof(iphc));
+
+        testVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+        testVector.SetPayloadOffset(40);
+        testVector.SetError(kErrorNone);
+
+        Test(testVector, true, true);
+    }
+
+    {
+        TestIphcVector testVector("Prefix of a replaced context is no longer compressed");
+
+        testVector.SetMacSource(sTestMacSourceDefaultLong);
+        testVector.SetMacDestination(sTestMacDestinationDefaultLong);
+        testVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault), Ip6::kProtoIcmp6, 64, "2001:2:0:1::1",
+                               "2001:2:0:1::2");
+
+        uint8_t iphc[] = {0x7a, 0x00, 0x3a, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+                          0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02};
+        testVector.SetIphcHeader(iphc, sizeof(iphc));
+
+        testVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+        testVector.SetPayloadOffset(40);
+        testVector.SetError(kErrorNone);
+
+        Test(testVector, true, true);
+    }
+
+    // Restore the Network Data used by the other tests.
+    Init();
+}
+
+template <typename Duration> static long long NanosecondsPerFrame(Duration aDuration, uint16_t aNumFrames)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(aDuration).count() / aNumFrames;
+}
+
+static void BenchmarkLowpanIphc(void)
+{
+    // Measures compression and decompression of the most common
+    // header shapes. Each shape is run with the compiled context table
+    // and again with the table invalidated before every frame, which
+    // costs about the same as the earlier per-frame Network Data walk.
+
+    static constexpr uint16_t kNumFrames = 20000;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Shape
+    {
+        const char *mName;
+        uint8_t     mNextHeader;
+        uint8_t     mHopLimit;
+        const char *mSource;
+        const char *mDestination;
+    };
+
+    static const Shape kShapes[] = {
+        {"link-local UDP", Ip6::kProtoUdp, 255, "fe80::200:5eef:1022:1100", "fe80::200:5eef:10aa:bbcc"},
+        {"mesh-local UDP", Ip6::kProtoUdp, 64, "fd00:cafe:face:1234::ff:fe00:0", "fd00:cafe:face:1234::ff:fe00:c003"},
+        {"ML-EID TCP", Ip6::kProtoTcp, 64, "fd00:cafe:face:1234:1:2:3:4", "fd00:cafe:face:1234:5:6:7:8"},
+        {"context 1 UDP", Ip6::kProtoUdp, 64, "2001:2:0:1::1", "2001:2:0:1::2"},
+    };
+
+    printf("BenchmarkLowpanIphc()");
+
+    for (const Shape &shape : kShapes)
+    {
+        TestIphcVector testVector(shape.mName);
+        Message       *message;
+        Message       *decompressed;
+        uint8_t        frame[127];
+        uint16_t       frameLength = 0;
+        uint8_t        ip6[512];
+        uint16_t       ip6Length;
+        uint16_t       payloadLength = sizeof(sTestPayloadDefault);
+
+        if (shape.mNextHeader == Ip6::kProtoUdp)
+        {
+            payloadLength += sizeof(Ip6::Udp::Header);
+            testVector.SetUDPHeader(19788, 61631, payloadLength, 0xbeef);
+        }
+
+        testVector.SetMacSource(sTestMacSourceDefaultLong);
+        testVector.SetMacDestination(sTestMacDestinationDefaultLong);
+        testVector.SetIpHeader(0x60000000, payloadLength, shape.mNextHeader, shape.mHopLimit, shape.mSource,
+                               shape.mDestination);
+
+        testVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+        testVector.GetUncompressedStream(ip6, ip6Length);
+
+        VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+        VerifyOrQuit((decompressed = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+        testVector.GetUncompressedStream(*message);
+
+        printf("\n  %-16s", shape.mName);
+
+        for (uint8_t pass = 0; pass < 2; pass++)
+        {
+            bool              invalidate = (pass == 1);
+            Clock::duration   compressDuration;
+            Clock::duration   decompressDuration;
+            Clock::time_point start;
+
+            start = Clock::now();
+
+            for (uint16_t num = 0; num < kNumFrames; num++)
+            {
+                FrameBuilder frameBuilder;
+
+                if (invalidate)
+                {
+                    sLowpan->InvalidateContexts();
+                }
+
+                frameBuilder.Init(frame, sizeof(frame));
+                message->SetOffset(0);
+                SuccessOrQuit(sLowpan->Compress(*message, testVector.mMacAddrs, frameBuilder));
+                frameLength = frameBuilder.GetLength();
+            }
+
+            compressDuration = Clock::now() - start;
+            start            = Clock::now();
+
+            for (uint16_t num = 0; num < kNumFrames; num++)
+            {
+                FrameData frameData;
+
+                if (invalidate)
+                {
+                    sLowpan->InvalidateContexts();
+                }
+
+                frameData.Init(frame, frameLength);
+                SuccessOrQuit(decompressed->SetLength(0));
+                decompressed->SetOffset(0);
+                SuccessOrQuit(sLowpan->Decompress(*decompressed, testVector.mMacAddrs, frameData, ip6Length));
+            }
+
+            decompressDuration = Clock::now() - start;
+
+            VerifyOrQuit(decompressed->GetLength() == message->GetOffset());
+            VerifyOrQuit(decompressed->CompareBytes(0, ip6, decompressed->GetLength()));
+
+            printf(" | %s: compress %4lld ns, decompress %4lld ns", invalidate ? "rebuilt" : "compiled",
+                   NanosecondsPerFrame(compressDuration, kNumFrames),
+                   NanosecondsPerFrame(decompressDuration, kNumFrames));
+        }
+
+        message->Free();
+        decompressed->Free();
+    }
+
+    printf("\n -- PASS\n");
+}
+
 void TestLowpanIphc(void)
 {
     sInstance = testInitInstance();
@@ -1851,6 +2045,10 @@ void TestLowpanIphc(void)
     TestErrorReservedNhc5();
     TestErrorReservedNhc6();
 
+    // Network Data changes and throughput.
+    TestContextUpdate();
+    BenchmarkLowpanIphc();
+
     testFreeInstance(sInstance);
 }
 
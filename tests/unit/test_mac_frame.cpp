@@ -26,8 +26,12 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+
+#include "common/array.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/num_utils.hpp"
 #include "mac/mac.hpp"
 #include "mac/mac_frame.hpp"
 #include "radio/radio.hpp"
@@ -721,6 +725,202 @@ void TestMacFrameAckGeneration(void)
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 }
 
+#if OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE > 0
+
+void TestMacHeaderTemplates(void)
+{
+    struct TestCase
+    {
+        Mac::Frame::Type          mType;
+        Mac::Frame::Version       mVersion;
+        bool                      mExtSource;
+        uint16_t                  mDestination; // Short address, or `kExtDest` for the extended address.
+        Mac::PanId                mDstPanId;
+        Mac::Frame::SecurityLevel mSecurity;
+        Mac::Frame::KeyIdMode     mKeyIdMode;
+    };
+
+    static constexpr uint16_t kExtDest = 0xfffe;
+
+    static const TestCase kTestCases[] = {
+        {Mac::Frame::kTypeData, Mac::Frame::kVersion2006, true, kExtDest, 0xface, Mac::Frame::kSecurityEncMic32,
+         Mac::Frame::kKeyIdMode1},
+        {Mac::Frame::kTypeData, Mac::Frame::kVersion2006, false, 0x1234, 0xface, Mac::Frame::kSecurityEncMic32,
+         Mac::Frame::kKeyIdMode1},
+        {Mac::Frame::kTypeData, Mac::Frame::kVersion2006, false, Mac::kShortAddrBroadcast, 0xface,
+         Mac::Frame::kSecurityNone, Mac::Frame::kKeyIdMode1},
+        {Mac::Frame::kTypeData, Mac::Frame::kVersion2015, true, kExtDest, 0xface, Mac::Frame::kSecurityEncMic32,
+         Mac::Frame::kKeyIdMode1},
+        {Mac::Frame::kTypeData, Mac::Frame::kVersion2006, true, Mac::kShortAddrBroadcast, Mac::kPanIdBroadcast,
+         Mac::Frame::kSecurityEncMic32, Mac::Frame::kKeyIdMode2},
+        {Mac::Frame::kTypeMacCmd, Mac::Frame::kVersion2006, false, 0x1234, 0xface, Mac::Frame::kSecurityEncMic32,
+         Mac::Frame::kKeyIdMode1},
+    };
+
+    const uint8_t kExtAddr1[] = {0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0};
+    const uint8_t kExtAddr2[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+
+    ot::Instance  *instance;
+    Mac::Mac      *mac;
+    otMacCounters *counters;
+
+    printf("TestMacHeaderTemplates");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    mac      = &instance->Get<Mac::Mac>();
+    counters = &mac->GetCounters();
+    mac->ResetCounters();
+
+    // Each header is prepared twice in a row: the second one must
+    // come from a template. There are more test cases than templates
+    // so going over them again replaces older templates. All headers
+    // must match a freshly built one.
+
+    for (uint8_t round = 0; round < 2; round++)
+    {
+        for (const TestCase &testCase : kTestCases)
+        {
+            uint8_t        expectedPsdu[OT_RADIO_FRAME_MAX_SIZE];
+            Mac::TxFrame   expectedFrame;
+            Mac::Addresses addresses;
+            Mac::PanIds    panIds;
+
+            memset(expectedPsdu, 0, sizeof(expectedPsdu));
+            expectedFrame.mPsdu      = expectedPsdu;
+            expectedFrame.mLength    = 0;
+            expectedFrame.mRadioType = 0;
+
+            if (testCase.mExtSource)
+            {
+                addresses.mSource.SetExtended(kExtAddr1);
+            }
+            else
+            {
+                addresses.mSource.SetShort(0x5678);
+            }
+
+            if (testCase.mDestination == kExtDest)
+            {
+                addresses.mDestination.SetExtended(kExtAddr2);
+            }
+            else
+            {
+                addresses.mDestination.SetShort(testCase.mDestination);
+            }
+
+            panIds.mSource      = 0xface;
+            panIds.mDestination = testCase.mDstPanId;
+
+            expectedFrame.InitMacHeader(testCase.mType, testCase.mVersion, addresses, panIds, testCase.mSecurity,
+                                        testCase.mKeyIdMode);
+
+            for (uint8_t attempt = 0; attempt < 2; attempt++)
+            {
+                uint8_t      psdu[OT_RADIO_FRAME_MAX_SIZE];
+                Mac::TxFrame frame;
+                uint32_t     hits = counters->mTxHeaderTemplateHit;
+
+                memset(psdu, 0, sizeof(psdu));
+                frame.mPsdu      = psdu;
+                frame.mLength    = 0;
+                frame.mRadioType = 0;
+
+                mac->InitTxFrameMacHeader(frame, testCase.mType, testCase.mVersion, addresses, panIds,
+                                          testCase.mSecurity, testCase.mKeyIdMode);
+
+                VerifyOrQuit(frame.GetLength() == expectedFrame.GetLength());
+                VerifyOrQuit(frame.GetHeaderLength() == expectedFrame.GetHeaderLength());
+                VerifyOrQuit(memcmp(psdu, expectedPsdu, frame.GetHeaderLength()) == 0);
+
+                if (attempt == 1)
+                {
+                    VerifyOrQuit(counters->mTxHeaderTemplateHit == hits + 1);
+                }
+            }
+        }
+    }
+
+    VerifyOrQuit(counters->mTxHeaderTemplateHit + counters->mTxHeaderTemplateMiss == 4 * GetArrayLength(kTestCases));
+    VerifyOrQuit(counters->mTxHeaderTemplateHit >= 2 * GetArrayLength(kTestCases));
+
+    printf(" - hits: %lu, misses: %lu -- PASS\n", ToUlong(counters->mTxHeaderTemplateHit),
+           ToUlong(counters->mTxHeaderTemplateMiss));
+
+    testFreeInstance(instance);
+}
+
+void BenchmarkMacHeaderTemplates(void)
+{
+    // Compares building a secured data frame header to an extended
+    // address field by field with copying it from a header template.
+
+    static constexpr uint32_t kNumFrames = 100000;
+
+    using Clock = std::chrono::steady_clock;
+
+    const uint8_t kExtAddr1[] = {0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0};
+    const uint8_t kExtAddr2[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+
+    ot::Instance     *instance;
+    Mac::Mac         *mac;
+    uint8_t           psdu[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::TxFrame      frame;
+    Mac::Addresses    addresses;
+    Mac::PanIds       panIds;
+    Clock::duration   buildDuration;
+    Clock::duration   templateDuration;
+    Clock::time_point start;
+
+    printf("BenchmarkMacHeaderTemplates");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+    mac = &instance->Get<Mac::Mac>();
+
+    frame.mPsdu      = psdu;
+    frame.mLength    = 0;
+    frame.mRadioType = 0;
+
+    addresses.mSource.SetExtended(kExtAddr1);
+    addresses.mDestination.SetExtended(kExtAddr2);
+    panIds.mSource      = 0xface;
+    panIds.mDestination = 0xface;
+
+    start = Clock::now();
+
+    for (uint32_t num = 0; num < kNumFrames; num++)
+    {
+        frame.InitMacHeader(Mac::Frame::kTypeData, Mac::Frame::kVersion2006, addresses, panIds,
+                            Mac::Frame::kSecurityEncMic32, Mac::Frame::kKeyIdMode1);
+    }
+
+    buildDuration = Clock::now() - start;
+    start         = Clock::now();
+
+    for (uint32_t num = 0; num < kNumFrames; num++)
+    {
+        mac->InitTxFrameMacHeader(frame, Mac::Frame::kTypeData, Mac::Frame::kVersion2006, addresses, panIds,
+                                  Mac::Frame::kSecurityEncMic32, Mac::Frame::kKeyIdMode1);
+    }
+
+    templateDuration = Clock::now() - start;
+
+    VerifyOrQuit(mac->GetCounters().mTxHeaderTemplateHit + 1 == kNumFrames);
+
+    printf("\n  %lu frames, built: %lld ns/frame, from template: %lld ns/frame", ToUlong(kNumFrames),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(buildDuration).count() /
+                                  kNumFrames),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(templateDuration).count() /
+                                  kNumFrames));
+    printf("\n -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE > 0
+
 } // namespace ot
 
 int main(void)
@@ -730,6 +930,10 @@ int main(void)
     ot::TestMacChannelMask();
     ot::TestMacFrameApi();
     ot::TestMacFrameAckGeneration();
+#if OPENTHREAD_CONFIG_MAC_TX_HEADER_TEMPLATE_CACHE_SIZE > 0
+    ot::TestMacHeaderTemplates();
+    ot::BenchmarkMacHeaderTemplates();
+#endif
     printf("All tests passed\n");
     return 0;
 }
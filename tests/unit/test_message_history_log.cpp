@@ -0,0 +1,431 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/array.hpp"
+#include "common/as_core_type.hpp"
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+#include "net/ip6_types.hpp"
+#include "radio/radio.hpp"
+#include "utils/message_history_log.hpp"
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+
+namespace ot {
+namespace Utils {
+
+typedef MessageHistoryLog::MessageInfo   MessageInfo;
+typedef MessageHistoryLog::MessageFilter MessageFilter;
+
+static constexpr uint32_t kMaxAge = MessageHistoryLog::kMaxAge;
+
+static uint32_t sNow;
+
+extern "C" uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+struct SpilledEntry
+{
+    MessageInfo mInfo;
+    uint32_t    mAge;
+};
+
+static SpilledEntry sSpilled[256];
+static uint16_t     sNumSpilled;
+
+static void HandleSpill(const otHistoryTrackerMessageInfo *aEntry, bool aIsTx, uint32_t aEntryAge, void *aContext)
+{
+    VerifyOrQuit(aIsTx);
+    VerifyOrQuit(aContext == &sNumSpilled);
+    VerifyOrQuit(sNumSpilled < GetArrayLength(sSpilled));
+
+    sSpilled[sNumSpilled].mInfo = *aEntry;
+    sSpilled[sNumSpilled].mAge  = aEntryAge;
+    sNumSpilled++;
+}
+
+static MessageInfo MakeEntry(uint16_t aIndex, uint16_t aNumAddresses)
+{
+    // Builds a deterministic entry from `aIndex`. Addresses are picked
+    // among `aNumAddresses` and neighbors among four RLOC16s. Fields
+    // not applicable to the IP protocol are left as zero, as done by
+    // `HistoryTracker` (and as read back from the log).
+
+    MessageInfo info;
+
+    memset(&info, 0, sizeof(info));
+
+    SuccessOrQuit(AsCoreType(&info.mSource.mAddress).FromString("fd00:1234::1"));
+    SuccessOrQuit(AsCoreType(&info.mDestination.mAddress).FromString("fd00:1234::2"));
+    info.mSource.mAddress.mFields.m16[7]      = Encoding::BigEndian::HostSwap16(aIndex % aNumAddresses);
+    info.mDestination.mAddress.mFields.m16[6] = Encoding::BigEndian::HostSwap16((aIndex + 1) % aNumAddresses);
+
+    info.mPayloadLength   = static_cast<uint16_t>(40 + aIndex * 13);
+    info.mNeighborRloc16  = static_cast<uint16_t>(0x1000 + 0x400 * (aIndex % 4));
+    info.mLinkSecurity    = (aIndex % 3) != 0;
+    info.mTxSuccess       = (aIndex % 5) != 0;
+    info.mPriority        = aIndex % 4;
+    info.mRadioIeee802154 = true;
+    info.mAveRxRss        = (aIndex % 2) ? static_cast<int8_t>(-40 - (aIndex % 50)) : Radio::kInvalidRssi;
+
+    switch (aIndex % 4)
+    {
+    case 0:
+        info.mIpProto           = Ip6::kProtoUdp;
+        info.mSource.mPort      = static_cast<uint16_t>(49152 + aIndex);
+        info.mDestination.mPort = 5683;
+        info.mChecksum          = static_cast<uint16_t>(0xbeef ^ aIndex);
+        break;
+    case 1:
+        info.mIpProto           = Ip6::kProtoTcp;
+        info.mSource.mPort      = 443;
+        info.mDestination.mPort = static_cast<uint16_t>(50000 + aIndex);
+        info.mChecksum          = static_cast<uint16_t>(0x1234 + aIndex);
+        break;
+    case 2:
+        info.mIpProto   = Ip6::kProtoIcmp6;
+        info.mIcmp6Type = 128;
+        info.mChecksum  = static_cast<uint16_t>(0xfeed - aIndex);
+        break;
+    default:
+        info.mIpProto = 59; // No next header
+        break;
+    }
+
+    return info;
+}
+
+static bool IsEqual(const MessageInfo &aFirst, const MessageInfo &aSecond)
+{
+    return memcmp(&aFirst, &aSecond, sizeof(MessageInfo)) == 0;
+}
+
+static void InitIterator(otHistoryTrackerIterator &aIterator)
+{
+    memset(&aIterator, 0, sizeof(aIterator));
+    aIterator.mData32       = sNow;
+    aIterator.mCursorOffset = MessageHistoryLog::kCursorNotStarted;
+}
+
+void TestRoundTrip(void)
+{
+    static constexpr uint16_t kNumEntries = 40;
+    static constexpr uint32_t kInterval   = 1500;
+
+    uint8_t                  buffer[4096];
+    MessageHistoryLog        log(buffer, sizeof(buffer), /* aIsTx */ false);
+    otHistoryTrackerIterator iterator;
+    const MessageInfo       *info;
+    uint32_t                 age;
+    uint16_t                 index;
+
+    printf("\nTestRoundTrip");
+
+    InitIterator(iterator);
+    VerifyOrQuit(log.Read(iterator, nullptr, age) == nullptr);
+
+    sNow = 1000;
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        log.Add(MakeEntry(i, 8));
+        sNow += kInterval + i;
+    }
+
+    VerifyOrQuit(log.GetSize() == kNumEntries);
+
+    // Read all entries from newest to oldest and check the content
+    // and the age of each entry.
+
+    InitIterator(iterator);
+    index = kNumEntries;
+
+    while ((info = log.Read(iterator, nullptr, age)) != nullptr)
+    {
+        uint32_t expectedAge = 0;
+
+        VerifyOrQuit(index > 0);
+        index--;
+
+        for (uint16_t i = index; i < kNumEntries; i++)
+        {
+            expectedAge += kInterval + i;
+        }
+
+        VerifyOrQuit(IsEqual(*info, MakeEntry(index, 8)));
+        VerifyOrQuit(age == expectedAge);
+    }
+
+    VerifyOrQuit(index == 0);
+
+    // The iterator stays at its end.
+    VerifyOrQuit(log.Read(iterator, nullptr, age) == nullptr);
+
+    printf(" -- PASS\n");
+}
+
+void TestDictionaryOverflow(void)
+{
+    // Use more distinct addresses and neighbors than the dictionary
+    // can hold, so some are stored in full within the records.
+
+    static constexpr uint16_t kNumEntries = 200;
+
+    uint8_t                  buffer[16384];
+    MessageHistoryLog        log(buffer, sizeof(buffer), /* aIsTx */ false);
+    otHistoryTrackerIterator iterator;
+    const MessageInfo       *info;
+    uint32_t                 age;
+    uint16_t                 index;
+
+    printf("TestDictionaryOverflow");
+
+    sNow = 5000;
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        MessageInfo entry = MakeEntry(i, 100);
+
+        entry.mNeighborRloc16 = 0x2000 + i;
+        log.Add(entry);
+        sNow += 10;
+    }
+
+    VerifyOrQuit(log.GetSize() == kNumEntries);
+
+    InitIterator(iterator);
+    index = kNumEntries;
+
+    while ((info = log.Read(iterator, nullptr, age)) != nullptr)
+    {
+        MessageInfo entry;
+
+        index--;
+        entry                 = MakeEntry(index, 100);
+        entry.mNeighborRloc16 = 0x2000 + index;
+        VerifyOrQuit(IsEqual(*info, entry));
+    }
+
+    VerifyOrQuit(index == 0);
+
+    printf(" -- PASS\n");
+}
+
+void TestSpill(void)
+{
+    static constexpr uint16_t kNumEntries = 300;
+    static constexpr uint32_t kInterval   = 100;
+
+    uint8_t                  buffer[1024];
+    MessageHistoryLog        log(buffer, sizeof(buffer), /* aIsTx */ true);
+    otHistoryTrackerIterator iterator;
+    const MessageInfo       *info;
+    uint32_t                 age;
+    uint16_t                 index;
+    uint16_t                 size;
+
+    printf("TestSpill");
+
+    sNumSpilled = 0;
+    sNow        = 20000;
+    log.SetSpillCallback(HandleSpill, &sNumSpilled);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        log.Add(MakeEntry(i, 8));
+        VerifyOrQuit(log.GetUsedBytes() <= sizeof(buffer));
+
+        // Every entry is either in the log or was spilled, in order.
+        VerifyOrQuit(log.GetSize() + sNumSpilled == i + 1);
+
+        sNow += kInterval;
+    }
+
+    size = log.GetSize();
+    VerifyOrQuit(sNumSpilled > 0);
+
+    printf("\n  %u entries kept in %u bytes (%u bytes per entry, %u bytes per fixed list entry)", size,
+           log.GetUsedBytes(), log.GetUsedBytes() / size,
+           static_cast<unsigned>(sizeof(MessageInfo) + sizeof(uint32_t)));
+
+    for (uint16_t i = 0; i < sNumSpilled; i++)
+    {
+        VerifyOrQuit(IsEqual(sSpilled[i].mInfo, MakeEntry(i, 8)));
+
+        // Entry `i` was spilled when an entry `j > i` was added at
+        // `20000 + j * kInterval`, so its age is a multiple of the
+        // interval.
+        VerifyOrQuit(sSpilled[i].mAge > 0);
+        VerifyOrQuit(sSpilled[i].mAge % kInterval == 0);
+    }
+
+    InitIterator(iterator);
+    index = kNumEntries;
+
+    while ((info = log.Read(iterator, nullptr, age)) != nullptr)
+    {
+        index--;
+        VerifyOrQuit(IsEqual(*info, MakeEntry(index, 8)));
+        VerifyOrQuit(age == (kNumEntries - index) * kInterval);
+    }
+
+    VerifyOrQuit(index == sNumSpilled);
+
+    // Entries dropped while iterating end the iteration.
+
+    InitIterator(iterator);
+    VerifyOrQuit(log.Read(iterator, nullptr, age) != nullptr);
+    VerifyOrQuit(log.Read(iterator, nullptr, age) != nullptr);
+
+    log.SetSpillCallback(nullptr, nullptr);
+
+    for (uint16_t i = 0; i < 2 * size; i++)
+    {
+        log.Add(MakeEntry(i, 8));
+    }
+
+    VerifyOrQuit(log.Read(iterator, nullptr, age) == nullptr);
+
+    printf(" -- PASS\n");
+}
+
+void TestFilter(void)
+{
+    static constexpr uint16_t kNumEntries = 100;
+    static constexpr uint32_t kInterval   = 1000;
+
+    uint8_t                  buffer[8192];
+    MessageHistoryLog        log(buffer, sizeof(buffer), /* aIsTx */ false);
+    otHistoryTrackerIterator iterator;
+    MessageFilter            filter;
+    const MessageInfo       *info;
+    uint32_t                 age;
+    uint16_t                 count;
+
+    printf("TestFilter");
+
+    sNow = 100000;
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        log.Add(MakeEntry(i, 8));
+        sNow += kInterval;
+    }
+
+    // Newest entry has age `kInterval`, oldest `kNumEntries * kInterval`.
+
+    memset(&filter, 0, sizeof(filter));
+    filter.mMaxAge = 10 * kInterval;
+
+    InitIterator(iterator);
+    count = 0;
+
+    while ((info = log.Read(iterator, &filter, age)) != nullptr)
+    {
+        VerifyOrQuit(age <= filter.mMaxAge);
+        VerifyOrQuit(IsEqual(*info, MakeEntry(kNumEntries - 1 - count, 8)));
+        count++;
+    }
+
+    VerifyOrQuit(count == 10);
+
+    // Match a neighbor within the last 40 entries.
+
+    filter.mMaxAge         = 40 * kInterval;
+    filter.mMatchNeighbor  = true;
+    filter.mNeighborRloc16 = 0x1400;
+
+    InitIterator(iterator);
+    count = 0;
+
+    while ((info = log.Read(iterator, &filter, age)) != nullptr)
+    {
+        VerifyOrQuit(info->mNeighborRloc16 == 0x1400);
+        VerifyOrQuit(age <= filter.mMaxAge);
+        count++;
+    }
+
+    VerifyOrQuit(count == 10);
+
+    // Neighbor not in the log.
+
+    filter.mNeighborRloc16 = 0x5800;
+
+    InitIterator(iterator);
+    VerifyOrQuit(log.Read(iterator, &filter, age) == nullptr);
+
+    // Entries older than max age.
+
+    sNow += kMaxAge;
+    log.UpdateAgedEntries();
+    sNow += kMaxAge / 2;
+
+    filter.mMaxAge        = kMaxAge - 1;
+    filter.mMatchNeighbor = false;
+
+    InitIterator(iterator);
+    VerifyOrQuit(log.Read(iterator, &filter, age) == nullptr);
+
+    InitIterator(iterator);
+    count = 0;
+
+    while ((info = log.Read(iterator, nullptr, age)) != nullptr)
+    {
+        VerifyOrQuit(age == kMaxAge);
+        count++;
+    }
+
+    VerifyOrQuit(count == kNumEntries);
+
+    printf(" -- PASS\n");
+}
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_COMPACT_MESSAGE_LISTS_ENABLE
+    ot::Utils::TestRoundTrip();
+    ot::Utils::TestDictionaryOverflow();
+    ot::Utils::TestSpill();
+    ot::Utils::TestFilter();
+    printf("\nAll tests passed\n");
+#else
+    printf("HISTORY_TRACKER_COMPACT_MESSAGE_LISTS feature is not enabled\n");
+#endif
+
+    return 0;
+}
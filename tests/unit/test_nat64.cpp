@@ -33,10 +33,13 @@
 
 #include "string.h"
 
+#include <chrono>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
+#include "net/checksum.hpp"
 #include "net/ip6.hpp"
 
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
@@ -141,6 +144,8 @@ void TestCase4To6(const char *aTestName,
     printf("  ... PASS\n");
 }
 
+#if !OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
 void TestNat64(void)
 {
     Ip6::Prefix  nat64prefix;
@@ -297,6 +302,378 @@ void TestNat64(void)
     testFreeInstance(sInstance);
 }
 
+#else // !OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
+static uint32_t sNow = 0;
+
+extern "C" uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+static constexpr uint8_t kIcmp6EchoRequest = 128;
+static constexpr uint8_t kIcmp4EchoReply   = 0;
+
+static const uint8_t kPayload[] = {0x61, 0x62, 0x63, 0x64};
+
+static Ip6::Prefix  sNat64Prefix;
+static Ip4::Address sNatAddress;
+static Ip4::Address sRemoteAddress;
+
+void InitPortTranslation(void)
+{
+    const uint8_t kNat64Prefix[] = {0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    const uint8_t kNatAddress[]  = {192, 168, 123, 1};
+    Ip4::Cidr     cidr;
+
+    sNow      = 0;
+    sInstance = testInitInstance();
+
+    SuccessOrQuit(sNatAddress.FromString("192.168.123.1"));
+    SuccessOrQuit(sRemoteAddress.FromString("172.16.243.197"));
+
+    // A single IPv4 address is shared by all Thread hosts.
+    cidr.Set(kNatAddress, 32);
+    sNat64Prefix.Set(kNat64Prefix, 96);
+    SuccessOrQuit(sInstance->Get<Nat64::Translator>().SetIp4Cidr(cidr));
+    sInstance->Get<Nat64::Translator>().SetNat64Prefix(sNat64Prefix);
+}
+
+void WriteTransportHeader(uint8_t *aBuffer, uint8_t aProtocol, uint8_t aIcmpType, uint16_t aSrcPort, uint16_t aDstPort)
+{
+    // Writes an 8-byte UDP header, or an ICMP echo header where the
+    // identifier is the port of the Thread host (`aSrcPort` for
+    // outgoing and `aDstPort` for incoming datagrams).
+
+    memset(aBuffer, 0, sizeof(Ip6::Udp::Header));
+
+    if (aProtocol == Ip6::kProtoUdp)
+    {
+        Encoding::BigEndian::WriteUint16(aSrcPort, &aBuffer[0]);
+        Encoding::BigEndian::WriteUint16(aDstPort, &aBuffer[2]);
+        Encoding::BigEndian::WriteUint16(sizeof(Ip6::Udp::Header) + sizeof(kPayload), &aBuffer[4]);
+    }
+    else
+    {
+        aBuffer[0] = aIcmpType;
+        Encoding::BigEndian::WriteUint16((aIcmpType == kIcmp6EchoRequest) ? aSrcPort : aDstPort, &aBuffer[4]);
+        Encoding::BigEndian::WriteUint16(1, &aBuffer[6]);
+    }
+}
+
+Message *NewOutgoingDatagram(const Ip6::Address &aHost, uint8_t aProtocol, uint16_t aPort, uint16_t aRemotePort)
+{
+    Message    *message = sInstance->Get<Ip6::Ip6>().NewMessage(0);
+    Ip6::Header header;
+    uint8_t     transport[sizeof(Ip6::Udp::Header)];
+
+    VerifyOrQuit(message != nullptr);
+
+    WriteTransportHeader(transport, aProtocol, kIcmp6EchoRequest, aPort, aRemotePort);
+
+    header.Clear();
+    header.InitVersionTrafficClassFlow();
+    header.SetPayloadLength(sizeof(transport) + sizeof(kPayload));
+    header.SetNextHeader(aProtocol);
+    header.SetHopLimit(64);
+    header.SetSource(aHost);
+    header.GetDestination().SynthesizeFromIp4Address(sNat64Prefix, sRemoteAddress);
+
+    SuccessOrQuit(message->Append(header));
+    SuccessOrQuit(message->AppendBytes(transport, sizeof(transport)));
+    SuccessOrQuit(message->AppendBytes(kPayload, sizeof(kPayload)));
+
+    return message;
+}
+
+Message *NewIncomingDatagram(uint8_t aProtocol, uint16_t aPort, uint16_t aRemotePort)
+{
+    Message    *message = sInstance->Get<Ip6::Ip6>().NewMessage(0);
+    Ip4::Header header;
+    uint8_t     transport[sizeof(Ip6::Udp::Header)];
+
+    VerifyOrQuit(message != nullptr);
+
+    WriteTransportHeader(transport, aProtocol, kIcmp4EchoReply, aRemotePort, aPort);
+
+    header.Clear();
+    header.InitVersionIhl();
+    header.SetTotalLength(sizeof(header) + sizeof(transport) + sizeof(kPayload));
+    header.SetProtocol((aProtocol == Ip6::kProtoUdp) ? Ip4::kProtoUdp : Ip4::kProtoIcmp);
+    header.SetTtl(64);
+    header.SetSource(sRemoteAddress);
+    header.SetDestination(sNatAddress);
+    Checksum::UpdateIp4HeaderChecksum(header);
+
+    SuccessOrQuit(message->Append(header));
+    SuccessOrQuit(message->AppendBytes(transport, sizeof(transport)));
+    SuccessOrQuit(message->AppendBytes(kPayload, sizeof(kPayload)));
+
+    return message;
+}
+
+uint16_t TranslateOutgoing(const Ip6::Address &aHost, uint8_t aProtocol, uint16_t aPort)
+{
+    // Translates an outgoing datagram and returns the translated port.
+
+    Message    *message = NewOutgoingDatagram(aHost, aProtocol, aPort, 4660);
+    Ip4::Header header;
+    uint16_t    port;
+
+    VerifyOrQuit(sInstance->Get<Nat64::Translator>().TranslateFromIp6(*message) == Nat64::Translator::kForward);
+
+    SuccessOrQuit(header.ParseFrom(*message));
+    VerifyOrQuit(header.GetSource() == sNatAddress);
+    VerifyOrQuit(header.GetDestination() == sRemoteAddress);
+    SuccessOrQuit(message->Read(sizeof(header) + ((aProtocol == Ip6::kProtoUdp) ? 0 : 4), port));
+
+    message->Free();
+
+    return Encoding::BigEndian::HostSwap16(port);
+}
+
+void VerifyIncoming(uint8_t aProtocol, uint16_t aPort, const Ip6::Address &aHost, uint16_t aHostPort)
+{
+    // Translates an incoming datagram to translated port `aPort` and
+    // verifies it is delivered to `aHost` on `aHostPort`.
+
+    Message         *message = NewIncomingDatagram(aProtocol, aPort, 4660);
+    Ip6::Header      header;
+    Ip6::MessageInfo messageInfo;
+    uint16_t         port;
+
+    VerifyOrQuit(sInstance->Get<Nat64::Translator>().TranslateToIp6(*message) == Nat64::Translator::kForward);
+
+    SuccessOrQuit(header.ParseFrom(*message));
+    VerifyOrQuit(header.GetDestination() == aHost);
+    VerifyOrQuit(header.GetNextHeader() == aProtocol);
+    SuccessOrQuit(message->Read(sizeof(header) + ((aProtocol == Ip6::kProtoUdp) ? 2 : 4), port));
+    VerifyOrQuit(Encoding::BigEndian::HostSwap16(port) == aHostPort);
+
+    messageInfo.SetPeerAddr(header.GetSource());
+    messageInfo.SetSockAddr(header.GetDestination());
+    message->SetOffset(sizeof(header));
+    SuccessOrQuit(Checksum::VerifyMessageChecksum(*message, messageInfo, aProtocol));
+
+    message->Free();
+}
+
+void TestNat64PortTranslation(void)
+{
+    Nat64::Translator                 *translator;
+    Nat64::Translator::MappingCounters counters;
+    Nat64::Translator::ErrorCounters   errorCounters;
+    Ip6::Address                       host1;
+    Ip6::Address                       host2;
+    uint16_t                           port1;
+    uint16_t                           port2;
+    uint16_t                           port;
+    Message                           *message;
+
+    printf("TestNat64PortTranslation()");
+
+    InitPortTranslation();
+    translator = &sInstance->Get<Nat64::Translator>();
+
+    SuccessOrQuit(host1.FromString("fd02::1"));
+    SuccessOrQuit(host2.FromString("fd02::2"));
+
+    // Two hosts using the same source port share the IPv4 address. The
+    // first one keeps its port, the second one is given another one.
+
+    port1 = TranslateOutgoing(host1, Ip6::kProtoUdp, 43981);
+    port2 = TranslateOutgoing(host2, Ip6::kProtoUdp, 43981);
+    VerifyOrQuit(port1 == 43981);
+    VerifyOrQuit(port2 != port1);
+
+    VerifyIncoming(Ip6::kProtoUdp, port1, host1, 43981);
+    VerifyIncoming(Ip6::kProtoUdp, port2, host2, 43981);
+
+    // The flows are reused by later datagrams.
+
+    VerifyOrQuit(TranslateOutgoing(host2, Ip6::kProtoUdp, 43981) == port2);
+
+    // Ports below the ephemeral range are not preserved.
+
+    port = TranslateOutgoing(host1, Ip6::kProtoUdp, 53);
+    VerifyOrQuit(port >= 1024);
+    VerifyIncoming(Ip6::kProtoUdp, port, host1, 53);
+
+    // ICMP echo identifiers are translated like ports.
+
+    port1 = TranslateOutgoing(host1, Ip6::kProtoIcmp6, 0xaabb);
+    port2 = TranslateOutgoing(host2, Ip6::kProtoIcmp6, 0xaabb);
+    VerifyOrQuit(port1 == 0xaabb);
+    VerifyOrQuit(port2 != port1);
+    VerifyIncoming(Ip6::kProtoIcmp6, port1, host1, 0xaabb);
+    VerifyIncoming(Ip6::kProtoIcmp6, port2, host2, 0xaabb);
+
+    translator->GetMappingCounters(counters);
+    VerifyOrQuit(counters.mAddressMappingsCreated == 2);
+    VerifyOrQuit(counters.mNumAddressMappings == 2);
+    VerifyOrQuit(counters.mPortMappingsCreated == 5);
+    VerifyOrQuit(counters.mNumPortMappings == 5);
+    VerifyOrQuit(counters.mMaxNumPortMappings == 5);
+    VerifyOrQuit(counters.mPortMappingCapacity == Nat64::Translator::kPortMappingPoolSize);
+    VerifyOrQuit(counters.mPortExhaustions == 0);
+
+    // Incoming datagrams without a flow are dropped.
+
+    message = NewIncomingDatagram(Ip6::kProtoUdp, 4321, 4660);
+    VerifyOrQuit(translator->TranslateToIp6(*message) == Nat64::Translator::kDrop);
+    message->Free();
+
+    translator->GetErrorCounters(errorCounters);
+    VerifyOrQuit(errorCounters.mCount4To6[Nat64::Translator::ErrorCounters::kNoMapping] == 1);
+
+    // Idle flows are released by the expirer timer, ICMP flows first.
+    // Address mappings are kept until all their flows are released.
+
+    sNow += Nat64::Translator::kIcmpIdleTimeoutMsec + 1;
+    otPlatAlarmMilliFired(sInstance);
+
+    translator->GetMappingCounters(counters);
+    VerifyOrQuit(counters.mNumPortMappings == 3);
+    VerifyOrQuit(counters.mPortMappingsReleased == 2);
+
+    message = NewIncomingDatagram(Ip6::kProtoIcmp6, port1, 4660);
+    VerifyOrQuit(translator->TranslateToIp6(*message) == Nat64::Translator::kDrop);
+    message->Free();
+
+    sNow += Nat64::Translator::kUdpIdleTimeoutMsec;
+    otPlatAlarmMilliFired(sInstance);
+
+    translator->GetMappingCounters(counters);
+    VerifyOrQuit(counters.mNumPortMappings == 0);
+    VerifyOrQuit(counters.mNumAddressMappings == 2);
+
+    sNow += Nat64::Translator::kAddressMappingIdleTimeoutMsec;
+    otPlatAlarmMilliFired(sInstance);
+
+    translator->GetMappingCounters(counters);
+    VerifyOrQuit(counters.mNumAddressMappings == 0);
+    VerifyOrQuit(counters.mAddressMappingsReleased == 2);
+
+    // Disabling the translator releases all mappings.
+
+    IgnoreReturnValue(TranslateOutgoing(host1, Ip6::kProtoUdp, 43981));
+    translator->SetEnabled(true);
+    translator->SetEnabled(false);
+
+    translator->GetMappingCounters(counters);
+    VerifyOrQuit(counters.mNumAddressMappings == 0);
+    VerifyOrQuit(counters.mNumPortMappings == 0);
+    VerifyOrQuit(counters.mPortMappingsReleased == 6);
+    VerifyOrQuit(counters.mAddressMappingsReleased == 3);
+
+    testFreeInstance(sInstance);
+
+    printf(" -- PASS\n");
+}
+
+void BenchmarkNat64PortTranslation(void)
+{
+    // Translates datagrams of 1024 concurrent UDP flows (64 hosts with
+    // 16 flows each) sharing a single IPv4 address, in both directions,
+    // and then checks port exhaustion and expiry of idle flows.
+
+    static constexpr uint16_t kNumHosts        = 64;
+    static constexpr uint16_t kNumFlowsPerHost = 16;
+    static constexpr uint16_t kNumFlows        = kNumHosts * kNumFlowsPerHost;
+    static constexpr uint16_t kNumRounds       = 20;
+
+    static_assert(kNumFlows <= Nat64::Translator::kPortMappingPoolSize, "Port mapping pool is too small");
+
+    using Clock = std::chrono::steady_clock;
+
+    Ip6::Address                       hosts[kNumHosts];
+    uint16_t                           ports[kNumFlows];
+    Nat64::Translator::MappingCounters counters;
+    Message                           *message;
+
+    printf("BenchmarkNat64PortTranslation()");
+
+    InitPortTranslation();
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        SuccessOrQuit(hosts[i].FromString("fd02::"));
+        hosts[i].mFields.m16[7] = Encoding::BigEndian::HostSwap16(i + 1);
+    }
+
+    for (uint16_t flow = 0; flow < kNumFlows; flow++)
+    {
+        ports[flow] = TranslateOutgoing(hosts[flow % kNumHosts], Ip6::kProtoUdp, 50000 + flow / kNumHosts);
+    }
+
+    for (uint8_t pass = 0; pass < 2; pass++)
+    {
+        bool              outgoing = (pass == 0);
+        Clock::time_point start    = Clock::now();
+        Clock::duration   duration;
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            for (uint16_t flow = 0; flow < kNumFlows; flow++)
+            {
+                const Ip6::Address &host     = hosts[flow % kNumHosts];
+                uint16_t            hostPort = 50000 + flow / kNumHosts;
+
+                if (outgoing)
+                {
+                    VerifyOrQuit(TranslateOutgoing(host, Ip6::kProtoUdp, hostPort) == ports[flow]);
+                }
+                else
+                {
+                    VerifyIncoming(Ip6::kProtoUdp, ports[flow], host, hostPort);
+                }
+            }
+        }
+
+        duration = Clock::now() - start;
+
+        printf("\n  %-8s %5lld ns/datagram (%u flows, including datagram creation and checks)",
+               outgoing ? "6 to 4" : "4 to 6",
+               static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() /
+                                      (kNumRounds * kNumFlows)),
+               kNumFlows);
+    }
+
+    sInstance->Get<Nat64::Translator>().GetMappingCounters(counters);
+    VerifyOrQuit(counters.mNumAddressMappings == kNumHosts);
+    VerifyOrQuit(counters.mNumPortMappings == kNumFlows);
+    VerifyOrQuit(counters.mPortMappingsCreated == kNumFlows);
+
+    // Fill the table and check that a new flow is rejected.
+
+    for (uint16_t flow = kNumFlows; flow < Nat64::Translator::kPortMappingPoolSize; flow++)
+    {
+        IgnoreReturnValue(TranslateOutgoing(hosts[0], Ip6::kProtoUdp, flow));
+    }
+
+    message = NewOutgoingDatagram(hosts[1], Ip6::kProtoUdp, 1234, 4660);
+    VerifyOrQuit(sInstance->Get<Nat64::Translator>().TranslateFromIp6(*message) == Nat64::Translator::kDrop);
+    message->Free();
+
+    sInstance->Get<Nat64::Translator>().GetMappingCounters(counters);
+    VerifyOrQuit(counters.mPortExhaustions == 1);
+    VerifyOrQuit(counters.mNumPortMappings == Nat64::Translator::kPortMappingPoolSize);
+
+    // Once the flows are idle, they are reclaimed for new ones.
+
+    sNow += Nat64::Translator::kUdpIdleTimeoutMsec + 1;
+    VerifyIncoming(Ip6::kProtoUdp, TranslateOutgoing(hosts[1], Ip6::kProtoUdp, 1234), hosts[1], 1234);
+
+    sInstance->Get<Nat64::Translator>().GetMappingCounters(counters);
+    VerifyOrQuit(counters.mNumPortMappings == 1);
+    VerifyOrQuit(counters.mPortMappingsReleased == Nat64::Translator::kPortMappingPoolSize);
+    VerifyOrQuit(counters.mMaxNumPortMappings == Nat64::Translator::kPortMappingPoolSize);
+
+    testFreeInstance(sInstance);
+
+    printf("\nBenchmarkNat64PortTranslation() -- PASS\n");
+}
+
+#endif // !OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
 } // namespace BorderRouter
 } // namespace ot
 
@@ -305,7 +682,12 @@ void TestNat64(void)
 int main(void)
 {
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    ot::BorderRouter::TestNat64PortTranslation();
+    ot::BorderRouter::BenchmarkNat64PortTranslation();
+#else
     ot::BorderRouter::TestNat64();
+#endif
     printf("All tests passed\n");
 #else  // OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     printf("NAT64 is not enabled\n");
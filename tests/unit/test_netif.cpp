@@ -28,6 +28,8 @@
 
 #include <stdarg.h>
 
+#include <chrono>
+
 #include "test_platform.h"
 
 #include <openthread/config.h>
@@ -35,7 +37,9 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
+#include "net/ip6.hpp"
 #include "net/netif.hpp"
+#include "thread/thread_netif.hpp"
 
 #include "test_util.h"
 
@@ -205,11 +209,169 @@ void TestNetifMulticastAddresses(void)
     }
 }
 
+static constexpr uint8_t kNumSourceAddresses = 16;
+
+// Adds `kNumSourceAddresses` unicast addresses to `ThreadNetif`: one link-local,
+// three mesh-local and twelve global addresses on distinct /64 prefixes.
+static void AddSourceAddresses(Instance &aInstance, Ip6::Netif::UnicastAddress aAddresses[])
+{
+    for (uint8_t i = 0; i < kNumSourceAddresses; i++)
+    {
+        char string[Ip6::Address::kInfoStringSize];
+
+        if (i == 0)
+        {
+            snprintf(string, sizeof(string), "fe80::1");
+        }
+        else if (i < 4)
+        {
+            snprintf(string, sizeof(string), "fd00:db8:%x::1", i);
+        }
+        else
+        {
+            snprintf(string, sizeof(string), "2001:db8:%x::1", i);
+        }
+
+        aAddresses[i].InitAsSlaacOrigin(64, /* aPreferred */ true);
+        SuccessOrQuit(aAddresses[i].GetAddress().FromString(string));
+        aInstance.Get<ThreadNetif>().AddUnicastAddress(aAddresses[i]);
+    }
+}
+
+static void RemoveSourceAddresses(Instance &aInstance, Ip6::Netif::UnicastAddress aAddresses[])
+{
+    for (uint8_t i = 0; i < kNumSourceAddresses; i++)
+    {
+        aInstance.Get<ThreadNetif>().RemoveUnicastAddress(aAddresses[i]);
+    }
+}
+
+static void VerifySourceAddress(Instance &aInstance, const char *aDestination, const char *aExpectedSource)
+{
+    Ip6::Address        destination;
+    Ip6::Address        expectedSource;
+    const Ip6::Address *source;
+
+    SuccessOrQuit(destination.FromString(aDestination));
+    SuccessOrQuit(expectedSource.FromString(aExpectedSource));
+
+    source = aInstance.Get<Ip6::Ip6>().SelectSourceAddress(destination);
+    VerifyOrQuit(source != nullptr);
+    VerifyOrQuit(*source == expectedSource, "SelectSourceAddress() returned an unexpected source");
+}
+
+void TestSourceAddressSelectionCache(void)
+{
+    Instance                  *instance = testInitInstance();
+    Ip6::Netif::UnicastAddress addresses[kNumSourceAddresses];
+    Ip6::Address               destination;
+    const Ip6::Address        *source;
+
+    AddSourceAddresses(*instance, addresses);
+
+    // Repeated look-ups must return the same result as the first one.
+
+    for (uint8_t pass = 0; pass < 2; pass++)
+    {
+        VerifySourceAddress(*instance, "2001:db8:7::99", "2001:db8:7::1");
+        VerifySourceAddress(*instance, "fd00:db8:2::99", "fd00:db8:2::1");
+        VerifySourceAddress(*instance, "fe80::99", "fe80::1");
+        VerifySourceAddress(*instance, "2001:db8:7::1", "2001:db8:7::1");
+    }
+
+    // Removing the selected address must flush its cached selection.
+
+    instance->Get<ThreadNetif>().RemoveUnicastAddress(addresses[7]);
+    VerifySourceAddress(*instance, "2001:db8:8::99", "2001:db8:8::1");
+    VerifyOrQuit(instance->Get<Ip6::Ip6>().SelectSourceAddress(addresses[7].GetAddress()) !=
+                 &addresses[7].GetAddress());
+
+    // Deprecating the selected address in place and re-adding it must
+    // flush the cache too. The result must match a fresh selection.
+
+    VerifySourceAddress(*instance, "2001:db8:9::99", "2001:db8:9::1");
+
+    addresses[9].mPreferred = false;
+    instance->Get<ThreadNetif>().AddUnicastAddress(addresses[9]);
+
+    SuccessOrQuit(destination.FromString("2001:db8:9::99"));
+    source = instance->Get<Ip6::Ip6>().SelectSourceAddress(destination);
+    VerifyOrQuit(source != &addresses[9].GetAddress());
+
+    instance->Get<Ip6::Ip6>().InvalidateSourceAddressCache();
+    VerifyOrQuit(instance->Get<Ip6::Ip6>().SelectSourceAddress(destination) == source);
+
+    RemoveSourceAddresses(*instance, addresses);
+
+    VerifyOrQuit(instance->Get<Ip6::Ip6>().SelectSourceAddress(addresses[4].GetAddress()) == nullptr);
+
+    testFreeInstance(instance);
+
+    printf("TestSourceAddressSelectionCache() -- PASS\n");
+}
+
+void BenchmarkSourceAddressSelection(void)
+{
+    // Measures source address selection with 16 unicast addresses on
+    // `ThreadNetif`, cycling over a few destinations (fewer than the
+    // cache size) with the cache in use and flushed before every call.
+
+    static constexpr uint32_t kNumSelections = 50000;
+
+    static const char *const kDestinations[] = {"2001:db8:c::99", "fd00:db8:3::99", "fe80::99", "2001:db8:4::1"};
+
+    using Clock = std::chrono::steady_clock;
+
+    Instance                  *instance = testInitInstance();
+    Ip6::Netif::UnicastAddress addresses[kNumSourceAddresses];
+    Ip6::Address               destinations[GetArrayLength(kDestinations)];
+
+    AddSourceAddresses(*instance, addresses);
+
+    for (uint8_t i = 0; i < GetArrayLength(kDestinations); i++)
+    {
+        SuccessOrQuit(destinations[i].FromString(kDestinations[i]));
+    }
+
+    printf("BenchmarkSourceAddressSelection()");
+
+    for (uint8_t pass = 0; pass < 2; pass++)
+    {
+        bool              invalidate = (pass == 1);
+        Clock::time_point start      = Clock::now();
+        Clock::duration   duration;
+
+        for (uint32_t num = 0; num < kNumSelections; num++)
+        {
+            if (invalidate)
+            {
+                instance->Get<Ip6::Ip6>().InvalidateSourceAddressCache();
+            }
+
+            VerifyOrQuit(instance->Get<Ip6::Ip6>().SelectSourceAddress(
+                             destinations[num % GetArrayLength(destinations)]) != nullptr);
+        }
+
+        duration = Clock::now() - start;
+
+        printf("\n  %-10s %5lld ns/selection", invalidate ? "uncached" : "cached",
+               static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() /
+                                      kNumSelections));
+    }
+
+    RemoveSourceAddresses(*instance, addresses);
+    testFreeInstance(instance);
+
+    printf("\nBenchmarkSourceAddressSelection() -- PASS\n");
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestNetifMulticastAddresses();
+    ot::TestSourceAddressSelectionCache();
+    ot::BenchmarkSourceAddressSelection();
     printf("All tests passed\n");
     return 0;
 }
@@ -0,0 +1,326 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "thread/network_data_delta.hpp"
+
+namespace ot {
+namespace NetworkData {
+
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+
+struct TlvList
+{
+    void Clear(void) { mLength = 0; }
+
+    void Add(uint8_t aType, uint8_t aValueLength, uint8_t aFill)
+    {
+        VerifyOrQuit(mLength + 2 + aValueLength <= sizeof(mData));
+        mData[mLength++] = aType;
+        mData[mLength++] = aValueLength;
+        memset(&mData[mLength], aFill, aValueLength);
+        mLength += aValueLength;
+    }
+
+    uint8_t mData[NetworkData::kMaxSize];
+    uint8_t mLength;
+};
+
+static void VerifyRoundTrip(const TlvList &aBase, const TlvList &aTarget, uint8_t &aDeltaLength)
+{
+    uint8_t delta[NetworkData::kMaxSize];
+    uint8_t target[NetworkData::kMaxSize];
+    uint8_t targetLength = sizeof(target);
+
+    aDeltaLength = sizeof(delta);
+    SuccessOrQuit(
+        DeltaManager::EncodeDelta(aBase.mData, aBase.mLength, aTarget.mData, aTarget.mLength, delta, aDeltaLength));
+    SuccessOrQuit(DeltaManager::ApplyDelta(aBase.mData, aBase.mLength, delta, aDeltaLength, target, targetLength));
+
+    VerifyOrQuit(targetLength == aTarget.mLength);
+    VerifyOrQuit(memcmp(target, aTarget.mData, targetLength) == 0);
+}
+
+void TestEncodeApply(void)
+{
+    TlvList base;
+    TlvList target;
+    uint8_t deltaLength;
+
+    printf("TestEncodeApply");
+
+    base.Clear();
+    base.Add(0x03, 20, 0x11);
+    base.Add(0x05, 30, 0x22);
+    base.Add(0x0b, 10, 0x33);
+    base.Add(0x03, 40, 0x44);
+
+    // Unchanged Network Data is a single copy.
+    VerifyRoundTrip(base, base, deltaLength);
+    VerifyOrQuit(deltaLength == 3);
+
+    // Appended TLV.
+    target = base;
+    target.Add(0x0d, 8, 0x55);
+    VerifyRoundTrip(base, target, deltaLength);
+    VerifyOrQuit(deltaLength == 3 + 2 + 10);
+
+    // Removed TLV in the middle.
+    target.Clear();
+    target.Add(0x03, 20, 0x11);
+    target.Add(0x0b, 10, 0x33);
+    target.Add(0x03, 40, 0x44);
+    VerifyRoundTrip(base, target, deltaLength);
+    VerifyOrQuit(deltaLength == 3 + 3);
+
+    // Modified TLV and reordered TLVs.
+    target.Clear();
+    target.Add(0x03, 40, 0x44);
+    target.Add(0x05, 31, 0x22);
+    target.Add(0x03, 20, 0x11);
+    VerifyRoundTrip(base, target, deltaLength);
+    VerifyOrQuit(deltaLength < target.mLength);
+
+    // Empty base and empty target.
+    target.Clear();
+    VerifyRoundTrip(base, target, deltaLength);
+    VerifyOrQuit(deltaLength == 0);
+
+    VerifyRoundTrip(target, base, deltaLength);
+    VerifyOrQuit(deltaLength == 2 + base.mLength);
+
+    printf(" -- PASS\n");
+}
+
+void TestRandomChanges(void)
+{
+    TlvList base;
+    TlvList target;
+    uint8_t deltaLength;
+
+    printf("TestRandomChanges");
+
+    for (uint16_t iter = 0; iter < 500; iter++)
+    {
+        uint8_t numTlvs = 1 + (rand() % 12);
+
+        base.Clear();
+
+        for (uint8_t i = 0; i < numTlvs; i++)
+        {
+            uint8_t length = static_cast<uint8_t>(rand() % 16);
+
+            if (base.mLength + 2 + length > NetworkData::kMaxSize)
+            {
+                break;
+            }
+
+            base.Add(static_cast<uint8_t>(rand()), length, static_cast<uint8_t>(rand()));
+        }
+
+        // Rebuild the target from the base TLVs, randomly dropping, changing or adding some of them.
+        target.Clear();
+
+        for (uint8_t offset = 0; offset < base.mLength; offset += 2 + base.mData[offset + 1])
+        {
+            uint8_t length = base.mData[offset + 1];
+
+            switch (rand() % 6)
+            {
+            case 0:
+                break;
+
+            case 1:
+                if (target.mLength + 2 + length <= NetworkData::kMaxSize)
+                {
+                    target.Add(base.mData[offset], length, static_cast<uint8_t>(rand()));
+                }
+                break;
+
+            case 2:
+                if (target.mLength + 2 + 4 <= NetworkData::kMaxSize)
+                {
+                    target.Add(static_cast<uint8_t>(rand()), 4, static_cast<uint8_t>(rand()));
+                }
+
+                OT_FALL_THROUGH;
+
+            default:
+                if (target.mLength + 2 + length <= NetworkData::kMaxSize)
+                {
+                    memcpy(&target.mData[target.mLength], &base.mData[offset], 2 + length);
+                    target.mLength += 2 + length;
+                }
+                break;
+            }
+        }
+
+        VerifyRoundTrip(base, target, deltaLength);
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestInvalidDelta(void)
+{
+    TlvList base;
+    uint8_t target[NetworkData::kMaxSize];
+    uint8_t targetLength;
+
+    printf("TestInvalidDelta");
+
+    base.Clear();
+    base.Add(0x03, 4, 0x11);
+    base.Add(0x05, 6, 0x22);
+
+    {
+        // Unknown op.
+        const uint8_t delta[] = {0x7f, 0, 1};
+
+        targetLength = sizeof(target);
+        VerifyOrQuit(DeltaManager::ApplyDelta(base.mData, base.mLength, delta, sizeof(delta), target, targetLength) ==
+                     kErrorParse);
+    }
+
+    {
+        // Copy beyond the last base TLV.
+        const uint8_t delta[] = {1, 1, 2};
+
+        targetLength = sizeof(target);
+        VerifyOrQuit(DeltaManager::ApplyDelta(base.mData, base.mLength, delta, sizeof(delta), target, targetLength) ==
+                     kErrorParse);
+    }
+
+    {
+        // Truncated copy op.
+        const uint8_t delta[] = {1, 0};
+
+        targetLength = sizeof(target);
+        VerifyOrQuit(DeltaManager::ApplyDelta(base.mData, base.mLength, delta, sizeof(delta), target, targetLength) ==
+                     kErrorParse);
+    }
+
+    {
+        // Insert longer than the delta.
+        const uint8_t delta[] = {2, 4, 0x03, 2, 0xaa};
+
+        targetLength = sizeof(target);
+        VerifyOrQuit(DeltaManager::ApplyDelta(base.mData, base.mLength, delta, sizeof(delta), target, targetLength) ==
+                     kErrorParse);
+    }
+
+    {
+        // Inserted bytes not forming a well-formed TLV.
+        const uint8_t delta[] = {2, 3, 0x03, 2, 0xaa};
+
+        targetLength = sizeof(target);
+        VerifyOrQuit(DeltaManager::ApplyDelta(base.mData, base.mLength, delta, sizeof(delta), target, targetLength) ==
+                     kErrorParse);
+    }
+
+    {
+        // Result larger than the target buffer.
+        const uint8_t delta[] = {1, 0, 2};
+
+        targetLength = base.mLength - 1;
+        VerifyOrQuit(DeltaManager::ApplyDelta(base.mData, base.mLength, delta, sizeof(delta), target, targetLength) ==
+                     kErrorParse);
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestEncodeNoBufs(void)
+{
+    TlvList base;
+    TlvList target;
+    uint8_t delta[NetworkData::kMaxSize];
+    uint8_t deltaLength;
+
+    printf("TestEncodeNoBufs");
+
+    base.Clear();
+    base.Add(0x03, 20, 0x11);
+
+    target.Clear();
+    target.Add(0x05, 20, 0x22);
+    target.Add(0x03, 20, 0x11);
+
+    deltaLength = 2 + 22 + 3 - 1;
+    VerifyOrQuit(DeltaManager::EncodeDelta(base.mData, base.mLength, target.mData, target.mLength, delta,
+                                           deltaLength) == kErrorNoBufs);
+
+    deltaLength = sizeof(delta);
+    SuccessOrQuit(
+        DeltaManager::EncodeDelta(base.mData, base.mLength, target.mData, target.mLength, delta, deltaLength));
+    VerifyOrQuit(deltaLength == 2 + 22 + 3);
+
+    // Malformed Network Data (TLV running past the end).
+    base.mData[1] = 30;
+    deltaLength   = sizeof(delta);
+    VerifyOrQuit(DeltaManager::EncodeDelta(base.mData, base.mLength, target.mData, target.mLength, delta,
+                                           deltaLength) == kErrorParse);
+
+    printf(" -- PASS\n");
+}
+
+void TestChecksum(void)
+{
+    const uint8_t kData[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    printf("TestChecksum");
+
+    VerifyOrQuit(DeltaManager::CalculateChecksum(kData, sizeof(kData)) == 0x31c3);
+    VerifyOrQuit(DeltaManager::CalculateChecksum(kData, sizeof(kData) - 1) != 0x31c3);
+
+    printf(" -- PASS\n");
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+
+} // namespace NetworkData
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_NETDATA_DELTA_ENABLE
+    ot::NetworkData::TestEncodeApply();
+    ot::NetworkData::TestRandomChanges();
+    ot::NetworkData::TestInvalidDelta();
+    ot::NetworkData::TestEncodeNoBufs();
+    ot::NetworkData::TestChecksum();
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,362 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/platform/radio.h>
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#include "utils/soft_source_match_table.h"
+
+namespace ot {
+
+static constexpr uint16_t kNumEntries  = RADIO_CONFIG_SRC_MATCH_SHORT_ENTRY_NUM;
+static constexpr uint16_t kNumAddrs    = 2 * kNumEntries; // Addresses used by the tests, half of them can be added.
+static constexpr uint16_t kPanId       = 0xface;
+static constexpr uint16_t kOtherPanId  = 0xbeef;
+static constexpr uint32_t kAckDeadline = 192; // Time (in usec) to prepare an ACK.
+
+static_assert(RADIO_CONFIG_SRC_MATCH_EXT_ENTRY_NUM == kNumEntries, "Short and ext tables should have same size");
+
+static uint32_t sRandom = 1;
+
+static uint32_t GetRandom(void)
+{
+    sRandom = sRandom * 1103515245u + 12345u;
+
+    return sRandom >> 8;
+}
+
+static uint16_t ShortAddress(uint16_t aIndex)
+{
+    // Children RLOC16s of a few routers.
+    return static_cast<uint16_t>(((aIndex % 8) << 10) | (1 + aIndex / 8));
+}
+
+static otExtAddress ExtAddress(uint16_t aIndex)
+{
+    otExtAddress extAddress;
+
+    for (uint8_t i = 0; i < sizeof(extAddress.m8); i++)
+    {
+        extAddress.m8[i] = static_cast<uint8_t>((aIndex * (i + 1) * 29 + i) & 0xff);
+    }
+
+    extAddress.m8[0] = static_cast<uint8_t>(aIndex >> 8);
+    extAddress.m8[7] = static_cast<uint8_t>(aIndex & 0xff);
+
+    return extAddress;
+}
+
+static bool HasShortEntry(uint16_t aIndex) { return utilsSoftSrcMatchShortFindEntry(ShortAddress(aIndex)) >= 0; }
+
+static bool HasExtEntry(uint16_t aIndex)
+{
+    otExtAddress extAddress = ExtAddress(aIndex);
+
+    return utilsSoftSrcMatchExtFindEntry(&extAddress) >= 0;
+}
+
+static otError AddExtEntry(uint16_t aIndex)
+{
+    otExtAddress extAddress = ExtAddress(aIndex);
+
+    return otPlatRadioAddSrcMatchExtEntry(nullptr, &extAddress);
+}
+
+static otError ClearExtEntry(uint16_t aIndex)
+{
+    otExtAddress extAddress = ExtAddress(aIndex);
+
+    return otPlatRadioClearSrcMatchExtEntry(nullptr, &extAddress);
+}
+
+static void VerifyEntries(const bool *aIsAdded)
+{
+    for (uint16_t index = 0; index < kNumAddrs; index++)
+    {
+        VerifyOrQuit(HasShortEntry(index) == aIsAdded[index]);
+        VerifyOrQuit(HasExtEntry(index) == aIsAdded[index]);
+    }
+}
+
+void TestSoftSrcMatchTable(void)
+{
+    bool isAdded[kNumAddrs];
+
+    printf("TestSoftSrcMatchTable()");
+
+    utilsSoftSrcMatchSetPanId(kPanId);
+    otPlatRadioClearSrcMatchShortEntries(nullptr);
+    otPlatRadioClearSrcMatchExtEntries(nullptr);
+
+    memset(isAdded, 0, sizeof(isAdded));
+    VerifyEntries(isAdded);
+
+    // Fill the tables.
+
+    for (uint16_t index = 0; index < kNumEntries; index++)
+    {
+        SuccessOrQuit(otPlatRadioAddSrcMatchShortEntry(nullptr, ShortAddress(index)));
+        SuccessOrQuit(AddExtEntry(index));
+        isAdded[index] = true;
+    }
+
+    VerifyEntries(isAdded);
+
+    VerifyOrQuit(otPlatRadioAddSrcMatchShortEntry(nullptr, ShortAddress(kNumEntries)) == OT_ERROR_NO_BUFS);
+    VerifyOrQuit(AddExtEntry(kNumEntries) == OT_ERROR_NO_BUFS);
+
+    // Entries are only matched on the PAN they were added on.
+
+    utilsSoftSrcMatchSetPanId(kOtherPanId);
+    VerifyOrQuit(!HasShortEntry(0));
+    VerifyOrQuit(!HasExtEntry(0));
+    utilsSoftSrcMatchSetPanId(kPanId);
+
+    // Remove every third entry.
+
+    for (uint16_t index = 0; index < kNumEntries; index += 3)
+    {
+        SuccessOrQuit(otPlatRadioClearSrcMatchShortEntry(nullptr, ShortAddress(index)));
+        SuccessOrQuit(ClearExtEntry(index));
+        isAdded[index] = false;
+    }
+
+    VerifyEntries(isAdded);
+
+    VerifyOrQuit(otPlatRadioClearSrcMatchShortEntry(nullptr, ShortAddress(0)) == OT_ERROR_NO_ADDRESS);
+    VerifyOrQuit(ClearExtEntry(0) == OT_ERROR_NO_ADDRESS);
+
+    // Duplicate entries are removed one at a time.
+
+    SuccessOrQuit(otPlatRadioAddSrcMatchShortEntry(nullptr, ShortAddress(1)));
+    SuccessOrQuit(AddExtEntry(1));
+    SuccessOrQuit(otPlatRadioClearSrcMatchShortEntry(nullptr, ShortAddress(1)));
+    SuccessOrQuit(ClearExtEntry(1));
+    VerifyEntries(isAdded);
+    SuccessOrQuit(otPlatRadioClearSrcMatchShortEntry(nullptr, ShortAddress(1)));
+    SuccessOrQuit(ClearExtEntry(1));
+    isAdded[1] = false;
+    VerifyEntries(isAdded);
+
+    // Random adds and removes, checked against `isAdded[]`.
+
+    for (uint16_t round = 0; round < 50; round++)
+    {
+        for (uint16_t num = 0; num < 200; num++)
+        {
+            uint16_t index = static_cast<uint16_t>(GetRandom() % kNumAddrs);
+
+            if (isAdded[index])
+            {
+                SuccessOrQuit(otPlatRadioClearSrcMatchShortEntry(nullptr, ShortAddress(index)));
+                SuccessOrQuit(ClearExtEntry(index));
+                isAdded[index] = false;
+            }
+            else if (otPlatRadioAddSrcMatchShortEntry(nullptr, ShortAddress(index)) == OT_ERROR_NONE)
+            {
+                SuccessOrQuit(AddExtEntry(index));
+                isAdded[index] = true;
+            }
+            else
+            {
+                VerifyOrQuit(AddExtEntry(index) == OT_ERROR_NO_BUFS);
+            }
+        }
+
+        VerifyEntries(isAdded);
+    }
+
+    otPlatRadioClearSrcMatchShortEntries(nullptr);
+    otPlatRadioClearSrcMatchExtEntries(nullptr);
+    memset(isAdded, 0, sizeof(isAdded));
+    VerifyEntries(isAdded);
+
+    printf(" -- PASS\n");
+}
+
+void TestSoftSrcMatchTableBulkAdd(void)
+{
+    static constexpr uint16_t kBatchSize = 8;
+
+    otShortAddress shortAddresses[kBatchSize];
+    otExtAddress   extAddresses[kBatchSize];
+    bool           isAdded[kNumAddrs];
+    uint16_t       numAdded = 0;
+
+    printf("TestSoftSrcMatchTableBulkAdd()");
+
+    utilsSoftSrcMatchSetPanId(kPanId);
+    otPlatRadioClearSrcMatchShortEntries(nullptr);
+    otPlatRadioClearSrcMatchExtEntries(nullptr);
+    memset(isAdded, 0, sizeof(isAdded));
+
+    // Add batches until the tables cannot take a full batch.
+
+    while (numAdded + kBatchSize <= kNumEntries)
+    {
+        for (uint16_t i = 0; i < kBatchSize; i++)
+        {
+            shortAddresses[i] = ShortAddress(numAdded + i);
+            extAddresses[i]   = ExtAddress(numAdded + i);
+        }
+
+        SuccessOrQuit(otPlatRadioAddSrcMatchShortEntries(nullptr, shortAddresses, kBatchSize));
+        SuccessOrQuit(otPlatRadioAddSrcMatchExtEntries(nullptr, extAddresses, kBatchSize));
+
+        for (uint16_t i = 0; i < kBatchSize; i++)
+        {
+            isAdded[numAdded++] = true;
+        }
+    }
+
+    VerifyEntries(isAdded);
+
+    // A batch which does not fit is not added at all.
+
+    if (numAdded < kNumEntries)
+    {
+        for (uint16_t i = 0; i < kBatchSize; i++)
+        {
+            shortAddresses[i] = ShortAddress(numAdded + i);
+            extAddresses[i]   = ExtAddress(numAdded + i);
+        }
+
+        VerifyOrQuit(otPlatRadioAddSrcMatchShortEntries(nullptr, shortAddresses, kBatchSize) == OT_ERROR_NO_BUFS);
+        VerifyOrQuit(otPlatRadioAddSrcMatchExtEntries(nullptr, extAddresses, kBatchSize) == OT_ERROR_NO_BUFS);
+        VerifyEntries(isAdded);
+
+        SuccessOrQuit(otPlatRadioAddSrcMatchShortEntries(nullptr, shortAddresses, kNumEntries - numAdded));
+        SuccessOrQuit(otPlatRadioAddSrcMatchExtEntries(nullptr, extAddresses, kNumEntries - numAdded));
+
+        while (numAdded < kNumEntries)
+        {
+            isAdded[numAdded++] = true;
+        }
+
+        VerifyEntries(isAdded);
+    }
+
+    VerifyOrQuit(otPlatRadioAddSrcMatchShortEntries(nullptr, shortAddresses, 1) == OT_ERROR_NO_BUFS);
+    VerifyOrQuit(otPlatRadioAddSrcMatchExtEntries(nullptr, extAddresses, 1) == OT_ERROR_NO_BUFS);
+    SuccessOrQuit(otPlatRadioAddSrcMatchShortEntries(nullptr, shortAddresses, 0));
+    SuccessOrQuit(otPlatRadioAddSrcMatchExtEntries(nullptr, extAddresses, 0));
+
+    otPlatRadioClearSrcMatchShortEntries(nullptr);
+    otPlatRadioClearSrcMatchExtEntries(nullptr);
+
+    printf(" -- PASS\n");
+}
+
+void BenchmarkSoftSrcMatchTableLookup(void)
+{
+    // Measures the lookup time of each address (added or not) with
+    // full tables. The largest one is the worst case when deciding
+    // the frame pending bit of an ACK.
+
+    static constexpr uint16_t kNumRepeats = 1000;
+
+    using Clock = std::chrono::steady_clock;
+
+    double   maxShortLookup = 0;
+    double   maxExtLookup   = 0;
+    double   sumShortLookup = 0;
+    double   sumExtLookup   = 0;
+    uint32_t numFound       = 0;
+
+    printf("BenchmarkSoftSrcMatchTableLookup()");
+
+    utilsSoftSrcMatchSetPanId(kPanId);
+    otPlatRadioClearSrcMatchShortEntries(nullptr);
+    otPlatRadioClearSrcMatchExtEntries(nullptr);
+
+    for (uint16_t index = 0; index < kNumEntries; index++)
+    {
+        SuccessOrQuit(otPlatRadioAddSrcMatchShortEntry(nullptr, ShortAddress(index)));
+        SuccessOrQuit(AddExtEntry(index));
+    }
+
+    for (uint16_t index = 0; index < kNumAddrs; index++)
+    {
+        uint16_t          shortAddress = ShortAddress(index);
+        otExtAddress      extAddress   = ExtAddress(index);
+        Clock::time_point start;
+        double            duration;
+
+        start = Clock::now();
+
+        for (uint16_t num = 0; num < kNumRepeats; num++)
+        {
+            numFound += (utilsSoftSrcMatchShortFindEntry(shortAddress) >= 0) ? 1 : 0;
+        }
+
+        duration = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / kNumRepeats;
+        maxShortLookup = (duration > maxShortLookup) ? duration : maxShortLookup;
+        sumShortLookup += duration;
+
+        start = Clock::now();
+
+        for (uint16_t num = 0; num < kNumRepeats; num++)
+        {
+            numFound += (utilsSoftSrcMatchExtFindEntry(&extAddress) >= 0) ? 1 : 0;
+        }
+
+        duration     = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / kNumRepeats;
+        maxExtLookup = (duration > maxExtLookup) ? duration : maxExtLookup;
+        sumExtLookup += duration;
+    }
+
+    VerifyOrQuit(numFound == 2u * kNumEntries * kNumRepeats);
+    VerifyOrQuit(maxShortLookup < kAckDeadline);
+    VerifyOrQuit(maxExtLookup < kAckDeadline);
+
+    printf("\n  %u entries, %u addresses looked up %u times each", kNumEntries, kNumAddrs, kNumRepeats);
+    printf("\n  short address lookup: avg %.3f usec, max %.3f usec", sumShortLookup / kNumAddrs, maxShortLookup);
+    printf("\n  ext address lookup: avg %.3f usec, max %.3f usec", sumExtLookup / kNumAddrs, maxExtLookup);
+
+    otPlatRadioClearSrcMatchShortEntries(nullptr);
+    otPlatRadioClearSrcMatchExtEntries(nullptr);
+
+    printf("\n -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestSoftSrcMatchTable();
+    ot::TestSoftSrcMatchTableBulkAdd();
+    ot::BenchmarkSoftSrcMatchTableLookup();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -859,6 +859,118 @@ void TestBuffer(void)
     testFreeInstance(sInstance);
 }
 
+void TestBufferScheduling(void)
+{
+    uint8_t                          buffer[kTestBufferSize];
+    Spinel::Buffer                   ncpBuffer(buffer, kTestBufferSize);
+    Spinel::Buffer::PriorityCounters counters;
+    uint16_t                         numFrames;
+
+    sInstance    = testInitInstance();
+    sMessagePool = &sInstance->Get<MessagePool>();
+
+    sContext.mFrameAddedCount   = 0;
+    sContext.mFrameRemovedCount = 0;
+    ClearTagHistory();
+
+    ncpBuffer.SetFrameAddedCallback(FrameAddedCallback, &sContext);
+    ncpBuffer.SetFrameRemovedCallback(FrameRemovedCallback, &sContext);
+
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\nTest: Weighted round-robin between priority levels");
+
+    ncpBuffer.SetPriorityWeights(2, 1);
+
+    WriteTestFrame1(ncpBuffer, Spinel::Buffer::kPriorityLow);
+    WriteTestFrame2(ncpBuffer, Spinel::Buffer::kPriorityLow);
+    WriteTestFrame3(ncpBuffer, Spinel::Buffer::kPriorityHigh);
+    WriteTestFrame4(ncpBuffer, Spinel::Buffer::kPriorityHigh);
+    WriteTestFrame3(ncpBuffer, Spinel::Buffer::kPriorityHigh);
+
+    ncpBuffer.GetPriorityCounters(Spinel::Buffer::kPriorityHigh, counters);
+    VerifyOrQuit(counters.mNumFrames == 3);
+    VerifyOrQuit(counters.mAddedFrames == 3);
+    VerifyOrQuit(counters.mNumBytes > 0);
+    VerifyOrQuit(counters.mMaxNumBytes == counters.mNumBytes);
+
+    ncpBuffer.GetPriorityCounters(Spinel::Buffer::kPriorityLow, counters);
+    VerifyOrQuit(counters.mNumFrames == 2);
+
+    // Two high priority frames, followed by one low priority frame.
+    VerifyAndRemoveFrame3(ncpBuffer);
+    VerifyAndRemoveFrame4(ncpBuffer);
+    VerifyAndRemoveFrame1(ncpBuffer);
+    VerifyAndRemoveFrame3(ncpBuffer);
+    VerifyAndRemoveFrame2(ncpBuffer);
+    VerifyOrQuit(ncpBuffer.IsEmpty());
+
+    ncpBuffer.GetPriorityCounters(Spinel::Buffer::kPriorityHigh, counters);
+    VerifyOrQuit(counters.mNumFrames == 0);
+    VerifyOrQuit(counters.mNumBytes == 0);
+    VerifyOrQuit(counters.mMaxNumBytes > 0);
+
+    // Strict priority when high priority weight is zero.
+    ncpBuffer.SetPriorityWeights(0, 1);
+
+    WriteTestFrame1(ncpBuffer, Spinel::Buffer::kPriorityLow);
+    WriteTestFrame3(ncpBuffer, Spinel::Buffer::kPriorityHigh);
+    WriteTestFrame4(ncpBuffer, Spinel::Buffer::kPriorityHigh);
+    WriteTestFrame2(ncpBuffer, Spinel::Buffer::kPriorityHigh);
+    VerifyAndRemoveFrame3(ncpBuffer);
+    VerifyAndRemoveFrame4(ncpBuffer);
+    VerifyAndRemoveFrame2(ncpBuffer);
+    VerifyAndRemoveFrame1(ncpBuffer);
+    VerifyOrQuit(ncpBuffer.IsEmpty());
+
+    printf(" -- PASS\n");
+
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\nTest: Priority length limit");
+
+    ncpBuffer.SetPriorityMaxLength(Spinel::Buffer::kPriorityLow, kTestBufferSize / 4);
+    ncpBuffer.ResetCounters();
+
+    numFrames = 0;
+
+    while (true)
+    {
+        ncpBuffer.InFrameBegin(Spinel::Buffer::kPriorityLow);
+
+        if ((ncpBuffer.InFrameFeedData(sMottoText, sizeof(sMottoText)) != OT_ERROR_NONE) ||
+            (ncpBuffer.InFrameEnd() != OT_ERROR_NONE))
+        {
+            break;
+        }
+
+        numFrames++;
+    }
+
+    ncpBuffer.GetPriorityCounters(Spinel::Buffer::kPriorityLow, counters);
+    VerifyOrQuit(counters.mNumFrames == numFrames);
+    VerifyOrQuit(counters.mAddedFrames == numFrames);
+    VerifyOrQuit(counters.mDroppedFrames == 1);
+    VerifyOrQuit(counters.mNumBytes <= kTestBufferSize / 4);
+
+    // The rest of the buffer remains available to high priority frames.
+    WriteTestFrame1(ncpBuffer, Spinel::Buffer::kPriorityHigh);
+    WriteTestFrame2(ncpBuffer, Spinel::Buffer::kPriorityHigh);
+
+    ncpBuffer.GetPriorityCounters(Spinel::Buffer::kPriorityHigh, counters);
+    VerifyOrQuit(counters.mNumFrames == 2);
+    VerifyOrQuit(counters.mDroppedFrames == 0);
+
+    ncpBuffer.Clear();
+    ClearTagHistory();
+
+    ncpBuffer.GetPriorityCounters(Spinel::Buffer::kPriorityLow, counters);
+    VerifyOrQuit(counters.mNumFrames == 0);
+    VerifyOrQuit(counters.mNumBytes == 0);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
 /**
  * NCP Buffer Fuzz testing
  *
@@ -1058,6 +1170,7 @@ void TestFuzzBuffer(void)
 int main(void)
 {
     ot::Spinel::TestBuffer();
+    ot::Spinel::TestBufferScheduling();
     ot::Spinel::TestFuzzBuffer();
     printf("\nAll tests passed.\n");
     return 0;
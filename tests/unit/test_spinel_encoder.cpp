@@ -28,6 +28,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "lib/spinel/spinel_decoder.hpp"
 #include "lib/spinel/spinel_encoder.hpp"
 
 #include "test_util.hpp"
@@ -357,12 +358,160 @@ void TestEncoder(void)
     printf(" -- PASS\n");
 }
 
+void TestEncoderPropValuesAre(void)
+{
+    uint8_t         buffer[kTestBufferSize];
+    Spinel::Buffer  ncpBuffer(buffer, kTestBufferSize);
+    Spinel::Encoder encoder(ncpBuffer);
+    Spinel::Decoder decoder;
+
+    uint8_t  frame[kTestBufferSize];
+    uint16_t frameLen;
+
+    const uint8_t  kHeader   = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0;
+    const uint8_t  kRole     = SPINEL_NET_ROLE_ROUTER;
+    const uint16_t kPanId    = 0xface;
+    const char     kName[]   = "OpenThread";
+    const uint32_t kPartId   = 0x12345678;
+    const uint8_t  kChannel  = 15;
+    uint8_t        numProps  = 0;
+    bool           sawPanId  = false;
+    bool           sawName   = false;
+    bool           sawPartId = false;
+    bool           sawRole   = false;
+
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\nTest 6: Encoding and decoding of a batched `VALUES_ARE` property update frame");
+
+    // Prepare the frame the same way NCP batches unsolicited updates:
+    // `A(t(iD))` with each property in its own struct, and an entry
+    // being dropped from the batch by resetting to a saved position.
+
+    SuccessOrQuit(encoder.BeginFrame(Spinel::Buffer::kPriorityHigh));
+    SuccessOrQuit(encoder.WriteUint8(kHeader));
+    SuccessOrQuit(encoder.WriteUintPacked(SPINEL_CMD_PROP_VALUES_ARE));
+
+    SuccessOrQuit(encoder.SavePosition());
+    SuccessOrQuit(encoder.OpenStruct());
+    SuccessOrQuit(encoder.WriteUintPacked(SPINEL_PROP_NET_ROLE));
+    SuccessOrQuit(encoder.WriteUint8(kRole));
+    SuccessOrQuit(encoder.CloseStruct());
+
+    SuccessOrQuit(encoder.SavePosition());
+    SuccessOrQuit(encoder.OpenStruct());
+    SuccessOrQuit(encoder.WriteUintPacked(SPINEL_PROP_PHY_CHAN));
+    SuccessOrQuit(encoder.WriteUint8(kChannel));
+    SuccessOrQuit(encoder.ResetToSaved());
+
+    SuccessOrQuit(encoder.SavePosition());
+    SuccessOrQuit(encoder.OpenStruct());
+    SuccessOrQuit(encoder.WriteUintPacked(SPINEL_PROP_MAC_15_4_PANID));
+    SuccessOrQuit(encoder.WriteUint16(kPanId));
+    SuccessOrQuit(encoder.CloseStruct());
+
+    SuccessOrQuit(encoder.SavePosition());
+    SuccessOrQuit(encoder.OpenStruct());
+    SuccessOrQuit(encoder.WriteUintPacked(SPINEL_PROP_NET_NETWORK_NAME));
+    SuccessOrQuit(encoder.WriteUtf8(kName));
+    SuccessOrQuit(encoder.CloseStruct());
+
+    SuccessOrQuit(encoder.SavePosition());
+    SuccessOrQuit(encoder.OpenStruct());
+    SuccessOrQuit(encoder.WriteUintPacked(SPINEL_PROP_NET_PARTITION_ID));
+    SuccessOrQuit(encoder.WriteUint32(kPartId));
+    SuccessOrQuit(encoder.CloseStruct());
+
+    SuccessOrQuit(encoder.EndFrame());
+
+    SuccessOrQuit(ReadFrame(ncpBuffer, frame, frameLen));
+
+    // Decode the frame as a host would, without any knowledge of
+    // the order or number of the properties in the batch.
+
+    decoder.Init(frame, frameLen);
+
+    {
+        uint8_t      header;
+        unsigned int command;
+
+        SuccessOrQuit(decoder.ReadUint8(header));
+        SuccessOrQuit(decoder.ReadUintPacked(command));
+        VerifyOrQuit(header == kHeader);
+        VerifyOrQuit(command == SPINEL_CMD_PROP_VALUES_ARE);
+    }
+
+    while (!decoder.IsAllRead())
+    {
+        unsigned int propKey;
+
+        SuccessOrQuit(decoder.OpenStruct());
+        SuccessOrQuit(decoder.ReadUintPacked(propKey));
+
+        switch (propKey)
+        {
+        case SPINEL_PROP_NET_ROLE:
+        {
+            uint8_t role;
+
+            SuccessOrQuit(decoder.ReadUint8(role));
+            VerifyOrQuit(role == kRole);
+            sawRole = true;
+            break;
+        }
+
+        case SPINEL_PROP_MAC_15_4_PANID:
+        {
+            uint16_t panId;
+
+            SuccessOrQuit(decoder.ReadUint16(panId));
+            VerifyOrQuit(panId == kPanId);
+            sawPanId = true;
+            break;
+        }
+
+        case SPINEL_PROP_NET_NETWORK_NAME:
+        {
+            const char *name;
+
+            SuccessOrQuit(decoder.ReadUtf8(name));
+            VerifyOrQuit(strcmp(name, kName) == 0);
+            sawName = true;
+            break;
+        }
+
+        case SPINEL_PROP_NET_PARTITION_ID:
+        {
+            uint32_t partId;
+
+            SuccessOrQuit(decoder.ReadUint32(partId));
+            VerifyOrQuit(partId == kPartId);
+            sawPartId = true;
+            break;
+        }
+
+        default:
+            VerifyOrQuit(false, "unexpected property in batch");
+        }
+
+        VerifyOrQuit(decoder.IsAllReadInStruct());
+        SuccessOrQuit(decoder.CloseStruct());
+        numProps++;
+    }
+
+    VerifyOrQuit(numProps == 4);
+    VerifyOrQuit(sawRole && sawPanId && sawName && sawPartId);
+    VerifyOrQuit(ncpBuffer.IsEmpty());
+
+    printf(" -- PASS\n");
+}
+
 } // namespace Spinel
 } // namespace ot
 
 int main(void)
 {
     ot::Spinel::TestEncoder();
+    ot::Spinel::TestEncoderPropValuesAre();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -35,6 +35,7 @@
 #include <openthread/srp_client.h>
 #include <openthread/srp_server.h>
 #include <openthread/thread.h>
+#include <openthread/platform/crypto.h>
 
 #include "common/arg_macros.hpp"
 #include "common/array.hpp"
@@ -133,6 +134,49 @@ void otPlatFree(void *aPtr)
 }
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// `otPlatCrypto`
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
+struct OffloadedVerification
+{
+    otPlatCryptoEcdsaPublicKey mPublicKey;
+    otPlatCryptoSha256Hash     mHash;
+    otPlatCryptoEcdsaSignature mSignature;
+    void                      *mContext;
+};
+
+static bool                              sOffloadVerifications = false;
+static Array<OffloadedVerification, 4>   sOffloadedVerifications;
+
+otError otPlatCryptoEcdsaVerifyStart(otInstance                       *aInstance,
+                                     const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                     const otPlatCryptoSha256Hash     *aHash,
+                                     const otPlatCryptoEcdsaSignature *aSignature,
+                                     void                             *aContext)
+{
+    otError                error        = OT_ERROR_NOT_IMPLEMENTED;
+    OffloadedVerification *verification;
+
+    VerifyOrQuit(aInstance == sInstance);
+    VerifyOrExit(sOffloadVerifications);
+
+    verification = sOffloadedVerifications.PushBack();
+    VerifyOrExit(verification != nullptr, error = OT_ERROR_BUSY);
+
+    verification->mPublicKey = *aPublicKey;
+    verification->mHash      = *aHash;
+    verification->mSignature = *aSignature;
+    verification->mContext   = aContext;
+    error                    = OT_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
 #if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
 void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
 {
@@ -1026,6 +1070,173 @@ void TestUpdateLeaseShortVariant(void)
 
 #endif // OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
+void CompleteOffloadedVerifications(void)
+{
+    // Verifies the signatures handed over to the platform, reporting
+    // the outcome in order.
+
+    for (const OffloadedVerification &verification : sOffloadedVerifications)
+    {
+        otPlatCryptoEcdsaVerifyDone(
+            sInstance, verification.mContext,
+            otPlatCryptoEcdsaVerify(&verification.mPublicKey, &verification.mHash, &verification.mSignature));
+    }
+
+    sOffloadedVerifications.Clear();
+}
+
+void WaitForOffloadedVerification(void)
+{
+    // Waits for the client to send its update and the server to hand
+    // its signature over to the platform.
+
+    for (uint16_t count = 0; sOffloadedVerifications.IsEmpty(); count++)
+    {
+        VerifyOrQuit(count < 200);
+        AdvanceTime(10);
+    }
+}
+
+void TestSrpServerAsyncSignatureVerify(void)
+{
+    Srp::Server                                *srpServer;
+    Srp::Client                                *srpClient;
+    Srp::Client::Service                        service1;
+    Srp::Client::Service                        service2;
+    uint16_t                                    heapAllocations;
+    const otSrpServerSignatureVerifierCounters *counters;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerAsyncSignatureVerify");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+    counters  = srpServer->GetSignatureVerifierCounters();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    PrepareService1(service1);
+    PrepareService2(service2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register a service with the platform declining the verification,
+    // validate that the server verifies the signature from its tasklet.
+
+    sOffloadVerifications = false;
+
+    SuccessOrQuit(srpClient->AddService(service1));
+
+    sUpdateHandlerMode       = kAccept;
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+    ValidateHost(*srpServer, kHostName);
+
+    VerifyOrQuit(counters->mVerified == 1);
+    VerifyOrQuit(counters->mFailed == 0);
+    VerifyOrQuit(counters->mOffloaded == 0);
+    VerifyOrQuit(counters->mQueueDepth == 0);
+    VerifyOrQuit(counters->mMaxQueueDepth == 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register a second service with the platform verifying the signature,
+    // validate that the update waits for the outcome.
+
+    sOffloadVerifications = true;
+
+    SuccessOrQuit(srpClient->AddService(service2));
+
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    WaitForOffloadedVerification();
+
+    AdvanceTime(500);
+
+    VerifyOrQuit(sOffloadedVerifications.GetLength() == 1);
+    VerifyOrQuit(!sProcessedUpdateCallback);
+    VerifyOrQuit(counters->mOffloaded == 1);
+    VerifyOrQuit(counters->mQueueDepth == 1);
+
+    CompleteOffloadedVerifications();
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+    VerifyOrQuit(service2.GetState() == Srp::Client::kRegistered);
+
+    VerifyOrQuit(counters->mVerified == 2);
+    VerifyOrQuit(counters->mQueueDepth == 0);
+    VerifyOrQuit(counters->mMaxLatency >= 500);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server while a verification is in progress on the
+    // platform, validate that its late outcome is ignored and that all
+    // heap allocations by SRP server are freed.
+
+    SuccessOrQuit(srpClient->RemoveService(service1));
+
+    sProcessedUpdateCallback = false;
+
+    WaitForOffloadedVerification();
+
+    VerifyOrQuit(sOffloadedVerifications.GetLength() == 1);
+    VerifyOrQuit(counters->mQueueDepth == 1);
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    sProcessedUpdateCallback = false;
+
+    CompleteOffloadedVerifications();
+    AdvanceTime(100);
+
+    VerifyOrQuit(!sProcessedUpdateCallback);
+    VerifyOrQuit(counters->mQueueDepth == 0);
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    sOffloadVerifications = false;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerAsyncSignatureVerify");
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
 #endif // ENABLE_SRP_TEST
 
 int main(void)
@@ -1038,6 +1249,9 @@ int main(void)
     TestSrpServerClientRemove(/* aShouldRemoveKeyLease */ false);
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     TestUpdateLeaseShortVariant();
+#endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    TestSrpServerAsyncSignatureVerify();
 #endif
     printf("All tests passed\n");
 #else
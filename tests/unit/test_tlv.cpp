@@ -28,6 +28,8 @@
 
 #include "test_platform.h"
 
+#include <chrono>
+
 #include <openthread/config.h>
 
 #include "common/instance.hpp"
@@ -184,11 +186,298 @@ void TestTlv(void)
     testFreeInstance(instance);
 }
 
+struct TestTlvSpec
+{
+    uint8_t  mType;
+    uint16_t mLength;
+};
+
+// Appends TLVs as specified by `aSpecs` (with value bytes derived from the TLV type).
+template <uint16_t kLength> static void AppendTestTlvs(Message &aMessage, const TestTlvSpec (&aSpecs)[kLength])
+{
+    for (const TestTlvSpec &spec : aSpecs)
+    {
+        if (spec.mLength < Tlv::kBaseTlvMaxLength)
+        {
+            Tlv tlv;
+
+            tlv.SetType(spec.mType);
+            tlv.SetLength(static_cast<uint8_t>(spec.mLength));
+            SuccessOrQuit(aMessage.Append(tlv));
+        }
+        else
+        {
+            ExtendedTlv extTlv;
+
+            extTlv.SetType(spec.mType);
+            extTlv.SetLength(spec.mLength);
+            SuccessOrQuit(aMessage.Append(extTlv));
+        }
+
+        for (uint16_t i = 0; i < spec.mLength; i++)
+        {
+            SuccessOrQuit(aMessage.Append<uint8_t>(spec.mType + static_cast<uint8_t>(i)));
+        }
+    }
+}
+
+typedef UintTlvInfo<1, uint32_t> TestUint32Tlv;
+typedef UintTlvInfo<2, uint8_t>  TestUint8Tlv;
+
+// Verifies that `aIndex` gives the same result as `Tlv` for all TLV types.
+static void VerifyTlvIndex(const Message &aMessage, const TlvIndex &aIndex)
+{
+    for (uint16_t type = 0; type <= NumericLimits<uint8_t>::kMax; type++)
+    {
+        uint8_t  tlvType          = static_cast<uint8_t>(type);
+        Error    error;
+        uint16_t valueOffset      = 0;
+        uint16_t length           = 0;
+        uint16_t indexValueOffset = 0;
+        uint16_t indexLength      = 0;
+        uint16_t endOffset        = 0;
+        uint16_t indexEndOffset   = 0;
+        uint32_t value            = 0;
+        uint32_t indexValue       = 0;
+        uint8_t  uint8Value       = 0;
+        uint8_t  indexUint8Value  = 0;
+        uint8_t  buffer[3]        = {0};
+        uint8_t  indexBuffer[3]   = {0};
+
+        error = Tlv::FindTlvValueOffset(aMessage, tlvType, valueOffset, length);
+        VerifyOrQuit(aIndex.FindTlvValueOffset(tlvType, indexValueOffset, indexLength) == error);
+        VerifyOrQuit(indexValueOffset == valueOffset);
+        VerifyOrQuit(indexLength == length);
+
+        error = Tlv::FindTlvValueStartEndOffsets(aMessage, tlvType, valueOffset, endOffset);
+        VerifyOrQuit(aIndex.FindTlvValueStartEndOffsets(tlvType, indexValueOffset, indexEndOffset) == error);
+        VerifyOrQuit(indexValueOffset == valueOffset);
+        VerifyOrQuit(indexEndOffset == endOffset);
+
+        switch (tlvType)
+        {
+        case 0:
+            error = Tlv::Find<TlvInfo<0>>(aMessage, buffer, sizeof(buffer));
+            VerifyOrQuit(aIndex.Find<TlvInfo<0>>(indexBuffer, sizeof(indexBuffer)) == error);
+            VerifyOrQuit(memcmp(buffer, indexBuffer, sizeof(buffer)) == 0);
+            break;
+        case 1:
+            error = Tlv::Find<TestUint32Tlv>(aMessage, value);
+            VerifyOrQuit(aIndex.Find<TestUint32Tlv>(indexValue) == error);
+            VerifyOrQuit(indexValue == value);
+            break;
+        case 2:
+            error = Tlv::Find<TestUint8Tlv>(aMessage, uint8Value);
+            VerifyOrQuit(aIndex.Find<TestUint8Tlv>(indexUint8Value) == error);
+            VerifyOrQuit(indexUint8Value == uint8Value);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void TestTlvIndex(void)
+{
+    const TestTlvSpec kSpecs[] = {
+        {0, 3}, {1, 4}, {2, 1}, {1, 2}, {3, 0}, {4, 300}, {5, 2}, {2, 5},
+    };
+
+    Instance *instance = testInitInstance();
+    Message  *message;
+    TlvIndex  index;
+    uint16_t  valueOffset;
+    uint16_t  length;
+
+    VerifyOrQuit(instance != nullptr);
+
+    printf("TestTlvIndex()");
+
+    VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+
+    // Empty message
+
+    index.Build(*message);
+    VerifyOrQuit(index.GetNumEntries() == 0);
+    VerifyOrQuit(!index.IsTruncated());
+    VerifyOrQuit(index.FindTlvValueOffset(1, valueOffset, length) == kErrorNotFound);
+
+    // Message with a header before the TLVs, and TLVs including
+    // duplicate types and an extended TLV.
+
+    SuccessOrQuit(message->Append<uint32_t>(0xffffffff));
+    message->SetOffset(sizeof(uint32_t));
+    AppendTestTlvs(*message, kSpecs);
+
+    index.Build(*message);
+    VerifyOrQuit(index.GetNumEntries() == GetArrayLength(kSpecs));
+    VerifyOrQuit(!index.IsTruncated());
+    VerifyTlvIndex(*message, index);
+
+    // TLV with a length beyond the end of the message, the TLVs after
+    // it must not be found.
+
+    {
+        Tlv tlv;
+
+        tlv.SetType(6);
+        tlv.SetLength(10);
+        SuccessOrQuit(message->Append(tlv));
+        SuccessOrQuit(message->Append<uint8_t>(0));
+    }
+
+    index.Build(*message);
+    VerifyOrQuit(index.GetNumEntries() == GetArrayLength(kSpecs));
+    VerifyOrQuit(index.FindTlvValueOffset(6, valueOffset, length) == kErrorNotFound);
+    VerifyTlvIndex(*message, index);
+
+    message->Free();
+
+    // More TLVs than the index can record
+
+    VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+
+    for (uint8_t type = 0; type < TlvIndex::kMaxEntries + 8; type++)
+    {
+        Tlv tlv;
+
+        tlv.SetType(type);
+        tlv.SetLength(sizeof(type));
+        SuccessOrQuit(message->Append(tlv));
+        SuccessOrQuit(message->Append(type));
+    }
+
+    index.Build(*message);
+    VerifyOrQuit(index.GetNumEntries() == TlvIndex::kMaxEntries);
+    VerifyOrQuit(index.IsTruncated());
+    SuccessOrQuit(index.FindTlvValueOffset(TlvIndex::kMaxEntries + 7, valueOffset, length));
+    VerifyTlvIndex(*message, index);
+
+    message->Free();
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+template <uint16_t kNumTlvs, uint16_t kNumLookups>
+static void BenchmarkTlvLookups(Instance          &aInstance,
+                                const char        *aName,
+                                const TestTlvSpec (&aSpecs)[kNumTlvs],
+                                const uint8_t (&aLookups)[kNumLookups])
+{
+    static constexpr uint16_t kNumRounds = 20000;
+
+    using Clock = std::chrono::steady_clock;
+
+    Message          *message;
+    uint32_t          findSum  = 0;
+    uint32_t          indexSum = 0;
+    Clock::duration   findDuration;
+    Clock::duration   indexDuration;
+    Clock::time_point start;
+
+    VerifyOrQuit((message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    AppendTestTlvs(*message, aSpecs);
+
+    start = Clock::now();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint8_t type : aLookups)
+        {
+            uint16_t valueOffset;
+            uint16_t length;
+            uint8_t  value;
+
+            SuccessOrQuit(Tlv::FindTlvValueOffset(*message, type, valueOffset, length));
+            SuccessOrQuit(message->Read(valueOffset, value));
+            findSum += value + length;
+        }
+    }
+
+    findDuration = Clock::now() - start;
+    start        = Clock::now();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        TlvIndex index;
+
+        index.Build(*message);
+
+        for (uint8_t type : aLookups)
+        {
+            uint16_t valueOffset;
+            uint16_t length;
+            uint8_t  value;
+
+            SuccessOrQuit(index.FindTlvValueOffset(type, valueOffset, length));
+            SuccessOrQuit(message->Read(valueOffset, value));
+            indexSum += value + length;
+        }
+    }
+
+    indexDuration = Clock::now() - start;
+
+    VerifyOrQuit(findSum == indexSum);
+
+    printf("\n  %s: %u TLVs (%u bytes), %u look-ups, %u rounds", aName, kNumTlvs, message->GetLength(), kNumLookups,
+           kNumRounds);
+    printf("\n    Tlv::Find: %lld usec",
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(findDuration).count()));
+    printf("\n    TlvIndex (including build): %lld usec",
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(indexDuration).count()));
+
+    message->Free();
+}
+
+void BenchmarkTlvIndex(void)
+{
+    // MLE Child ID Request: Response, Link/MLE Frame Counter, Mode,
+    // Timeout, Version, TLV Request, Address Registration, Active and
+    // Pending Timestamp, Supervision Interval. The look-ups follow
+    // `MleRouter::HandleChildIdRequest()`.
+
+    const TestTlvSpec kChildIdRequest[] = {
+        {4, 8}, {5, 4}, {8, 4}, {1, 1}, {2, 4}, {18, 2}, {13, 2}, {19, 36}, {22, 8}, {23, 8}, {27, 2},
+    };
+
+    const uint8_t kChildIdRequestLookups[] = {18, 4, 5, 8, 1, 2, 13, 27, 22, 23, 19};
+
+    // Network Diagnostic Get answer: Ext Address, RLOC16, Mode,
+    // Timeout, Connectivity, Route64, Leader Data, Network Data, IPv6
+    // Address List, MAC Counters, Child Table, Channel Pages, Max
+    // Child Timeout, Version, Vendor Name/Model/SW Version, Thread
+    // Stack Version, MLE Counters. The look-ups read every TLV.
+
+    const TestTlvSpec kDiagGetAnswer[] = {
+        {0, 8},   {1, 2},  {2, 1},  {3, 4},  {4, 10}, {5, 20}, {6, 8},   {7, 60},  {8, 48}, {9, 36},
+        {16, 30}, {17, 1}, {19, 4}, {24, 2}, {25, 16}, {26, 16}, {27, 16}, {28, 32}, {34, 66},
+    };
+
+    const uint8_t kDiagGetAnswerLookups[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 17, 19, 24, 25, 26, 27, 28, 34};
+
+    Instance *instance = testInitInstance();
+
+    VerifyOrQuit(instance != nullptr);
+
+    printf("BenchmarkTlvIndex()");
+
+    BenchmarkTlvLookups(*instance, "MLE Child ID Request", kChildIdRequest, kChildIdRequestLookups);
+    BenchmarkTlvLookups(*instance, "Network Diagnostic Get answer", kDiagGetAnswer, kDiagGetAnswerLookups);
+
+    printf("\n -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestTlv();
+    ot::TestTlvIndex();
+    ot::BenchmarkTlvIndex();
     printf("All tests passed\n");
     return 0;
 }
@@ -1227,6 +1227,12 @@ class OTCI(object):
                 info['lq_in'] = int(v)
             elif k == 'RSSI':
                 info['rssi'] = int(v)
+            elif k == 'Queued Messages':
+                info['queued_msgs'] = int(v)
+            elif k == 'Max Queued Messages':
+                info['max_queued_msgs'] = int(v)
+            elif k == 'Queued Message Age':
+                info['queued_msg_age'] = int(v)
             else:
                 self.log('warning', "Child info %s: %s ignored", k, v)
 